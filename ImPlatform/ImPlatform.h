@@ -182,6 +182,22 @@
     #else
         #define IMPLATFORM_GFX_SUPPORT_INTEGER_FORMATS 0
     #endif
+
+    // Block-compressed formats: BC1-7, ETC2, ASTC 4x4
+    // Uploaded as-is where the device samples them (ImPlatform_SupportsPixelFormat),
+    // decoded to RGBA8 on the CPU elsewhere, so every backend accepts them
+    #if (IM_CURRENT_GFX == IM_GFX_OPENGL3) || \
+        (IM_CURRENT_GFX == IM_GFX_DIRECTX9) || \
+        (IM_CURRENT_GFX == IM_GFX_DIRECTX10) || \
+        (IM_CURRENT_GFX == IM_GFX_DIRECTX11) || \
+        (IM_CURRENT_GFX == IM_GFX_DIRECTX12) || \
+        (IM_CURRENT_GFX == IM_GFX_VULKAN) || \
+        (IM_CURRENT_GFX == IM_GFX_METAL) || \
+        (IM_CURRENT_GFX == IM_GFX_WGPU)
+        #define IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS 1
+    #else
+        #define IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS 0
+    #endif
 #endif
 
 // Platform feature support flags
@@ -326,6 +342,22 @@ typedef enum ImPlatform_PixelFormat {
     ImPlatform_PixelFormat_R32UI,        // Single channel, 32-bit unsigned integer
     ImPlatform_PixelFormat_R32I,         // Single channel, 32-bit signed integer
 #endif
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed formats (4x4 texel blocks, pixel data is the blocks row by row).
+    // UpdateTexture regions must start on a block boundary and cover whole blocks
+    // except along the right/bottom texture edge. Native textures get a single mip level.
+    ImPlatform_PixelFormat_BC1,          // RGB + 1-bit alpha, 8 bytes/block (DXT1)
+    ImPlatform_PixelFormat_BC2,          // RGB + 4-bit explicit alpha, 16 bytes/block (DXT3)
+    ImPlatform_PixelFormat_BC3,          // RGB + interpolated alpha, 16 bytes/block (DXT5)
+    ImPlatform_PixelFormat_BC4,          // Single channel, 8 bytes/block
+    ImPlatform_PixelFormat_BC5,          // Two channel, 16 bytes/block
+    ImPlatform_PixelFormat_BC6H,         // RGB unsigned half float (HDR), 16 bytes/block; the CPU fallback clamps to [0, 1]
+    ImPlatform_PixelFormat_BC7,          // RGBA, high quality, 16 bytes/block
+    ImPlatform_PixelFormat_ETC2_RGB8,    // RGB, 8 bytes/block
+    ImPlatform_PixelFormat_ETC2_RGBA8,   // RGB + EAC alpha, 16 bytes/block
+    ImPlatform_PixelFormat_ASTC_4x4,     // LDR RGBA, 16 bytes/block
+#endif
 } ImPlatform_PixelFormat;
 
 // ----------------------------------------------------------------------------
@@ -417,10 +449,60 @@ static inline size_t ImPlatform_ImageBufferTightByteSize(const ImImageBuffer* bu
     return (size_t)buf->width * (size_t)buf->height * (size_t)buf->channels * ImPlatform_SampleTypeSize(buf->type);
 }
 
+// Returns the texture format storing an ImImageBuffer's (type, channels) as is
+// (F64 samples map to the F32 formats and are narrowed on upload), or false when
+// no ImPlatform_PixelFormat matches (64-bit integers, 3-channel formats disabled
+// by IMPLATFORM_GFX_SUPPORT_RGB_EXTENDED, ...).
+static inline bool ImPlatform_ImageBufferPixelFormat(const ImImageBuffer* buf, ImPlatform_PixelFormat* out_format) {
+    if (!buf || !out_format || buf->channels < 1 || buf->channels > 4) return false;
+    const int c = (int)buf->channels;
+    switch (buf->type) {
+    case ImSampleType_U8:
+        *out_format = c == 1 ? ImPlatform_PixelFormat_R8 : c == 2 ? ImPlatform_PixelFormat_RG8 : c == 3 ? ImPlatform_PixelFormat_RGB8 : ImPlatform_PixelFormat_RGBA8;
+        return true;
+    case ImSampleType_U16:
+#if !IMPLATFORM_GFX_SUPPORT_RGB_EXTENDED
+        if (c == 3) return false;
+#else
+        if (c == 3) { *out_format = ImPlatform_PixelFormat_RGB16; return true; }
+#endif
+        *out_format = c == 1 ? ImPlatform_PixelFormat_R16 : c == 2 ? ImPlatform_PixelFormat_RG16 : ImPlatform_PixelFormat_RGBA16;
+        return true;
+#if IMPLATFORM_GFX_SUPPORT_HALF_FLOAT_FORMATS
+    case ImSampleType_F16:
+#if !IMPLATFORM_GFX_SUPPORT_RGB_EXTENDED
+        if (c == 3) return false;
+#else
+        if (c == 3) { *out_format = ImPlatform_PixelFormat_RGB16F; return true; }
+#endif
+        *out_format = c == 1 ? ImPlatform_PixelFormat_R16F : c == 2 ? ImPlatform_PixelFormat_RG16F : ImPlatform_PixelFormat_RGBA16F;
+        return true;
+#endif
+    case ImSampleType_F32:
+    case ImSampleType_F64:
+#if !IMPLATFORM_GFX_SUPPORT_RGB_EXTENDED
+        if (c == 3) return false;
+#else
+        if (c == 3) { *out_format = ImPlatform_PixelFormat_RGB32F; return true; }
+#endif
+        *out_format = c == 1 ? ImPlatform_PixelFormat_R32F : c == 2 ? ImPlatform_PixelFormat_RG32F : ImPlatform_PixelFormat_RGBA32F;
+        return true;
+#if IMPLATFORM_GFX_SUPPORT_INTEGER_FORMATS
+    case ImSampleType_I8:  if (c == 1) { *out_format = ImPlatform_PixelFormat_R8I;   return true; } return false;
+    case ImSampleType_I16: if (c == 1) { *out_format = ImPlatform_PixelFormat_R16I;  return true; } return false;
+    case ImSampleType_U32: if (c == 1) { *out_format = ImPlatform_PixelFormat_R32UI; return true; } return false;
+    case ImSampleType_I32: if (c == 1) { *out_format = ImPlatform_PixelFormat_R32I;  return true; } return false;
+#endif
+    default:
+        return false;
+    }
+}
+
 // Texture filtering modes
 typedef enum ImPlatform_TextureFilter {
     ImPlatform_TextureFilter_Nearest,    // Point sampling (sharp, pixelated)
     ImPlatform_TextureFilter_Linear,     // Linear filtering (smooth, blurred)
+    ImPlatform_TextureFilter_LinearMipLinear, // Trilinear: linear within and between mip levels (min_filter only)
 } ImPlatform_TextureFilter;
 
 // Texture wrap/boundary modes
@@ -439,10 +521,20 @@ typedef struct ImPlatform_TextureDesc {
     ImPlatform_TextureFilter mag_filter;  // Magnification filter
     ImPlatform_TextureWrap wrap_u;        // Horizontal wrap mode
     ImPlatform_TextureWrap wrap_v;        // Vertical wrap mode
+    unsigned int mip_levels;              // 1: no mipmaps (default), 0: full chain, N: at most N levels
+                                          // Levels are generated on the GPU at creation and after every update
+                                          // (single level on DX12, full chain only on DX9). OpenGL and Vulkan
+                                          // sample with the texture's own filters; on DX9/10/11 and Metal wrap the
+                                          // draw in ImPlatform_PushSampler(ImPlatform_TextureFilter_LinearMipLinear, ...)
 } ImPlatform_TextureDesc;
 
+// True when the device samples `format` natively. Block-compressed formats it returns false for
+// are still accepted by ImPlatform_CreateTexture: they are decoded to RGBA8 on the CPU, which
+// costs the uncompressed memory.
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format);
+
 // Helper function to create a texture descriptor with common defaults
-// Default: RGBA8, Linear filtering, Clamp wrapping
+// Default: RGBA8, Linear filtering, Clamp wrapping, no mipmaps
 IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(
     unsigned int width,
     unsigned int height
@@ -450,6 +542,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(
 
 // Create a 2D texture from raw pixel data
 // pixel_data: Pointer to pixel data (size must match width * height * pixel_format_size)
+//             May be NULL on OpenGL3 and Vulkan to allocate storage with undefined content
 // desc: Texture descriptor defining texture properties
 // Returns: ImTextureID (opaque handle) or NULL on failure
 // Note: The pixel data can be freed after this call returns
@@ -503,6 +596,218 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(
     unsigned int height
 );
 
+// Streaming texture update: write pixels straight into the backend's staging memory
+// instead of handing over a client pointer (saves one copy for live video/camera feeds).
+// Returns a pointer to width*height tightly packed pixels in the texture's format, or
+// NULL if streaming is unavailable (fall back to ImPlatform_UpdateTexture).
+// Fill the memory, then call ImPlatform_EndTextureUpload. Only one upload may be open at a time.
+// Supported: OpenGL3 (pixel buffer object ring), Vulkan (staging ring)
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(
+    ImTextureID texture_id,
+    unsigned int x,
+    unsigned int y,
+    unsigned int width,
+    unsigned int height
+);
+
+// Submit the region opened with ImPlatform_BeginTextureUpload.
+// The copy to the texture overlaps with rendering, it does not stall the CPU.
+// Returns: true on success, false on failure
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID texture_id);
+
+// Create a 2D texture straight from an ImImageBuffer (strided, planar, ROI or flipped layout)
+// buffer: Source image; the texture is buffer->width x buffer->height
+// desc: Optional sampling state (NULL for defaults). The format is deduced from the buffer
+//       (see ImPlatform_ImageBufferPixelFormat); desc->format may only pick an equivalent
+//       layout (BGRA8, sRGB). desc->width/height are ignored.
+// Returns: ImTextureID or NULL on failure (including sample types without a matching format)
+// Row strides are handed to the GPU API directly (OpenGL3, Vulkan); other layouts are repacked.
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(
+    const ImImageBuffer* buffer,
+    const ImPlatform_TextureDesc* desc
+);
+
+// Re-upload a whole texture created by ImPlatform_CreateTextureFromImageBuffer
+// buffer: Same dimensions and format as at creation, any layout
+// Returns: true on success. Returns true without uploading when buffer->version
+//          equals the version last uploaded (OpenGL3, Vulkan).
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(
+    ImTextureID texture_id,
+    const ImImageBuffer* buffer
+);
+
+// Asynchronous texture creation for very large images (tiled preparation pipeline)
+// The image is split into bands of rows; worker threads convert and copy the bands into
+// staging memory while the render thread submits finished bands to the GPU in order.
+typedef struct ImPlatform_TextureJob_T* ImPlatform_TextureJob;
+
+// Start creating a texture from an ImImageBuffer (same format rules as ImPlatform_CreateTextureFromImageBuffer)
+// buffer: Source image; its memory must stay valid until the job is complete or destroyed
+// desc: Optional sampling state (NULL for defaults)
+// Returns: Job handle or NULL on failure. Call from the render thread.
+IMPLATFORM_API ImPlatform_TextureJob ImPlatform_CreateTextureAsync(
+    const ImImageBuffer* buffer,
+    const ImPlatform_TextureDesc* desc
+);
+
+// Submit the bands prepared since the last call (call once per frame on the render thread)
+// Returns: Progress in [0, 1], 1 once every band has been submitted, or a negative value on failure
+IMPLATFORM_API float ImPlatform_UpdateTextureJob(ImPlatform_TextureJob job);
+
+// Texture being filled by the job; it is valid (with partially uploaded content) right after
+// ImPlatform_CreateTextureAsync and stays alive after the job is destroyed.
+IMPLATFORM_API ImTextureID ImPlatform_GetTextureJobTexture(ImPlatform_TextureJob job);
+
+// Stop the workers and free the job. The texture is not released, use ImPlatform_DestroyTexture.
+IMPLATFORM_API void ImPlatform_DestroyTextureJob(ImPlatform_TextureJob job);
+
+// Virtual texture: images larger than the GPU texture limit (gigapixel viewing)
+// The image is cut into a mip pyramid of fixed-size tiles. Only the tiles visible at the current
+// zoom are streamed into a fixed-size GPU tile cache (LRU eviction), so GPU memory is bounded
+// by the cache size instead of the image size.
+typedef struct ImPlatform_VirtualTexture_T* ImPlatform_VirtualTexture;
+
+typedef struct ImPlatform_VirtualTextureDesc {
+    unsigned int tile_size;               // Tile edge in pixels (default: 256)
+    unsigned int cache_tiles;             // Tiles resident on the GPU (default: 256)
+    unsigned int uploads_per_frame;       // Tiles streamed per frame at most (default: 8)
+    ImPlatform_TextureFilter mag_filter;  // Magnification filter (default: Linear)
+} ImPlatform_VirtualTextureDesc;
+
+IMPLATFORM_API ImPlatform_VirtualTextureDesc ImPlatform_VirtualTextureDesc_Default(void);
+
+// Create a virtual texture over an ImImageBuffer
+// buffer: Source image; its memory must stay valid while the virtual texture exists
+// desc: Optional tiling parameters (NULL for defaults)
+// Returns: Handle or NULL on failure
+IMPLATFORM_API ImPlatform_VirtualTexture ImPlatform_CreateVirtualTexture(
+    const ImImageBuffer* buffer,
+    const ImPlatform_VirtualTextureDesc* desc
+);
+
+IMPLATFORM_API void ImPlatform_DestroyVirtualTexture(ImPlatform_VirtualTexture vt);
+
+// Draw the image region uv0..uv1 into the screen rectangle p_min..p_max (same convention as ImDrawList::AddImage)
+// Missing tiles are streamed (up to uploads_per_frame), coarser resident tiles stand in meanwhile.
+IMPLATFORM_API void ImPlatform_DrawVirtualTexture(
+    ImDrawList* draw,
+    ImPlatform_VirtualTexture vt,
+    ImVec2 p_min,
+    ImVec2 p_max,
+    ImVec2 uv0,
+    ImVec2 uv1
+);
+
+// ImGui::Image equivalent: draws into the current window and advances the layout
+IMPLATFORM_API void ImPlatform_VirtualTextureImage(
+    ImPlatform_VirtualTexture vt,
+    ImVec2 size,
+    ImVec2 uv0,
+    ImVec2 uv1
+);
+
+// Memory-mapped image files
+// The file is mapped read-only and described by an ImImageBuffer pointing into the mapping:
+// opening is instant whatever the file size, pages are read from disk when first touched and
+// uploads read straight from the mapping.
+typedef struct ImPlatform_MappedImage_T* ImPlatform_MappedImage;
+
+// Map an image file, detecting its layout:
+//   - Binary PGM / PPM (P5 / P6, maxval <= 255)
+//   - PFM (Pf / PF, little-endian; bottom-up rows become a negative y stride)
+//   - Raw file with a JSON sidecar ("<path>.json", or the path with a .json extension):
+//     { "width": 4096, "height": 4096, "channels": 3, "type": "u16",
+//       "layout": "interleaved" | "planar", "offset": 0, "row_stride": 0, "flip_y": false }
+//     type: u8 i8 u16 i16 u32 i32 f16 f32 f64. offset and row_stride (bytes, 0: tight) are optional.
+// out_buffer: Receives the image description, valid until ImPlatform_UnmapImageFile
+// Returns: Handle or NULL on failure
+IMPLATFORM_API ImPlatform_MappedImage ImPlatform_MapImageFile(
+    const char* path,
+    ImImageBuffer* out_buffer
+);
+
+// Map a raw file with a caller-provided layout
+// layout: Everything but `host`; byte_offset is relative to the start of the file
+IMPLATFORM_API ImPlatform_MappedImage ImPlatform_MapRawImageFile(
+    const char* path,
+    const ImImageBuffer* layout,
+    ImImageBuffer* out_buffer
+);
+
+// Drop the pages read so far from the process working set (they stay in the OS file cache).
+// Call after uploading a region to keep the resident size near the visible region.
+IMPLATFORM_API void ImPlatform_TrimMappedImage(ImPlatform_MappedImage image);
+
+IMPLATFORM_API void ImPlatform_UnmapImageFile(ImPlatform_MappedImage image);
+
+// Texture atlas: many small images packed into a few large page textures
+// Images drawn from the same page share one texture, so ImGui merges their draw commands
+// (a grid of thumbnails costs one bind per page instead of one per image).
+// Rectangles are packed on shelves (rows of similar height) and can be removed at any time;
+// the space they leave is reused by later inserts.
+typedef struct ImPlatform_Atlas_T* ImPlatform_Atlas;
+typedef unsigned int ImPlatform_AtlasHandle;    // 0 is never a valid handle
+
+typedef struct ImPlatform_AtlasDesc {
+    unsigned int page_size;               // Page edge in texels (default: 2048)
+    unsigned int max_pages;               // Pages created on demand, at most (default: 4)
+    unsigned int padding;                 // Texels around each image, filled with its edge texels (default: 1)
+    ImPlatform_PixelFormat format;        // Uncompressed format of every page (default: RGBA8)
+    ImPlatform_TextureFilter min_filter;  // Minification filter (default: Linear, no mipmaps)
+    ImPlatform_TextureFilter mag_filter;  // Magnification filter (default: Linear)
+} ImPlatform_AtlasDesc;
+
+// Where an atlas image lives; pass texture_id, uv0 and uv1 to ImGui::Image / ImDrawList::AddImage
+typedef struct ImPlatform_AtlasRegion {
+    ImTextureID  texture_id;    // Page texture
+    ImVec2       uv0;           // Top-left of the image in the page
+    ImVec2       uv1;           // Bottom-right of the image in the page
+    unsigned int page;          // Page index
+    unsigned int x, y;          // Top-left texel of the image in the page
+    unsigned int width, height; // Image size in texels
+} ImPlatform_AtlasRegion;
+
+IMPLATFORM_API ImPlatform_AtlasDesc ImPlatform_AtlasDesc_Default(void);
+
+// desc: Optional parameters (NULL for defaults)
+// Returns: Handle or NULL on failure. Pages are only created by the first insert that needs them.
+IMPLATFORM_API ImPlatform_Atlas ImPlatform_CreateAtlas(const ImPlatform_AtlasDesc* desc);
+
+// Destroys every page texture; regions and handles of the atlas become invalid
+IMPLATFORM_API void ImPlatform_DestroyAtlas(ImPlatform_Atlas atlas);
+
+// Pack and upload an image
+// pixel_data: width*height tightly packed pixels in the atlas format
+// Returns: Handle, or 0 if the image does not fit (larger than a page, or every page full)
+IMPLATFORM_API ImPlatform_AtlasHandle ImPlatform_AtlasInsert(
+    ImPlatform_Atlas atlas,
+    const void* pixel_data,
+    unsigned int width,
+    unsigned int height
+);
+
+// Re-upload the pixels of an image (same size as at insertion)
+// Returns: true on success, false for a stale handle or a failed upload
+IMPLATFORM_API bool ImPlatform_AtlasUpdate(
+    ImPlatform_Atlas atlas,
+    ImPlatform_AtlasHandle handle,
+    const void* pixel_data
+);
+
+// Free the space of an image. The handle becomes stale (later lookups fail) at once, but the space
+// is only reused by inserts of the next frames, so draws already recorded this frame are unaffected.
+IMPLATFORM_API void ImPlatform_AtlasRemove(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle);
+
+// Returns: true and fills out_region when the handle is live
+IMPLATFORM_API bool ImPlatform_AtlasGetRegion(
+    ImPlatform_Atlas atlas,
+    ImPlatform_AtlasHandle handle,
+    ImPlatform_AtlasRegion* out_region
+);
+
+// ImGui::Image equivalent for an atlas image; draws nothing but still advances the layout for a stale handle
+IMPLATFORM_API void ImPlatform_AtlasImage(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle, ImVec2 size);
+
 // Copy the contents of one texture into another (GPU-to-GPU copy)
 // dst: Destination texture (must have been created with ImPlatform_CreateTexture)
 // src: Source texture (must have been created with ImPlatform_CreateTexture)
@@ -516,12 +821,85 @@ IMPLATFORM_API bool ImPlatform_CopyTexture(
 // Copy the current backbuffer contents into a user-created texture.
 // dst must have been created with ImPlatform_CreateTexture matching the backbuffer dimensions.
 // Useful for post-processing effects (blur, distortion) on the rendered scene.
+// OpenGL and DX11 copy immediately. Vulkan, DX12 and WebGPU record the copy at the end of
+// the frame being built, so dst holds that frame's final image from the next frame on.
+// OpenGL and Vulkan scale to fit dst; DX12 needs a render texture and WebGPU a texture
+// of the backbuffer format and size.
 // Returns: true on success, false on failure or unsupported backend
 IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst);
 
 // Query the current backbuffer dimensions in pixels.
 IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height);
 
+// Asynchronous readback of texture contents to the CPU. The copy is queued with the
+// current frame and lands a few frames later; nothing waits on the GPU.
+// Implemented on OpenGL (pixel buffer + fence) and Vulkan (host-visible buffer + frame fence).
+typedef struct ImPlatform_Readback_t* ImPlatform_Readback;
+
+// pixels: Texels of the region in the texture format, rows row_pitch bytes apart.
+//         NULL if the readback failed (texture destroyed before the copy was made).
+// Only valid during the call, the readback is released once the callback returns.
+typedef void (*ImPlatform_ReadbackCallback)(const void* pixels, unsigned int width, unsigned int height,
+                                            unsigned int row_pitch, void* user_data);
+
+// Queue a readback of a texture or render texture region (level 0)
+// x, y, width, height: Region in texels, width/height 0 for the rest of the texture
+// callback: Optional, called from ImPlatform_GfxAPINewFrame once the pixels are on the CPU.
+//           Without one, poll with ImPlatform_IsReadbackReady and call ImPlatform_ReleaseReadback.
+// Returns: Handle, or NULL on failure or unsupported backend (block-compressed textures are not readable).
+//          With a callback the handle is only valid until the callback ran.
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(
+    ImTextureID texture,
+    unsigned int x,
+    unsigned int y,
+    unsigned int width,
+    unsigned int height,
+    ImPlatform_ReadbackCallback callback,
+    void* user_data
+);
+
+// Returns: true once the readback completed or failed. Never blocks.
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback readback);
+
+// Returns: Pixels of a completed readback, NULL while pending or on failure.
+//          Valid until the readback is released.
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback readback, unsigned int* out_row_pitch);
+
+// Free a readback, pending or not. OpenGL and Vulkan keep a few freed buffers for later
+// requests of the same size, so reading back every frame does not allocate.
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback readback);
+
+// Video capture of the main window. Every Nth frame is copied (ImPlatform_CopyBackbuffer) and read
+// back asynchronously; a worker thread converts it to I420 (BT.601 limited range) and writes it out.
+// A frame that finds the readbacks or the output still busy is dropped, rendering never waits.
+// Needs asynchronous readback (OpenGL, Vulkan) and threads.
+typedef enum ImPlatform_CaptureFormat {
+    ImPlatform_CaptureFormat_Y4M,        // YUV4MPEG2 stream (header + framed I420), read by ffmpeg, mpv...
+    ImPlatform_CaptureFormat_I420,       // Raw I420 frames back to back: Y plane, then U, then V
+} ImPlatform_CaptureFormat;
+
+typedef struct ImPlatform_CaptureDesc {
+    const char* path;                     // Output file, or "|command" to pipe into a process ("|ffmpeg -i - out.mp4")
+    ImPlatform_CaptureFormat format;
+    unsigned int frame_interval;          // Capture every Nth frame, 0 or 1: every frame
+    unsigned int fps_num;                 // Frame rate written in the Y4M header, 0: 60 / frame_interval
+    unsigned int fps_den;                 // 0: 1
+} ImPlatform_CaptureDesc;
+
+// Start capturing. The video keeps the backbuffer size of this call (rounded down to even),
+// later resizes are scaled to it. With a pipe, a reader exiting early raises SIGPIPE on POSIX.
+// Returns: false if a capture is running, the output can't be opened or the backend has no readback
+IMPLATFORM_API bool ImPlatform_BeginCapture(const ImPlatform_CaptureDesc* desc);
+
+// Stop capturing: frames already on the CPU are written, those still on the GPU are dropped
+// ImPlatform_ShutdownWindow calls it for a capture still running
+IMPLATFORM_API void ImPlatform_EndCapture(void);
+
+IMPLATFORM_API bool ImPlatform_IsCapturing(void);
+
+// Frames written and frames dropped since the last ImPlatform_BeginCapture
+IMPLATFORM_API void ImPlatform_GetCaptureStats(unsigned int* frames_written, unsigned int* frames_dropped);
+
 // Create a texture that can also be used as a render target (for offscreen passes).
 // Unlike ImPlatform_CreateTexture, no pixel data is needed — the texture starts cleared.
 // Returns: ImTextureID that can be used with ImPlatform_BeginRenderToTexture and as a shader input.
@@ -595,6 +973,7 @@ typedef struct ImPlatform_VertexBufferDesc {
     ImPlatform_BufferUsage usage;         // Usage hint
     const ImPlatform_VertexAttribute* attributes; // Array of vertex attributes
     unsigned int attribute_count;         // Number of attributes in array
+    unsigned int instance_step_rate;      // 0 = per-vertex data, N = per-instance data advancing every N instances
 } ImPlatform_VertexBufferDesc;
 
 // Index buffer descriptor - describes index buffer properties
@@ -684,6 +1063,118 @@ IMPLATFORM_API void ImPlatform_DrawIndexed(
     unsigned int start_index
 );
 
+// Bind a per-instance vertex buffer for ImPlatform_DrawIndexedInstanced
+// instance_buffer: Vertex buffer created with instance_step_rate > 0 (or NULL to unbind)
+// Note: Instance attributes follow the vertex buffer's: attribute i of the instance
+//       buffer feeds shader input location (vertex buffer attribute_count + i)
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(
+    ImPlatform_VertexBuffer instance_buffer
+);
+
+// Draw several instances using currently bound buffers
+// primitive_type: Type of primitive (0=triangles, 1=lines, 2=points)
+// index_count: Number of indices to draw (0 = draw all indices in buffer)
+// start_index: Starting index in index buffer
+// instance_count: Number of instances to draw
+// start_instance: First element read from the instance buffer
+// Note: Implemented on OpenGL3 and Vulkan. Vulkan only supports an instance_step_rate of 1.
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(
+    unsigned int primitive_type,
+    unsigned int index_count,
+    unsigned int start_index,
+    unsigned int instance_count,
+    unsigned int start_instance
+);
+
+// Indirect draw arguments - one record per draw, laid out like the GL
+// DrawElementsIndirectCommand and VkDrawIndexedIndirectCommand (20 bytes)
+typedef struct ImPlatform_DrawIndexedIndirectArgs {
+    unsigned int index_count;             // Number of indices to draw
+    unsigned int instance_count;          // Number of instances (1 for a plain draw, 0 skips the draw)
+    unsigned int start_index;             // Starting index in index buffer
+    int base_vertex;                      // Added to every index before fetching the vertex
+    unsigned int start_instance;          // First element read from the instance buffer
+} ImPlatform_DrawIndexedIndirectArgs;
+
+// Opaque handle for indirect argument buffers
+typedef void* ImPlatform_IndirectBuffer;
+
+// Create a buffer of indirect draw arguments
+// args: Array of draw_count records
+// draw_count: Number of records
+// usage: Usage hint
+// Returns: Indirect buffer handle or NULL on failure
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(
+    const ImPlatform_DrawIndexedIndirectArgs* args,
+    unsigned int draw_count,
+    ImPlatform_BufferUsage usage
+);
+
+// Update indirect draw arguments
+// buffer: Indirect buffer to update
+// args: New records
+// offset: Offset in records (NOT bytes)
+// count: Number of records to update
+// Returns: true on success, false on failure
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(
+    ImPlatform_IndirectBuffer buffer,
+    const ImPlatform_DrawIndexedIndirectArgs* args,
+    unsigned int offset,
+    unsigned int count
+);
+
+// Destroy an indirect buffer and free its resources
+// buffer: Indirect buffer to destroy
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(
+    ImPlatform_IndirectBuffer buffer
+);
+
+// Submit a batch of indexed draws from an indirect buffer, using currently bound
+// buffers (including the instance buffer, if any)
+// primitive_type: Type of primitive (0=triangles, 1=lines, 2=points)
+// indirect_buffer: Draw arguments
+// first_draw: First record to draw
+// draw_count: Number of records to draw
+// Note: One API call on OpenGL 4.3 (glMultiDrawElementsIndirect) and on Vulkan devices
+//       with the multiDrawIndirect feature; a loop over the records elsewhere.
+//       Vulkan devices without drawIndirectFirstInstance need start_instance = 0.
+//       Implemented on OpenGL3 and Vulkan.
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(
+    unsigned int primitive_type,
+    ImPlatform_IndirectBuffer indirect_buffer,
+    unsigned int first_draw,
+    unsigned int draw_count
+);
+
+// Transient geometry - per frame allocations for geometry regenerated every frame.
+// The memory comes from a persistently mapped buffer split in one region per frame
+// in flight and recycled with fences, so it is written in place without copies or
+// stalls. Handles returned here are owned by the frame: bind them with
+// ImPlatform_BindBuffers, never destroy them, and don't use them (or the returned
+// pointers) after ImPlatform_GfxAPISwapBuffer. Fill the memory before the draw
+// that uses it. Currently implemented on OpenGL3 only; other backends return NULL.
+
+// Allocate vertices for this frame
+// desc: Vertex layout; vertex_count vertices of vertex_stride bytes are allocated, usage is ignored
+// out_buffer: Receives the vertex buffer handle to bind
+// Returns: Write pointer, or NULL when unsupported or the frame's region is exhausted
+//          (the region grows for the next frame)
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(
+    const ImPlatform_VertexBufferDesc* desc,
+    ImPlatform_VertexBuffer* out_buffer
+);
+
+// Allocate indices for this frame
+// index_count: Number of indices
+// format: Index format (16-bit or 32-bit)
+// out_buffer: Receives the index buffer handle to bind
+// Returns: Write pointer, or NULL on failure (see ImPlatform_AllocTransientVertices)
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(
+    unsigned int index_count,
+    ImPlatform_IndexFormat format,
+    ImPlatform_IndexBuffer* out_buffer
+);
+
 // ============================================================================
 // Custom Shader System API
 // ============================================================================
@@ -711,6 +1202,7 @@ typedef enum ImPlatform_ShaderFormat {
 #define IMPLATFORM_SHADER_COMPILE_OPTIMIZATION_LOW    (1u << 1)   // Minimum optimization
 #define IMPLATFORM_SHADER_COMPILE_OPTIMIZATION_HIGH   (1u << 2)   // Maximum optimization (slowest compile)
 #define IMPLATFORM_SHADER_COMPILE_DEBUG               (1u << 3)   // Include debug info in bytecode
+#define IMPLATFORM_SHADER_COMPILE_ASYNC               (1u << 4)   // OpenGL3: don't wait for the compile, errors are reported at link time
 
 // Shader descriptor - describes shader source
 typedef struct ImPlatform_ShaderDesc {
@@ -722,11 +1214,11 @@ typedef struct ImPlatform_ShaderDesc {
     const char* entry_point;              // Entry point function name (e.g., "main", "VSMain")
 
     // Bytecode disk cache (optional). When non-NULL, the backend hashes the
-    // source+entry+profile and looks for a cached bytecode file at
-    //   ./shaders/bytecode_cache/<cache_key>_<entry>_<hash>.<ext>
+    // source+entry+profile and looks for cached bytecode in the backend's pack
+    //   ./shaders/bytecode_cache/<backend>.impack
     // On cache hit the backend skips its compile step entirely; on miss it
     // compiles from source and saves the resulting bytecode for next launch.
-    // Any change to the source invalidates the cache automatically.
+    // Any change to the source, device or driver invalidates the cache automatically.
     // Ignored when `bytecode` is supplied directly.
     const char* cache_key;
 
@@ -749,7 +1241,16 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(
     const ImPlatform_ShaderDesc* desc
 );
 
+// Set the size cap of the shader bytecode cache (compressed bytes, 0: unbounded, default: 64 MB)
+// Least recently used entries are dropped when the cache is written back at shutdown.
+IMPLATFORM_API void ImPlatform_SetShaderCacheMaxSize(
+    size_t max_bytes
+);
+
 // Destroy a shader and free its resources
+// Programs already created from the shader stay valid: on Vulkan they keep its module alive
+// until they are destroyed, so shaders can be destroyed right after creating the program
+// (including with ImPlatform_CreateShaderProgramAsync)
 // shader: Shader to destroy
 IMPLATFORM_API void ImPlatform_DestroyShader(
     ImPlatform_Shader shader
@@ -764,6 +1265,60 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(
     ImPlatform_Shader fragment_shader
 );
 
+// Create a shader program without waiting for the driver to compile and link it
+// The handle is usable right away: until ImPlatform_IsShaderProgramReady returns true,
+// custom shader draws use the fallback program (ImPlatform_SetShaderProgramFallback) or
+// ImGui's default shader. Link errors are logged once the driver is done.
+// OpenGL3: links in the background with GL_KHR_parallel_shader_compile; create the shaders
+//          with IMPLATFORM_SHADER_COMPILE_ASYNC so their compiles don't wait either
+// Vulkan:  the pipeline is created by worker threads through the shared pipeline cache
+// Other backends create the program synchronously.
+// Returns: Shader program handle or NULL on immediate failure
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(
+    ImPlatform_Shader vertex_shader,
+    ImPlatform_Shader fragment_shader
+);
+
+// Returns true once the program can be drawn with; false while it compiles or if it failed.
+// Never blocks, except on OpenGL without GL_KHR_parallel_shader_compile where it waits for the link.
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(
+    ImPlatform_ShaderProgram program
+);
+
+// Set the program drawn in place of programs that are not ready yet (NULL: ImGui's default shader)
+// The fallback should be created with ImPlatform_CreateShaderProgram.
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(
+    ImPlatform_ShaderProgram program
+);
+
+// Opaque handle of a shader program watched for hot reload
+typedef struct ImPlatform_ShaderWatch_T* ImPlatform_ShaderWatch;
+
+// Rebuild a program whenever the source files of its stages change (opt-in, for development)
+// A watcher thread waits for the files to change (inotify on Linux, modification time polling
+// elsewhere) and reads them. In ImPlatform_GfxAPINewFrame only the changed stages are recompiled,
+// the program is created with ImPlatform_CreateShaderProgramAsync and, once ready, replaces
+// *program at a later frame boundary; the previous program is destroyed a few frames after.
+// A stage that fails to compile keeps the last working program on screen.
+// program: variable holding a program created from vs_desc / fs_desc
+// vs_desc / fs_desc: descriptors of the stages (copied); the file content replaces
+//                    source_code, or bytecode for ImPlatform_ShaderFormat_SPIRV
+// vs_path / fs_path: file of each stage, NULL for a stage that is not watched
+// Returns: watch handle, or NULL when file watching is unavailable (no threads)
+IMPLATFORM_API ImPlatform_ShaderWatch ImPlatform_WatchShaderProgram(
+    ImPlatform_ShaderProgram* program,
+    const ImPlatform_ShaderDesc* vs_desc,
+    const char* vs_path,
+    const ImPlatform_ShaderDesc* fs_desc,
+    const char* fs_path
+);
+
+// Stop watching. Destroy the program held in the watched variable first:
+// the shaders created by reloads are released here.
+IMPLATFORM_API void ImPlatform_UnwatchShaderProgram(
+    ImPlatform_ShaderWatch watch
+);
+
 // Destroy a shader program and free its resources
 // program: Shader program to destroy
 IMPLATFORM_API void ImPlatform_DestroyShaderProgram(
@@ -807,6 +1362,13 @@ IMPLATFORM_API bool ImPlatform_SetShaderUniform(
 //   ImPlatform_SetUniform("ColorStart", &color1, sizeof(ImVec4));
 //   ImPlatform_SetUniform("ColorEnd", &color2, sizeof(ImVec4));
 //   ImPlatform_EndUniformBlock(program);
+// OpenGL: uniforms declared inside GLSL uniform blocks (GL 3.1 / ES 3.0) have no
+// count or size limit. They are written at the offsets reflected from the program
+// (std140 unless the block says otherwise, so array elements and matrix columns
+// are 16 byte aligned) and each block is bound as a single uniform buffer range.
+// Vulkan / WebGPU: names are resolved against the push constant block (SPIR-V) or the
+// var<uniform> struct (WGSL) reflected when the program is created, so uniforms may be
+// set in any order. Shaders without reflectable names fall back to call order packing.
 // program: Shader program to set uniforms on
 IMPLATFORM_API void ImPlatform_BeginUniformBlock(
     ImPlatform_ShaderProgram program
@@ -855,9 +1417,16 @@ IMPLATFORM_API void ImPlatform_BeginCustomShader(
 IMPLATFORM_API void ImPlatform_BeginCustomShader_Render(ImPlatform_ShaderProgram program);
 
 // Upload per-draw-call shader constants and bind them for the next draw.
+// Called between ImPlatform_BeginCustomShader/EndCustomShader the constants are captured
+// into a per-frame arena and bound by a draw callback; inside a draw callback they are bound
+// immediately. Many widgets can share one program this way, each with its own constants.
+// OpenGL3: replaces the start of the program's first uniform block not declaring ProjMtx,
+//          uploaded to its own range of the per-frame ring
+// Vulkan:  fragment push constants at offset 64 (size multiple of 4, 64 bytes max)
 // data: Pointer to constant data
 // size: Size of constant data in bytes
-// Returns an opaque handle that must be freed with ImPlatform_PopShaderConstants.
+// Returns an opaque handle that must be freed with ImPlatform_PopShaderConstants, NULL on failure.
+// Pop restores the program's uniform block data for the following draws.
 IMPLATFORM_API void* ImPlatform_PushShaderConstants(const void* data, unsigned int size);
 IMPLATFORM_API void  ImPlatform_PopShaderConstants(void* handle);
 
@@ -1107,6 +1676,33 @@ IMPLATFORM_API int ImPlatform_GetVersionNum(void)
 ImPlatform_BorderlessParams g_BorderlessParams = { 5, 100, 100, true, true };
 #endif
 
+// Shared pixel conversion kernels
+#include "ImPlatform_convert.cpp"
+
+// Shared tiled texture preparation (worker threads)
+#include "ImPlatform_texture_job.cpp"
+
+// Shared tiled virtual texture
+#include "ImPlatform_virtual_texture.cpp"
+
+// Shared memory-mapped image files
+#include "ImPlatform_image_file.cpp"
+
+// Shared block-compressed texture decoders
+#include "ImPlatform_compressed.cpp"
+
+// Shared texture atlas (shelf packer)
+#include "ImPlatform_atlas.cpp"
+
+// Shared shader bytecode cache (indexed pack)
+#include "ImPlatform_shader_cache.cpp"
+
+// Shared shader hot reload (file watcher thread)
+#include "ImPlatform_shader_reload.cpp"
+
+// Shared video capture (readback ring, conversion thread)
+#include "ImPlatform_capture.cpp"
+
 // Include graphics backend implementation
 #if IM_CURRENT_GFX == IM_GFX_OPENGL3
     #include "ImPlatform_gfx_opengl3.cpp"
@@ -434,24 +434,408 @@ struct ImPlatform_GfxData_WebGPU* ImPlatform_Gfx_GetData_WebGPU(void);
 }
 #endif
 
+// ============================================================================
+// Pixel conversion kernels (ImPlatform_convert.cpp)
+// ============================================================================
+// Vectorized (SSE2 / AVX2+F16C / NEON, picked at runtime) conversions for
+// formats the GPU APIs can't consume as is. Buffers are tightly packed and
+// must not overlap, except for ImPlatform_Convert_SwizzleRB8 which may run in place.
+
+const char* ImPlatform_Convert_GetISA(void);                                                // "AVX2", "SSE2", "NEON" or "Scalar"
+void ImPlatform_Convert_RGB8ToRGBA8(void* dst, const void* src, size_t pixel_count);        // Alpha = 0xFF
+void ImPlatform_Convert_SwizzleRB8(void* dst, const void* src, size_t pixel_count);         // RGBA8 <-> BGRA8
+void ImPlatform_Convert_F64ToF32(float* dst, const double* src, size_t count);
+void ImPlatform_Convert_F32ToF16(ImU16* dst, const float* src, size_t count);               // Round to nearest even
+void ImPlatform_Convert_U16ToF32(float* dst, const ImU16* src, size_t count);               // Normalized to [0, 1]
+void ImPlatform_Convert_Planar8ToRGBA8(void* dst, const void* r, const void* g, const void* b,
+                                       const void* a, size_t pixel_count);                  // a == NULL: alpha = 0xFF
+void ImPlatform_Convert_RGBA8ToI420(void* y0, void* y1, void* u, void* v, const void* row0, const void* row1,
+                                    size_t pixel_count);                                    // Two rows, even pixel_count, BT.601 limited range
+
+// ============================================================================
+// Pixel formats
+// ============================================================================
+
+// Bytes of one pixel as passed to ImPlatform_CreateTexture / ImPlatform_UpdateTexture, 0 for block-compressed formats
+static inline unsigned int ImPlatform_PixelFormatBytes(ImPlatform_PixelFormat format)
+{
+    switch (format)
+    {
+    case ImPlatform_PixelFormat_R8:      return 1;
+    case ImPlatform_PixelFormat_RG8:     return 2;
+    case ImPlatform_PixelFormat_RGB8:    return 3;
+    case ImPlatform_PixelFormat_RGBA8:   return 4;
+    case ImPlatform_PixelFormat_R16:     return 2;
+    case ImPlatform_PixelFormat_RG16:    return 4;
+    case ImPlatform_PixelFormat_RGBA16:  return 8;
+    case ImPlatform_PixelFormat_R32F:    return 4;
+    case ImPlatform_PixelFormat_RG32F:   return 8;
+    case ImPlatform_PixelFormat_RGBA32F: return 16;
+#if IMPLATFORM_GFX_SUPPORT_BGRA_FORMATS
+    case ImPlatform_PixelFormat_BGRA8:   return 4;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_HALF_FLOAT_FORMATS
+    case ImPlatform_PixelFormat_R16F:    return 2;
+    case ImPlatform_PixelFormat_RG16F:   return 4;
+    case ImPlatform_PixelFormat_RGBA16F: return 8;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_RGB_EXTENDED
+    case ImPlatform_PixelFormat_RGB16:   return 6;
+    case ImPlatform_PixelFormat_RGB16F:  return 6;
+    case ImPlatform_PixelFormat_RGB32F:  return 12;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_SRGB_FORMATS
+    case ImPlatform_PixelFormat_RGB8_SRGB:  return 3;
+    case ImPlatform_PixelFormat_RGBA8_SRGB: return 4;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_PACKED_FORMATS
+    case ImPlatform_PixelFormat_RGB10A2: return 4;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_DEPTH_FORMATS
+    case ImPlatform_PixelFormat_D16:     return 2;
+    case ImPlatform_PixelFormat_D32F:    return 4;
+    case ImPlatform_PixelFormat_D24S8:   return 4;
+    case ImPlatform_PixelFormat_D32FS8:  return 8;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_INTEGER_FORMATS
+    case ImPlatform_PixelFormat_R8UI:    return 1;
+    case ImPlatform_PixelFormat_R8I:     return 1;
+    case ImPlatform_PixelFormat_R16UI:   return 2;
+    case ImPlatform_PixelFormat_R16I:    return 2;
+    case ImPlatform_PixelFormat_R32UI:   return 4;
+    case ImPlatform_PixelFormat_R32I:    return 4;
+#endif
+    default:                             return 0;
+    }
+}
+
+// ============================================================================
+// Mipmaps (shared across graphics backends)
+// ============================================================================
+
+// Number of levels of a full mip chain down to 1x1
+static inline unsigned int ImPlatform_FullMipCount(unsigned int width, unsigned int height)
+{
+    unsigned int extent = width > height ? width : height;
+    unsigned int levels = 1;
+    while (extent > 1)
+    {
+        extent >>= 1;
+        levels++;
+    }
+    return levels;
+}
+
+// Levels to allocate for `desc` (ImPlatform_TextureDesc::mip_levels, 0 = full chain)
+static inline unsigned int ImPlatform_TextureMipCount(const ImPlatform_TextureDesc* desc)
+{
+    const unsigned int full = ImPlatform_FullMipCount(desc->width, desc->height);
+    return (desc->mip_levels == 0 || desc->mip_levels > full) ? full : desc->mip_levels;
+}
+
+// ============================================================================
+// Block-compressed formats (ImPlatform_compressed.cpp)
+// ============================================================================
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+// Bytes per 4x4 block, 0 for uncompressed formats
+static inline unsigned int ImPlatform_CompressedBlockBytes(ImPlatform_PixelFormat format)
+{
+    switch (format)
+    {
+    case ImPlatform_PixelFormat_BC1:
+    case ImPlatform_PixelFormat_BC4:
+    case ImPlatform_PixelFormat_ETC2_RGB8:
+        return 8;
+    case ImPlatform_PixelFormat_BC2:
+    case ImPlatform_PixelFormat_BC3:
+    case ImPlatform_PixelFormat_BC5:
+    case ImPlatform_PixelFormat_BC6H:
+    case ImPlatform_PixelFormat_BC7:
+    case ImPlatform_PixelFormat_ETC2_RGBA8:
+    case ImPlatform_PixelFormat_ASTC_4x4:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// Bytes of one row of blocks / of a whole width x height region
+static inline size_t ImPlatform_CompressedRowBytes(ImPlatform_PixelFormat format, unsigned int width)
+{
+    return (size_t)((width + 3) / 4) * ImPlatform_CompressedBlockBytes(format);
+}
+static inline size_t ImPlatform_CompressedSize(ImPlatform_PixelFormat format, unsigned int width, unsigned int height)
+{
+    return ImPlatform_CompressedRowBytes(format, width) * ((height + 3) / 4);
+}
+
+// Update regions start on a block boundary and cover whole blocks, except along the right/bottom edge
+static inline bool ImPlatform_CompressedRegionValid(unsigned int x, unsigned int y, unsigned int width, unsigned int height,
+                                                    unsigned int tex_width, unsigned int tex_height)
+{
+    return width && height && (x & 3) == 0 && (y & 3) == 0 &&
+           x + width <= tex_width && y + height <= tex_height &&
+           ((width & 3) == 0 || x + width == tex_width) &&
+           ((height & 3) == 0 || y + height == tex_height);
+}
+
+// Decodes width x height texels of `blocks` (tightly packed block rows) to RGBA8 rows of dst_pitch bytes.
+// Single-channel formats decode to (R, 0, 0, 255), two-channel ones to (R, G, 0, 255), BC6H clamped to [0, 1].
+bool ImPlatform_DecodeCompressed(ImPlatform_PixelFormat format, const void* blocks, unsigned int width, unsigned int height,
+                                 void* dst_rgba8, size_t dst_pitch);
+
+// CPU fallback for formats the device can't sample: creates an RGBA8 texture from the decoded
+// blocks and remembers the source format, so ImPlatform_UpdateTexture keeps taking blocks.
+// Backends route CreateTexture here, and UpdateTexture when ImPlatform_IsDecodedCompressedTexture.
+ImTextureID ImPlatform_CreateTexture_DecodeCompressed(const void* blocks, const ImPlatform_TextureDesc* desc);
+bool        ImPlatform_IsDecodedCompressedTexture(ImTextureID texture_id);
+bool        ImPlatform_UpdateTexture_DecodeCompressed(ImTextureID texture_id, const void* blocks,
+                                                      unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+void        ImPlatform_ForgetDecodedCompressedTexture(ImTextureID texture_id);   // From ImPlatform_DestroyTexture
+#else
+static inline unsigned int ImPlatform_CompressedBlockBytes(ImPlatform_PixelFormat) { return 0; }
+#endif
+
+// ============================================================================
+// ImImageBuffer upload helpers (shared across graphics backends)
+// ============================================================================
+// Backends upload an ImImageBuffer without repacking whenever the GPU API can
+// consume its layout (GL_UNPACK_ROW_LENGTH, VkBufferImageCopy::bufferRowLength).
+// Only layouts the APIs can't express (flips, planar, odd strides) go through
+// ImPlatform_ImageBufferCopyTight.
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum ImPlatform_ImageBufferLayout {
+    ImPlatform_ImageBufferLayout_Tight,     // Interleaved pixels, rows back to back
+    ImPlatform_ImageBufferLayout_RowPitch,  // Interleaved pixels, positive row pitch in whole pixels (ROI)
+    ImPlatform_ImageBufferLayout_Rows,      // Interleaved pixels, any other row pitch (flipped, odd pitch): row copies
+    ImPlatform_ImageBufferLayout_Scatter,   // Planar / mirrored / arbitrary strides: per-sample copies
+} ImPlatform_ImageBufferLayout;
+
+// Bytes per pixel of the buffer's interleaved representation.
+static inline size_t ImPlatform_ImageBufferPixelBytes(const ImImageBuffer* buf)
+{
+    return (size_t)buf->channels * ImPlatform_SampleTypeSize(buf->type);
+}
+
+// F64 samples have no GPU format and are narrowed to F32 on upload.
+static inline bool ImPlatform_ImageBufferNeedsConversion(const ImImageBuffer* buf)
+{
+    return buf->type == ImSampleType_F64;
+}
+
+// Bytes per pixel once uploaded (after F64 -> F32 narrowing).
+static inline size_t ImPlatform_ImageBufferUploadPixelBytes(const ImImageBuffer* buf)
+{
+    return ImPlatform_ImageBufferNeedsConversion(buf) ? (size_t)buf->channels * 4 : ImPlatform_ImageBufferPixelBytes(buf);
+}
+
+// Address of pixel (x, y), channel 0.
+static inline const unsigned char* ImPlatform_ImageBufferPixel(const ImImageBuffer* buf, unsigned int x, unsigned int y)
+{
+    return (const unsigned char*)buf->host + buf->byte_offset + (ptrdiff_t)x * buf->x_stride_bytes + (ptrdiff_t)y * buf->y_stride_bytes;
+}
+
+static inline ImPlatform_ImageBufferLayout ImPlatform_ImageBufferClassify(const ImImageBuffer* buf)
+{
+    const ptrdiff_t sample = (ptrdiff_t)ImPlatform_SampleTypeSize(buf->type);
+    const ptrdiff_t pixel  = (ptrdiff_t)ImPlatform_ImageBufferPixelBytes(buf);
+    const bool interleaved = (buf->channels == 1 || buf->c_stride_bytes == sample) &&
+                             (buf->width == 1 || buf->x_stride_bytes == pixel);
+    if (!interleaved)
+        return ImPlatform_ImageBufferLayout_Scatter;
+    const ptrdiff_t row = pixel * (ptrdiff_t)buf->width;
+    if (buf->height == 1 || buf->y_stride_bytes == row)
+        return ImPlatform_ImageBufferLayout_Tight;
+    if (buf->y_stride_bytes > row && buf->y_stride_bytes % pixel == 0)
+        return ImPlatform_ImageBufferLayout_RowPitch;
+    return ImPlatform_ImageBufferLayout_Rows;
+}
+
+// Validates a buffer against the texture format it is uploaded to.
+// Fills *out_format with the format matching (type, channels); `requested`
+// may override it with an equivalent layout (BGRA8, sRGB variants).
+static inline bool ImPlatform_ImageBufferResolveFormat(const ImImageBuffer* buf, const ImPlatform_TextureDesc* requested, ImPlatform_PixelFormat* out_format)
+{
+    if (!buf || !buf->host || buf->width == 0 || buf->height == 0)
+        return false;
+    if (!ImPlatform_ImageBufferPixelFormat(buf, out_format))
+        return false;
+    if (!requested || requested->format == *out_format)
+        return true;
+    switch (requested->format)
+    {
+#if IMPLATFORM_GFX_SUPPORT_BGRA_FORMATS
+    case ImPlatform_PixelFormat_BGRA8:
+#endif
+#if IMPLATFORM_GFX_SUPPORT_SRGB_FORMATS
+    case ImPlatform_PixelFormat_RGBA8_SRGB:
+#endif
+    case ImPlatform_PixelFormat_RGBA8:
+        if (*out_format != ImPlatform_PixelFormat_RGBA8)
+            return false;
+        break;
+#if IMPLATFORM_GFX_SUPPORT_SRGB_FORMATS
+    case ImPlatform_PixelFormat_RGB8_SRGB:
+        if (*out_format != ImPlatform_PixelFormat_RGB8)
+            return false;
+        break;
+#endif
+    default:
+        return false;
+    }
+    *out_format = requested->format;
+    return true;
+}
+
+// Copies the buffer into tightly packed rows, `dst_pixel_bytes` apart, narrowing
+// F64 to F32. Extra destination bytes per pixel are set to 0xFF (opaque alpha
+// when an 8-bit RGB buffer feeds an RGBA texture).
+// Interleaved rows, RGB8 expansion and 8-bit planar packing use the
+// vectorized ImPlatform_Convert_* kernels.
+static inline void ImPlatform_ImageBufferCopyTight(const ImImageBuffer* buf, void* dst, size_t dst_pixel_bytes)
+{
+    const size_t src_sample = ImPlatform_SampleTypeSize(buf->type);
+    const size_t sample     = ImPlatform_ImageBufferNeedsConversion(buf) ? 4 : src_sample;
+    const size_t pixel      = sample * buf->channels;
+    const bool interleaved  = ImPlatform_ImageBufferClassify(buf) != ImPlatform_ImageBufferLayout_Scatter;
+    const bool planar8      = !interleaved && src_sample == 1 && buf->channels >= 3 && dst_pixel_bytes == 4 &&
+                              (buf->width == 1 || buf->x_stride_bytes == 1);
+    unsigned char* out = (unsigned char*)dst;
+    for (unsigned int y = 0; y < buf->height; y++)
+    {
+        const unsigned char* src = ImPlatform_ImageBufferPixel(buf, 0, y);
+        if (interleaved && dst_pixel_bytes == pixel)
+        {
+            if (ImPlatform_ImageBufferNeedsConversion(buf))
+                ImPlatform_Convert_F64ToF32((float*)out, (const double*)src, (size_t)buf->width * buf->channels);
+            else
+                memcpy(out, src, pixel * buf->width);
+            out += pixel * buf->width;
+            continue;
+        }
+        if (interleaved && src_sample == 1 && buf->channels == 3 && dst_pixel_bytes == 4)
+        {
+            ImPlatform_Convert_RGB8ToRGBA8(out, src, buf->width);
+            out += 4 * (size_t)buf->width;
+            continue;
+        }
+        if (planar8)
+        {
+            const ptrdiff_t cs = buf->c_stride_bytes;
+            ImPlatform_Convert_Planar8ToRGBA8(out, src, src + cs, src + 2 * cs, buf->channels == 4 ? src + 3 * cs : NULL, buf->width);
+            out += 4 * (size_t)buf->width;
+            continue;
+        }
+        for (unsigned int x = 0; x < buf->width; x++, src += buf->x_stride_bytes)
+        {
+            const unsigned char* s = src;
+            for (unsigned int c = 0; c < buf->channels; c++, s += buf->c_stride_bytes, out += sample)
+            {
+                switch (src_sample)
+                {
+                case 1:  out[0] = s[0]; break;
+                case 2:  memcpy(out, s, 2); break;
+                case 4:  memcpy(out, s, 4); break;
+                default:
+                    if (sample == 4)
+                    {
+                        double d;
+                        memcpy(&d, s, 8);
+                        float f = (float)d;
+                        memcpy(out, &f, 4);
+                    }
+                    else
+                    {
+                        memcpy(out, s, 8);
+                    }
+                    break;
+                }
+            }
+            for (size_t pad = pixel; pad < dst_pixel_bytes; pad++)
+                *out++ = 0xFF;
+        }
+    }
+}
+
+// Generic path for backends without a native strided upload: repack, then
+// go through ImPlatform_CreateTexture / ImPlatform_UpdateTexture.
+static inline ImTextureID ImPlatform_CreateTextureFromImageBuffer_Repack(const ImImageBuffer* buf, const ImPlatform_TextureDesc* desc)
+{
+    ImPlatform_PixelFormat format;
+    if (!ImPlatform_ImageBufferResolveFormat(buf, desc, &format))
+        return (ImTextureID)0;
+    ImPlatform_TextureDesc d = desc ? *desc : ImPlatform_TextureDesc_Default(buf->width, buf->height);
+    d.width  = buf->width;
+    d.height = buf->height;
+    d.format = format;
+    if (!ImPlatform_ImageBufferNeedsConversion(buf) && ImPlatform_ImageBufferClassify(buf) == ImPlatform_ImageBufferLayout_Tight)
+        return ImPlatform_CreateTexture(ImPlatform_ImageBufferPixel(buf, 0, 0), &d);
+    const size_t pixel = ImPlatform_ImageBufferUploadPixelBytes(buf);
+    void* tight = malloc(pixel * buf->width * buf->height);
+    if (!tight)
+        return (ImTextureID)0;
+    ImPlatform_ImageBufferCopyTight(buf, tight, pixel);
+    ImTextureID tex = ImPlatform_CreateTexture(tight, &d);
+    free(tight);
+    return tex;
+}
+
+static inline bool ImPlatform_UpdateTextureFromImageBuffer_Repack(ImTextureID texture_id, const ImImageBuffer* buf)
+{
+    if (!texture_id || !buf || !buf->host)
+        return false;
+    if (!ImPlatform_ImageBufferNeedsConversion(buf) && ImPlatform_ImageBufferClassify(buf) == ImPlatform_ImageBufferLayout_Tight)
+        return ImPlatform_UpdateTexture(texture_id, ImPlatform_ImageBufferPixel(buf, 0, 0), 0, 0, buf->width, buf->height);
+    const size_t pixel = ImPlatform_ImageBufferUploadPixelBytes(buf);
+    void* tight = malloc(pixel * buf->width * buf->height);
+    if (!tight)
+        return false;
+    ImPlatform_ImageBufferCopyTight(buf, tight, pixel);
+    bool ok = ImPlatform_UpdateTexture(texture_id, tight, 0, 0, buf->width, buf->height);
+    free(tight);
+    return ok;
+}
+
+// Texture whose content is filled later with ImPlatform_UpdateTexture: uninitialized storage where
+// the backend accepts NULL pixels (OpenGL3, Vulkan), a zero-filled upload elsewhere.
+static inline ImTextureID ImPlatform_CreateEmptyTexture(const ImPlatform_TextureDesc* desc, size_t pixel_bytes)
+{
+    ImTextureID tex = ImPlatform_CreateTexture(NULL, desc);
+    if (tex)
+        return tex;
+    void* zeros = calloc((size_t)desc->width * desc->height, pixel_bytes);
+    if (!zeros)
+        return (ImTextureID)0;
+    tex = ImPlatform_CreateTexture(zeros, desc);
+    free(zeros);
+    return tex;
+}
+
 // ============================================================================
 // Shader bytecode disk cache (shared across graphics backends)
 // ============================================================================
-// Backend-agnostic helpers for storing pre-compiled shader bytecode on disk
-// keyed by a hash of the source + entry + profile. Each graphics backend
-// (DX11, DX12, Vulkan SPIR-V, Metal, WebGPU) picks its own extension and
-// compiles into its own native bytecode format; this header only provides
-// hashing, path generation, and file I/O.
+// Backend-agnostic store for pre-compiled shader bytecode keyed by a hash of
+// the source + entry + profile. Each graphics backend (DX10/11/12, OpenGL
+// program binaries, Vulkan pipeline cache) produces its own native bytecode;
+// ImPlatform_shader_cache.cpp keeps all of a backend's blobs in one LZ4
+// compressed pack (./shaders/bytecode_cache/<backend>.impack) keyed by the
+// backend and device/driver identity, mapped once at open.
 //
 // Typical flow per backend CreateShader:
 //   1. If desc->bytecode is set -> use it directly (skip cache)
 //   2. Else if desc->cache_key is set:
 //       hash = FNV64(source + entry + profile)
-//       path = BuildPath(cache_key, entry, ext, hash)
-//       cached = CacheLoad(path)
+//       name = BuildName(cache_key, entry, ext, hash)
+//       cached = CacheLoad(name)
 //       if cached: wrap in native blob, done
-//       else: compile (with desc->compile_flags), CacheSave(path, blob), done
+//       else: compile (with desc->compile_flags), CacheSave(name, blob), done
 //   3. Else: compile without cache (legacy path)
+// The backend opens the cache once its device exists and closes it (writing
+// new entries back) on shutdown. Render thread only.
 
 #if IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
 
@@ -459,15 +843,6 @@ struct ImPlatform_GfxData_WebGPU* ImPlatform_Gfx_GetData_WebGPU(void);
 #include <stdlib.h>
 #include <string.h>
 
-#ifdef _WIN32
-    #include <direct.h>
-    #define IMPLATFORM_MKDIR_(path) _mkdir(path)
-#else
-    #include <sys/stat.h>
-    #include <sys/types.h>
-    #define IMPLATFORM_MKDIR_(path) mkdir((path), 0755)
-#endif
-
 // FNV-1a 64-bit hash of a buffer.
 static inline unsigned long long ImPlatform_ShaderCacheHashBytes(const void* data, size_t len)
 {
@@ -495,54 +870,226 @@ static inline unsigned long long ImPlatform_ShaderCacheHashSource(
     return h;
 }
 
-// Build the on-disk cache path and ensure the parent directories exist.
-// Layout: ./shaders/bytecode_cache/<cache_key>_<entry>_<16-hex-hash>.<ext>
-// Parent dirs are created silently; mkdir errors are ignored.
-static inline void ImPlatform_ShaderCacheBuildPath(
-    char* out_path, size_t out_size,
+// Map the backend's pack. Entries written for another device_id (GPU, driver or compiler
+// version, whatever invalidates the backend's bytecode) are discarded. Reopening with the
+// same identity is a no-op.
+void ImPlatform_ShaderCacheOpen(const char* backend, const void* device_id, size_t device_id_size);
+// Write new entries back (atomically, LRU entries dropped past the size cap) and unmap.
+void ImPlatform_ShaderCacheClose(void);
+
+// Entry name: <cache_key>_<entry>_<16-hex-hash>.<ext>
+void ImPlatform_ShaderCacheBuildName(
+    char* out_name, size_t out_size,
     const char* cache_key, const char* entry, const char* ext,
-    unsigned long long hash)
+    unsigned long long hash);
+
+// Path of a standalone file next to the pack (caches the driver reads from a URL, like
+// MTLBinaryArchive). Creates the directory.
+void ImPlatform_ShaderCacheBuildFilePath(char* out_path, size_t out_size, const char* file_name);
+
+// Load a cached blob. Returns a newly-allocated buffer (caller must free() it) and writes
+// the size into *out_size. Returns NULL on cache miss or when the cache isn't open.
+void* ImPlatform_ShaderCacheLoad(const char* name, size_t* out_size);
+
+// Add or replace a blob. It reaches the disk when the cache is closed. Returns true on success.
+bool ImPlatform_ShaderCacheSave(const char* name, const void* data, size_t size);
+
+// Shader hot reload (ImPlatform_shader_reload.cpp): swaps rebuilt programs of ImPlatform_WatchShaderProgram.
+// Called by every backend at the start of ImPlatform_GfxAPINewFrame.
+void ImPlatform_ShaderReload_NewFrame(void);
+
+// -----------------------------------------------------------------------------
+// Shader reflection name table
+// -----------------------------------------------------------------------------
+// Open-addressing hash table mapping uniform names to a backend value (GL
+// location, constant buffer offset...), filled once when a program is created
+// so per-draw lookups never go back to the driver or compare strings linearly.
+
+struct ImPlatform_ShaderNameEntry
 {
-    IMPLATFORM_MKDIR_("./shaders");
-    IMPLATFORM_MKDIR_("./shaders/bytecode_cache");
-    snprintf(out_path, out_size, "./shaders/bytecode_cache/%s_%s_%016llx.%s",
-             cache_key ? cache_key : "shader",
-             entry ? entry : "main",
-             hash,
-             ext ? ext : "bin");
+    unsigned long long hash;    // 0 = empty slot
+    char* name;                 // malloc'ed copy
+    int value;                  // Backend defined (GL location, byte offset...)
+    unsigned int size;          // Size in bytes, 0 if unknown
+};
+
+struct ImPlatform_ShaderNameTable
+{
+    ImPlatform_ShaderNameEntry* entries;
+    unsigned int capacity;      // Power of two
+    unsigned int count;
+};
+
+static inline unsigned long long ImPlatform_ShaderNameHash(const char* name, size_t len)
+{
+    unsigned long long h = ImPlatform_ShaderCacheHashBytes(name, len);
+    return h ? h : 1;
 }
 
-// Load a cached bytecode blob from disk. Returns a newly-allocated buffer
-// (caller must free() it) and writes the size into *out_size. Returns NULL
-// on cache miss or I/O error.
-static inline void* ImPlatform_ShaderCacheLoad(const char* path, size_t* out_size)
+static inline const ImPlatform_ShaderNameEntry* ImPlatform_ShaderNameTable_FindN(const ImPlatform_ShaderNameTable* table, const char* name, size_t len)
 {
-    if (!path || !out_size) return NULL;
-    *out_size = 0;
-    FILE* f = fopen(path, "rb");
-    if (!f) return NULL;
-    if (fseek(f, 0, SEEK_END) != 0) { fclose(f); return NULL; }
-    long sz = ftell(f);
-    if (sz <= 0) { fclose(f); return NULL; }
-    if (fseek(f, 0, SEEK_SET) != 0) { fclose(f); return NULL; }
-    void* data = malloc((size_t)sz);
-    if (!data) { fclose(f); return NULL; }
-    size_t read = fread(data, 1, (size_t)sz, f);
-    fclose(f);
-    if (read != (size_t)sz) { free(data); return NULL; }
-    *out_size = (size_t)sz;
-    return data;
+    if (!table->capacity || !name) return NULL;
+    unsigned long long h = ImPlatform_ShaderNameHash(name, len);
+    unsigned int mask = table->capacity - 1;
+    for (unsigned int i = (unsigned int)h & mask;; i = (i + 1) & mask)
+    {
+        const ImPlatform_ShaderNameEntry* e = &table->entries[i];
+        if (e->hash == 0)
+            return NULL;
+        if (e->hash == h && strncmp(e->name, name, len) == 0 && e->name[len] == '\0')
+            return e;
+    }
 }
 
-// Save a bytecode blob to disk. Returns true on success.
-static inline bool ImPlatform_ShaderCacheSave(const char* path, const void* data, size_t size)
+static inline const ImPlatform_ShaderNameEntry* ImPlatform_ShaderNameTable_Find(const ImPlatform_ShaderNameTable* table, const char* name)
 {
-    if (!path || !data || size == 0) return false;
-    FILE* f = fopen(path, "wb");
-    if (!f) return false;
-    size_t written = fwrite(data, 1, size, f);
-    fclose(f);
-    return written == size;
+    return name ? ImPlatform_ShaderNameTable_FindN(table, name, strlen(name)) : NULL;
+}
+
+static inline void ImPlatform_ShaderNameTable_Free(ImPlatform_ShaderNameTable* table)
+{
+    for (unsigned int i = 0; i < table->capacity; i++)
+        free(table->entries[i].name);
+    free(table->entries);
+    table->entries = NULL;
+    table->capacity = table->count = 0;
+}
+
+// Adds (or overwrites) `name`. Names are taken up to `len` characters. Returns false on allocation failure.
+static inline bool ImPlatform_ShaderNameTable_AddN(ImPlatform_ShaderNameTable* table, const char* name, size_t len, int value, unsigned int size)
+{
+    // Keep the load factor under 1/2
+    if ((table->count + 1) * 2 > table->capacity)
+    {
+        unsigned int capacity = table->capacity ? table->capacity * 2 : 16;
+        ImPlatform_ShaderNameEntry* entries = (ImPlatform_ShaderNameEntry*)calloc(capacity, sizeof(ImPlatform_ShaderNameEntry));
+        if (!entries) return false;
+        for (unsigned int i = 0; i < table->capacity; i++)
+        {
+            const ImPlatform_ShaderNameEntry* e = &table->entries[i];
+            if (e->hash == 0) continue;
+            unsigned int j = (unsigned int)e->hash & (capacity - 1);
+            while (entries[j].hash != 0)
+                j = (j + 1) & (capacity - 1);
+            entries[j] = *e;
+        }
+        free(table->entries);
+        table->entries = entries;
+        table->capacity = capacity;
+    }
+
+    unsigned long long h = ImPlatform_ShaderNameHash(name, len);
+    unsigned int mask = table->capacity - 1;
+    unsigned int i = (unsigned int)h & mask;
+    for (; table->entries[i].hash != 0; i = (i + 1) & mask)
+    {
+        ImPlatform_ShaderNameEntry* e = &table->entries[i];
+        if (e->hash == h && strncmp(e->name, name, len) == 0 && e->name[len] == '\0')
+        {
+            e->value = value;
+            e->size = size;
+            return true;
+        }
+    }
+
+    char* copy = (char*)malloc(len + 1);
+    if (!copy) return false;
+    memcpy(copy, name, len);
+    copy[len] = '\0';
+    ImPlatform_ShaderNameEntry* e = &table->entries[i];
+    e->hash = h;
+    e->name = copy;
+    e->value = value;
+    e->size = size;
+    table->count++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Frame arena
+// -----------------------------------------------------------------------------
+// Paged bump allocator for data captured while a frame is built and read back by
+// draw callbacks when it is rendered (e.g. per-draw shader constants). Reset once
+// the frame has been rendered; pages are kept for the next frames.
+
+#define IMPLATFORM_FRAME_ARENA_PAGE_SIZE (64u * 1024u)
+
+struct ImPlatform_FrameArenaPage
+{
+    ImPlatform_FrameArenaPage* next;
+    size_t capacity;
+    size_t used;
+    // capacity bytes follow
+};
+
+struct ImPlatform_FrameArena
+{
+    ImPlatform_FrameArenaPage* pages;    // First page
+    ImPlatform_FrameArenaPage* current;  // Page being filled, pages after it are empty
+};
+
+// Returns 16 byte aligned storage valid until the next ImPlatform_FrameArena_Reset, NULL on allocation failure
+static inline void* ImPlatform_FrameArena_Alloc(ImPlatform_FrameArena* arena, size_t size)
+{
+    const size_t header = (sizeof(ImPlatform_FrameArenaPage) + 15) & ~(size_t)15;
+    size = (size + 15) & ~(size_t)15;
+    ImPlatform_FrameArenaPage* page = arena->current;
+    if (page && page->used + size > page->capacity)
+    {
+        page = page->next;
+        if (page && size > page->capacity)
+            page = NULL;
+        if (page)
+            arena->current = page;
+    }
+    if (!page)
+    {
+        size_t capacity = size > IMPLATFORM_FRAME_ARENA_PAGE_SIZE ? size : IMPLATFORM_FRAME_ARENA_PAGE_SIZE;
+        page = (ImPlatform_FrameArenaPage*)malloc(header + capacity);
+        if (!page) return NULL;
+        page->capacity = capacity;
+        page->used = 0;
+        if (arena->current)
+        {
+            page->next = arena->current->next;
+            arena->current->next = page;
+        }
+        else
+        {
+            page->next = arena->pages;
+            arena->pages = page;
+        }
+        arena->current = page;
+    }
+    void* ptr = (unsigned char*)page + header + page->used;
+    page->used += size;
+    return ptr;
+}
+
+static inline void ImPlatform_FrameArena_Reset(ImPlatform_FrameArena* arena)
+{
+    for (ImPlatform_FrameArenaPage* page = arena->pages; page; page = page->next)
+        page->used = 0;
+    arena->current = arena->pages;
+}
+
+static inline void ImPlatform_FrameArena_Free(ImPlatform_FrameArena* arena)
+{
+    while (arena->pages)
+    {
+        ImPlatform_FrameArenaPage* page = arena->pages;
+        arena->pages = page->next;
+        free(page);
+    }
+    arena->current = NULL;
 }
 
 #endif  // IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
+
+// ============================================================================
+// Video capture (ImPlatform_capture.cpp)
+// ============================================================================
+
+// Queues the backbuffer copy and readback of ImPlatform_BeginCapture.
+// Called by every backend at the end of ImPlatform_GfxAPIRender, once the ImGui draw data is recorded.
+void ImPlatform_Capture_EndFrame(void);
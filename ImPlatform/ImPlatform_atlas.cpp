@@ -0,0 +1,494 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Texture Atlas
+// Packs many small images into a few page textures, shared by all graphics backends.
+//
+// Each page is cut into horizontal shelves. An image goes to the shelf wasting the least height,
+// or opens a new shelf at the top of the free area of a page; within a shelf, free runs of
+// columns are kept sorted so removing an image merges its columns back with its neighbours.
+// A shelf left empty merges with empty shelves around it, and one at the top of the used area
+// gives its rows back, so the space of removed images is reused by later inserts of any size.
+// That space is only freed once the frame the image was removed in is over, so an insert never
+// uploads over texels that draws recorded earlier in the frame still sample.
+// Pixels only move through ImPlatform_UpdateTexture, so every backend supports it.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Shelf heights are rounded up to this many texels so images of close sizes share shelves
+#define IMPLATFORM_ATLAS_SHELF_ROUNDING 8
+
+// Handles pack the entry index (plus one, so 0 stays invalid) with a generation counter
+#define IMPLATFORM_ATLAS_INDEX_BITS 20
+#define IMPLATFORM_ATLAS_INDEX_MASK ((1u << IMPLATFORM_ATLAS_INDEX_BITS) - 1)
+
+struct ImPlatform_AtlasShelf
+{
+    unsigned int y;
+    unsigned int height;
+    unsigned int used;          // Images packed on the shelf
+};
+
+// Free run of columns [x, x + width) of the shelf starting at row `y`
+struct ImPlatform_AtlasSpan
+{
+    unsigned int y;
+    unsigned int x;
+    unsigned int width;
+};
+
+struct ImPlatform_AtlasPage
+{
+    ImTextureID                     texture;
+    unsigned int                    top;        // First row not covered by a shelf
+    ImVector<ImPlatform_AtlasShelf> shelves;    // Sorted by y, contiguous from row 0 to `top`
+    ImVector<ImPlatform_AtlasSpan>  spans;      // Sorted by (y, x)
+};
+
+struct ImPlatform_AtlasEntry
+{
+    unsigned int page;
+    unsigned int x, y;              // Allocated rectangle, padding included
+    unsigned int width, height;
+    unsigned int generation;
+    int          next_free;
+    bool         live;
+};
+
+// Rectangle of a removed image, freed once the ImGui frame it was removed in is over
+struct ImPlatform_AtlasRetired
+{
+    unsigned int page;
+    unsigned int x, y;
+    unsigned int width;
+    int          frame;
+};
+
+struct ImPlatform_Atlas_T
+{
+    ImPlatform_AtlasDesc            desc;
+    unsigned int                    pixel_bytes;
+    ImPlatform_AtlasPage*           pages;      // desc.max_pages slots, the first page_count in use
+    unsigned int                    page_count;
+    ImVector<ImPlatform_AtlasEntry> entries;
+    int                             free_head;
+    ImVector<ImPlatform_AtlasRetired> retired;
+    unsigned char*                  staging;    // Padded image being uploaded
+    size_t                          staging_size;
+};
+
+IMPLATFORM_API ImPlatform_AtlasDesc ImPlatform_AtlasDesc_Default(void)
+{
+    ImPlatform_AtlasDesc desc;
+    desc.page_size  = 2048;
+    desc.max_pages  = 4;
+    desc.padding    = 1;
+    desc.format     = ImPlatform_PixelFormat_RGBA8;
+    desc.min_filter = ImPlatform_TextureFilter_Linear;
+    desc.mag_filter = ImPlatform_TextureFilter_Linear;
+    return desc;
+}
+
+// ============================================================================
+// Shelf packer
+// ============================================================================
+
+static int ImPlatform_Atlas_FindShelf(const ImPlatform_AtlasPage* page, unsigned int y)
+{
+    for (int i = 0; i < page->shelves.Size; i++)
+        if (page->shelves[i].y == y)
+            return i;
+    return -1;
+}
+
+// Index of the first span at or after (y, x)
+static int ImPlatform_Atlas_SpanLowerBound(const ImPlatform_AtlasPage* page, unsigned int y, unsigned int x)
+{
+    int lo = 0, hi = page->spans.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) / 2;
+        const ImPlatform_AtlasSpan* s = &page->spans[mid];
+        if (s->y < y || (s->y == y && s->x < x))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void ImPlatform_Atlas_InsertSpan(ImPlatform_AtlasPage* page, unsigned int y, unsigned int x, unsigned int width)
+{
+    ImPlatform_AtlasSpan span;
+    span.y = y;
+    span.x = x;
+    span.width = width;
+    page->spans.insert(page->spans.Data + ImPlatform_Atlas_SpanLowerBound(page, y, x), span);
+}
+
+// Give columns [x, x + width) of shelf `y` back, merging with the adjacent free runs
+static void ImPlatform_Atlas_FreeColumns(ImPlatform_AtlasPage* page, unsigned int y, unsigned int x, unsigned int width)
+{
+    int i = ImPlatform_Atlas_SpanLowerBound(page, y, x);
+    const bool merge_prev = i > 0 && page->spans[i - 1].y == y && page->spans[i - 1].x + page->spans[i - 1].width == x;
+    const bool merge_next = i < page->spans.Size && page->spans[i].y == y && page->spans[i].x == x + width;
+    if (merge_prev && merge_next)
+    {
+        page->spans[i - 1].width += width + page->spans[i].width;
+        page->spans.erase(page->spans.Data + i);
+    }
+    else if (merge_prev)
+    {
+        page->spans[i - 1].width += width;
+    }
+    else if (merge_next)
+    {
+        page->spans[i].x = x;
+        page->spans[i].width += width;
+    }
+    else
+    {
+        ImPlatform_Atlas_InsertSpan(page, y, x, width);
+    }
+}
+
+// Remove the single full-width span of an empty shelf
+static void ImPlatform_Atlas_RemoveShelfSpan(ImPlatform_AtlasPage* page, unsigned int y)
+{
+    const int i = ImPlatform_Atlas_SpanLowerBound(page, y, 0);
+    IM_ASSERT(i < page->spans.Size && page->spans[i].y == y);
+    page->spans.erase(page->spans.Data + i);
+}
+
+// Shelf `index` just became empty: merge it with empty neighbours, give it back if it is the topmost
+static void ImPlatform_Atlas_CollapseShelf(ImPlatform_AtlasPage* page, int index)
+{
+    if (index + 1 < page->shelves.Size && page->shelves[index + 1].used == 0)
+    {
+        ImPlatform_Atlas_RemoveShelfSpan(page, page->shelves[index + 1].y);
+        page->shelves[index].height += page->shelves[index + 1].height;
+        page->shelves.erase(page->shelves.Data + index + 1);
+    }
+    if (index > 0 && page->shelves[index - 1].used == 0)
+    {
+        ImPlatform_Atlas_RemoveShelfSpan(page, page->shelves[index].y);
+        page->shelves[index - 1].height += page->shelves[index].height;
+        page->shelves.erase(page->shelves.Data + index);
+        index--;
+    }
+    if (index == page->shelves.Size - 1)
+    {
+        ImPlatform_Atlas_RemoveShelfSpan(page, page->shelves[index].y);
+        page->top = page->shelves[index].y;
+        page->shelves.pop_back();
+    }
+}
+
+static void ImPlatform_Atlas_AddShelf(ImPlatform_AtlasPage* page, int index, unsigned int y, unsigned int height, unsigned int page_size)
+{
+    ImPlatform_AtlasShelf shelf;
+    shelf.y = y;
+    shelf.height = height;
+    shelf.used = 0;
+    page->shelves.insert(page->shelves.Data + index, shelf);
+    ImPlatform_Atlas_InsertSpan(page, y, 0, page_size);
+}
+
+static unsigned int ImPlatform_Atlas_ShelfHeight(unsigned int height, unsigned int page_size)
+{
+    const unsigned int rounded = (height + IMPLATFORM_ATLAS_SHELF_ROUNDING - 1) & ~(unsigned int)(IMPLATFORM_ATLAS_SHELF_ROUNDING - 1);
+    return rounded < page_size ? rounded : page_size;
+}
+
+// Allocate width x height texels in `page`. Returns false when it doesn't fit.
+static bool ImPlatform_Atlas_PageAlloc(ImPlatform_AtlasPage* page, unsigned int page_size, unsigned int width, unsigned int height,
+                                       unsigned int* out_x, unsigned int* out_y)
+{
+    const unsigned int shelf_height = ImPlatform_Atlas_ShelfHeight(height, page_size);
+
+    // Shelf wasting the least height. Partly filled shelves only take images of a similar height
+    // so a tall shelf isn't lined with small images; empty shelves are split to fit.
+    int best_span = -1, best_shelf = -1;
+    unsigned int best_waste = 0xFFFFFFFFu;
+    for (int i = 0; i < page->shelves.Size; i++)
+    {
+        const ImPlatform_AtlasShelf* shelf = &page->shelves[i];
+        if (shelf->height < height)
+            continue;
+        if (shelf->used > 0 && shelf->height > shelf_height + shelf_height / 2)
+            continue;
+        const unsigned int waste = shelf->used > 0 ? shelf->height - height : shelf_height - height + 1;
+        if (waste >= best_waste)
+            continue;
+        for (int s = ImPlatform_Atlas_SpanLowerBound(page, shelf->y, 0); s < page->spans.Size && page->spans[s].y == shelf->y; s++)
+            if (page->spans[s].width >= width)
+            {
+                best_span  = s;
+                best_shelf = i;
+                best_waste = waste;
+                break;
+            }
+    }
+
+    if (best_shelf < 0)
+    {
+        // Open a shelf in the rows left at the top
+        if (page_size - page->top < height)
+            return false;
+        const unsigned int h = page_size - page->top < shelf_height ? page_size - page->top : shelf_height;
+        best_shelf = page->shelves.Size;
+        ImPlatform_Atlas_AddShelf(page, best_shelf, page->top, h, page_size);
+        page->top += h;
+        best_span = page->spans.Size - 1;
+    }
+    else if (page->shelves[best_shelf].used == 0 && page->shelves[best_shelf].height >= shelf_height + IMPLATFORM_ATLAS_SHELF_ROUNDING)
+    {
+        // Split an empty shelf, the rows below stay an empty shelf
+        ImPlatform_AtlasShelf* shelf = &page->shelves[best_shelf];
+        const unsigned int rest_y = shelf->y + shelf_height, rest_h = shelf->height - shelf_height;
+        shelf->height = shelf_height;
+        ImPlatform_Atlas_AddShelf(page, best_shelf + 1, rest_y, rest_h, page_size);
+    }
+
+    ImPlatform_AtlasSpan* span = &page->spans[best_span];
+    *out_x = span->x;
+    *out_y = span->y;
+    if (span->width == width)
+    {
+        page->spans.erase(span);
+    }
+    else
+    {
+        span->x += width;
+        span->width -= width;
+    }
+    page->shelves[best_shelf].used++;
+    return true;
+}
+
+static void ImPlatform_Atlas_PageFree(ImPlatform_AtlasPage* page, unsigned int x, unsigned int y, unsigned int width)
+{
+    const int index = ImPlatform_Atlas_FindShelf(page, y);
+    IM_ASSERT(index >= 0 && page->shelves[index].used > 0);
+    ImPlatform_Atlas_FreeColumns(page, y, x, width);
+    if (--page->shelves[index].used == 0)
+        ImPlatform_Atlas_CollapseShelf(page, index);
+}
+
+// ============================================================================
+// Entries and uploads
+// ============================================================================
+
+static ImPlatform_AtlasEntry* ImPlatform_Atlas_Lookup(ImPlatform_Atlas_T* atlas, ImPlatform_AtlasHandle handle)
+{
+    if (!atlas || !handle)
+        return NULL;
+    const int index = (int)(handle & IMPLATFORM_ATLAS_INDEX_MASK) - 1;
+    if (index < 0 || index >= atlas->entries.Size)
+        return NULL;
+    ImPlatform_AtlasEntry* e = &atlas->entries[index];
+    return (e->live && (e->generation << IMPLATFORM_ATLAS_INDEX_BITS) == (handle & ~IMPLATFORM_ATLAS_INDEX_MASK)) ? e : NULL;
+}
+
+// Upload an image into its entry, replicating its edge texels into the padding
+static bool ImPlatform_Atlas_Upload(ImPlatform_Atlas_T* atlas, const ImPlatform_AtlasEntry* e, const void* pixel_data)
+{
+    const unsigned int pad = atlas->desc.padding;
+    ImTextureID texture = atlas->pages[e->page].texture;
+    if (pad == 0)
+        return ImPlatform_UpdateTexture(texture, pixel_data, e->x, e->y, e->width, e->height);
+
+    const size_t pb = atlas->pixel_bytes;
+    const size_t row_bytes = (size_t)e->width * pb;
+    const size_t size = row_bytes * e->height;
+    if (size > atlas->staging_size)
+    {
+        unsigned char* staging = (unsigned char*)realloc(atlas->staging, size);
+        if (!staging)
+            return false;
+        atlas->staging = staging;
+        atlas->staging_size = size;
+    }
+
+    const unsigned int w = e->width - 2 * pad, h = e->height - 2 * pad;
+    const unsigned char* src = (const unsigned char*)pixel_data;
+    for (unsigned int y = 0; y < h; y++)
+    {
+        unsigned char* dst = atlas->staging + (size_t)(pad + y) * row_bytes;
+        const unsigned char* row = src + (size_t)y * w * pb;
+        memcpy(dst + pad * pb, row, (size_t)w * pb);
+        for (unsigned int x = 0; x < pad; x++)
+        {
+            memcpy(dst + x * pb, row, pb);
+            memcpy(dst + (pad + w + x) * pb, row + (size_t)(w - 1) * pb, pb);
+        }
+    }
+    for (unsigned int y = 0; y < pad; y++)
+    {
+        memcpy(atlas->staging + (size_t)y * row_bytes, atlas->staging + (size_t)pad * row_bytes, row_bytes);
+        memcpy(atlas->staging + (size_t)(pad + h + y) * row_bytes, atlas->staging + (size_t)(pad + h - 1) * row_bytes, row_bytes);
+    }
+    return ImPlatform_UpdateTexture(texture, atlas->staging, e->x, e->y, e->width, e->height);
+}
+
+static bool ImPlatform_Atlas_AddPage(ImPlatform_Atlas_T* atlas)
+{
+    if (atlas->page_count >= atlas->desc.max_pages)
+        return false;
+    ImPlatform_TextureDesc page_desc = ImPlatform_TextureDesc_Default(atlas->desc.page_size, atlas->desc.page_size);
+    page_desc.format     = atlas->desc.format;
+    page_desc.min_filter = atlas->desc.min_filter;
+    page_desc.mag_filter = atlas->desc.mag_filter;
+    ImTextureID texture = ImPlatform_CreateEmptyTexture(&page_desc, atlas->pixel_bytes);
+    if (!texture)
+    {
+        fprintf(stderr, "[ImPlatform] Failed to create atlas page (%ux%u)\n", atlas->desc.page_size, atlas->desc.page_size);
+        return false;
+    }
+    ImPlatform_AtlasPage* page = &atlas->pages[atlas->page_count++];
+    page->texture = texture;
+    page->top = 0;
+    return true;
+}
+
+// Free the rectangles of images removed in an earlier frame
+static void ImPlatform_Atlas_FreeRetired(ImPlatform_Atlas_T* atlas)
+{
+    const int frame = ImGui::GetFrameCount();
+    int kept = 0;
+    for (int i = 0; i < atlas->retired.Size; i++)
+    {
+        const ImPlatform_AtlasRetired& r = atlas->retired[i];
+        if (r.frame == frame)
+            atlas->retired[kept++] = r;
+        else
+            ImPlatform_Atlas_PageFree(&atlas->pages[r.page], r.x, r.y, r.width);
+    }
+    atlas->retired.shrink(kept);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+IMPLATFORM_API ImPlatform_Atlas ImPlatform_CreateAtlas(const ImPlatform_AtlasDesc* desc)
+{
+    ImPlatform_AtlasDesc d = desc ? *desc : ImPlatform_AtlasDesc_Default();
+    const unsigned int pixel_bytes = ImPlatform_PixelFormatBytes(d.format);
+    if (pixel_bytes == 0 || d.page_size == 0 || d.max_pages == 0 || 2 * d.padding >= d.page_size)
+        return NULL;
+
+    ImPlatform_Atlas_T* atlas = new ImPlatform_Atlas_T;
+    atlas->desc         = d;
+    atlas->pixel_bytes  = pixel_bytes;
+    atlas->pages        = new ImPlatform_AtlasPage[d.max_pages];
+    atlas->page_count   = 0;
+    atlas->free_head    = -1;
+    atlas->staging      = NULL;
+    atlas->staging_size = 0;
+    return atlas;
+}
+
+IMPLATFORM_API void ImPlatform_DestroyAtlas(ImPlatform_Atlas atlas)
+{
+    if (!atlas)
+        return;
+    for (unsigned int i = 0; i < atlas->page_count; i++)
+        ImPlatform_DestroyTexture(atlas->pages[i].texture);
+    delete[] atlas->pages;
+    free(atlas->staging);
+    delete atlas;
+}
+
+IMPLATFORM_API ImPlatform_AtlasHandle ImPlatform_AtlasInsert(ImPlatform_Atlas atlas, const void* pixel_data, unsigned int width, unsigned int height)
+{
+    if (!atlas || !pixel_data || width == 0 || height == 0)
+        return 0;
+    const unsigned int pad = atlas->desc.padding;
+    if (width > atlas->desc.page_size - 2 * pad || height > atlas->desc.page_size - 2 * pad)
+        return 0;
+    if (atlas->free_head < 0 && atlas->entries.Size >= (int)IMPLATFORM_ATLAS_INDEX_MASK)
+        return 0;
+    ImPlatform_Atlas_FreeRetired(atlas);
+
+    // First page with room, then a new page
+    ImPlatform_AtlasEntry e;
+    e.width  = width + 2 * pad;
+    e.height = height + 2 * pad;
+    for (e.page = 0; e.page < atlas->page_count; e.page++)
+        if (ImPlatform_Atlas_PageAlloc(&atlas->pages[e.page], atlas->desc.page_size, e.width, e.height, &e.x, &e.y))
+            break;
+    if (e.page == atlas->page_count &&
+        (!ImPlatform_Atlas_AddPage(atlas) || !ImPlatform_Atlas_PageAlloc(&atlas->pages[e.page], atlas->desc.page_size, e.width, e.height, &e.x, &e.y)))
+        return 0;
+
+    if (!ImPlatform_Atlas_Upload(atlas, &e, pixel_data))
+    {
+        ImPlatform_Atlas_PageFree(&atlas->pages[e.page], e.x, e.y, e.width);
+        return 0;
+    }
+
+    e.generation = 0;
+    e.next_free  = -1;
+    e.live       = true;
+    int index = atlas->free_head;
+    if (index >= 0)
+    {
+        atlas->free_head = atlas->entries[index].next_free;
+        e.generation = atlas->entries[index].generation;
+        atlas->entries[index] = e;
+    }
+    else
+    {
+        index = atlas->entries.Size;
+        atlas->entries.push_back(e);
+    }
+    return (e.generation << IMPLATFORM_ATLAS_INDEX_BITS) | (ImPlatform_AtlasHandle)(index + 1);
+}
+
+IMPLATFORM_API bool ImPlatform_AtlasUpdate(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle, const void* pixel_data)
+{
+    const ImPlatform_AtlasEntry* e = ImPlatform_Atlas_Lookup(atlas, handle);
+    return e && pixel_data && ImPlatform_Atlas_Upload(atlas, e, pixel_data);
+}
+
+IMPLATFORM_API void ImPlatform_AtlasRemove(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle)
+{
+    ImPlatform_AtlasEntry* e = ImPlatform_Atlas_Lookup(atlas, handle);
+    if (!e)
+        return;
+    ImPlatform_AtlasRetired retired = { e->page, e->x, e->y, e->width, ImGui::GetFrameCount() };
+    atlas->retired.push_back(retired);
+    e->live = false;
+    e->generation = (e->generation + 1) & (0xFFFFFFFFu >> IMPLATFORM_ATLAS_INDEX_BITS);
+    e->next_free = atlas->free_head;
+    atlas->free_head = (int)(e - atlas->entries.Data);
+}
+
+IMPLATFORM_API bool ImPlatform_AtlasGetRegion(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle, ImPlatform_AtlasRegion* out_region)
+{
+    const ImPlatform_AtlasEntry* e = ImPlatform_Atlas_Lookup(atlas, handle);
+    if (!e || !out_region)
+        return false;
+    const unsigned int pad = atlas->desc.padding;
+    const float inv_page = 1.0f / (float)atlas->desc.page_size;
+    out_region->texture_id = atlas->pages[e->page].texture;
+    out_region->page       = e->page;
+    out_region->x          = e->x + pad;
+    out_region->y          = e->y + pad;
+    out_region->width      = e->width - 2 * pad;
+    out_region->height     = e->height - 2 * pad;
+    out_region->uv0        = ImVec2((float)out_region->x * inv_page, (float)out_region->y * inv_page);
+    out_region->uv1        = ImVec2((float)(out_region->x + out_region->width) * inv_page, (float)(out_region->y + out_region->height) * inv_page);
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_AtlasImage(ImPlatform_Atlas atlas, ImPlatform_AtlasHandle handle, ImVec2 size)
+{
+    ImPlatform_AtlasRegion region;
+    if (ImPlatform_AtlasGetRegion(atlas, handle, &region))
+        ImGui::Image(region.texture_id, size, region.uv0, region.uv1);
+    else
+        ImGui::Dummy(size);
+}
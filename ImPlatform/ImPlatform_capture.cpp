@@ -0,0 +1,355 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Video Capture
+// Records the main window to a Y4M or raw I420 stream, written to a file or piped into a process.
+//
+// Every Nth frame, at the end of ImPlatform_GfxAPIRender, the backbuffer is copied into a render
+// texture of the capture size and read back asynchronously into one slot of a small ring. Once the
+// pixels are on the CPU a worker thread converts them to I420 with the SIMD kernels of
+// ImPlatform_convert.cpp and writes them out. A frame that finds no free slot, because the GPU or
+// the output (a slow pipe) is behind, is dropped: the render thread never waits on either.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #define IMPLATFORM_CAPTURE_THREADS 0
+#else
+    #define IMPLATFORM_CAPTURE_THREADS 1
+#endif
+
+#if IMPLATFORM_CAPTURE_THREADS
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+    #define IMPLATFORM_CAPTURE_POPEN(cmd)   _popen(cmd, "wb")
+    #define IMPLATFORM_CAPTURE_PCLOSE(f)    _pclose(f)
+#else
+    #define IMPLATFORM_CAPTURE_POPEN(cmd)   popen(cmd, "w")
+    #define IMPLATFORM_CAPTURE_PCLOSE(f)    pclose(f)
+#endif
+
+// Frames in flight between the copy and the end of the write. Readbacks land 2-3 frames after
+// the copy, the rest absorbs output hiccups before frames start being dropped.
+// Keep it within the readback buffer pools of the backends (8) so slots never allocate.
+#ifndef IMPLATFORM_CAPTURE_SLOTS
+#define IMPLATFORM_CAPTURE_SLOTS 6
+#endif
+
+enum ImPlatform_CaptureSlotState
+{
+    ImPlatform_CaptureSlot_Free,
+    ImPlatform_CaptureSlot_Reading,     // Readback requested, pixels not on the CPU yet
+    ImPlatform_CaptureSlot_Writing,     // Owned by the worker thread
+    ImPlatform_CaptureSlot_Written,     // Readback to release on the render thread
+};
+
+struct ImPlatform_CaptureSlot
+{
+    std::atomic<int>        state;
+    ImPlatform_Readback     readback;
+    const unsigned char*    pixels;         // NULL: the readback failed, the worker counts it dropped
+    unsigned int            row_pitch;
+};
+
+struct ImPlatform_CaptureState
+{
+    bool                    active;
+    FILE*                   file;
+    bool                    is_pipe;
+    ImPlatform_CaptureFormat format;
+    ImTextureID             target;         // RGBA8 render texture of the capture size
+    unsigned int            width;          // Even
+    unsigned int            height;         // Even
+    unsigned int            interval;
+    unsigned int            frame_index;
+    int                     next_request;   // Slots are used round-robin, so they complete in order
+    int                     next_ready;
+    ImPlatform_CaptureSlot  slots[IMPLATFORM_CAPTURE_SLOTS];
+    unsigned char*          frame;          // I420 planes, worker thread only
+    std::thread*            thread;
+    std::mutex              mutex;
+    std::condition_variable wake;
+    bool                    quit;           // Guarded by mutex
+    std::atomic<unsigned int> written;
+    std::atomic<unsigned int> dropped;
+};
+static ImPlatform_CaptureState g_Capture;
+
+// ============================================================================
+// Worker thread
+// ============================================================================
+
+static bool ImPlatform_Capture_WriteFrame(const ImPlatform_CaptureSlot* slot)
+{
+    const unsigned int w = g_Capture.width, h = g_Capture.height;
+    const size_t luma = (size_t)w * h;
+    unsigned char* y = g_Capture.frame;
+    unsigned char* u = y + luma;
+    unsigned char* v = u + luma / 4;
+
+    // Textures copied from the GL default framebuffer are bottom-up
+    const unsigned char* src = slot->pixels;
+    ptrdiff_t pitch = (ptrdiff_t)slot->row_pitch;
+#if IM_CURRENT_GFX == IM_GFX_OPENGL3
+    src += (ptrdiff_t)(h - 1) * pitch;
+    pitch = -pitch;
+#endif
+    for (unsigned int row = 0; row < h; row += 2)
+        ImPlatform_Convert_RGBA8ToI420(y + (size_t)row * w, y + (size_t)(row + 1) * w,
+                                       u + (size_t)(row / 2) * (w / 2), v + (size_t)(row / 2) * (w / 2),
+                                       src + (ptrdiff_t)row * pitch, src + (ptrdiff_t)(row + 1) * pitch, w);
+
+    if (g_Capture.format == ImPlatform_CaptureFormat_Y4M && fputs("FRAME\n", g_Capture.file) < 0)
+        return false;
+    return fwrite(g_Capture.frame, 1, luma + luma / 2, g_Capture.file) == luma + luma / 2;
+}
+
+static void ImPlatform_Capture_ThreadMain(void)
+{
+    for (int index = 0;; index = (index + 1) % IMPLATFORM_CAPTURE_SLOTS)
+    {
+        ImPlatform_CaptureSlot* slot = &g_Capture.slots[index];
+        {
+            std::unique_lock<std::mutex> lock(g_Capture.mutex);
+            g_Capture.wake.wait(lock, [slot] {
+                return g_Capture.quit || slot->state.load(std::memory_order_acquire) == ImPlatform_CaptureSlot_Writing;
+            });
+            // Frames are handed over in order: once this one isn't, nothing else is left to write
+            if (slot->state.load(std::memory_order_acquire) != ImPlatform_CaptureSlot_Writing)
+                return;
+        }
+        if (slot->pixels && ImPlatform_Capture_WriteFrame(slot))
+            g_Capture.written.fetch_add(1, std::memory_order_relaxed);
+        else
+            g_Capture.dropped.fetch_add(1, std::memory_order_relaxed);
+        slot->state.store(ImPlatform_CaptureSlot_Written, std::memory_order_release);
+    }
+}
+
+// ============================================================================
+// Render thread
+// ============================================================================
+
+// Release the readbacks the worker is done with and hand it those whose pixels arrived
+static void ImPlatform_Capture_Collect(void)
+{
+    for (int i = 0; i < IMPLATFORM_CAPTURE_SLOTS; i++)
+    {
+        ImPlatform_CaptureSlot* slot = &g_Capture.slots[i];
+        if (slot->state.load(std::memory_order_acquire) != ImPlatform_CaptureSlot_Written)
+            continue;
+        // The backend keeps the buffer: the next request of the same size re-arms it
+        ImPlatform_ReleaseReadback(slot->readback);
+        slot->readback = NULL;
+        slot->state.store(ImPlatform_CaptureSlot_Free, std::memory_order_relaxed);
+    }
+
+    bool handed = false;
+    for (;;)
+    {
+        ImPlatform_CaptureSlot* slot = &g_Capture.slots[g_Capture.next_ready];
+        if (slot->state.load(std::memory_order_relaxed) != ImPlatform_CaptureSlot_Reading ||
+            !ImPlatform_IsReadbackReady(slot->readback))
+            break;
+        slot->pixels = (const unsigned char*)ImPlatform_GetReadbackData(slot->readback, &slot->row_pitch);
+        {
+            std::lock_guard<std::mutex> lock(g_Capture.mutex);
+            slot->state.store(ImPlatform_CaptureSlot_Writing, std::memory_order_release);
+        }
+        g_Capture.next_ready = (g_Capture.next_ready + 1) % IMPLATFORM_CAPTURE_SLOTS;
+        handed = true;
+    }
+    if (handed)
+        g_Capture.wake.notify_one();
+}
+
+void ImPlatform_Capture_EndFrame(void)
+{
+    if (!g_Capture.active)
+        return;
+
+    ImPlatform_Capture_Collect();
+    if (g_Capture.frame_index++ % g_Capture.interval != 0)
+        return;
+
+    ImPlatform_CaptureSlot* slot = &g_Capture.slots[g_Capture.next_request];
+    if (slot->state.load(std::memory_order_acquire) != ImPlatform_CaptureSlot_Free ||
+        !ImPlatform_CopyBackbuffer(g_Capture.target))
+    {
+        g_Capture.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    slot->readback = ImPlatform_RequestReadback(g_Capture.target, 0, 0, 0, 0, NULL, NULL);
+    if (!slot->readback)
+    {
+        g_Capture.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    slot->pixels = NULL;
+    slot->state.store(ImPlatform_CaptureSlot_Reading, std::memory_order_relaxed);
+    g_Capture.next_request = (g_Capture.next_request + 1) % IMPLATFORM_CAPTURE_SLOTS;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+IMPLATFORM_API bool ImPlatform_BeginCapture(const ImPlatform_CaptureDesc* desc)
+{
+    if (!desc || !desc->path || !desc->path[0] || g_Capture.active)
+        return false;
+
+    // I420 subsamples chroma 2x2
+    unsigned int width = 0, height = 0;
+    ImPlatform_GetBackbufferSize(&width, &height);
+    width &= ~1u;
+    height &= ~1u;
+    if (width == 0 || height == 0)
+        return false;
+
+    ImPlatform_TextureDesc tex_desc = ImPlatform_TextureDesc_Default(width, height);
+    ImTextureID target = ImPlatform_CreateRenderTexture(&tex_desc);
+    if (!target)
+        return false;
+
+    // Backends without asynchronous readback refuse any request
+    ImPlatform_Readback probe = ImPlatform_RequestReadback(target, 0, 0, 1, 1, NULL, NULL);
+    if (!probe)
+    {
+        ImPlatform_DestroyTexture(target);
+        return false;
+    }
+    ImPlatform_ReleaseReadback(probe);
+
+    const bool is_pipe = desc->path[0] == '|';
+    FILE* file = is_pipe ? IMPLATFORM_CAPTURE_POPEN(desc->path + 1) : fopen(desc->path, "wb");
+    unsigned char* frame = (unsigned char*)malloc((size_t)width * height * 3 / 2);
+    if (!file || !frame)
+    {
+        if (file && is_pipe)
+            IMPLATFORM_CAPTURE_PCLOSE(file);
+        else if (file)
+            fclose(file);
+        free(frame);
+        ImPlatform_DestroyTexture(target);
+        return false;
+    }
+
+    g_Capture.interval = desc->frame_interval ? desc->frame_interval : 1;
+    if (desc->format == ImPlatform_CaptureFormat_Y4M)
+    {
+        unsigned int fps_num = desc->fps_num ? desc->fps_num : 60;
+        unsigned int fps_den = desc->fps_num ? (desc->fps_den ? desc->fps_den : 1) : g_Capture.interval;
+        fprintf(file, "YUV4MPEG2 W%u H%u F%u:%u Ip A1:1 C420jpeg\n", width, height, fps_num, fps_den);
+    }
+
+    g_Capture.file         = file;
+    g_Capture.is_pipe      = is_pipe;
+    g_Capture.format       = desc->format;
+    g_Capture.target       = target;
+    g_Capture.width        = width;
+    g_Capture.height       = height;
+    g_Capture.frame_index  = 0;
+    g_Capture.next_request = 0;
+    g_Capture.next_ready   = 0;
+    g_Capture.frame        = frame;
+    g_Capture.quit         = false;
+    g_Capture.written.store(0, std::memory_order_relaxed);
+    g_Capture.dropped.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < IMPLATFORM_CAPTURE_SLOTS; i++)
+    {
+        g_Capture.slots[i].state.store(ImPlatform_CaptureSlot_Free, std::memory_order_relaxed);
+        g_Capture.slots[i].readback = NULL;
+    }
+    g_Capture.thread = new std::thread(ImPlatform_Capture_ThreadMain);
+    g_Capture.active = true;
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_EndCapture(void)
+{
+    if (!g_Capture.active)
+        return;
+
+    // Frames already on the CPU are written, the worker exits after the last one
+    ImPlatform_Capture_Collect();
+    {
+        std::lock_guard<std::mutex> lock(g_Capture.mutex);
+        g_Capture.quit = true;
+    }
+    g_Capture.wake.notify_one();
+    g_Capture.thread->join();
+    delete g_Capture.thread;
+    g_Capture.thread = NULL;
+
+    for (int i = 0; i < IMPLATFORM_CAPTURE_SLOTS; i++)
+    {
+        ImPlatform_CaptureSlot* slot = &g_Capture.slots[i];
+        if (slot->state.load(std::memory_order_relaxed) == ImPlatform_CaptureSlot_Reading)
+            g_Capture.dropped.fetch_add(1, std::memory_order_relaxed);
+        if (slot->readback)
+            ImPlatform_ReleaseReadback(slot->readback);
+        slot->readback = NULL;
+        slot->state.store(ImPlatform_CaptureSlot_Free, std::memory_order_relaxed);
+    }
+
+    if (g_Capture.is_pipe)
+        IMPLATFORM_CAPTURE_PCLOSE(g_Capture.file);
+    else
+        fclose(g_Capture.file);
+    g_Capture.file = NULL;
+    free(g_Capture.frame);
+    g_Capture.frame = NULL;
+    ImPlatform_DestroyTexture(g_Capture.target);
+    g_Capture.target = (ImTextureID)0;
+    g_Capture.active = false;
+}
+
+IMPLATFORM_API bool ImPlatform_IsCapturing(void)
+{
+    return g_Capture.active;
+}
+
+IMPLATFORM_API void ImPlatform_GetCaptureStats(unsigned int* frames_written, unsigned int* frames_dropped)
+{
+    if (frames_written)
+        *frames_written = g_Capture.written.load(std::memory_order_relaxed);
+    if (frames_dropped)
+        *frames_dropped = g_Capture.dropped.load(std::memory_order_relaxed);
+}
+
+#else
+
+void ImPlatform_Capture_EndFrame(void)
+{
+}
+
+IMPLATFORM_API bool ImPlatform_BeginCapture(const ImPlatform_CaptureDesc* /*desc*/)
+{
+    return false; // No worker thread
+}
+
+IMPLATFORM_API void ImPlatform_EndCapture(void)
+{
+}
+
+IMPLATFORM_API bool ImPlatform_IsCapturing(void)
+{
+    return false;
+}
+
+IMPLATFORM_API void ImPlatform_GetCaptureStats(unsigned int* frames_written, unsigned int* frames_dropped)
+{
+    if (frames_written)
+        *frames_written = 0;
+    if (frames_dropped)
+        *frames_dropped = 0;
+}
+
+#endif // IMPLATFORM_CAPTURE_THREADS
@@ -0,0 +1,1322 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Block-Compressed Textures
+// CPU decoders for BC1-7, ETC2 and ASTC 4x4 (LDR), and the RGBA8 fallback used by every graphics backend
+// when the device can't sample a compressed format.
+//
+// Decoding is per 4x4 block, straight into the destination rows: no intermediate copy of the
+// whole image besides the RGBA8 upload buffer itself.
+
+#include "ImPlatform_Internal.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static inline unsigned char ImPlatform_BC_Clamp255(int v)
+{
+    return (unsigned char)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+static inline void ImPlatform_BC_Expand565(unsigned int c, int* r, int* g, int* b)
+{
+    int r5 = (c >> 11) & 31, g6 = (c >> 5) & 63, b5 = c & 31;
+    *r = (r5 << 3) | (r5 >> 2);
+    *g = (g6 << 2) | (g6 >> 4);
+    *b = (b5 << 3) | (b5 >> 2);
+}
+
+// ============================================================================
+// BC1-BC5
+// ============================================================================
+// Blocks decode into a 4x4 RGBA8 tile (64 bytes, row-major).
+
+// BC1 color block. BC2/BC3 always use the 4-color mode.
+static void ImPlatform_BC_DecodeColor(const unsigned char* block, unsigned char* tile, bool allow_1bit_alpha)
+{
+    unsigned int c0 = block[0] | (block[1] << 8);
+    unsigned int c1 = block[2] | (block[3] << 8);
+    unsigned int bits = block[4] | (block[5] << 8) | (block[6] << 16) | ((unsigned int)block[7] << 24);
+
+    int r[4], g[4], b[4], a[4] = { 255, 255, 255, 255 };
+    ImPlatform_BC_Expand565(c0, &r[0], &g[0], &b[0]);
+    ImPlatform_BC_Expand565(c1, &r[1], &g[1], &b[1]);
+    if (c0 > c1 || !allow_1bit_alpha)
+    {
+        r[2] = (2 * r[0] + r[1]) / 3; g[2] = (2 * g[0] + g[1]) / 3; b[2] = (2 * b[0] + b[1]) / 3;
+        r[3] = (r[0] + 2 * r[1]) / 3; g[3] = (g[0] + 2 * g[1]) / 3; b[3] = (b[0] + 2 * b[1]) / 3;
+    }
+    else
+    {
+        r[2] = (r[0] + r[1]) / 2; g[2] = (g[0] + g[1]) / 2; b[2] = (b[0] + b[1]) / 2;
+        r[3] = g[3] = b[3] = a[3] = 0;
+    }
+
+    for (int i = 0; i < 16; i++, bits >>= 2)
+    {
+        unsigned int idx = bits & 3;
+        tile[i * 4 + 0] = (unsigned char)r[idx];
+        tile[i * 4 + 1] = (unsigned char)g[idx];
+        tile[i * 4 + 2] = (unsigned char)b[idx];
+        tile[i * 4 + 3] = (unsigned char)a[idx];
+    }
+}
+
+// BC3 alpha / BC4 / BC5 channel block, written to byte `channel` of each texel
+static void ImPlatform_BC_DecodeChannel(const unsigned char* block, unsigned char* tile, int channel)
+{
+    int v[8];
+    v[0] = block[0];
+    v[1] = block[1];
+    if (v[0] > v[1])
+    {
+        for (int i = 1; i < 7; i++)
+            v[i + 1] = ((7 - i) * v[0] + i * v[1]) / 7;
+    }
+    else
+    {
+        for (int i = 1; i < 5; i++)
+            v[i + 1] = ((5 - i) * v[0] + i * v[1]) / 5;
+        v[6] = 0;
+        v[7] = 255;
+    }
+
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; i++)
+        bits |= (uint64_t)block[2 + i] << (8 * i);
+    for (int i = 0; i < 16; i++, bits >>= 3)
+        tile[i * 4 + channel] = (unsigned char)v[bits & 7];
+}
+
+// BC2 explicit 4-bit alpha
+static void ImPlatform_BC_DecodeExplicitAlpha(const unsigned char* block, unsigned char* tile)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        int a4 = (block[i >> 1] >> ((i & 1) * 4)) & 15;
+        tile[i * 4 + 3] = (unsigned char)(a4 * 17);
+    }
+}
+
+// ============================================================================
+// BC7
+// ============================================================================
+
+struct ImPlatform_BC7Mode { unsigned char subsets, partition_bits, rotation_bits, index_sel_bits, color_bits, alpha_bits, endpoint_pbits, shared_pbits, index_bits, index_bits2; };
+static const ImPlatform_BC7Mode g_BC7Modes[8] =
+{
+    { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+    { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+    { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+    { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+    { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+    { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+    { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+    { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+};
+
+// Subset of each texel, bit i (2 subsets) / bits 2i..2i+1 (3 subsets) for texel i
+static const uint16_t g_BC7Partitions2[64] =
+{
+    0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80,
+    0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8, 0xff00, 0xfff0, 0xf000,
+    0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce,
+    0x088c, 0x3110, 0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c,
+    0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696, 0xa55a,
+    0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660,
+    0x0272, 0x04e4, 0x4e40, 0x2720, 0xc936, 0x936c, 0x39c6, 0x639c,
+    0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22,
+};
+static const uint32_t g_BC7Partitions3[64] =
+{
+    0xaa685050, 0x6a5a5040, 0x5a5a4200, 0x5450a0a8, 0xa5a50000, 0xa0a05050, 0x5555a0a0, 0x5a5a5050,
+    0xaa550000, 0xaa555500, 0xaaaa5500, 0x90909090, 0x94949494, 0xa4a4a4a4, 0xa9a59450, 0x2a0a4250,
+    0xa5945040, 0x0a425054, 0xa5a5a500, 0x55a0a0a0, 0xa8a85454, 0x6a6a4040, 0xa4a45000, 0x1a1a0500,
+    0x0050a4a4, 0xaaa59090, 0x14696914, 0x69691400, 0xa08585a0, 0xaa821414, 0x50a4a450, 0x6a5a0200,
+    0xa9a58000, 0x5090a0a8, 0xa8a09050, 0x24242424, 0x00aa5500, 0x24924924, 0x24499224, 0x50a50a50,
+    0x500aa550, 0xaaaa4444, 0x66660000, 0xa5a0a5a0, 0x50a050a0, 0x69286928, 0x44aaaa44, 0x66666600,
+    0xaa444444, 0x54a854a8, 0x95809580, 0x96969600, 0xa85454a8, 0x80959580, 0xaa141414, 0x96960000,
+    0xaaaa1414, 0xa05050a0, 0xa0a5a5a0, 0x96000000, 0x40804080, 0xa9a8a9a8, 0xaaaaaa44, 0x2a4a5254,
+};
+
+// Anchor texel of subset 1 (2 subsets), of subsets 1 and 2 (3 subsets). Subset 0 is anchored at texel 0.
+static const unsigned char g_BC7Anchor2[64] =
+{
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+     6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15,
+};
+static const unsigned char g_BC7Anchor3a[64] =
+{
+     3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+     3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+     8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+     3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3,
+};
+static const unsigned char g_BC7Anchor3b[64] =
+{
+    15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+    15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+    15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+    15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8,
+};
+
+static const unsigned char g_BC7Weights2[4]  = { 0, 21, 43, 64 };
+static const unsigned char g_BC7Weights3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const unsigned char g_BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+struct ImPlatform_BC7Bits
+{
+    uint64_t lo, hi;
+    unsigned int pos;
+};
+
+static inline unsigned int ImPlatform_BC7_Read(ImPlatform_BC7Bits* b, unsigned int count)
+{
+    if (count == 0)
+        return 0;
+    unsigned int v;
+    if (b->pos >= 64)
+        v = (unsigned int)(b->hi >> (b->pos - 64));
+    else if (b->pos + count <= 64)
+        v = (unsigned int)(b->lo >> b->pos);
+    else
+        v = (unsigned int)((b->lo >> b->pos) | (b->hi << (64 - b->pos)));
+    b->pos += count;
+    return v & ((1u << count) - 1);
+}
+
+static inline int ImPlatform_BC7_Interpolate(int e0, int e1, unsigned int index, unsigned int index_bits)
+{
+    const unsigned char* w = index_bits == 2 ? g_BC7Weights2 : index_bits == 3 ? g_BC7Weights3 : g_BC7Weights4;
+    return ((64 - w[index]) * e0 + w[index] * e1 + 32) >> 6;
+}
+
+static void ImPlatform_BC7_Decode(const unsigned char* block, unsigned char* tile)
+{
+    ImPlatform_BC7Bits bits = {};
+    for (int i = 0; i < 8; i++)
+    {
+        bits.lo |= (uint64_t)block[i] << (8 * i);
+        bits.hi |= (uint64_t)block[8 + i] << (8 * i);
+    }
+
+    unsigned int mode = 0;
+    while (mode < 8 && !ImPlatform_BC7_Read(&bits, 1))
+        mode++;
+    if (mode == 8)
+    {
+        // Reserved mode: transparent black
+        memset(tile, 0, 64);
+        return;
+    }
+    const ImPlatform_BC7Mode& m = g_BC7Modes[mode];
+
+    unsigned int partition = ImPlatform_BC7_Read(&bits, m.partition_bits);
+    unsigned int rotation  = ImPlatform_BC7_Read(&bits, m.rotation_bits);
+    unsigned int index_sel = ImPlatform_BC7_Read(&bits, m.index_sel_bits);
+
+    // Endpoints: all R, then all G, then all B, then all A; two per subset
+    const int endpoint_count = m.subsets * 2;
+    int ep[6][4];
+    for (int c = 0; c < 3; c++)
+        for (int e = 0; e < endpoint_count; e++)
+            ep[e][c] = (int)ImPlatform_BC7_Read(&bits, m.color_bits);
+    for (int e = 0; e < endpoint_count; e++)
+        ep[e][3] = m.alpha_bits ? (int)ImPlatform_BC7_Read(&bits, m.alpha_bits) : 255;
+
+    // P-bits extend every component by one low bit
+    int pbits[6] = {};
+    const bool has_pbits = m.endpoint_pbits || m.shared_pbits;
+    if (m.endpoint_pbits)
+        for (int e = 0; e < endpoint_count; e++)
+            pbits[e] = (int)ImPlatform_BC7_Read(&bits, 1);
+    else if (m.shared_pbits)
+        for (int s = 0; s < m.subsets; s++)
+            pbits[s * 2] = pbits[s * 2 + 1] = (int)ImPlatform_BC7_Read(&bits, 1);
+
+    // Unquantize to 8 bits
+    for (int e = 0; e < endpoint_count; e++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            int prec = c < 3 ? m.color_bits : m.alpha_bits;
+            if (prec == 0)
+                continue;
+            int v = ep[e][c];
+            if (has_pbits)
+            {
+                v = (v << 1) | pbits[e];
+                prec++;
+            }
+            v <<= 8 - prec;
+            ep[e][c] = v | (v >> prec);
+        }
+    }
+
+    // Index streams; anchor texels carry one bit less
+    unsigned int subset_of[16];
+    unsigned int anchor1 = 0, anchor2 = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        if (m.subsets == 2)
+            subset_of[i] = (g_BC7Partitions2[partition] >> i) & 1;
+        else if (m.subsets == 3)
+            subset_of[i] = (g_BC7Partitions3[partition] >> (2 * i)) & 3;
+        else
+            subset_of[i] = 0;
+    }
+    if (m.subsets == 2)
+        anchor1 = g_BC7Anchor2[partition];
+    else if (m.subsets == 3)
+    {
+        anchor1 = g_BC7Anchor3a[partition];
+        anchor2 = g_BC7Anchor3b[partition];
+    }
+
+    unsigned int index1[16], index2[16] = {};
+    for (unsigned int i = 0; i < 16; i++)
+    {
+        bool anchor = i == 0 || (m.subsets >= 2 && i == anchor1) || (m.subsets == 3 && i == anchor2);
+        index1[i] = ImPlatform_BC7_Read(&bits, m.index_bits - (anchor ? 1 : 0));
+    }
+    if (m.index_bits2)
+        for (unsigned int i = 0; i < 16; i++)
+            index2[i] = ImPlatform_BC7_Read(&bits, m.index_bits2 - (i == 0 ? 1 : 0));
+
+    for (int i = 0; i < 16; i++)
+    {
+        const int* e0 = ep[subset_of[i] * 2];
+        const int* e1 = ep[subset_of[i] * 2 + 1];
+        int rgba[4];
+        if (m.index_bits2)
+        {
+            // Modes 4/5: separate color and alpha indices, mode 4 can swap them
+            unsigned int ci = index_sel ? index2[i] : index1[i], cb = index_sel ? m.index_bits2 : m.index_bits;
+            unsigned int ai = index_sel ? index1[i] : index2[i], ab = index_sel ? m.index_bits : m.index_bits2;
+            for (int c = 0; c < 3; c++)
+                rgba[c] = ImPlatform_BC7_Interpolate(e0[c], e1[c], ci, cb);
+            rgba[3] = ImPlatform_BC7_Interpolate(e0[3], e1[3], ai, ab);
+        }
+        else
+        {
+            for (int c = 0; c < 4; c++)
+                rgba[c] = ImPlatform_BC7_Interpolate(e0[c], e1[c], index1[i], m.index_bits);
+        }
+        if (rotation)
+        {
+            int t = rgba[3];
+            rgba[3] = rgba[rotation - 1];
+            rgba[rotation - 1] = t;
+        }
+        for (int c = 0; c < 4; c++)
+            tile[i * 4 + c] = (unsigned char)rgba[c];
+    }
+}
+
+// ============================================================================
+// BC6H (unsigned)
+// ============================================================================
+// Endpoints are scattered over the mode's layout, one run of bits per entry below. The RGBA8
+// fallback has no HDR range: the half-float texels are clamped to [0, 1].
+
+enum
+{
+    IMPLATFORM_BC6H_RW, IMPLATFORM_BC6H_GW, IMPLATFORM_BC6H_BW,
+    IMPLATFORM_BC6H_RX, IMPLATFORM_BC6H_GX, IMPLATFORM_BC6H_BX,
+    IMPLATFORM_BC6H_RY, IMPLATFORM_BC6H_GY, IMPLATFORM_BC6H_BY,
+    IMPLATFORM_BC6H_RZ, IMPLATFORM_BC6H_GZ, IMPLATFORM_BC6H_BZ,
+};
+
+struct ImPlatform_BC6HRun { unsigned char field, shift, count; };   // `count` bits into bit `shift` of endpoint `field`
+struct ImPlatform_BC6HMode
+{
+    unsigned char regions, transformed, endpoint_bits, delta_bits[3];
+    ImPlatform_BC6HRun runs[24];
+};
+
+#define RW IMPLATFORM_BC6H_RW
+#define GW IMPLATFORM_BC6H_GW
+#define BW IMPLATFORM_BC6H_BW
+#define RX IMPLATFORM_BC6H_RX
+#define GX IMPLATFORM_BC6H_GX
+#define BX IMPLATFORM_BC6H_BX
+#define RY IMPLATFORM_BC6H_RY
+#define GY IMPLATFORM_BC6H_GY
+#define BY IMPLATFORM_BC6H_BY
+#define RZ IMPLATFORM_BC6H_RZ
+#define GZ IMPLATFORM_BC6H_GZ
+#define BZ IMPLATFORM_BC6H_BZ
+// Modes 1-14 in D3D order; runs follow the mode bits
+static const ImPlatform_BC6HMode g_BC6HModes[14] =
+{
+    { 2, 1, 10, { 5, 5, 5 }, { {GY,4,1},{BY,4,1},{BZ,4,1},{RW,0,10},{GW,0,10},{BW,0,10},{RX,0,5},{GZ,4,1},{GY,0,4},{GX,0,5},{BZ,0,1},{GZ,0,4},{BX,0,5},{BZ,1,1},{BY,0,4},{RY,0,5},{BZ,2,1},{RZ,0,5},{BZ,3,1} } },
+    { 2, 1, 7,  { 6, 6, 6 }, { {GY,5,1},{GZ,4,1},{GZ,5,1},{RW,0,7},{BZ,0,1},{BZ,1,1},{BY,4,1},{GW,0,7},{BY,5,1},{BZ,2,1},{GY,4,1},{BW,0,7},{BZ,3,1},{BZ,5,1},{BZ,4,1},{RX,0,6},{GY,0,4},{GX,0,6},{GZ,0,4},{BX,0,6},{BY,0,4},{RY,0,6},{RZ,0,6} } },
+    { 2, 1, 11, { 5, 4, 4 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,5},{RW,10,1},{GY,0,4},{GX,0,4},{GW,10,1},{BZ,0,1},{GZ,0,4},{BX,0,4},{BW,10,1},{BZ,1,1},{BY,0,4},{RY,0,5},{BZ,2,1},{RZ,0,5},{BZ,3,1} } },
+    { 2, 1, 11, { 4, 5, 4 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,4},{RW,10,1},{GZ,4,1},{GY,0,4},{GX,0,5},{GW,10,1},{GZ,0,4},{BX,0,4},{BW,10,1},{BZ,1,1},{BY,0,4},{RY,0,4},{BZ,0,1},{BZ,2,1},{RZ,0,4},{GY,4,1},{BZ,3,1} } },
+    { 2, 1, 11, { 4, 4, 5 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,4},{RW,10,1},{BY,4,1},{GY,0,4},{GX,0,4},{GW,10,1},{BZ,0,1},{GZ,0,4},{BX,0,5},{BW,10,1},{BY,0,4},{RY,0,4},{BZ,1,1},{BZ,2,1},{RZ,0,4},{BZ,4,1},{BZ,3,1} } },
+    { 2, 1, 9,  { 5, 5, 5 }, { {RW,0,9},{BY,4,1},{GW,0,9},{GY,4,1},{BW,0,9},{BZ,4,1},{RX,0,5},{GZ,4,1},{GY,0,4},{GX,0,5},{BZ,0,1},{GZ,0,4},{BX,0,5},{BZ,1,1},{BY,0,4},{RY,0,5},{BZ,2,1},{RZ,0,5},{BZ,3,1} } },
+    { 2, 1, 8,  { 6, 5, 5 }, { {RW,0,8},{GZ,4,1},{BY,4,1},{GW,0,8},{BZ,2,1},{GY,4,1},{BW,0,8},{BZ,3,1},{BZ,4,1},{RX,0,6},{GY,0,4},{GX,0,5},{BZ,0,1},{GZ,0,4},{BX,0,5},{BZ,1,1},{BY,0,4},{RY,0,6},{RZ,0,6} } },
+    { 2, 1, 8,  { 5, 6, 5 }, { {RW,0,8},{BZ,0,1},{BY,4,1},{GW,0,8},{GY,5,1},{GY,4,1},{BW,0,8},{GZ,5,1},{BZ,4,1},{RX,0,5},{GZ,4,1},{GY,0,4},{GX,0,6},{GZ,0,4},{BX,0,5},{BZ,1,1},{BY,0,4},{RY,0,5},{BZ,2,1},{RZ,0,5},{BZ,3,1} } },
+    { 2, 1, 8,  { 5, 5, 6 }, { {RW,0,8},{BZ,1,1},{BY,4,1},{GW,0,8},{BY,5,1},{GY,4,1},{BW,0,8},{BZ,5,1},{BZ,4,1},{RX,0,5},{GZ,4,1},{GY,0,4},{GX,0,5},{BZ,0,1},{GZ,0,4},{BX,0,6},{BY,0,4},{RY,0,5},{BZ,2,1},{RZ,0,5},{BZ,3,1} } },
+    { 2, 0, 6,  { 6, 6, 6 }, { {RW,0,6},{GZ,4,1},{BZ,0,1},{BZ,1,1},{BY,4,1},{GW,0,6},{GY,5,1},{BY,5,1},{BZ,2,1},{GY,4,1},{BW,0,6},{GZ,5,1},{BZ,3,1},{BZ,5,1},{BZ,4,1},{RX,0,6},{GY,0,4},{GX,0,6},{GZ,0,4},{BX,0,6},{BY,0,4},{RY,0,6},{RZ,0,6} } },
+    { 1, 0, 10, { 10, 10, 10 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,10},{GX,0,10},{BX,0,10} } },
+    { 1, 1, 11, { 9, 9, 9 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,9},{RW,10,1},{GX,0,9},{GW,10,1},{BX,0,9},{BW,10,1} } },
+    { 1, 1, 12, { 8, 8, 8 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,8},{RW,11,1},{RW,10,1},{GX,0,8},{GW,11,1},{GW,10,1},{BX,0,8},{BW,11,1},{BW,10,1} } },
+    { 1, 1, 16, { 4, 4, 4 }, { {RW,0,10},{GW,0,10},{BW,0,10},{RX,0,4},{RW,15,1},{RW,14,1},{RW,13,1},{RW,12,1},{RW,11,1},{RW,10,1},
+                               {GX,0,4},{GW,15,1},{GW,14,1},{GW,13,1},{GW,12,1},{GW,11,1},{GW,10,1},
+                               {BX,0,4},{BW,15,1},{BW,14,1},{BW,13,1},{BW,12,1},{BW,11,1},{BW,10,1} } },
+};
+#undef RW
+#undef GW
+#undef BW
+#undef RX
+#undef GX
+#undef BX
+#undef RY
+#undef GY
+#undef BY
+#undef RZ
+#undef GZ
+#undef BZ
+
+// Endpoint of `bits` bits -> 16-bit scale
+static inline int ImPlatform_BC6H_Unquantize(int v, int bits)
+{
+    if (bits >= 15)
+        return v;
+    if (v == 0)
+        return 0;
+    if (v == (1 << bits) - 1)
+        return 0xFFFF;
+    return ((v << 16) + 0x8000) >> bits;
+}
+
+// Unsigned half-float bits -> 0..255, clamped at 1.0
+static inline unsigned char ImPlatform_BC6H_HalfToUnorm8(int h)
+{
+    if (h >= 0x3C00)
+        return 255;
+    const int exponent = h >> 10, mantissa = h & 0x3FF;
+    const float f = exponent ? ldexpf((float)(mantissa | 0x400), exponent - 25) : ldexpf((float)mantissa, -24);
+    return (unsigned char)(f * 255.0f + 0.5f);
+}
+
+static void ImPlatform_BC6H_Decode(const unsigned char* block, unsigned char* tile)
+{
+    ImPlatform_BC7Bits bits = {};
+    for (int i = 0; i < 8; i++)
+    {
+        bits.lo |= (uint64_t)block[i] << (8 * i);
+        bits.hi |= (uint64_t)block[8 + i] << (8 * i);
+    }
+
+    // 2-bit modes 1-2, 5-bit modes 3-14; four 5-bit values are reserved
+    unsigned int mode = ImPlatform_BC7_Read(&bits, 2);
+    int index = (int)mode;
+    if (mode >= 2)
+    {
+        mode |= ImPlatform_BC7_Read(&bits, 3) << 2;
+        index = (mode & 3) == 2 ? 2 + (int)(mode >> 2) : (mode >> 2) < 4 ? 10 + (int)(mode >> 2) : -1;
+    }
+    if (index < 0)
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            tile[i * 4 + 0] = tile[i * 4 + 1] = tile[i * 4 + 2] = 0;
+            tile[i * 4 + 3] = 255;
+        }
+        return;
+    }
+    const ImPlatform_BC6HMode& m = g_BC6HModes[index];
+
+    int ep[4][3] = {};   // w, x, y, z
+    for (int r = 0; r < 24 && m.runs[r].count; r++)
+        ep[m.runs[r].field / 3][m.runs[r].field % 3] |= (int)ImPlatform_BC7_Read(&bits, m.runs[r].count) << m.runs[r].shift;
+    const unsigned int partition = m.regions == 2 ? ImPlatform_BC7_Read(&bits, 5) : 0;
+
+    // Transformed modes store x, y, z as signed deltas from w
+    const int endpoint_count = m.regions * 2;
+    if (m.transformed)
+    {
+        const int mask = (1 << m.endpoint_bits) - 1;
+        for (int e = 1; e < endpoint_count; e++)
+            for (int c = 0; c < 3; c++)
+            {
+                const int sign = 1 << (m.delta_bits[c] - 1);
+                ep[e][c] = (ep[0][c] + ((ep[e][c] ^ sign) - sign)) & mask;
+            }
+    }
+    for (int e = 0; e < endpoint_count; e++)
+        for (int c = 0; c < 3; c++)
+            ep[e][c] = ImPlatform_BC6H_Unquantize(ep[e][c], m.endpoint_bits);
+
+    // Indices: 3 bits with two regions, 4 with one; anchor texels carry one bit less
+    const unsigned int index_bits = m.regions == 2 ? 3 : 4;
+    const unsigned int anchor1 = m.regions == 2 ? g_BC7Anchor2[partition] : 0;
+    for (unsigned int i = 0; i < 16; i++)
+    {
+        const bool anchor = i == 0 || (m.regions == 2 && i == anchor1);
+        const unsigned int idx = ImPlatform_BC7_Read(&bits, index_bits - (anchor ? 1 : 0));
+        const unsigned int region = m.regions == 2 ? (g_BC7Partitions2[partition] >> i) & 1 : 0;
+        for (int c = 0; c < 3; c++)
+        {
+            const int v = ImPlatform_BC7_Interpolate(ep[region * 2][c], ep[region * 2 + 1][c], idx, index_bits);
+            tile[i * 4 + c] = ImPlatform_BC6H_HalfToUnorm8((v * 31) >> 6);
+        }
+        tile[i * 4 + 3] = 255;
+    }
+}
+
+// ============================================================================
+// ETC2 / EAC
+// ============================================================================
+// Blocks are big-endian; texel indices run down the columns (index = x * 4 + y).
+
+static const int g_ETC1Modifiers[8][2] =
+{
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+};
+static const int g_ETC2Distances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+static const int g_EACModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 }, { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 }, { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 }, { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 }, { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 }, { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 }, { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 }, { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+static inline void ImPlatform_ETC_SetTexel(unsigned char* tile, int x, int y, int r, int g, int b)
+{
+    unsigned char* t = tile + (y * 4 + x) * 4;
+    t[0] = ImPlatform_BC_Clamp255(r);
+    t[1] = ImPlatform_BC_Clamp255(g);
+    t[2] = ImPlatform_BC_Clamp255(b);
+    t[3] = 255;
+}
+
+static void ImPlatform_ETC2_DecodeRGB(const unsigned char* block, unsigned char* tile)
+{
+    const unsigned int msbs = (block[4] << 8) | block[5];
+    const unsigned int lsbs = (block[6] << 8) | block[7];
+    const bool diff = (block[3] & 2) != 0;
+
+    int r1, g1, b1, r2, g2, b2;
+    if (diff)
+    {
+        int rb = block[0] >> 3, gb = block[1] >> 3, bb = block[2] >> 3;
+        int rd = ((int)(block[0] & 7) ^ 4) - 4, gd = ((int)(block[1] & 7) ^ 4) - 4, bd = ((int)(block[2] & 7) ^ 4) - 4;
+
+        if (rb + rd < 0 || rb + rd > 31)
+        {
+            // T mode
+            int c[2][3] =
+            {
+                { (((block[0] >> 3) & 3) << 2) | (block[0] & 3), block[1] >> 4, block[1] & 15 },
+                { block[2] >> 4, block[2] & 15, block[3] >> 4 },
+            };
+            for (int i = 0; i < 2; i++)
+                for (int k = 0; k < 3; k++)
+                    c[i][k] *= 17;
+            int d = g_ETC2Distances[(((block[3] >> 2) & 3) << 1) | (block[3] & 1)];
+            int paint[4][3] =
+            {
+                { c[0][0], c[0][1], c[0][2] },
+                { c[1][0] + d, c[1][1] + d, c[1][2] + d },
+                { c[1][0], c[1][1], c[1][2] },
+                { c[1][0] - d, c[1][1] - d, c[1][2] - d },
+            };
+            for (int p = 0; p < 16; p++)
+            {
+                int idx = (((msbs >> p) & 1) << 1) | ((lsbs >> p) & 1);
+                ImPlatform_ETC_SetTexel(tile, p >> 2, p & 3, paint[idx][0], paint[idx][1], paint[idx][2]);
+            }
+            return;
+        }
+        if (gb + gd < 0 || gb + gd > 31)
+        {
+            // H mode
+            int c[2][3] =
+            {
+                { (block[0] >> 3) & 15, ((block[0] & 7) << 1) | ((block[1] >> 4) & 1), (block[1] & 8) | ((block[1] & 3) << 1) | (block[2] >> 7) },
+                { (block[2] >> 3) & 15, ((block[2] & 7) << 1) | (block[3] >> 7), (block[3] >> 3) & 15 },
+            };
+            int v0 = (c[0][0] << 8) | (c[0][1] << 4) | c[0][2];
+            int v1 = (c[1][0] << 8) | (c[1][1] << 4) | c[1][2];
+            int d = g_ETC2Distances[(((block[3] >> 2) & 1) << 2) | ((block[3] & 1) << 1) | (v0 >= v1 ? 1 : 0)];
+            for (int i = 0; i < 2; i++)
+                for (int k = 0; k < 3; k++)
+                    c[i][k] *= 17;
+            int paint[4][3] =
+            {
+                { c[0][0] + d, c[0][1] + d, c[0][2] + d },
+                { c[0][0] - d, c[0][1] - d, c[0][2] - d },
+                { c[1][0] + d, c[1][1] + d, c[1][2] + d },
+                { c[1][0] - d, c[1][1] - d, c[1][2] - d },
+            };
+            for (int p = 0; p < 16; p++)
+            {
+                int idx = (((msbs >> p) & 1) << 1) | ((lsbs >> p) & 1);
+                ImPlatform_ETC_SetTexel(tile, p >> 2, p & 3, paint[idx][0], paint[idx][1], paint[idx][2]);
+            }
+            return;
+        }
+        if (bb + bd < 0 || bb + bd > 31)
+        {
+            // Planar mode: origin, horizontal and vertical colors, bilinear across the block
+            int ro = (block[0] >> 1) & 63;
+            int go = ((block[0] & 1) << 6) | ((block[1] >> 1) & 63);
+            int bo = ((block[1] & 1) << 5) | (((block[2] >> 3) & 3) << 3) | ((block[2] & 3) << 1) | (block[3] >> 7);
+            int rh = (((block[3] >> 2) & 31) << 1) | (block[3] & 1);
+            int gh = block[4] >> 1;
+            int bh = ((block[4] & 1) << 5) | (block[5] >> 3);
+            int rv = ((block[5] & 7) << 3) | (block[6] >> 5);
+            int gv = ((block[6] & 31) << 2) | (block[7] >> 6);
+            int bv = block[7] & 63;
+            ro = (ro << 2) | (ro >> 4); rh = (rh << 2) | (rh >> 4); rv = (rv << 2) | (rv >> 4);
+            go = (go << 1) | (go >> 6); gh = (gh << 1) | (gh >> 6); gv = (gv << 1) | (gv >> 6);
+            bo = (bo << 2) | (bo >> 4); bh = (bh << 2) | (bh >> 4); bv = (bv << 2) | (bv >> 4);
+            for (int y = 0; y < 4; y++)
+                for (int x = 0; x < 4; x++)
+                    ImPlatform_ETC_SetTexel(tile, x, y,
+                                            (x * (rh - ro) + y * (rv - ro) + 4 * ro + 2) >> 2,
+                                            (x * (gh - go) + y * (gv - go) + 4 * go + 2) >> 2,
+                                            (x * (bh - bo) + y * (bv - bo) + 4 * bo + 2) >> 2);
+            return;
+        }
+
+        // Differential mode
+        r1 = rb; g1 = gb; b1 = bb;
+        r2 = rb + rd; g2 = gb + gd; b2 = bb + bd;
+        r1 = (r1 << 3) | (r1 >> 2); g1 = (g1 << 3) | (g1 >> 2); b1 = (b1 << 3) | (b1 >> 2);
+        r2 = (r2 << 3) | (r2 >> 2); g2 = (g2 << 3) | (g2 >> 2); b2 = (b2 << 3) | (b2 >> 2);
+    }
+    else
+    {
+        // Individual mode
+        r1 = (block[0] >> 4) * 17; r2 = (block[0] & 15) * 17;
+        g1 = (block[1] >> 4) * 17; g2 = (block[1] & 15) * 17;
+        b1 = (block[2] >> 4) * 17; b2 = (block[2] & 15) * 17;
+    }
+
+    const int* mod1 = g_ETC1Modifiers[block[3] >> 5];
+    const int* mod2 = g_ETC1Modifiers[(block[3] >> 2) & 7];
+    const bool flip = (block[3] & 1) != 0;
+    for (int p = 0; p < 16; p++)
+    {
+        int x = p >> 2, y = p & 3;
+        bool second = flip ? y >= 2 : x >= 2;
+        int idx = (((msbs >> p) & 1) << 1) | ((lsbs >> p) & 1);
+        const int* mod = second ? mod2 : mod1;
+        int delta = (idx & 1) ? mod[1] : mod[0];
+        if (idx & 2)
+            delta = -delta;
+        if (second)
+            ImPlatform_ETC_SetTexel(tile, x, y, r2 + delta, g2 + delta, b2 + delta);
+        else
+            ImPlatform_ETC_SetTexel(tile, x, y, r1 + delta, g1 + delta, b1 + delta);
+    }
+}
+
+static void ImPlatform_EAC_DecodeAlpha(const unsigned char* block, unsigned char* tile)
+{
+    const int base = block[0];
+    const int multiplier = block[1] >> 4;
+    const int* mod = g_EACModifiers[block[1] & 15];
+    uint64_t bits = 0;
+    for (int i = 2; i < 8; i++)
+        bits = (bits << 8) | block[i];
+    for (int p = 0; p < 16; p++)
+    {
+        int idx = (int)((bits >> (45 - 3 * p)) & 7);
+        int x = p >> 2, y = p & 3;
+        tile[(y * 4 + x) * 4 + 3] = ImPlatform_BC_Clamp255(base + mod[idx] * multiplier);
+    }
+}
+
+// ============================================================================
+// ASTC (LDR, 4x4 footprint)
+// ============================================================================
+// Endpoint values are integer-sequence encoded (ISE) upwards from bit 17 (one partition) or
+// 29, the weight grid downwards from bit 127. Texels take the top 8 bits of the 16-bit
+// interpolation, like VK_EXT_astc_decode_mode with RGBA8. HDR endpoint modes, which LDR
+// devices don't decode either, and invalid blocks give the error color (magenta).
+
+struct ImPlatform_ASTCRange
+{
+    unsigned short levels;
+    unsigned char  trits, quints, bits;
+};
+
+// Every ISE range, smallest first
+static const ImPlatform_ASTCRange g_ASTCRanges[21] =
+{
+    {   2, 0, 0, 1 }, {   3, 1, 0, 0 }, {   4, 0, 0, 2 }, {   5, 0, 1, 0 }, {   6, 1, 0, 1 }, {   8, 0, 0, 3 },
+    {  10, 0, 1, 1 }, {  12, 1, 0, 2 }, {  16, 0, 0, 4 }, {  20, 0, 1, 2 }, {  24, 1, 0, 3 }, {  32, 0, 0, 5 },
+    {  40, 0, 1, 3 }, {  48, 1, 0, 4 }, {  64, 0, 0, 6 }, {  80, 0, 1, 4 }, {  96, 1, 0, 5 }, { 128, 0, 0, 7 },
+    { 160, 0, 1, 5 }, { 192, 1, 0, 6 }, { 256, 0, 0, 8 },
+};
+#define IMPLATFORM_ASTC_RANGE_6 4   // Smallest range allowed for endpoints
+
+static inline unsigned int ImPlatform_ASTC_Read(const unsigned char* block, unsigned int pos, unsigned int count)
+{
+    unsigned int v = 0;
+    for (unsigned int i = 0; i < count && pos + i < 128; i++)
+        v |= ((block[(pos + i) >> 3] >> ((pos + i) & 7)) & 1u) << i;
+    return v;
+}
+
+static inline unsigned int ImPlatform_ASTC_SequenceBits(const ImPlatform_ASTCRange& r, unsigned int count)
+{
+    return r.bits * count + (r.trits ? (8 * count + 4) / 5 : r.quints ? (7 * count + 2) / 3 : 0);
+}
+
+// 8 packed bits -> 5 trits
+static void ImPlatform_ASTC_UnpackTrits(unsigned int T, unsigned int* t)
+{
+    unsigned int C;
+    if (((T >> 2) & 7) == 7)
+    {
+        C = (((T >> 5) & 7) << 2) | (T & 3);
+        t[4] = t[3] = 2;
+    }
+    else
+    {
+        C = T & 0x1F;
+        if (((T >> 5) & 3) == 3) { t[4] = 2; t[3] = (T >> 7) & 1; }
+        else                     { t[4] = (T >> 7) & 1; t[3] = (T >> 5) & 3; }
+    }
+    if ((C & 3) == 3)             { t[2] = 2; t[1] = (C >> 4) & 1; t[0] = (((C >> 3) & 1) << 1) | ((C >> 2) & ~(C >> 3) & 1); }
+    else if (((C >> 2) & 3) == 3) { t[2] = 2; t[1] = 2; t[0] = C & 3; }
+    else                          { t[2] = (C >> 4) & 1; t[1] = (C >> 2) & 3; t[0] = (C & 2) | (C & ~(C >> 1) & 1); }
+}
+
+// 7 packed bits -> 3 quints
+static void ImPlatform_ASTC_UnpackQuints(unsigned int Q, unsigned int* q)
+{
+    if (((Q >> 1) & 3) == 3 && ((Q >> 5) & 3) == 0)
+    {
+        q[2] = ((Q & 1) << 2) | (((Q >> 4) & ~Q & 1) << 1) | ((Q >> 3) & ~Q & 1);
+        q[1] = q[0] = 4;
+        return;
+    }
+    unsigned int C;
+    if (((Q >> 1) & 3) == 3) { q[2] = 4; C = (((Q >> 3) & 3) << 3) | ((~(Q >> 5) & 3) << 1) | (Q & 1); }
+    else                     { q[2] = (Q >> 5) & 3; C = Q & 0x1F; }
+    if ((C & 7) == 5) { q[1] = 4; q[0] = (C >> 3) & 3; }
+    else              { q[1] = (C >> 3) & 3; q[0] = C & 7; }
+}
+
+// Reads `count` values of range `r` starting at bit `pos`. Groups of 5 trit values (3 quint values)
+// pack their digits in 8 (7) bits spread after each value's low bits; a short last group reads zeros.
+static void ImPlatform_ASTC_ReadSequence(const unsigned char* block, unsigned int pos, const ImPlatform_ASTCRange& r,
+                                         unsigned int count, unsigned int* out)
+{
+    static const unsigned char trit_share[5]  = { 2, 2, 1, 2, 1 };
+    static const unsigned char quint_share[3] = { 3, 2, 2 };
+    const unsigned int n = r.bits;
+    const unsigned int group = r.trits ? 5 : r.quints ? 3 : 1;
+    for (unsigned int first = 0; first < count; first += group)
+    {
+        unsigned int low[5], packed = 0, packed_bits = 0, digits[5] = {};
+        const unsigned int values = count - first < group ? count - first : group;
+        for (unsigned int i = 0; i < values; i++)
+        {
+            low[i] = ImPlatform_ASTC_Read(block, pos, n);
+            pos += n;
+            const unsigned int share = r.trits ? trit_share[i] : r.quints ? quint_share[i] : 0;
+            packed |= ImPlatform_ASTC_Read(block, pos, share) << packed_bits;
+            pos += share;
+            packed_bits += share;
+        }
+        if (r.trits)
+            ImPlatform_ASTC_UnpackTrits(packed, digits);
+        else if (r.quints)
+            ImPlatform_ASTC_UnpackQuints(packed, digits);
+        for (unsigned int i = 0; i < values; i++)
+            out[first + i] = (digits[i] << n) | low[i];
+    }
+}
+
+static inline int ImPlatform_ASTC_Replicate(unsigned int v, unsigned int bits, unsigned int to_bits)
+{
+    int result = 0;
+    for (int shift = (int)to_bits - (int)bits; shift > -(int)bits; shift -= (int)bits)
+        result |= shift >= 0 ? (int)(v << shift) : (int)(v >> -shift);
+    return result;
+}
+
+// Endpoint value -> 0..255
+static int ImPlatform_ASTC_UnquantizeColor(unsigned int v, const ImPlatform_ASTCRange& r)
+{
+    const unsigned int n = r.bits;
+    if (!r.trits && !r.quints)
+        return ImPlatform_ASTC_Replicate(v, n, 8);
+
+    // The digit scaled by C, scrambled with the low bits (B) and mirrored by the lowest bit (A)
+    const unsigned int m = v & ((1u << n) - 1), D = v >> n;
+    const unsigned int A = (m & 1) ? 0x1FF : 0;
+    const unsigned int b = (m >> 1) & 1, cb = (m >> 1) & 3, dcb = (m >> 1) & 7, edcb = (m >> 1) & 15, fedcb = (m >> 1) & 31;
+    unsigned int B = 0, C;
+    if (r.trits)
+    {
+        switch (n)
+        {
+        case 1:  C = 204; break;
+        case 2:  C = 93;  B = b * 0x116; break;
+        case 3:  C = 44;  B = (cb >> 1) * 0x10A + (cb & 1) * 0x85; break;
+        case 4:  C = 22;  B = dcb * 0x41; break;
+        case 5:  C = 11;  B = (edcb << 5) | (edcb >> 2); break;
+        default: C = 5;   B = (fedcb << 4) | (fedcb >> 4); break;
+        }
+    }
+    else
+    {
+        switch (n)
+        {
+        case 1:  C = 113; break;
+        case 2:  C = 54;  B = b * 0x10C; break;
+        case 3:  C = 26;  B = (cb << 7) | (cb << 1) | (cb >> 1); break;
+        case 4:  C = 13;  B = (dcb << 6) | (dcb >> 1); break;
+        default: C = 6;   B = (edcb << 5) | (edcb >> 3); break;
+        }
+    }
+    const unsigned int T = ((D * C + B) ^ A) & 0x1FF;
+    return (int)((A & 0x80) | (T >> 2));
+}
+
+// Weight value -> 0..64
+static int ImPlatform_ASTC_UnquantizeWeight(unsigned int v, const ImPlatform_ASTCRange& r)
+{
+    static const unsigned char trit_values[3]  = { 0, 32, 63 };
+    static const unsigned char quint_values[5] = { 0, 16, 32, 47, 63 };
+    const unsigned int n = r.bits;
+    unsigned int T;
+    if (!r.trits && !r.quints)
+        T = (unsigned int)ImPlatform_ASTC_Replicate(v, n, 6);
+    else if (n == 0)
+        T = r.trits ? trit_values[v] : quint_values[v];
+    else
+    {
+        const unsigned int m = v & ((1u << n) - 1), D = v >> n;
+        const unsigned int A = (m & 1) ? 0x7F : 0;
+        const unsigned int b = (m >> 1) & 1, cb = (m >> 1) & 3;
+        unsigned int B = 0, C;
+        if (r.trits)
+        {
+            switch (n)
+            {
+            case 1:  C = 50; break;
+            case 2:  C = 23; B = b * 0x45; break;
+            default: C = 11; B = (cb << 5) | cb; break;
+            }
+        }
+        else
+        {
+            C = n == 1 ? 28 : 13;
+            B = n == 1 ? 0 : b * 0x42;
+        }
+        T = (A & 0x20) | ((((D * C + B) ^ A) & 0x7F) >> 2);
+    }
+    return (int)(T > 32 ? T + 1 : T);
+}
+
+// Partition of texel (x, y) for a given seed (blocks under 31 texels hash doubled coordinates)
+static unsigned int ImPlatform_ASTC_SelectPartition(unsigned int seed, unsigned int x, unsigned int y, unsigned int partitions)
+{
+    x <<= 1;
+    y <<= 1;
+    seed += (partitions - 1) * 1024;
+    uint32_t rnum = seed;
+    rnum ^= rnum >> 15; rnum -= rnum << 17; rnum += rnum << 7; rnum += rnum << 4;
+    rnum ^= rnum >> 5;  rnum += rnum << 16; rnum ^= rnum >> 7; rnum ^= rnum >> 3;
+    rnum ^= rnum << 6;  rnum ^= rnum >> 17;
+
+    // Seeds 9-12 only weight z, always 0 in 2D
+    unsigned int s[8];
+    for (int i = 0; i < 8; i++)
+    {
+        s[i] = (rnum >> (4 * i)) & 0xF;
+        s[i] *= s[i];
+    }
+    unsigned int sh1, sh2;
+    if (seed & 1) { sh1 = (seed & 2) ? 4 : 5; sh2 = partitions == 3 ? 6 : 5; }
+    else          { sh1 = partitions == 3 ? 6 : 5; sh2 = (seed & 2) ? 4 : 5; }
+    for (int i = 0; i < 8; i++)
+        s[i] >>= (i & 1) ? sh2 : sh1;
+
+    unsigned int a = (s[0] * x + s[1] * y + (rnum >> 14)) & 0x3F;
+    unsigned int b = (s[2] * x + s[3] * y + (rnum >> 10)) & 0x3F;
+    unsigned int c = (s[4] * x + s[5] * y + (rnum >> 6)) & 0x3F;
+    unsigned int d = (s[6] * x + s[7] * y + (rnum >> 2)) & 0x3F;
+    if (partitions < 4) d = 0;
+    if (partitions < 3) c = 0;
+    if (a >= b && a >= c && a >= d) return 0;
+    if (b >= c && b >= d)           return 1;
+    if (c >= d)                     return 2;
+    return 3;
+}
+
+// Offset in the top 7 bits of `a` moves its low bit into the base `b`; offsets are signed 6-bit
+static inline void ImPlatform_ASTC_TransferBits(int* a, int* b)
+{
+    *b = (*b >> 1) | (*a & 0x80);
+    *a = (*a >> 1) & 0x3F;
+    if (*a & 0x20)
+        *a -= 0x40;
+}
+
+static inline void ImPlatform_ASTC_BlueContract(int* e)
+{
+    e[0] = (e[0] + e[2]) >> 1;
+    e[1] = (e[1] + e[2]) >> 1;
+}
+
+// Endpoint pair of an LDR color endpoint mode. False for the HDR modes.
+static bool ImPlatform_ASTC_DecodeEndpoints(unsigned int cem, int* v, int* e0, int* e1)
+{
+    switch (cem)
+    {
+    case 0: // Luminance
+        e0[0] = e0[1] = e0[2] = v[0]; e0[3] = 255;
+        e1[0] = e1[1] = e1[2] = v[1]; e1[3] = 255;
+        break;
+    case 1: // Luminance, base + offset
+    {
+        const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+        const int l1 = l0 + (v[1] & 0x3F);
+        e0[0] = e0[1] = e0[2] = l0; e0[3] = 255;
+        e1[0] = e1[1] = e1[2] = l1 < 255 ? l1 : 255; e1[3] = 255;
+        break;
+    }
+    case 4: // Luminance + alpha
+        e0[0] = e0[1] = e0[2] = v[0]; e0[3] = v[2];
+        e1[0] = e1[1] = e1[2] = v[1]; e1[3] = v[3];
+        break;
+    case 5: // Luminance + alpha, base + offset
+        ImPlatform_ASTC_TransferBits(&v[1], &v[0]);
+        ImPlatform_ASTC_TransferBits(&v[3], &v[2]);
+        e0[0] = e0[1] = e0[2] = v[0];        e0[3] = v[2];
+        e1[0] = e1[1] = e1[2] = v[0] + v[1]; e1[3] = v[2] + v[3];
+        break;
+    case 6:  // RGB, base + scale
+    case 10: // RGB, base + scale, plus two alphas
+        for (int c = 0; c < 3; c++)
+        {
+            e0[c] = (v[c] * v[3]) >> 8;
+            e1[c] = v[c];
+        }
+        e0[3] = cem == 10 ? v[4] : 255;
+        e1[3] = cem == 10 ? v[5] : 255;
+        break;
+    case 8:  // RGB
+    case 12: // RGBA
+    {
+        const bool rgba = cem == 12;
+        for (int c = 0; c < 4; c++)
+        {
+            e0[c] = c < 3 || rgba ? v[c * 2] : 255;
+            e1[c] = c < 3 || rgba ? v[c * 2 + 1] : 255;
+        }
+        if (v[1] + v[3] + v[5] < v[0] + v[2] + v[4])
+        {
+            // Swapped endpoints flag a blue-contracted pair
+            for (int c = 0; c < 4; c++) { int t = e0[c]; e0[c] = e1[c]; e1[c] = t; }
+            ImPlatform_ASTC_BlueContract(e0);
+            ImPlatform_ASTC_BlueContract(e1);
+        }
+        break;
+    }
+    case 9:  // RGB, base + offset
+    case 13: // RGBA, base + offset
+    {
+        const bool rgba = cem == 13;
+        for (int c = 0; c < (rgba ? 4 : 3); c++)
+            ImPlatform_ASTC_TransferBits(&v[c * 2 + 1], &v[c * 2]);
+        for (int c = 0; c < 4; c++)
+        {
+            e0[c] = c < 3 || rgba ? v[c * 2] : 255;
+            e1[c] = c < 3 || rgba ? v[c * 2] + v[c * 2 + 1] : 255;
+        }
+        if (v[1] + v[3] + v[5] < 0)
+        {
+            for (int c = 0; c < 4; c++) { int t = e0[c]; e0[c] = e1[c]; e1[c] = t; }
+            ImPlatform_ASTC_BlueContract(e0);
+            ImPlatform_ASTC_BlueContract(e1);
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+    for (int c = 0; c < 4; c++)
+    {
+        e0[c] = ImPlatform_BC_Clamp255(e0[c]);
+        e1[c] = ImPlatform_BC_Clamp255(e1[c]);
+    }
+    return true;
+}
+
+static void ImPlatform_ASTC_DecodeError(unsigned char* tile)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        tile[i * 4 + 0] = tile[i * 4 + 2] = tile[i * 4 + 3] = 255;
+        tile[i * 4 + 1] = 0;
+    }
+}
+
+static void ImPlatform_ASTC_Decode(const unsigned char* block, unsigned char* tile)
+{
+    const unsigned int mode = ImPlatform_ASTC_Read(block, 0, 11);
+
+    // Void-extent: one color, 16-bit UNORM components in the upper half
+    if ((mode & 0x1FF) == 0x1FC)
+    {
+        if (mode & 0x200)
+        {
+            ImPlatform_ASTC_DecodeError(tile); // HDR
+            return;
+        }
+        for (int c = 0; c < 4; c++)
+        {
+            const unsigned char value = (unsigned char)(ImPlatform_ASTC_Read(block, 64 + 16 * c, 16) >> 8);
+            for (int i = 0; i < 16; i++)
+                tile[i * 4 + c] = value;
+        }
+        return;
+    }
+
+    // Block mode: weight grid size, weight range, dual plane
+    unsigned int grid_w, grid_h, range, high = (mode >> 9) & 1, dual = (mode >> 10) & 1;
+    const unsigned int a = (mode >> 5) & 3, b = (mode >> 7) & 3;
+    if (mode & 3)
+    {
+        range = ((mode >> 4) & 1) | ((mode & 3) << 1);
+        switch ((mode >> 2) & 3)
+        {
+        case 0:  grid_w = b + 4; grid_h = a + 2; break;
+        case 1:  grid_w = b + 8; grid_h = a + 2; break;
+        case 2:  grid_w = a + 2; grid_h = b + 8; break;
+        default:
+            if (mode & 0x100) { grid_w = (b & 1) + 2; grid_h = a + 2; }
+            else              { grid_w = a + 2; grid_h = (b & 1) + 6; }
+            break;
+        }
+    }
+    else
+    {
+        range = ((mode >> 4) & 1) | (((mode >> 2) & 3) << 1);
+        switch (b)
+        {
+        case 0:  grid_w = 12; grid_h = a + 2; break;
+        case 1:  grid_w = a + 2; grid_h = 12; break;
+        case 2:  grid_w = a + 6; grid_h = ((mode >> 9) & 3) + 6; high = dual = 0; break;
+        default:
+            grid_w = a == 0 ? 6 : 10;
+            grid_h = a == 0 ? 10 : 6;
+            if (a > 1)
+                range = 0; // Reserved
+            break;
+        }
+    }
+
+    const unsigned int partitions = ImPlatform_ASTC_Read(block, 11, 2) + 1;
+    const unsigned int weight_count = grid_w * grid_h * (dual + 1);
+    if (range < 2 || grid_w > 4 || grid_h > 4 || (dual && partitions == 4))
+    {
+        ImPlatform_ASTC_DecodeError(tile);
+        return;
+    }
+    const ImPlatform_ASTCRange& weight_range = g_ASTCRanges[range - 2 + high * 6];
+    const unsigned int weight_bits = ImPlatform_ASTC_SequenceBits(weight_range, weight_count);
+    if (weight_bits < 24 || weight_bits > 96)
+    {
+        ImPlatform_ASTC_DecodeError(tile);
+        return;
+    }
+
+    // Color endpoint modes. With several partitions and different classes, the extra mode bits
+    // sit right below the weights, the dual plane component below those.
+    unsigned int cem[4] = {}, seed = 0, color_pos = 17, below_weights = 128 - weight_bits;
+    if (partitions == 1)
+    {
+        cem[0] = ImPlatform_ASTC_Read(block, 13, 4);
+    }
+    else
+    {
+        seed = ImPlatform_ASTC_Read(block, 13, 10);
+        color_pos = 29;
+        const unsigned int field = ImPlatform_ASTC_Read(block, 23, 6);
+        if ((field & 3) == 0)
+        {
+            for (unsigned int p = 0; p < partitions; p++)
+                cem[p] = field >> 2;
+        }
+        else
+        {
+            const unsigned int extra = 3 * partitions - 4;
+            below_weights -= extra;
+            const unsigned int bits = (field >> 2) | (ImPlatform_ASTC_Read(block, below_weights, extra) << 4);
+            const unsigned int base = (field & 3) - 1;
+            for (unsigned int p = 0; p < partitions; p++)
+                cem[p] = ((((bits >> p) & 1) + base) << 2) | ((bits >> (partitions + 2 * p)) & 3);
+        }
+    }
+    unsigned int plane2_component = 4;
+    if (dual)
+    {
+        below_weights -= 2;
+        plane2_component = ImPlatform_ASTC_Read(block, below_weights, 2);
+    }
+
+    // Endpoints use the largest range that fits between the modes and the weights
+    unsigned int value_count = 0;
+    for (unsigned int p = 0; p < partitions; p++)
+        value_count += ((cem[p] >> 2) + 1) * 2;
+    const int color_bits = (int)below_weights - (int)color_pos;
+    int color_range = -1;
+    for (int i = 20; i >= IMPLATFORM_ASTC_RANGE_6 && color_range < 0; i--)
+        if ((int)ImPlatform_ASTC_SequenceBits(g_ASTCRanges[i], value_count) <= color_bits)
+            color_range = i;
+    if (value_count > 18 || color_range < 0)
+    {
+        ImPlatform_ASTC_DecodeError(tile);
+        return;
+    }
+
+    unsigned int raw[64];
+    int values[18];
+    ImPlatform_ASTC_ReadSequence(block, color_pos, g_ASTCRanges[color_range], value_count, raw);
+    for (unsigned int i = 0; i < value_count; i++)
+        values[i] = ImPlatform_ASTC_UnquantizeColor(raw[i], g_ASTCRanges[color_range]);
+
+    int endpoints[4][2][4];
+    for (unsigned int p = 0, first = 0; p < partitions; first += ((cem[p] >> 2) + 1) * 2, p++)
+        if (!ImPlatform_ASTC_DecodeEndpoints(cem[p], values + first, endpoints[p][0], endpoints[p][1]))
+        {
+            ImPlatform_ASTC_DecodeError(tile);
+            return;
+        }
+
+    // Weights run from bit 127 down: read them from the bit-reversed block
+    unsigned char reversed[16];
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned int v = block[15 - i];
+        v = ((v & 0xF0) >> 4) | ((v & 0x0F) << 4);
+        v = ((v & 0xCC) >> 2) | ((v & 0x33) << 2);
+        v = ((v & 0xAA) >> 1) | ((v & 0x55) << 1);
+        reversed[i] = (unsigned char)v;
+    }
+    ImPlatform_ASTC_ReadSequence(reversed, 0, weight_range, weight_count, raw);
+
+    // Planes interleave; the padding covers the zero-weight neighbours of the last grid texels
+    int grid[2][16 + 5] = {};
+    for (unsigned int i = 0; i < weight_count; i++)
+        grid[i % (dual + 1)][i / (dual + 1)] = ImPlatform_ASTC_UnquantizeWeight(raw[i], weight_range);
+
+    for (unsigned int y = 0; y < 4; y++)
+    {
+        for (unsigned int x = 0; x < 4; x++)
+        {
+            // Bilinear infill of the grid onto the block (342 = 1024 / 3, rounded)
+            const unsigned int gs = (342 * x * (grid_w - 1) + 32) >> 6;
+            const unsigned int gt = (342 * y * (grid_h - 1) + 32) >> 6;
+            const unsigned int fs = gs & 0xF, ft = gt & 0xF;
+            const unsigned int w11 = (fs * ft + 8) >> 4, w10 = ft - w11, w01 = fs - w11, w00 = 16 - fs - ft + w11;
+            const unsigned int v0 = (gs >> 4) + (gt >> 4) * grid_w;
+            int weight[2];
+            for (int plane = 0; plane < 2; plane++)
+            {
+                const int* g = grid[plane];
+                weight[plane] = (int)((g[v0] * w00 + g[v0 + 1] * w01 + g[v0 + grid_w] * w10 + g[v0 + grid_w + 1] * w11 + 8) >> 4);
+            }
+
+            const unsigned int p = partitions > 1 ? ImPlatform_ASTC_SelectPartition(seed, x, y, partitions) : 0;
+            unsigned char* texel = tile + (y * 4 + x) * 4;
+            for (unsigned int c = 0; c < 4; c++)
+            {
+                const int w = c == plane2_component ? weight[1] : weight[0];
+                const int c0 = endpoints[p][0][c] * 257, c1 = endpoints[p][1][c] * 257;
+                texel[c] = (unsigned char)(((c0 * (64 - w) + c1 * w + 32) >> 6) >> 8);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Image decode
+// ============================================================================
+
+bool ImPlatform_DecodeCompressed(ImPlatform_PixelFormat format, const void* blocks, unsigned int width, unsigned int height,
+                                 void* dst_rgba8, size_t dst_pitch)
+{
+    const unsigned int block_bytes = ImPlatform_CompressedBlockBytes(format);
+    if (!block_bytes || !blocks || !dst_rgba8)
+        return false;
+
+    const unsigned char* src = (const unsigned char*)blocks;
+    unsigned char* dst = (unsigned char*)dst_rgba8;
+    const unsigned int blocks_x = (width + 3) / 4;
+    const unsigned int blocks_y = (height + 3) / 4;
+
+    unsigned char tile[64];
+    for (unsigned int by = 0; by < blocks_y; by++)
+    {
+        for (unsigned int bx = 0; bx < blocks_x; bx++, src += block_bytes)
+        {
+            switch (format)
+            {
+            case ImPlatform_PixelFormat_BC1:
+                ImPlatform_BC_DecodeColor(src, tile, true);
+                break;
+            case ImPlatform_PixelFormat_BC2:
+                ImPlatform_BC_DecodeColor(src + 8, tile, false);
+                ImPlatform_BC_DecodeExplicitAlpha(src, tile);
+                break;
+            case ImPlatform_PixelFormat_BC3:
+                ImPlatform_BC_DecodeColor(src + 8, tile, false);
+                ImPlatform_BC_DecodeChannel(src, tile, 3);
+                break;
+            case ImPlatform_PixelFormat_BC4:
+            case ImPlatform_PixelFormat_BC5:
+                for (int i = 0; i < 16; i++)
+                {
+                    tile[i * 4 + 1] = tile[i * 4 + 2] = 0;
+                    tile[i * 4 + 3] = 255;
+                }
+                ImPlatform_BC_DecodeChannel(src, tile, 0);
+                if (format == ImPlatform_PixelFormat_BC5)
+                    ImPlatform_BC_DecodeChannel(src + 8, tile, 1);
+                break;
+            case ImPlatform_PixelFormat_BC6H:
+                ImPlatform_BC6H_Decode(src, tile);
+                break;
+            case ImPlatform_PixelFormat_BC7:
+                ImPlatform_BC7_Decode(src, tile);
+                break;
+            case ImPlatform_PixelFormat_ETC2_RGB8:
+                ImPlatform_ETC2_DecodeRGB(src, tile);
+                break;
+            case ImPlatform_PixelFormat_ETC2_RGBA8:
+                ImPlatform_ETC2_DecodeRGB(src + 8, tile);
+                ImPlatform_EAC_DecodeAlpha(src, tile);
+                break;
+            case ImPlatform_PixelFormat_ASTC_4x4:
+                ImPlatform_ASTC_Decode(src, tile);
+                break;
+            default:
+                return false;
+            }
+
+            // Clip the tile against the right/bottom edge
+            const unsigned int x0 = bx * 4, y0 = by * 4;
+            const unsigned int w = width - x0 < 4 ? width - x0 : 4;
+            const unsigned int h = height - y0 < 4 ? height - y0 : 4;
+            for (unsigned int y = 0; y < h; y++)
+                memcpy(dst + (size_t)(y0 + y) * dst_pitch + (size_t)x0 * 4, tile + y * 16, w * 4);
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// RGBA8 fallback textures
+// ============================================================================
+
+struct ImPlatform_DecodedTexture
+{
+    ImTextureID              id;
+    ImPlatform_PixelFormat   format;
+    unsigned int             width, height;
+    ImPlatform_DecodedTexture* next;
+};
+static ImPlatform_DecodedTexture* g_DecodedTextures = NULL;
+static bool g_DecodedForwarding = false;   // Set while the decoded RGBA8 goes back through ImPlatform_UpdateTexture
+
+static ImPlatform_DecodedTexture* ImPlatform_FindDecodedTexture(ImTextureID texture_id)
+{
+    for (ImPlatform_DecodedTexture* e = g_DecodedTextures; e; e = e->next)
+        if (e->id == texture_id)
+            return e;
+    return NULL;
+}
+
+ImTextureID ImPlatform_CreateTexture_DecodeCompressed(const void* blocks, const ImPlatform_TextureDesc* desc)
+{
+    ImPlatform_TextureDesc d = *desc;
+    d.format = ImPlatform_PixelFormat_RGBA8;
+
+    // No blocks: uninitialized storage, where the backend supports it
+    unsigned char* rgba = NULL;
+    if (blocks)
+    {
+        rgba = (unsigned char*)malloc((size_t)desc->width * desc->height * 4);
+        if (!rgba)
+            return (ImTextureID)0;
+        ImPlatform_DecodeCompressed(desc->format, blocks, desc->width, desc->height, rgba, (size_t)desc->width * 4);
+    }
+    ImTextureID tex = ImPlatform_CreateTexture(rgba, &d);
+    free(rgba);
+    if (!tex)
+        return (ImTextureID)0;
+
+    ImPlatform_DecodedTexture* e = new ImPlatform_DecodedTexture();
+    e->id     = tex;
+    e->format = desc->format;
+    e->width  = desc->width;
+    e->height = desc->height;
+    e->next   = g_DecodedTextures;
+    g_DecodedTextures = e;
+    return tex;
+}
+
+bool ImPlatform_IsDecodedCompressedTexture(ImTextureID texture_id)
+{
+    return g_DecodedTextures && !g_DecodedForwarding && ImPlatform_FindDecodedTexture(texture_id) != NULL;
+}
+
+bool ImPlatform_UpdateTexture_DecodeCompressed(ImTextureID texture_id, const void* blocks,
+                                               unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+{
+    ImPlatform_DecodedTexture* e = ImPlatform_FindDecodedTexture(texture_id);
+    if (!e || !blocks || !ImPlatform_CompressedRegionValid(x, y, width, height, e->width, e->height))
+        return false;
+
+    unsigned char* rgba = (unsigned char*)malloc((size_t)width * height * 4);
+    if (!rgba)
+        return false;
+    ImPlatform_DecodeCompressed(e->format, blocks, width, height, rgba, (size_t)width * 4);
+    g_DecodedForwarding = true;
+    bool ok = ImPlatform_UpdateTexture(texture_id, rgba, x, y, width, height);
+    g_DecodedForwarding = false;
+    free(rgba);
+    return ok;
+}
+
+void ImPlatform_ForgetDecodedCompressedTexture(ImTextureID texture_id)
+{
+    for (ImPlatform_DecodedTexture** link = &g_DecodedTextures; *link; link = &(*link)->next)
+    {
+        if ((*link)->id == texture_id)
+        {
+            ImPlatform_DecodedTexture* e = *link;
+            *link = e->next;
+            delete e;
+            return;
+        }
+    }
+}
+
+#endif // IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
@@ -0,0 +1,663 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Pixel Conversion Kernels
+// CPU conversions for formats without a native GPU equivalent, shared by all graphics backends.
+//
+// Each kernel has a scalar reference plus SSE2 / AVX2 (+F16C) / NEON versions.
+// The widest instruction set supported by the running CPU is picked once, on first use.
+// Define IMPLATFORM_CONVERT_SCALAR_ONLY to compile the scalar kernels only.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(IMPLATFORM_CONVERT_SCALAR_ONLY)
+    #if defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+        #define IMPLATFORM_CONVERT_X86 1
+        #include <emmintrin.h>
+        #include <immintrin.h>
+        #if defined(_MSC_VER) && !defined(__clang__)
+            #include <intrin.h>
+            #define IMPLATFORM_TARGET_AVX2
+        #else
+            #define IMPLATFORM_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+        #endif
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define IMPLATFORM_CONVERT_NEON 1
+        #include <arm_neon.h>
+    #endif
+#endif
+
+// ============================================================================
+// Scalar reference kernels
+// ============================================================================
+
+static void ImPlatform_Convert_RGB8ToRGBA8_Scalar(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    for (size_t i = 0; i < count; i++, src += 3, dst += 4)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = 0xFF;
+    }
+}
+
+static void ImPlatform_Convert_SwizzleRB8_Scalar(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    for (size_t i = 0; i < count; i++, src += 4, dst += 4)
+    {
+        unsigned char r = src[0], b = src[2];
+        dst[0] = b;
+        dst[1] = src[1];
+        dst[2] = r;
+        dst[3] = src[3];
+    }
+}
+
+static void ImPlatform_Convert_F64ToF32_Scalar(float* dst, const double* src, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        dst[i] = (float)src[i];
+}
+
+// Round to nearest even; overflow gives infinity, NaN stays NaN (quiet)
+static inline ImU16 ImPlatform_FloatToHalf(float value)
+{
+    const uint32_t f16max       = (127 + 16) << 23;
+    const uint32_t f32infty     = 255u << 23;
+    const uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    uint32_t u;
+    memcpy(&u, &value, 4);
+    const uint32_t sign = u & 0x80000000u;
+    u ^= sign;
+
+    uint32_t h;
+    if (u >= f16max)
+    {
+        h = (u > f32infty) ? 0x7E00 : 0x7C00;
+    }
+    else if (u < (113u << 23))
+    {
+        // Subnormal half: let the FPU round by adding a magic number
+        float f, magic;
+        memcpy(&f, &u, 4);
+        memcpy(&magic, &denorm_magic, 4);
+        f += magic;
+        memcpy(&h, &f, 4);
+        h -= denorm_magic;
+    }
+    else
+    {
+        const uint32_t mant_odd = (u >> 13) & 1;
+        u += ((uint32_t)(15 - 127) << 23) + 0xFFF;
+        u += mant_odd;
+        h = u >> 13;
+    }
+    return (ImU16)(h | (sign >> 16));
+}
+
+static void ImPlatform_Convert_F32ToF16_Scalar(ImU16* dst, const float* src, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        dst[i] = ImPlatform_FloatToHalf(src[i]);
+}
+
+static void ImPlatform_Convert_U16ToF32_Scalar(float* dst, const ImU16* src, size_t count)
+{
+    const float scale = 1.0f / 65535.0f;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = (float)src[i] * scale;
+}
+
+static void ImPlatform_Convert_Planar8ToRGBA8_Scalar(unsigned char* dst, const unsigned char* r, const unsigned char* g,
+                                                     const unsigned char* b, const unsigned char* a, size_t count)
+{
+    for (size_t i = 0; i < count; i++, dst += 4)
+    {
+        dst[0] = r[i];
+        dst[1] = g[i];
+        dst[2] = b[i];
+        dst[3] = a ? a[i] : 0xFF;
+    }
+}
+
+// BT.601 limited range in 8.8 fixed point. The offsets are folded into the rounding bias:
+// (x + 128 + (16 << 8)) >> 8 == ((x + 128) >> 8) + 16, and the sum stays positive for SIMD.
+// Chroma takes the sum of a 2x2 block (4x the average), hence the 10-bit shift.
+#define IMPLATFORM_I420_Y_BIAS      (128 + (16 << 8))
+#define IMPLATFORM_I420_C_BIAS      (512 + (128 << 10))
+
+static void ImPlatform_Convert_RGBA8ToI420_Scalar(unsigned char* y0, unsigned char* y1, unsigned char* u, unsigned char* v,
+                                                  const unsigned char* row0, const unsigned char* row1, size_t count)
+{
+    for (size_t i = 0; i + 2 <= count; i += 2, row0 += 8, row1 += 8)
+    {
+        y0[i]     = (unsigned char)((66 * row0[0] + 129 * row0[1] + 25 * row0[2] + IMPLATFORM_I420_Y_BIAS) >> 8);
+        y0[i + 1] = (unsigned char)((66 * row0[4] + 129 * row0[5] + 25 * row0[6] + IMPLATFORM_I420_Y_BIAS) >> 8);
+        y1[i]     = (unsigned char)((66 * row1[0] + 129 * row1[1] + 25 * row1[2] + IMPLATFORM_I420_Y_BIAS) >> 8);
+        y1[i + 1] = (unsigned char)((66 * row1[4] + 129 * row1[5] + 25 * row1[6] + IMPLATFORM_I420_Y_BIAS) >> 8);
+        const int r = row0[0] + row0[4] + row1[0] + row1[4];
+        const int g = row0[1] + row0[5] + row1[1] + row1[5];
+        const int b = row0[2] + row0[6] + row1[2] + row1[6];
+        u[i / 2] = (unsigned char)((-38 * r -  74 * g + 112 * b + IMPLATFORM_I420_C_BIAS) >> 10);
+        v[i / 2] = (unsigned char)((112 * r -  94 * g -  18 * b + IMPLATFORM_I420_C_BIAS) >> 10);
+    }
+}
+
+// ============================================================================
+// SSE2 kernels (x86 baseline)
+// ============================================================================
+
+#if IMPLATFORM_CONVERT_X86
+
+static void ImPlatform_Convert_RGB8ToRGBA8_SSE2(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    // SSE2 has no byte shuffle: gather 4 pixels with overlapping 32-bit loads.
+    // Each load reads one byte past its pixel, so stop a pixel early.
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+    size_t i = 0;
+    for (; i + 5 <= count; i += 4, src += 12, dst += 16)
+    {
+        uint32_t p0, p1, p2, p3;
+        memcpy(&p0, src + 0, 4);
+        memcpy(&p1, src + 3, 4);
+        memcpy(&p2, src + 6, 4);
+        memcpy(&p3, src + 9, 4);
+        __m128i v = _mm_set_epi32((int)p3, (int)p2, (int)p1, (int)p0);
+        _mm_storeu_si128((__m128i*)dst, _mm_or_si128(v, alpha));
+    }
+    ImPlatform_Convert_RGB8ToRGBA8_Scalar(dst, src, count - i);
+}
+
+static void ImPlatform_Convert_SwizzleRB8_SSE2(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    const __m128i mask_ga = _mm_set1_epi32((int)0xFF00FF00);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4, src += 16, dst += 16)
+    {
+        __m128i v  = _mm_loadu_si128((const __m128i*)src);
+        __m128i ga = _mm_and_si128(v, mask_ga);
+        __m128i rb = _mm_andnot_si128(mask_ga, v);
+        rb = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+        _mm_storeu_si128((__m128i*)dst, _mm_or_si128(ga, rb));
+    }
+    ImPlatform_Convert_SwizzleRB8_Scalar(dst, src, count - i);
+}
+
+static void ImPlatform_Convert_F64ToF32_SSE2(float* dst, const double* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+    }
+    ImPlatform_Convert_F64ToF32_Scalar(dst + i, src + i, count - i);
+}
+
+// Vector form of ImPlatform_FloatToHalf (4 lanes, result in the low 16 bits of each lane, sign extended)
+static inline __m128i ImPlatform_FloatToHalf_SSE2(__m128 f)
+{
+    const __m128i f16max        = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i nan_bit       = _mm_set1_epi32(0x200);
+    const __m128i infinity_f16  = _mm_set1_epi32(0x7C00);
+    const __m128i min_normal    = _mm_set1_epi32((127 - 14) << 23);
+    const __m128i subnorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i normal_bias   = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+    __m128  sign       = _mm_and_ps(f, _mm_set1_ps(-0.0f));
+    __m128  absf       = _mm_xor_ps(f, sign);
+    __m128i absi       = _mm_castps_si128(absf);
+    __m128i is_regular = _mm_cmpgt_epi32(f16max, absi);
+    __m128i is_nan     = _mm_castps_si128(_mm_cmpunord_ps(absf, absf));
+    __m128i special    = _mm_or_si128(_mm_and_si128(is_nan, nan_bit), infinity_f16);
+    __m128i is_sub     = _mm_cmpgt_epi32(min_normal, absi);
+
+    __m128i subnormal  = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absf, _mm_castsi128_ps(subnorm_magic))), subnorm_magic);
+    __m128i mant_odd   = _mm_srai_epi32(_mm_slli_epi32(absi, 31 - 13), 31);
+    __m128i normal     = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absi, normal_bias), mant_odd), 13);
+
+    __m128i finite     = _mm_or_si128(_mm_and_si128(is_sub, subnormal), _mm_andnot_si128(is_sub, normal));
+    __m128i joined     = _mm_or_si128(_mm_and_si128(is_regular, finite), _mm_andnot_si128(is_regular, special));
+    return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+static void ImPlatform_Convert_F32ToF16_SSE2(ImU16* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i lo = ImPlatform_FloatToHalf_SSE2(_mm_loadu_ps(src + i));
+        __m128i hi = ImPlatform_FloatToHalf_SSE2(_mm_loadu_ps(src + i + 4));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(lo, hi));
+    }
+    ImPlatform_Convert_F32ToF16_Scalar(dst + i, src + i, count - i);
+}
+
+static void ImPlatform_Convert_U16ToF32_SSE2(float* dst, const ImU16* src, size_t count)
+{
+    const __m128  scale = _mm_set1_ps(1.0f / 65535.0f);
+    const __m128i zero  = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_ps(dst + i,     _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+    }
+    ImPlatform_Convert_U16ToF32_Scalar(dst + i, src + i, count - i);
+}
+
+static void ImPlatform_Convert_Planar8ToRGBA8_SSE2(unsigned char* dst, const unsigned char* r, const unsigned char* g,
+                                                   const unsigned char* b, const unsigned char* a, size_t count)
+{
+    const __m128i opaque = _mm_set1_epi8((char)0xFF);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i vr = _mm_loadu_si128((const __m128i*)(r + i));
+        __m128i vg = _mm_loadu_si128((const __m128i*)(g + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i va = a ? _mm_loadu_si128((const __m128i*)(a + i)) : opaque;
+        __m128i rg_lo = _mm_unpacklo_epi8(vr, vg), rg_hi = _mm_unpackhi_epi8(vr, vg);
+        __m128i ba_lo = _mm_unpacklo_epi8(vb, va), ba_hi = _mm_unpackhi_epi8(vb, va);
+        unsigned char* out = dst + i * 4;
+        _mm_storeu_si128((__m128i*)(out +  0), _mm_unpacklo_epi16(rg_lo, ba_lo));
+        _mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi16(rg_lo, ba_lo));
+        _mm_storeu_si128((__m128i*)(out + 32), _mm_unpacklo_epi16(rg_hi, ba_hi));
+        _mm_storeu_si128((__m128i*)(out + 48), _mm_unpackhi_epi16(rg_hi, ba_hi));
+    }
+    ImPlatform_Convert_Planar8ToRGBA8_Scalar(dst + i * 4, r + i, g + i, b + i, a ? a + i : NULL, count - i);
+}
+
+// [a0+a1, a2+a3, b0+b1, b2+b3]
+static inline __m128i ImPlatform_AddPairs_SSE2(__m128i a, __m128i b)
+{
+    const __m128 fa = _mm_castsi128_ps(a), fb = _mm_castsi128_ps(b);
+    return _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))),
+                         _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))));
+}
+
+// Dot product of 4 RGBA8 pixels with coeffs (16-bit [c0 c1 c2 c3] x2), plus bias, shifted
+static inline __m128i ImPlatform_DotRGBA8_SSE2(__m128i px, __m128i coeffs, __m128i bias)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(px, zero), coeffs);
+    __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(px, zero), coeffs);
+    return _mm_srli_epi32(_mm_add_epi32(ImPlatform_AddPairs_SSE2(lo, hi), bias), 8);
+}
+
+// 2x2 block sums of 4 pixels on two rows: two RGBA sums in 16-bit lanes
+static inline __m128i ImPlatform_SumBlocksRGBA8_SSE2(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    return _mm_unpacklo_epi64(_mm_add_epi16(lo, _mm_srli_si128(lo, 8)), _mm_add_epi16(hi, _mm_srli_si128(hi, 8)));
+}
+
+// 4 chroma samples from two block sums
+static inline __m128i ImPlatform_Chroma4_SSE2(__m128i s0, __m128i s1, __m128i coeffs, __m128i bias)
+{
+    __m128i c = ImPlatform_AddPairs_SSE2(_mm_madd_epi16(s0, coeffs), _mm_madd_epi16(s1, coeffs));
+    return _mm_srli_epi32(_mm_add_epi32(c, bias), 10);
+}
+
+static void ImPlatform_Convert_RGBA8ToI420_SSE2(unsigned char* y0, unsigned char* y1, unsigned char* u, unsigned char* v,
+                                                const unsigned char* row0, const unsigned char* row1, size_t count)
+{
+    const __m128i coeff_y = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+    const __m128i coeff_u = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+    const __m128i coeff_v = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+    const __m128i bias_y  = _mm_set1_epi32(IMPLATFORM_I420_Y_BIAS);
+    const __m128i bias_c  = _mm_set1_epi32(IMPLATFORM_I420_C_BIAS);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i a[4], b[4];
+        for (int k = 0; k < 4; k++)
+        {
+            a[k] = _mm_loadu_si128((const __m128i*)(row0 + i * 4 + k * 16));
+            b[k] = _mm_loadu_si128((const __m128i*)(row1 + i * 4 + k * 16));
+        }
+        __m128i ya = _mm_packus_epi16(
+            _mm_packs_epi32(ImPlatform_DotRGBA8_SSE2(a[0], coeff_y, bias_y), ImPlatform_DotRGBA8_SSE2(a[1], coeff_y, bias_y)),
+            _mm_packs_epi32(ImPlatform_DotRGBA8_SSE2(a[2], coeff_y, bias_y), ImPlatform_DotRGBA8_SSE2(a[3], coeff_y, bias_y)));
+        __m128i yb = _mm_packus_epi16(
+            _mm_packs_epi32(ImPlatform_DotRGBA8_SSE2(b[0], coeff_y, bias_y), ImPlatform_DotRGBA8_SSE2(b[1], coeff_y, bias_y)),
+            _mm_packs_epi32(ImPlatform_DotRGBA8_SSE2(b[2], coeff_y, bias_y), ImPlatform_DotRGBA8_SSE2(b[3], coeff_y, bias_y)));
+        _mm_storeu_si128((__m128i*)(y0 + i), ya);
+        _mm_storeu_si128((__m128i*)(y1 + i), yb);
+
+        __m128i s[4];
+        for (int k = 0; k < 4; k++)
+            s[k] = ImPlatform_SumBlocksRGBA8_SSE2(a[k], b[k]);
+        __m128i vu = _mm_packs_epi32(ImPlatform_Chroma4_SSE2(s[0], s[1], coeff_u, bias_c), ImPlatform_Chroma4_SSE2(s[2], s[3], coeff_u, bias_c));
+        __m128i vv = _mm_packs_epi32(ImPlatform_Chroma4_SSE2(s[0], s[1], coeff_v, bias_c), ImPlatform_Chroma4_SSE2(s[2], s[3], coeff_v, bias_c));
+        _mm_storel_epi64((__m128i*)(u + i / 2), _mm_packus_epi16(vu, vu));
+        _mm_storel_epi64((__m128i*)(v + i / 2), _mm_packus_epi16(vv, vv));
+    }
+    ImPlatform_Convert_RGBA8ToI420_Scalar(y0 + i, y1 + i, u + i / 2, v + i / 2, row0 + i * 4, row1 + i * 4, count - i);
+}
+
+// ============================================================================
+// AVX2 (+F16C) kernels, compiled for the target, selected at runtime
+// ============================================================================
+
+IMPLATFORM_TARGET_AVX2
+static void ImPlatform_Convert_RGB8ToRGBA8_AVX2(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    // Move pixels 0-3 to the low lane and 4-7 to the high lane, then expand per lane
+    const __m256i lanes  = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+    const __m256i expand = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha  = _mm256_set1_epi32((int)0xFF000000);
+    size_t i = 0;
+    // 8 pixels use 24 bytes but the load reads 32
+    for (; i + 11 <= count; i += 8, src += 24, dst += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)src);
+        v = _mm256_permutevar8x32_epi32(v, lanes);
+        v = _mm256_shuffle_epi8(v, expand);
+        _mm256_storeu_si256((__m256i*)dst, _mm256_or_si256(v, alpha));
+    }
+    ImPlatform_Convert_RGB8ToRGBA8_SSE2(dst, src, count - i);
+}
+
+IMPLATFORM_TARGET_AVX2
+static void ImPlatform_Convert_SwizzleRB8_AVX2(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    const __m256i swap = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                          2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8, src += 32, dst += 32)
+        _mm256_storeu_si256((__m256i*)dst, _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)src), swap));
+    ImPlatform_Convert_SwizzleRB8_SSE2(dst, src, count - i);
+}
+
+IMPLATFORM_TARGET_AVX2
+static void ImPlatform_Convert_F64ToF32_AVX2(float* dst, const double* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i));
+        __m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4));
+        _mm256_storeu_ps(dst + i, _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+    }
+    ImPlatform_Convert_F64ToF32_SSE2(dst + i, src + i, count - i);
+}
+
+IMPLATFORM_TARGET_AVX2
+static void ImPlatform_Convert_F32ToF16_AVX2(ImU16* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    ImPlatform_Convert_F32ToF16_Scalar(dst + i, src + i, count - i);
+}
+
+IMPLATFORM_TARGET_AVX2
+static void ImPlatform_Convert_U16ToF32_AVX2(float* dst, const ImU16* src, size_t count)
+{
+    const __m256 scale = _mm256_set1_ps(1.0f / 65535.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale));
+    }
+    ImPlatform_Convert_U16ToF32_Scalar(dst + i, src + i, count - i);
+}
+
+// Planar packing is bound by memory bandwidth, the SSE2 version is kept for AVX2 as well
+
+static bool ImPlatform_Convert_CPUHasAVX2(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool f16c    = (info[2] & (1 << 29)) != 0;
+    if (!osxsave || !f16c || (_xgetbv(0) & 6) != 6) // OS saves YMM state
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+#endif
+}
+
+#endif // IMPLATFORM_CONVERT_X86
+
+// ============================================================================
+// NEON kernels (AArch64 baseline)
+// ============================================================================
+
+#if IMPLATFORM_CONVERT_NEON
+
+static void ImPlatform_Convert_RGB8ToRGBA8_NEON(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16, src += 48, dst += 64)
+    {
+        uint8x16x3_t rgb = vld3q_u8(src);
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(dst, rgba);
+    }
+    ImPlatform_Convert_RGB8ToRGBA8_Scalar(dst, src, count - i);
+}
+
+static void ImPlatform_Convert_SwizzleRB8_NEON(unsigned char* dst, const unsigned char* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16, src += 64, dst += 64)
+    {
+        uint8x16x4_t v = vld4q_u8(src);
+        uint8x16_t r = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = r;
+        vst4q_u8(dst, v);
+    }
+    ImPlatform_Convert_SwizzleRB8_Scalar(dst, src, count - i);
+}
+
+static void ImPlatform_Convert_F64ToF32_NEON(float* dst, const double* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_high_f32_f64(vcvt_f32_f64(vld1q_f64(src + i)), vld1q_f64(src + i + 2)));
+    ImPlatform_Convert_F64ToF32_Scalar(dst + i, src + i, count - i);
+}
+
+static void ImPlatform_Convert_F32ToF16_NEON(ImU16* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        float16x8_t h = vcombine_f16(vcvt_f16_f32(vld1q_f32(src + i)), vcvt_f16_f32(vld1q_f32(src + i + 4)));
+        vst1q_u16(dst + i, vreinterpretq_u16_f16(h));
+    }
+    ImPlatform_Convert_F32ToF16_Scalar(dst + i, src + i, count - i);
+}
+
+static void ImPlatform_Convert_U16ToF32_NEON(float* dst, const ImU16* src, size_t count)
+{
+    const float32x4_t scale = vdupq_n_f32(1.0f / 65535.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint16x8_t v = vld1q_u16(src + i);
+        vst1q_f32(dst + i,     vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale));
+        vst1q_f32(dst + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale));
+    }
+    ImPlatform_Convert_U16ToF32_Scalar(dst + i, src + i, count - i);
+}
+
+static void ImPlatform_Convert_Planar8ToRGBA8_NEON(unsigned char* dst, const unsigned char* r, const unsigned char* g,
+                                                   const unsigned char* b, const unsigned char* a, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t rgba;
+        rgba.val[0] = vld1q_u8(r + i);
+        rgba.val[1] = vld1q_u8(g + i);
+        rgba.val[2] = vld1q_u8(b + i);
+        rgba.val[3] = a ? vld1q_u8(a + i) : vdupq_n_u8(0xFF);
+        vst4q_u8(dst + i * 4, rgba);
+    }
+    ImPlatform_Convert_Planar8ToRGBA8_Scalar(dst + i * 4, r + i, g + i, b + i, a ? a + i : NULL, count - i);
+}
+
+static inline uint8x16_t ImPlatform_RGBToY16_NEON(const uint8x16x4_t& px)
+{
+    const uint16x8_t bias = vdupq_n_u16(IMPLATFORM_I420_Y_BIAS);
+    uint16x8_t lo = vmlal_u8(vmlal_u8(vmlal_u8(bias, vget_low_u8(px.val[0]), vdup_n_u8(66)),
+                                      vget_low_u8(px.val[1]), vdup_n_u8(129)), vget_low_u8(px.val[2]), vdup_n_u8(25));
+    uint16x8_t hi = vmlal_u8(vmlal_u8(vmlal_u8(bias, vget_high_u8(px.val[0]), vdup_n_u8(66)),
+                                      vget_high_u8(px.val[1]), vdup_n_u8(129)), vget_high_u8(px.val[2]), vdup_n_u8(25));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+// 8 chroma samples from 2x2 block sums
+static inline uint8x8_t ImPlatform_Chroma8_NEON(int16x8_t r, int16x8_t g, int16x8_t b, int16_t cr, int16_t cg, int16_t cb)
+{
+    const int32x4_t bias = vdupq_n_s32(IMPLATFORM_I420_C_BIAS);
+    int32x4_t lo = vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(bias, vget_low_s16(r), cr), vget_low_s16(g), cg), vget_low_s16(b), cb);
+    int32x4_t hi = vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(bias, vget_high_s16(r), cr), vget_high_s16(g), cg), vget_high_s16(b), cb);
+    return vqmovun_s16(vcombine_s16(vshrn_n_s32(lo, 10), vshrn_n_s32(hi, 10)));
+}
+
+static void ImPlatform_Convert_RGBA8ToI420_NEON(unsigned char* y0, unsigned char* y1, unsigned char* u, unsigned char* v,
+                                                const unsigned char* row0, const unsigned char* row1, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t a = vld4q_u8(row0 + i * 4);
+        uint8x16x4_t b = vld4q_u8(row1 + i * 4);
+        vst1q_u8(y0 + i, ImPlatform_RGBToY16_NEON(a));
+        vst1q_u8(y1 + i, ImPlatform_RGBToY16_NEON(b));
+        int16x8_t r = vreinterpretq_s16_u16(vaddq_u16(vpaddlq_u8(a.val[0]), vpaddlq_u8(b.val[0])));
+        int16x8_t g = vreinterpretq_s16_u16(vaddq_u16(vpaddlq_u8(a.val[1]), vpaddlq_u8(b.val[1])));
+        int16x8_t bl = vreinterpretq_s16_u16(vaddq_u16(vpaddlq_u8(a.val[2]), vpaddlq_u8(b.val[2])));
+        vst1_u8(u + i / 2, ImPlatform_Chroma8_NEON(r, g, bl, -38, -74, 112));
+        vst1_u8(v + i / 2, ImPlatform_Chroma8_NEON(r, g, bl, 112, -94, -18));
+    }
+    ImPlatform_Convert_RGBA8ToI420_Scalar(y0 + i, y1 + i, u + i / 2, v + i / 2, row0 + i * 4, row1 + i * 4, count - i);
+}
+
+#endif // IMPLATFORM_CONVERT_NEON
+
+// ============================================================================
+// Runtime dispatch
+// ============================================================================
+
+struct ImPlatform_ConvertKernels {
+    const char* isa;
+    void (*RGB8ToRGBA8)(unsigned char*, const unsigned char*, size_t);
+    void (*SwizzleRB8)(unsigned char*, const unsigned char*, size_t);
+    void (*F64ToF32)(float*, const double*, size_t);
+    void (*F32ToF16)(ImU16*, const float*, size_t);
+    void (*U16ToF32)(float*, const ImU16*, size_t);
+    void (*Planar8ToRGBA8)(unsigned char*, const unsigned char*, const unsigned char*, const unsigned char*, const unsigned char*, size_t);
+    void (*RGBA8ToI420)(unsigned char*, unsigned char*, unsigned char*, unsigned char*, const unsigned char*, const unsigned char*, size_t);
+};
+
+static const ImPlatform_ConvertKernels* ImPlatform_Convert_SelectKernels(void)
+{
+#if IMPLATFORM_CONVERT_X86
+    static const ImPlatform_ConvertKernels avx2 = {
+        "AVX2",
+        ImPlatform_Convert_RGB8ToRGBA8_AVX2, ImPlatform_Convert_SwizzleRB8_AVX2, ImPlatform_Convert_F64ToF32_AVX2,
+        ImPlatform_Convert_F32ToF16_AVX2, ImPlatform_Convert_U16ToF32_AVX2, ImPlatform_Convert_Planar8ToRGBA8_SSE2,
+        ImPlatform_Convert_RGBA8ToI420_SSE2,
+    };
+    static const ImPlatform_ConvertKernels sse2 = {
+        "SSE2",
+        ImPlatform_Convert_RGB8ToRGBA8_SSE2, ImPlatform_Convert_SwizzleRB8_SSE2, ImPlatform_Convert_F64ToF32_SSE2,
+        ImPlatform_Convert_F32ToF16_SSE2, ImPlatform_Convert_U16ToF32_SSE2, ImPlatform_Convert_Planar8ToRGBA8_SSE2,
+        ImPlatform_Convert_RGBA8ToI420_SSE2,
+    };
+    return ImPlatform_Convert_CPUHasAVX2() ? &avx2 : &sse2;
+#elif IMPLATFORM_CONVERT_NEON
+    static const ImPlatform_ConvertKernels neon = {
+        "NEON",
+        ImPlatform_Convert_RGB8ToRGBA8_NEON, ImPlatform_Convert_SwizzleRB8_NEON, ImPlatform_Convert_F64ToF32_NEON,
+        ImPlatform_Convert_F32ToF16_NEON, ImPlatform_Convert_U16ToF32_NEON, ImPlatform_Convert_Planar8ToRGBA8_NEON,
+        ImPlatform_Convert_RGBA8ToI420_NEON,
+    };
+    return &neon;
+#else
+    static const ImPlatform_ConvertKernels scalar = {
+        "Scalar",
+        ImPlatform_Convert_RGB8ToRGBA8_Scalar, ImPlatform_Convert_SwizzleRB8_Scalar, ImPlatform_Convert_F64ToF32_Scalar,
+        ImPlatform_Convert_F32ToF16_Scalar, ImPlatform_Convert_U16ToF32_Scalar, ImPlatform_Convert_Planar8ToRGBA8_Scalar,
+        ImPlatform_Convert_RGBA8ToI420_Scalar,
+    };
+    return &scalar;
+#endif
+}
+
+static const ImPlatform_ConvertKernels* ImPlatform_Convert_Kernels(void)
+{
+    static const ImPlatform_ConvertKernels* kernels = ImPlatform_Convert_SelectKernels();
+    return kernels;
+}
+
+// ============================================================================
+// Entry points (declared in ImPlatform_Internal.h)
+// ============================================================================
+
+const char* ImPlatform_Convert_GetISA(void)
+{
+    return ImPlatform_Convert_Kernels()->isa;
+}
+
+void ImPlatform_Convert_RGB8ToRGBA8(void* dst, const void* src, size_t pixel_count)
+{
+    ImPlatform_Convert_Kernels()->RGB8ToRGBA8((unsigned char*)dst, (const unsigned char*)src, pixel_count);
+}
+
+void ImPlatform_Convert_SwizzleRB8(void* dst, const void* src, size_t pixel_count)
+{
+    ImPlatform_Convert_Kernels()->SwizzleRB8((unsigned char*)dst, (const unsigned char*)src, pixel_count);
+}
+
+void ImPlatform_Convert_F64ToF32(float* dst, const double* src, size_t count)
+{
+    ImPlatform_Convert_Kernels()->F64ToF32(dst, src, count);
+}
+
+void ImPlatform_Convert_F32ToF16(ImU16* dst, const float* src, size_t count)
+{
+    ImPlatform_Convert_Kernels()->F32ToF16(dst, src, count);
+}
+
+void ImPlatform_Convert_U16ToF32(float* dst, const ImU16* src, size_t count)
+{
+    ImPlatform_Convert_Kernels()->U16ToF32(dst, src, count);
+}
+
+void ImPlatform_Convert_Planar8ToRGBA8(void* dst, const void* r, const void* g, const void* b, const void* a, size_t pixel_count)
+{
+    ImPlatform_Convert_Kernels()->Planar8ToRGBA8((unsigned char*)dst, (const unsigned char*)r, (const unsigned char*)g,
+                                                 (const unsigned char*)b, (const unsigned char*)a, pixel_count);
+}
+
+void ImPlatform_Convert_RGBA8ToI420(void* y0, void* y1, void* u, void* v, const void* row0, const void* row1, size_t pixel_count)
+{
+    ImPlatform_Convert_Kernels()->RGBA8ToI420((unsigned char*)y0, (unsigned char*)y1, (unsigned char*)u, (unsigned char*)v,
+                                              (const unsigned char*)row0, (const unsigned char*)row1, pixel_count);
+}
@@ -32,8 +32,8 @@ static D3D11_VIEWPORT          g_SavedViewport = {};
 static D3D11_RECT              g_SavedScissor = {};
 static UINT                    g_SavedScissorCount = 0;
 
-// Sampler table: [filter][wrap] — filter: 0=Nearest,1=Linear  wrap: 0=Clamp,1=Repeat,2=Mirror
-static ID3D11SamplerState* g_Samplers[2][3]  = {};
+// Sampler table: [filter][wrap] — filter: 0=Nearest,1=Linear,2=LinearMipLinear  wrap: 0=Clamp,1=Repeat,2=Mirror
+static ID3D11SamplerState* g_Samplers[3][3]  = {};
 static ID3D11SamplerState* g_SamplerStack[8] = {};
 static int                 g_SamplerDepth    = 0;
 
@@ -204,9 +204,11 @@ bool ImPlatform_InitGfx_Internal_DX11(void)
         return false;
 
     // Pre-create all filter×wrap sampler combinations
-    static const D3D11_FILTER      kFilters[2] = { D3D11_FILTER_MIN_MAG_MIP_POINT, D3D11_FILTER_MIN_MAG_MIP_LINEAR };
+    // Nearest/Linear stay on level 0 (MaxLOD 0); LinearMipLinear samples the whole chain.
+    static const D3D11_FILTER      kFilters[3] = { D3D11_FILTER_MIN_MAG_MIP_POINT, D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_FILTER_MIN_MAG_MIP_LINEAR };
+    static const FLOAT             kMaxLOD[3]  = { 0.0f, 0.0f, D3D11_FLOAT32_MAX };
     static const D3D11_TEXTURE_ADDRESS_MODE kAddr[3] = { D3D11_TEXTURE_ADDRESS_CLAMP, D3D11_TEXTURE_ADDRESS_WRAP, D3D11_TEXTURE_ADDRESS_MIRROR };
-    for (int f = 0; f < 2; ++f)
+    for (int f = 0; f < 3; ++f)
     for (int w = 0; w < 3; ++w)
     {
         D3D11_SAMPLER_DESC sd = {};
@@ -215,7 +217,7 @@ bool ImPlatform_InitGfx_Internal_DX11(void)
         sd.AddressV       = kAddr[w];
         sd.AddressW       = D3D11_TEXTURE_ADDRESS_CLAMP;
         sd.ComparisonFunc = D3D11_COMPARISON_NEVER;
-        sd.MaxLOD         = D3D11_FLOAT32_MAX;
+        sd.MaxLOD         = kMaxLOD[f];
         g_GfxData.pDevice->CreateSamplerState(&sd, &g_Samplers[f][w]);
     }
 
@@ -225,6 +227,9 @@ bool ImPlatform_InitGfx_Internal_DX11(void)
 // ImPlatform API - InitGfx
 IMPLATFORM_API bool ImPlatform_InitGfx(void)
 {
+    // DXBC doesn't depend on the GPU or driver, only on the compiler that produced it
+    const unsigned int compiler_version = D3D_COMPILER_VERSION;
+    ImPlatform_ShaderCacheOpen("dx11", &compiler_version, sizeof(compiler_version));
     return ImPlatform_InitGfx_Internal_DX11();
 }
 
@@ -255,6 +260,7 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplDX11_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
 }
 
 // ImPlatform API - GfxAPIClear
@@ -277,6 +283,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
 {
     (void)vClearColor; // Not used for DX11
     ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+    ImPlatform_Capture_EndFrame();
     return true;
 }
 
@@ -317,9 +324,12 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow (gfx-specific part)
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
-    for (int f = 0; f < 2; ++f)
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
+    for (int f = 0; f < 3; ++f)
         for (int w = 0; w < 3; ++w)
             if (g_Samplers[f][w]) { g_Samplers[f][w]->Release(); g_Samplers[f][w] = nullptr; }
+    ImPlatform_ShaderCacheClose();
     ImGui_ImplDX11_Shutdown();
     ImPlatform_Gfx_CleanupDevice_DX11(&g_GfxData);
 }
@@ -440,6 +450,30 @@ static DXGI_FORMAT ImPlatform_GetD3D11Format(ImPlatform_PixelFormat format, int*
     case ImPlatform_PixelFormat_R32I:
         *out_bytes_per_pixel = 4;
         return DXGI_FORMAT_R32_SINT;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: no per-texel size, see ImPlatform_CompressedBlockBytes. ETC2/ASTC are decoded on the CPU.
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC1_UNORM;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC2_UNORM;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC3_UNORM;
+    case ImPlatform_PixelFormat_BC4:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC4_UNORM;
+    case ImPlatform_PixelFormat_BC5:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC5_UNORM;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC6H_UF16;
+    case ImPlatform_PixelFormat_BC7:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC7_UNORM;
 #endif
     default:
         *out_bytes_per_pixel = 4;
@@ -457,6 +491,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -465,31 +500,59 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     if (!desc || !pixel_data || !g_GfxData.pDevice)
         return NULL;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // D3D11 wants block-compressed textures sized in whole blocks
+    const bool compressed = ImPlatform_CompressedBlockBytes(desc->format) != 0;
+    if (compressed && (!ImPlatform_SupportsPixelFormat(desc->format) || (desc->width & 3) || (desc->height & 3)))
+        return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+#else
+    const bool compressed = false;
+#endif
+
     int bytes_per_pixel;
     DXGI_FORMAT format = ImPlatform_GetD3D11Format(desc->format, &bytes_per_pixel);
 
+    // Mipmapped textures are generated on the GPU (GenerateMips needs RENDER_TARGET binding)
+    unsigned int mip_levels = compressed ? 1 : ImPlatform_TextureMipCount(desc);
+    UINT format_support = 0;
+    if (mip_levels > 1 &&
+        (FAILED(g_GfxData.pDevice->CheckFormatSupport(format, &format_support)) ||
+         !(format_support & D3D11_FORMAT_SUPPORT_MIP_AUTOGEN)))
+        mip_levels = 1;
+
     // Create texture
     D3D11_TEXTURE2D_DESC tex_desc;
     ZeroMemory(&tex_desc, sizeof(tex_desc));
     tex_desc.Width = desc->width;
     tex_desc.Height = desc->height;
-    tex_desc.MipLevels = 1;
+    tex_desc.MipLevels = mip_levels;
     tex_desc.ArraySize = 1;
     tex_desc.Format = format;
     tex_desc.SampleDesc.Count = 1;
     tex_desc.Usage = D3D11_USAGE_DEFAULT;
     tex_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
     tex_desc.CPUAccessFlags = 0;
+    if (mip_levels > 1)
+    {
+        tex_desc.BindFlags |= D3D11_BIND_RENDER_TARGET;
+        tex_desc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+    }
 
     D3D11_SUBRESOURCE_DATA subResource;
     subResource.pSysMem = pixel_data;
     subResource.SysMemPitch = desc->width * bytes_per_pixel;
     subResource.SysMemSlicePitch = 0;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (compressed)
+        subResource.SysMemPitch = (UINT)ImPlatform_CompressedRowBytes(desc->format, desc->width);
+#endif
 
     ID3D11Texture2D* pTexture = NULL;
-    HRESULT hr = g_GfxData.pDevice->CreateTexture2D(&tex_desc, &subResource, &pTexture);
+    HRESULT hr = g_GfxData.pDevice->CreateTexture2D(&tex_desc, mip_levels > 1 ? NULL : &subResource, &pTexture);
     if (FAILED(hr) || !pTexture)
         return NULL;
+    if (mip_levels > 1)
+        g_GfxData.pDeviceContext->UpdateSubresource(pTexture, 0, NULL, pixel_data, subResource.SysMemPitch, 0);
 
     // Create shader resource view
     D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
@@ -505,6 +568,8 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
 
     if (FAILED(hr) || !pSRV)
         return NULL;
+    if (mip_levels > 1)
+        g_GfxData.pDeviceContext->GenerateMips(pSRV);
 
     // Note: Filtering and wrapping are set via samplers in D3D11, not per-texture
     // The renderer backend manages sampler states
@@ -529,6 +594,25 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(
 
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return true; }
 
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        if (format == ImPlatform_PixelFormat_ETC2_RGB8 || format == ImPlatform_PixelFormat_ETC2_RGBA8 ||
+            format == ImPlatform_PixelFormat_ASTC_4x4 || !g_GfxData.pDevice)
+            return false;
+        int bytes_per_pixel;
+        UINT support = 0;
+        const UINT needed = D3D11_FORMAT_SUPPORT_TEXTURE2D | D3D11_FORMAT_SUPPORT_SHADER_SAMPLE;
+        return SUCCEEDED(g_GfxData.pDevice->CheckFormatSupport(ImPlatform_GetD3D11Format(format, &bytes_per_pixel), &support)) &&
+               (support & needed) == needed;
+    }
+#endif
+    (void)format;
+    return true;
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void* voxel_data,
                                                       const ImPlatform_TextureDesc3D* desc)
 {
@@ -577,6 +661,11 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     if (!texture_id || !pixel_data || !g_GfxData.pDeviceContext)
         return false;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
     ID3D11ShaderResourceView* pSRV = (ID3D11ShaderResourceView*)texture_id;
 
     // Get the underlying texture
@@ -610,6 +699,27 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     case DXGI_FORMAT_R32G32_FLOAT: bytes_per_pixel = 8; break;
     case DXGI_FORMAT_R32G32B32A32_FLOAT: bytes_per_pixel = 16; break;
     }
+    UINT row_pitch = width * bytes_per_pixel;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: the pitch is one row of 4x4 blocks and the box must cover whole blocks
+    UINT block_bytes = 0;
+    switch (desc.Format)
+    {
+    case DXGI_FORMAT_BC1_UNORM: case DXGI_FORMAT_BC4_UNORM: block_bytes = 8; break;
+    case DXGI_FORMAT_BC2_UNORM: case DXGI_FORMAT_BC3_UNORM: case DXGI_FORMAT_BC5_UNORM: case DXGI_FORMAT_BC6H_UF16: case DXGI_FORMAT_BC7_UNORM: block_bytes = 16; break;
+    default: break;
+    }
+    if (block_bytes)
+    {
+        if (!ImPlatform_CompressedRegionValid(x, y, width, height, desc.Width, desc.Height))
+        {
+            pTexture->Release();
+            return false;
+        }
+        row_pitch = ((width + 3) / 4) * block_bytes;
+    }
+#endif
 
     // Update texture sub-region
     D3D11_BOX box;
@@ -620,12 +730,22 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     box.front = 0;
     box.back = 1;
 
-    g_GfxData.pDeviceContext->UpdateSubresource(pTexture, 0, &box, pixel_data, width * bytes_per_pixel, 0);
+    g_GfxData.pDeviceContext->UpdateSubresource(pTexture, 0, &box, pixel_data, row_pitch, 0);
+    if (desc.MiscFlags & D3D11_RESOURCE_MISC_GENERATE_MIPS)
+        g_GfxData.pDeviceContext->GenerateMips(pSRV);
 
     pTexture->Release();
     return true;
 }
 
+// Streaming upload is not implemented on this backend; callers fall back to ImPlatform_UpdateTexture.
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int) { return NULL; }
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID) { return false; }
+
+// No strided upload path on this backend: repack tightly, then CreateTexture/UpdateTexture
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc) { return ImPlatform_CreateTextureFromImageBuffer_Repack(buffer, desc); }
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer) { return ImPlatform_UpdateTextureFromImageBuffer_Repack(texture_id, buffer); }
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !g_GfxData.pDevice)
@@ -771,6 +891,12 @@ IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned i
     if (height) *height = g_ImPlatform_BackbufferH;
 }
 
+// Asynchronous readback is not implemented on this backend
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int, ImPlatform_ReadbackCallback, void*) { return NULL; }
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback) { return false; }
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback, unsigned int*) { return NULL; }
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback) {}
+
 IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     if (!dst || !src || !g_GfxData.pDeviceContext)
@@ -803,13 +929,16 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
     ID3D11ShaderResourceView* pSRV = (ID3D11ShaderResourceView*)texture_id;
     pSRV->Release();
 }
 
 IMPLATFORM_API void ImPlatform_PushSampler(ImPlatform_TextureFilter filter, ImPlatform_TextureWrap wrap)
 {
-    int f = (filter == ImPlatform_TextureFilter_Linear) ? 1 : 0;
+    int f = (int)filter; if (f < 0 || f > 2) f = 0;
     int w = (int)wrap;
     if (w < 0 || w > 2) w = 0;
     ID3D11SamplerState* s = g_Samplers[f][w];
@@ -1092,6 +1221,20 @@ IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned
     g_GfxData.pDeviceContext->DrawIndexed(index_count, start_index, 0);
 }
 
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+
+// Instanced drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer /*instance_buffer*/) {}
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/, unsigned int /*instance_count*/, unsigned int /*start_instance*/) {}
+
+// Indirect drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*draw_count*/, ImPlatform_BufferUsage /*usage*/) { return NULL; }
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/, const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*offset*/, unsigned int /*count*/) { return false; }
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/) {}
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int /*primitive_type*/, ImPlatform_IndirectBuffer /*indirect_buffer*/, unsigned int /*first_draw*/, unsigned int /*draw_count*/) {}
+
 // ============================================================================
 // Custom Shader System API - DirectX 11
 // ============================================================================
@@ -1200,24 +1343,24 @@ static UINT ImPlatform_DX11_TranslateCompileFlags(unsigned int compile_flags)
 }
 
 // Try to load cached DXBC bytecode for this shader into a fresh ID3DBlob.
-// Returns NULL on cache miss or I/O error. out_cache_path receives the
-// computed cache path so the caller can save after a successful compile.
+// Returns NULL on cache miss or I/O error. out_cache_name receives the
+// computed cache entry name so the caller can save after a successful compile.
 static ID3DBlob* ImPlatform_DX11_TryLoadCachedBytecode(
     const ImPlatform_ShaderDesc* desc,
     const char* entry, const char* target, size_t source_len,
-    char* out_cache_path, size_t out_cache_path_size)
+    char* out_cache_name, size_t out_cache_name_size)
 {
-    out_cache_path[0] = '\0';
+    out_cache_name[0] = '\0';
     if (!desc->cache_key || !desc->cache_key[0])
         return NULL;
 
     unsigned long long hash = ImPlatform_ShaderCacheHashSource(
         desc->source_code, source_len, entry, target);
-    ImPlatform_ShaderCacheBuildPath(out_cache_path, out_cache_path_size,
+    ImPlatform_ShaderCacheBuildName(out_cache_name, out_cache_name_size,
                                     desc->cache_key, entry, "dxbc", hash);
 
     size_t cached_size = 0;
-    void* cached = ImPlatform_ShaderCacheLoad(out_cache_path, &cached_size);
+    void* cached = ImPlatform_ShaderCacheLoad(out_cache_name, &cached_size);
     if (!cached || cached_size == 0)
     {
         if (cached) free(cached);
@@ -1284,11 +1427,11 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
         // Source-compile path with optional disk cache.
         const char* entry = desc->entry_point ? desc->entry_point : "main";
         size_t source_len = strlen(desc->source_code);
-        char cache_path[512];
+        char cache_name[512];
 
         // 1) Try the cache first
         shader_data->pBlob = ImPlatform_DX11_TryLoadCachedBytecode(
-            desc, entry, target, source_len, cache_path, sizeof(cache_path));
+            desc, entry, target, source_len, cache_name, sizeof(cache_name));
 
         // 2) Cache miss (or no cache_key): compile from source
         if (!shader_data->pBlob)
@@ -1320,9 +1463,9 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
             if (pErrorBlob) pErrorBlob->Release();
 
             // 3) Save to cache for next launch
-            if (desc->cache_key && desc->cache_key[0] && shader_data->pBlob && cache_path[0])
+            if (desc->cache_key && desc->cache_key[0] && shader_data->pBlob && cache_name[0])
             {
-                if (ImPlatform_ShaderCacheSave(cache_path,
+                if (ImPlatform_ShaderCacheSave(cache_name,
                                                shader_data->pBlob->GetBufferPointer(),
                                                shader_data->pBlob->GetBufferSize()))
                 {
@@ -1458,6 +1601,11 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
     delete program_data;
 }
 
+// Asynchronous program creation is only implemented on OpenGL3 and Vulkan: programs are created synchronously
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader) { return ImPlatform_CreateShaderProgram(vertex_shader, fragment_shader); }
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program) { return program != NULL; }
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram /*program*/) {}
+
 IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram program)
 {
     if (!program)
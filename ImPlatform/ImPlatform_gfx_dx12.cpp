@@ -105,6 +105,12 @@ static const UINT              g_RTVTexDescCapacity  = 16;
 // The entry that is currently acting as render target (set by BeginRenderToTexture)
 static ImPlatform_RTTracking_DX12* g_ActiveRTEntry = NULL;
 
+// Render textures queued by ImPlatform_CopyBackbuffer, copied when the frame command list is closed
+#define IMPLATFORM_DX12_MAX_BACKBUFFER_COPIES 8
+static ImPlatform_RTTracking_DX12* g_BackbufferCopies[IMPLATFORM_DX12_MAX_BACKBUFFER_COPIES] = {};
+static int g_BackbufferCopyCount = 0;
+static void ImPlatform_DX12_RecordBackbufferCopies(ID3D12Resource* backbuffer);
+
 // Uniform block API state
 static ImPlatform_ShaderProgram g_CurrentUniformBlockProgram = nullptr;
 static void* g_UniformBlockData = nullptr;
@@ -375,6 +381,10 @@ IMPLATFORM_API bool ImPlatform_InitGfxAPI(void)
 // ImPlatform API - InitGfx
 IMPLATFORM_API bool ImPlatform_InitGfx(void)
 {
+    // DXBC doesn't depend on the GPU or driver, only on the compiler that produced it
+    const unsigned int compiler_version = D3D_COMPILER_VERSION;
+    ImPlatform_ShaderCacheOpen("dx12", &compiler_version, sizeof(compiler_version));
+
     ImGui_ImplDX12_InitInfo init_info = {};
     init_info.Device = g_GfxData.pDevice;
     init_info.CommandQueue = g_GfxData.pCommandQueue;
@@ -409,6 +419,7 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplDX12_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
 }
 
 // ImPlatform API - GfxAPIClear
@@ -428,6 +439,10 @@ IMPLATFORM_API bool ImPlatform_GfxAPIClear(ImVec4 const vClearColor)
     g_GfxData.pCommandList->Reset(frameCtx->pCommandAllocator, NULL);
     g_GfxData.pCommandList->ResourceBarrier(1, &barrier);
 
+    D3D12_RESOURCE_DESC backbuffer_desc = g_GfxData.pRenderTargetResource[backBufferIdx]->GetDesc();
+    g_ImPlatform_BackbufferW = (unsigned int)backbuffer_desc.Width;
+    g_ImPlatform_BackbufferH = (unsigned int)backbuffer_desc.Height;
+
     // Clear
     const float clear_color_with_alpha[4] = {
         vClearColor.x * vClearColor.w,
@@ -458,6 +473,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
     (void)vClearColor;
 
     ImPlatform_RenderDrawDataWrapper(ImGui::GetDrawData(), g_GfxData.pCommandList);
+    ImPlatform_Capture_EndFrame();
 
     return true;
 }
@@ -512,6 +528,9 @@ IMPLATFORM_API bool ImPlatform_GfxAPISwapBuffer(void)
 {
     UINT backBufferIdx = g_GfxData.pSwapChain->GetCurrentBackBufferIndex();
 
+    // The frame is complete, viewports included
+    ImPlatform_DX12_RecordBackbufferCopies(g_GfxData.pRenderTargetResource[backBufferIdx]);
+
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -544,6 +563,9 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
+    ImPlatform_ShaderCacheClose();
     ImGui_ImplDX12_Shutdown();
     ImPlatform_Gfx_CleanupDevice_DX12(&g_GfxData);
 }
@@ -664,6 +686,30 @@ static DXGI_FORMAT ImPlatform_GetD3D12Format(ImPlatform_PixelFormat format, int*
     case ImPlatform_PixelFormat_R32I:
         *out_bytes_per_pixel = 4;
         return DXGI_FORMAT_R32_SINT;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: no per-texel size, see ImPlatform_CompressedBlockBytes. ETC2/ASTC are decoded on the CPU.
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC1_UNORM;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC2_UNORM;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC3_UNORM;
+    case ImPlatform_PixelFormat_BC4:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC4_UNORM;
+    case ImPlatform_PixelFormat_BC5:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC5_UNORM;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC6H_UF16;
+    case ImPlatform_PixelFormat_BC7:
+        *out_bytes_per_pixel = 0;
+        return DXGI_FORMAT_BC7_UNORM;
 #endif
     default:
         *out_bytes_per_pixel = 4;
@@ -681,6 +727,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -696,6 +743,25 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigne
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return NULL; }
 
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        if (format == ImPlatform_PixelFormat_ETC2_RGB8 || format == ImPlatform_PixelFormat_ETC2_RGBA8 ||
+            format == ImPlatform_PixelFormat_ASTC_4x4 || !g_GfxData.pDevice)
+            return false;
+        int bytes_per_pixel;
+        D3D12_FEATURE_DATA_FORMAT_SUPPORT support = {};
+        support.Format = ImPlatform_GetD3D12Format(format, &bytes_per_pixel);
+        return SUCCEEDED(g_GfxData.pDevice->CheckFeatureSupport(D3D12_FEATURE_FORMAT_SUPPORT, &support, sizeof(support))) &&
+               (support.Support1 & D3D12_FORMAT_SUPPORT1_TEXTURE2D) && (support.Support1 & D3D12_FORMAT_SUPPORT1_SHADER_SAMPLE);
+    }
+#endif
+    (void)format;
+    return true;
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !pixel_data || !g_GfxData.pDevice || !g_GfxData.pCommandQueue || !g_GfxData.pSrvDescHeapAlloc)
@@ -704,6 +770,20 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     int bytes_per_pixel;
     DXGI_FORMAT format = ImPlatform_GetD3D12Format(desc->format, &bytes_per_pixel);
 
+    // Rows of the upload: texel rows, or rows of 4x4 blocks for block-compressed formats
+    UINT srcPitch = desc->width * bytes_per_pixel;
+    UINT srcRows = desc->height;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(desc->format))
+    {
+        // D3D12 wants block-compressed textures sized in whole blocks
+        if (!ImPlatform_SupportsPixelFormat(desc->format) || (desc->width & 3) || (desc->height & 3))
+            return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+        srcPitch = (UINT)ImPlatform_CompressedRowBytes(desc->format, desc->width);
+        srcRows = desc->height / 4;
+    }
+#endif
+
     // Create texture resource
     D3D12_HEAP_PROPERTIES props;
     memset(&props, 0, sizeof(D3D12_HEAP_PROPERTIES));
@@ -734,8 +814,8 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
         return NULL;
 
     // Create upload buffer
-    UINT uploadPitch = (desc->width * bytes_per_pixel + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u) & ~(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u);
-    UINT uploadSize = desc->height * uploadPitch;
+    UINT uploadPitch = (srcPitch + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u) & ~(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1u);
+    UINT uploadSize = srcRows * uploadPitch;
 
     D3D12_RESOURCE_DESC upload_desc;
     ZeroMemory(&upload_desc, sizeof(upload_desc));
@@ -774,12 +854,12 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     hr = uploadBuffer->Map(0, &range, &mapped);
     if (SUCCEEDED(hr))
     {
-        for (UINT y = 0; y < desc->height; y++)
+        for (UINT y = 0; y < srcRows; y++)
         {
             memcpy(
                 (void*)((uintptr_t)mapped + y * uploadPitch),
-                (const unsigned char*)pixel_data + y * desc->width * bytes_per_pixel,
-                desc->width * bytes_per_pixel);
+                (const unsigned char*)pixel_data + y * srcPitch,
+                srcPitch);
         }
         uploadBuffer->Unmap(0, &range);
     }
@@ -883,6 +963,14 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID /*texture_id*/, const v
     return false;
 }
 
+// Streaming upload is not implemented on this backend; callers fall back to ImPlatform_UpdateTexture.
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int) { return NULL; }
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID) { return false; }
+
+// No strided upload path on this backend: repack tightly, then CreateTexture/UpdateTexture
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc) { return ImPlatform_CreateTextureFromImageBuffer_Repack(buffer, desc); }
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer) { return ImPlatform_UpdateTextureFromImageBuffer_Repack(texture_id, buffer); }
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !g_GfxData.pDevice || !g_GfxData.pSrvDescHeapAlloc)
@@ -1034,13 +1122,92 @@ IMPLATFORM_API void ImPlatform_EndRenderToTexture(void)
     g_GfxData.pCommandList->RSSetScissorRects(1, &scissor);
 }
 
-IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst) { (void)dst; return false; }
+// CopyResource needs matching sizes and formats, the swapchain may have been
+// resized since the copy was queued
+static bool ImPlatform_DX12_MatchesBackbuffer(const ImPlatform_RTTracking_DX12* entry, const D3D12_RESOURCE_DESC& backbuffer_desc)
+{
+    return entry->width == (unsigned int)backbuffer_desc.Width && entry->height == backbuffer_desc.Height &&
+           entry->format == backbuffer_desc.Format;
+}
+
+static void ImPlatform_DX12_RecordBackbufferCopies(ID3D12Resource* backbuffer)
+{
+    if (g_BackbufferCopyCount == 0)
+        return;
+    D3D12_RESOURCE_DESC backbuffer_desc = backbuffer->GetDesc();
+
+    D3D12_RESOURCE_BARRIER barriers[1 + IMPLATFORM_DX12_MAX_BACKBUFFER_COPIES] = {};
+    ID3D12Resource* targets[IMPLATFORM_DX12_MAX_BACKBUFFER_COPIES];
+    UINT count = 0;
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+        if (ImPlatform_DX12_MatchesBackbuffer(g_BackbufferCopies[i], backbuffer_desc))
+            targets[count++] = g_BackbufferCopies[i]->pTexture;
+    g_BackbufferCopyCount = 0;
+    if (count == 0)
+        return;
+
+    barriers[0].Transition.pResource   = backbuffer;
+    barriers[0].Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
+    barriers[0].Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_SOURCE;
+    for (UINT i = 0; i < count; i++)
+    {
+        barriers[1 + i].Transition.pResource   = targets[i];
+        barriers[1 + i].Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+        barriers[1 + i].Transition.StateAfter  = D3D12_RESOURCE_STATE_COPY_DEST;
+    }
+    for (UINT i = 0; i <= count; i++)
+    {
+        barriers[i].Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barriers[i].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    }
+    g_GfxData.pCommandList->ResourceBarrier(1 + count, barriers);
+
+    for (UINT i = 0; i < count; i++)
+        g_GfxData.pCommandList->CopyResource(targets[i], backbuffer);
+
+    for (UINT i = 0; i <= count; i++)
+    {
+        D3D12_RESOURCE_STATES state = barriers[i].Transition.StateBefore;
+        barriers[i].Transition.StateBefore = barriers[i].Transition.StateAfter;
+        barriers[i].Transition.StateAfter  = state;
+    }
+    g_GfxData.pCommandList->ResourceBarrier(1 + count, barriers);
+}
+
+// The copy is recorded when the frame command list is closed (ImPlatform_GfxAPISwapBuffer)
+IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst)
+{
+    if (!dst || !g_GfxData.pSwapChain)
+        return false;
+
+    ImPlatform_RTTracking_DX12* entry = g_RTTrackingHead;
+    while (entry) { if ((ImTextureID)entry->srvGpuHandle.ptr == dst) break; entry = entry->next; }
+    if (!entry) return false;
+
+    UINT backBufferIdx = g_GfxData.pSwapChain->GetCurrentBackBufferIndex();
+    if (!ImPlatform_DX12_MatchesBackbuffer(entry, g_GfxData.pRenderTargetResource[backBufferIdx]->GetDesc()))
+        return false;
+
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+        if (g_BackbufferCopies[i] == entry)
+            return true;
+    if (g_BackbufferCopyCount == IMPLATFORM_DX12_MAX_BACKBUFFER_COPIES)
+        return false;
+    g_BackbufferCopies[g_BackbufferCopyCount++] = entry;
+    return true;
+}
 IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height)
 {
     if (width)  *width  = g_ImPlatform_BackbufferW;
     if (height) *height = g_ImPlatform_BackbufferH;
 }
 
+// Asynchronous readback is not implemented on this backend
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int, ImPlatform_ReadbackCallback, void*) { return NULL; }
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback) { return false; }
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback, unsigned int*) { return NULL; }
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback) {}
+
 IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     // DX12 texture copy requires proper command list management and resource tracking
@@ -1054,6 +1221,10 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id || !g_GfxData.pSrvDescHeapAlloc)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
+
     // Free the descriptor from the heap
     D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
     gpuHandle.ptr = (UINT64)texture_id;
@@ -1122,6 +1293,20 @@ IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int /*primitive_type*/, unsi
     // Stub
 }
 
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+
+// Instanced drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer /*instance_buffer*/) {}
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/, unsigned int /*instance_count*/, unsigned int /*start_instance*/) {}
+
+// Indirect drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*draw_count*/, ImPlatform_BufferUsage /*usage*/) { return NULL; }
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/, const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*offset*/, unsigned int /*count*/) { return false; }
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/) {}
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int /*primitive_type*/, ImPlatform_IndirectBuffer /*indirect_buffer*/, unsigned int /*first_draw*/, unsigned int /*draw_count*/) {}
+
 // ============================================================================
 // Custom Shader System API - DirectX 12
 // ============================================================================
@@ -1167,19 +1352,19 @@ static UINT ImPlatform_DX12_TranslateCompileFlags(unsigned int compile_flags)
 static ID3DBlob* ImPlatform_DX12_TryLoadCachedBytecode(
     const ImPlatform_ShaderDesc* desc,
     const char* entry, const char* target, size_t source_len,
-    char* out_cache_path, size_t out_cache_path_size)
+    char* out_cache_name, size_t out_cache_name_size)
 {
-    out_cache_path[0] = '\0';
+    out_cache_name[0] = '\0';
     if (!desc->cache_key || !desc->cache_key[0])
         return NULL;
 
     unsigned long long hash = ImPlatform_ShaderCacheHashSource(
         desc->source_code, source_len, entry, target);
-    ImPlatform_ShaderCacheBuildPath(out_cache_path, out_cache_path_size,
+    ImPlatform_ShaderCacheBuildName(out_cache_name, out_cache_name_size,
                                     desc->cache_key, entry, "dxbc", hash);
 
     size_t cached_size = 0;
-    void* cached = ImPlatform_ShaderCacheLoad(out_cache_path, &cached_size);
+    void* cached = ImPlatform_ShaderCacheLoad(out_cache_name, &cached_size);
     if (!cached || cached_size == 0)
     {
         if (cached) free(cached);
@@ -1244,11 +1429,11 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
         // Source-compile path with optional disk cache.
         const char* entry = desc->entry_point ? desc->entry_point : "main";
         size_t source_len = strlen(desc->source_code);
-        char cache_path[512];
+        char cache_name[512];
 
         // 1) Try the cache first
         shader_data->pBlob = ImPlatform_DX12_TryLoadCachedBytecode(
-            desc, entry, target, source_len, cache_path, sizeof(cache_path));
+            desc, entry, target, source_len, cache_name, sizeof(cache_name));
 
         // 2) Cache miss (or no cache_key): compile from source
         if (!shader_data->pBlob)
@@ -1280,9 +1465,9 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
             if (pErrorBlob) pErrorBlob->Release();
 
             // 3) Save to cache for next launch
-            if (desc->cache_key && desc->cache_key[0] && shader_data->pBlob && cache_path[0])
+            if (desc->cache_key && desc->cache_key[0] && shader_data->pBlob && cache_name[0])
             {
-                if (ImPlatform_ShaderCacheSave(cache_path,
+                if (ImPlatform_ShaderCacheSave(cache_name,
                                                shader_data->pBlob->GetBufferPointer(),
                                                shader_data->pBlob->GetBufferSize()))
                 {
@@ -1523,6 +1708,11 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
     delete program_data;
 }
 
+// Asynchronous program creation is only implemented on OpenGL3 and Vulkan: programs are created synchronously
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader) { return ImPlatform_CreateShaderProgram(vertex_shader, fragment_shader); }
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program) { return program != NULL; }
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram /*program*/) {}
+
 IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram /*program*/)
 {
     // In DX12, shader binding is done via PSO in the draw callback
@@ -33,7 +33,7 @@ static IDirect3DSurface9* g_SavedSurface  = NULL;
 static D3DVIEWPORT9       g_SavedViewport = {};
 
 // Sampler stack for PushSampler/PopSampler — saves D3D9 per-stage state
-struct ImPlatform_SamplerStackEntry_DX9 { DWORD minF, magF, addrU, addrV; };
+struct ImPlatform_SamplerStackEntry_DX9 { DWORD minF, magF, mipF, addrU, addrV; };
 static ImPlatform_SamplerStackEntry_DX9 g_SamplerStack[8];
 static int                              g_SamplerDepth = 0;
 
@@ -176,6 +176,7 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplDX9_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
 }
 
 // ImPlatform API - GfxAPIClear
@@ -212,6 +213,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
 
     ImGui_ImplDX9_RenderDrawData(ImGui::GetDrawData());
     g_GfxData.pDevice->EndScene();
+    ImPlatform_Capture_EndFrame();
 
     return true;
 }
@@ -257,6 +259,8 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
     ImGui_ImplDX9_Shutdown();
     ImPlatform_Gfx_CleanupDevice_DX9(&g_GfxData);
 }
@@ -303,6 +307,18 @@ static D3DFORMAT ImPlatform_GetD3D9Format(ImPlatform_PixelFormat format, int* ou
     case ImPlatform_PixelFormat_RGBA32F:
         *out_bytes_per_pixel = 16;
         return D3DFMT_A32B32G32R32F;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: only the DXTn formats are core D3D9, the rest are decoded on the CPU
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return D3DFMT_DXT1;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return D3DFMT_DXT3;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return D3DFMT_DXT5;
+#endif
     default:
         *out_bytes_per_pixel = 4;
         return D3DFMT_A8R8G8B8;
@@ -319,6 +335,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -336,6 +353,23 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigne
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return NULL; }
 
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        if ((format != ImPlatform_PixelFormat_BC1 && format != ImPlatform_PixelFormat_BC2 &&
+             format != ImPlatform_PixelFormat_BC3) || !g_GfxData.pD3D)
+            return false;
+        int bytes_per_pixel;
+        return SUCCEEDED(g_GfxData.pD3D->CheckDeviceFormat(D3DADAPTER_DEFAULT, D3DDEVTYPE_HAL, D3DFMT_X8R8G8B8, 0,
+                                                           D3DRTYPE_TEXTURE, ImPlatform_GetD3D9Format(format, &bytes_per_pixel)));
+    }
+#endif
+    (void)format;
+    return true;
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !pixel_data || !g_GfxData.pDevice)
@@ -344,11 +378,39 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     int bytes_per_pixel;
     D3DFORMAT format = ImPlatform_GetD3D9Format(desc->format, &bytes_per_pixel);
 
-    // Create texture
+    // Rows to copy: texel rows, or rows of 4x4 blocks for DXTn
+    unsigned int src_pitch = desc->width * bytes_per_pixel;
+    unsigned int src_rows = desc->height;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    const bool compressed = ImPlatform_CompressedBlockBytes(desc->format) != 0;
+    if (compressed)
+    {
+        // D3D9 wants DXTn textures sized in whole blocks
+        if (!ImPlatform_SupportsPixelFormat(desc->format) || (desc->width & 3) || (desc->height & 3))
+            return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+        src_pitch = (unsigned int)ImPlatform_CompressedRowBytes(desc->format, desc->width);
+        src_rows = desc->height / 4;
+    }
+#else
+    const bool compressed = false;
+#endif
+
+    // Create texture. Mipmaps use D3DUSAGE_AUTOGENMIPMAP (full chain only, the driver
+    // rebuilds the sub-levels from level 0); fall back to a single level if unsupported.
     LPDIRECT3DTEXTURE9 pTexture = NULL;
-    HRESULT hr = g_GfxData.pDevice->CreateTexture(
-        desc->width, desc->height, 1, 0,
-        format, D3DPOOL_MANAGED, &pTexture, NULL);
+    HRESULT hr = E_FAIL;
+    bool has_mips = !compressed && ImPlatform_TextureMipCount(desc) > 1;
+    if (has_mips)
+        hr = g_GfxData.pDevice->CreateTexture(
+            desc->width, desc->height, 0, D3DUSAGE_AUTOGENMIPMAP,
+            format, D3DPOOL_MANAGED, &pTexture, NULL);
+    if (FAILED(hr) || !pTexture)
+    {
+        has_mips = false;
+        hr = g_GfxData.pDevice->CreateTexture(
+            desc->width, desc->height, 1, 0,
+            format, D3DPOOL_MANAGED, &pTexture, NULL);
+    }
 
     if (FAILED(hr) || !pTexture)
         return NULL;
@@ -365,12 +427,14 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     // Copy pixel data row by row
     unsigned char* dest = (unsigned char*)rect.pBits;
     const unsigned char* src = (const unsigned char*)pixel_data;
-    for (unsigned int y = 0; y < desc->height; y++)
+    for (unsigned int y = 0; y < src_rows; y++)
     {
-        memcpy(dest + y * rect.Pitch, src + y * desc->width * bytes_per_pixel, desc->width * bytes_per_pixel);
+        memcpy(dest + y * rect.Pitch, src + y * src_pitch, src_pitch);
     }
 
     pTexture->UnlockRect(0);
+    if (has_mips)
+        pTexture->GenerateMipSubLevels();
 
     // Set texture to stage 0 (not strictly necessary but matches old implementation)
     g_GfxData.pDevice->SetTexture(0, pTexture);
@@ -381,6 +445,8 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
 
     g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MINFILTER, min_filter);
     g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, mag_filter);
+    g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MIPFILTER,
+        (has_mips && desc->min_filter == ImPlatform_TextureFilter_LinearMipLinear) ? D3DTEXF_LINEAR : D3DTEXF_NONE);
 
     // Set addressing modes
     D3DTEXTUREADDRESS wrap_u = D3DTADDRESS_CLAMP;
@@ -409,6 +475,11 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     if (!texture_id || !pixel_data)
         return false;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
     LPDIRECT3DTEXTURE9 pTexture = (LPDIRECT3DTEXTURE9)texture_id;
 
     // Get texture description
@@ -432,6 +503,17 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     case D3DFMT_G32R32F: bytes_per_pixel = 8; break;
     case D3DFMT_A32B32G32R32F: bytes_per_pixel = 16; break;
     }
+    unsigned int src_pitch = width * bytes_per_pixel;
+    unsigned int src_rows = height;
+
+    // DXTn: whole blocks only, the locked pitch is one row of 4x4 blocks
+    if (desc.Format == D3DFMT_DXT1 || desc.Format == D3DFMT_DXT3 || desc.Format == D3DFMT_DXT5)
+    {
+        if (!ImPlatform_CompressedRegionValid(x, y, width, height, desc.Width, desc.Height))
+            return false;
+        src_pitch = ((width + 3) / 4) * (desc.Format == D3DFMT_DXT1 ? 8 : 16);
+        src_rows = (height + 3) / 4;
+    }
 
     // Lock the sub-rectangle
     RECT rect;
@@ -448,15 +530,25 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     // Copy data
     unsigned char* dest = (unsigned char*)locked_rect.pBits;
     const unsigned char* src = (const unsigned char*)pixel_data;
-    for (unsigned int row = 0; row < height; row++)
+    for (unsigned int row = 0; row < src_rows; row++)
     {
-        memcpy(dest + row * locked_rect.Pitch, src + row * width * bytes_per_pixel, width * bytes_per_pixel);
+        memcpy(dest + row * locked_rect.Pitch, src + row * src_pitch, src_pitch);
     }
 
     pTexture->UnlockRect(0);
+    if (desc.Usage & D3DUSAGE_AUTOGENMIPMAP)
+        pTexture->GenerateMipSubLevels();
     return true;
 }
 
+// Streaming upload is not implemented on this backend; callers fall back to ImPlatform_UpdateTexture.
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int) { return NULL; }
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID) { return false; }
+
+// No strided upload path on this backend: repack tightly, then CreateTexture/UpdateTexture
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc) { return ImPlatform_CreateTextureFromImageBuffer_Repack(buffer, desc); }
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer) { return ImPlatform_UpdateTextureFromImageBuffer_Repack(texture_id, buffer); }
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !g_GfxData.pDevice)
@@ -537,6 +629,12 @@ IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned i
     if (height) *height = g_ImPlatform_BackbufferH;
 }
 
+// Asynchronous readback is not implemented on this backend
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int, ImPlatform_ReadbackCallback, void*) { return NULL; }
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback) { return false; }
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback, unsigned int*) { return NULL; }
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback) {}
+
 IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     if (!dst || !src || !g_GfxData.pDevice)
@@ -569,6 +667,9 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
     LPDIRECT3DTEXTURE9 pTexture = (LPDIRECT3DTEXTURE9)texture_id;
     pTexture->Release();
 }
@@ -586,6 +687,7 @@ IMPLATFORM_API void ImPlatform_PushSampler(ImPlatform_TextureFilter filter, ImPl
                 auto& e = g_SamplerStack[g_SamplerDepth++];
                 g_GfxData.pDevice->GetSamplerState(0, D3DSAMP_MINFILTER, &e.minF);
                 g_GfxData.pDevice->GetSamplerState(0, D3DSAMP_MAGFILTER, &e.magF);
+                g_GfxData.pDevice->GetSamplerState(0, D3DSAMP_MIPFILTER, &e.mipF);
                 g_GfxData.pDevice->GetSamplerState(0, D3DSAMP_ADDRESSU,  &e.addrU);
                 g_GfxData.pDevice->GetSamplerState(0, D3DSAMP_ADDRESSV,  &e.addrV);
             }
@@ -593,13 +695,15 @@ IMPLATFORM_API void ImPlatform_PushSampler(ImPlatform_TextureFilter filter, ImPl
             int enc   = (int)(uintptr_t)cmd->UserCallbackData;
             int f     = (enc >> 8) & 0xFF;
             int w     = enc & 0xFF;
-            static const DWORD kFilter[2] = { D3DTEXF_POINT, D3DTEXF_LINEAR };
+            static const DWORD kFilter[3] = { D3DTEXF_POINT, D3DTEXF_LINEAR, D3DTEXF_LINEAR };
+            static const DWORD kMip[3]    = { D3DTEXF_NONE,  D3DTEXF_NONE,   D3DTEXF_LINEAR };
             static const DWORD kAddr[3]   = { D3DTADDRESS_CLAMP, D3DTADDRESS_WRAP, D3DTADDRESS_MIRROR };
-            DWORD df = kFilter[f & 1];
+            if (f > 2) f = 0;
+            DWORD df = kFilter[f];
             DWORD da = kAddr[w < 3 ? w : 0];
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MINFILTER, df);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, df);
-            g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
+            g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, kMip[f]);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_ADDRESSU,  da);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_ADDRESSV,  da);
         }, (void*)encoded);
@@ -613,6 +717,7 @@ IMPLATFORM_API void ImPlatform_PopSampler(void)
             const auto& e = g_SamplerStack[--g_SamplerDepth];
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MINFILTER, e.minF);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, e.magF);
+            g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, e.mipF);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_ADDRESSU,  e.addrU);
             g_GfxData.pDevice->SetSamplerState(0, D3DSAMP_ADDRESSV,  e.addrV);
         }, nullptr);
@@ -837,6 +942,20 @@ IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned
     g_GfxData.pDevice->DrawIndexedPrimitive(d3d_prim, 0, 0, index_count, start_index, prim_count);
 }
 
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+
+// Instanced drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer /*instance_buffer*/) {}
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/, unsigned int /*instance_count*/, unsigned int /*start_instance*/) {}
+
+// Indirect drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*draw_count*/, ImPlatform_BufferUsage /*usage*/) { return NULL; }
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/, const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*offset*/, unsigned int /*count*/) { return false; }
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/) {}
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int /*primitive_type*/, ImPlatform_IndirectBuffer /*indirect_buffer*/, unsigned int /*first_draw*/, unsigned int /*draw_count*/) {}
+
 // ============================================================================
 // Custom Shader System API - DirectX 9
 // ============================================================================
@@ -870,6 +989,11 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram /*p
     // Stub
 }
 
+// Asynchronous program creation is only implemented on OpenGL3 and Vulkan: programs are created synchronously
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader) { return ImPlatform_CreateShaderProgram(vertex_shader, fragment_shader); }
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program) { return program != NULL; }
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram /*program*/) {}
+
 IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram /*program*/)
 {
     // Stub
@@ -54,16 +54,14 @@ ImPlatform_GfxData_Metal* ImPlatform_Gfx_GetData_Metal(void)
 // compiled pipeline state objects in an opaque .metallib blob that Metal
 // knows how to consume. We load it once on device create, attach it to every
 // MTLRenderPipelineDescriptor so Metal can look up cached pipelines, and
-// serialize it back to disk on cleanup. The ShaderCacheLoad helper is NOT
-// used to read the bytes (MTLBinaryArchive wants a URL directly); we only
-// use ImPlatform_ShaderCacheBuildPath for the directory layout and the
-// stdio-level save/serialize path is driven by Metal's serializeToURL:.
+// serialize it back to disk on cleanup. The archive is NOT stored in the
+// shader cache pack (MTLBinaryArchive wants a URL directly); it lives as a
+// standalone file next to it (ImPlatform_ShaderCacheBuildFilePath) and the
+// save/serialize path is driven by Metal's serializeToURL:.
 
 static void ImPlatform_Metal_BuildArchivePath(char* out_path, size_t out_size)
 {
-    // cache_key="metal_global", entry="archive", ext="metallib", hash=0
-    ImPlatform_ShaderCacheBuildPath(out_path, out_size,
-                                    "metal_global", "archive", "metallib", 0);
+    ImPlatform_ShaderCacheBuildFilePath(out_path, out_size, "metal_global_archive.metallib");
 }
 
 static bool ImPlatform_Metal_FileExists(const char* path)
@@ -286,16 +284,17 @@ IMPLATFORM_API bool ImPlatform_InitGfx(void)
         if (!ImGui_ImplMetal_Init(device))
             return false;
 
-        // Create 6 sampler states for all filter/wrap combinations
-        static const MTLSamplerMinMagFilter kMinMag[2] = { MTLSamplerMinMagFilterNearest, MTLSamplerMinMagFilterLinear };
+        // Create 9 sampler states for all filter/wrap combinations
+        static const MTLSamplerMinMagFilter kMinMag[3] = { MTLSamplerMinMagFilterNearest, MTLSamplerMinMagFilterLinear, MTLSamplerMinMagFilterLinear };
+        static const MTLSamplerMipFilter    kMip[3]    = { MTLSamplerMipFilterNotMipmapped, MTLSamplerMipFilterNotMipmapped, MTLSamplerMipFilterLinear };
         static const MTLSamplerAddressMode  kAddr[3]   = { MTLSamplerAddressModeClampToEdge, MTLSamplerAddressModeRepeat, MTLSamplerAddressModeMirrorRepeat };
-        for (int f = 0; f < 2; ++f)
+        for (int f = 0; f < 3; ++f)
         for (int w = 0; w < 3; ++w)
         {
             MTLSamplerDescriptor* desc = [[MTLSamplerDescriptor alloc] init];
             desc.minFilter  = kMinMag[f];
             desc.magFilter  = kMinMag[f];
-            desc.mipFilter  = MTLSamplerMipFilterNotMipmapped;
+            desc.mipFilter  = kMip[f];
             desc.sAddressMode = kAddr[w];
             desc.tAddressMode = kAddr[w];
             id<MTLSamplerState> s = [device newSamplerStateWithDescriptor:desc];
@@ -320,6 +319,7 @@ IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
         CAMetalLayer* layer = (__bridge CAMetalLayer*)g_GfxData.pMetalLayer;
         ImGui_ImplMetal_NewFrame((__bridge MTLRenderPassDescriptor*)g_GfxData.pRenderPassDescriptor);
     }
+    ImPlatform_ShaderReload_NewFrame();
 }
 
 // ImPlatform API - GfxAPIClear
@@ -360,6 +360,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
         ImPlatform_RenderDrawDataWrapper(ImGui::GetDrawData(), commandBuffer, renderEncoder);
 
         [renderEncoder endEncoding];
+        ImPlatform_Capture_EndFrame();
 
         return true;
     }
@@ -411,7 +412,9 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
-    for (int f = 0; f < 2; ++f)
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
+    for (int f = 0; f < 3; ++f)
     for (int w = 0; w < 3; ++w)
         if (g_MetalSamplers[f][w]) { CFRelease(g_MetalSamplers[f][w]); g_MetalSamplers[f][w] = nullptr; }
 
@@ -524,6 +527,39 @@ static MTLPixelFormat ImPlatform_GetMetalFormat(ImPlatform_PixelFormat format, i
     case ImPlatform_PixelFormat_R32I:
         *out_bytes_per_pixel = 4;
         return MTLPixelFormatR32Sint;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: no per-texel size, see ImPlatform_CompressedBlockBytes
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC1_RGBA;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC2_RGBA;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC3_RGBA;
+    case ImPlatform_PixelFormat_BC4:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC4_RUnorm;
+    case ImPlatform_PixelFormat_BC5:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC5_RGUnorm;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC6H_RGBUfloat;
+    case ImPlatform_PixelFormat_BC7:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatBC7_RGBAUnorm;
+    case ImPlatform_PixelFormat_ETC2_RGB8:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatETC2_RGB8;
+    case ImPlatform_PixelFormat_ETC2_RGBA8:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatEAC_RGBA8;
+    case ImPlatform_PixelFormat_ASTC_4x4:
+        *out_bytes_per_pixel = 0;
+        return MTLPixelFormatASTC_4x4_LDR;
 #endif
     default:
         *out_bytes_per_pixel = 4;
@@ -541,6 +577,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -556,11 +593,52 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigne
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return (ImTextureID)0; }
 
+// BC needs supportsBCTextureCompression (every Mac GPU, Apple silicon iPads), ETC2/ASTC the Apple GPU families
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        if (!g_GfxData.pMetalDevice)
+            return false;
+        id<MTLDevice> device = (__bridge id<MTLDevice>)g_GfxData.pMetalDevice;
+        const bool etc_astc = format == ImPlatform_PixelFormat_ETC2_RGB8 || format == ImPlatform_PixelFormat_ETC2_RGBA8 ||
+                              format == ImPlatform_PixelFormat_ASTC_4x4;
+        if (@available(macOS 11.0, iOS 16.4, *))
+            return etc_astc ? [device supportsFamily:MTLGPUFamilyApple2] : device.supportsBCTextureCompression;
+        return false;
+    }
+#endif
+    (void)format;
+    return true;
+}
+
+// Rebuild levels 1..N from level 0 with a blit pass; the queue orders it before later draws.
+static void ImPlatform_Metal_GenerateMips(id<MTLTexture> texture)
+{
+    if (texture.mipmapLevelCount <= 1 || !g_GfxData.pCommandQueue)
+        return;
+    id<MTLCommandQueue> queue = (__bridge id<MTLCommandQueue>)g_GfxData.pCommandQueue;
+    id<MTLCommandBuffer> cb = [queue commandBuffer];
+    id<MTLBlitCommandEncoder> blit = [cb blitCommandEncoder];
+    [blit generateMipmapsForTexture:texture];
+    [blit endEncoding];
+    [cb commit];
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !pixel_data || !g_GfxData.pMetalDevice)
         return (ImTextureID)0;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    const bool compressed = ImPlatform_CompressedBlockBytes(desc->format) != 0;
+    if (compressed && !ImPlatform_SupportsPixelFormat(desc->format))
+        return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+#else
+    const bool compressed = false;
+#endif
+
     @autoreleasepool {
         int bytes_per_pixel;
         MTLPixelFormat format = ImPlatform_GetMetalFormat(desc->format, &bytes_per_pixel);
@@ -572,6 +650,7 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
                                                                                                   mipmapped:NO];
         textureDescriptor.usage = MTLTextureUsageShaderRead;
         textureDescriptor.storageMode = MTLStorageModeManaged;
+        textureDescriptor.mipmapLevelCount = compressed ? 1 : ImPlatform_TextureMipCount(desc);
 
         // Create the texture
         id<MTLTexture> texture = [(__bridge id<MTLDevice>)g_GfxData.pMetalDevice newTextureWithDescriptor:textureDescriptor];
@@ -580,14 +659,19 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
 
         // Upload pixel data
         NSUInteger bytesPerRow = desc->width * bytes_per_pixel;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+        if (compressed)
+            bytesPerRow = ImPlatform_CompressedRowBytes(desc->format, desc->width);
+#endif
         MTLRegion region = MTLRegionMake2D(0, 0, desc->width, desc->height);
         [texture replaceRegion:region mipmapLevel:0 withBytes:pixel_data bytesPerRow:bytesPerRow];
+        ImPlatform_Metal_GenerateMips(texture);
 
         // Create sampler descriptor
         MTLSamplerDescriptor* samplerDescriptor = [[MTLSamplerDescriptor alloc] init];
         samplerDescriptor.minFilter = (desc->min_filter == ImPlatform_TextureFilter_Nearest) ? MTLSamplerMinMagFilterNearest : MTLSamplerMinMagFilterLinear;
         samplerDescriptor.magFilter = (desc->mag_filter == ImPlatform_TextureFilter_Nearest) ? MTLSamplerMinMagFilterNearest : MTLSamplerMinMagFilterLinear;
-        samplerDescriptor.mipFilter = MTLSamplerMipFilterNotMipmapped;
+        samplerDescriptor.mipFilter = (desc->min_filter == ImPlatform_TextureFilter_LinearMipLinear) ? MTLSamplerMipFilterLinear : MTLSamplerMipFilterNotMipmapped;
 
         MTLSamplerAddressMode wrap_s = MTLSamplerAddressModeClampToEdge;
         MTLSamplerAddressMode wrap_t = MTLSamplerAddressModeClampToEdge;
@@ -620,6 +704,11 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     if (!texture_id || !pixel_data)
         return false;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
     @autoreleasepool {
         // Cast ImTextureID (unsigned long long) -> void* -> id<MTLTexture>
         id<MTLTexture> texture = (__bridge id<MTLTexture>)(void*)(uintptr_t)texture_id;
@@ -657,16 +746,43 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
             case MTLPixelFormatR32Sint: bytes_per_pixel = 4; break;
             default: break;
         }
+        NSUInteger bytesPerRow = width * bytes_per_pixel;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+        // Block-compressed: whole blocks only, one row of 4x4 blocks per bytesPerRow
+        NSUInteger block_bytes = 0;
+        switch (format)
+        {
+            case MTLPixelFormatBC1_RGBA: case MTLPixelFormatBC4_RUnorm: case MTLPixelFormatETC2_RGB8: block_bytes = 8; break;
+            case MTLPixelFormatBC2_RGBA: case MTLPixelFormatBC3_RGBA: case MTLPixelFormatBC5_RGUnorm: case MTLPixelFormatBC6H_RGBUfloat:
+            case MTLPixelFormatBC7_RGBAUnorm: case MTLPixelFormatEAC_RGBA8: case MTLPixelFormatASTC_4x4_LDR: block_bytes = 16; break;
+            default: break;
+        }
+        if (block_bytes)
+        {
+            if (!ImPlatform_CompressedRegionValid(x, y, width, height, (unsigned int)texture.width, (unsigned int)texture.height))
+                return false;
+            bytesPerRow = ((width + 3) / 4) * block_bytes;
+        }
+#endif
 
         // Update the sub-region
-        NSUInteger bytesPerRow = width * bytes_per_pixel;
         MTLRegion region = MTLRegionMake2D(x, y, width, height);
         [texture replaceRegion:region mipmapLevel:0 withBytes:pixel_data bytesPerRow:bytesPerRow];
+        ImPlatform_Metal_GenerateMips(texture);
 
         return true;
     }
 }
 
+// Streaming upload is not implemented on this backend; callers fall back to ImPlatform_UpdateTexture.
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int) { return NULL; }
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID) { return false; }
+
+// No strided upload path on this backend: repack tightly, then CreateTexture/UpdateTexture
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc) { return ImPlatform_CreateTextureFromImageBuffer_Repack(buffer, desc); }
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer) { return ImPlatform_UpdateTextureFromImageBuffer_Repack(texture_id, buffer); }
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !g_GfxData.pMetalDevice)
@@ -740,6 +856,12 @@ IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned i
     if (height) *height = g_ImPlatform_BackbufferH;
 }
 
+// Asynchronous readback is not implemented on this backend
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int, ImPlatform_ReadbackCallback, void*) { return NULL; }
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback) { return false; }
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback, unsigned int*) { return NULL; }
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback) {}
+
 IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     if (!dst || !src || !g_GfxData.pCommandQueue)
@@ -780,6 +902,9 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
     @autoreleasepool {
         // Release the bridged texture
         // Cast ImTextureID (unsigned long long) -> void* -> id<MTLTexture>
@@ -802,6 +927,20 @@ IMPLATFORM_API void ImPlatform_BindVertexBuffer(ImPlatform_VertexBuffer vertex_b
 IMPLATFORM_API void ImPlatform_BindIndexBuffer(ImPlatform_IndexBuffer index_buffer) {}
 IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned int index_count, unsigned int start_index) {}
 
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+
+// Instanced drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer /*instance_buffer*/) {}
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/, unsigned int /*instance_count*/, unsigned int /*start_instance*/) {}
+
+// Indirect drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*draw_count*/, ImPlatform_BufferUsage /*usage*/) { return NULL; }
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/, const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*offset*/, unsigned int /*count*/) { return false; }
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/) {}
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int /*primitive_type*/, ImPlatform_IndirectBuffer /*indirect_buffer*/, unsigned int /*first_draw*/, unsigned int /*draw_count*/) {}
+
 // ============================================================================
 // Custom Shader System API - Metal Implementation
 // ============================================================================
@@ -831,7 +970,7 @@ static ImDrawData* g_CurrentDrawData = nullptr;
 static void* g_CurrentRenderEncoder = nullptr; // id<MTLRenderCommandEncoder>
 
 // Sampler override state - [filter][wrap]: filter 0=Nearest 1=Linear, wrap 0=Clamp 1=Wrap 2=Mirror
-static void* g_MetalSamplers[2][3]  = {};  // id<MTLSamplerState>
+static void* g_MetalSamplers[3][3]  = {};  // id<MTLSamplerState>
 static void* g_SamplerStack[8]      = {};  // id<MTLSamplerState>
 static int   g_SamplerDepth         = 0;
 
@@ -1061,6 +1200,11 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
     }
 }
 
+// Asynchronous program creation is only implemented on OpenGL3 and Vulkan: programs are created synchronously
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader) { return ImPlatform_CreateShaderProgram(vertex_shader, fragment_shader); }
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program) { return program != NULL; }
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram /*program*/) {}
+
 IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram program)
 {
     // Metal doesn't have a global "use program" concept
@@ -1390,7 +1534,7 @@ IMPLATFORM_API void ImPlatform_PushSampler(ImPlatform_TextureFilter filter, ImPl
                 int enc = (int)(uintptr_t)cmd->UserCallbackData;
                 int f = (enc >> 8) & 0xFF;
                 int w = enc & 0xFF;
-                if (f < 2 && w < 3 && g_MetalSamplers[f][w])
+                if (f < 3 && w < 3 && g_MetalSamplers[f][w])
                 {
                     id<MTLSamplerState> s = (__bridge id<MTLSamplerState>)g_MetalSamplers[f][w];
                     [encoder setFragmentSamplerState:s atIndex:0];
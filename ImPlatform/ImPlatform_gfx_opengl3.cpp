@@ -160,6 +160,120 @@
 #ifndef GL_DEPTH32F_STENCIL8
 #define GL_DEPTH32F_STENCIL8              0x8CAD
 #endif
+// Pixel buffer objects, buffer mapping and sync objects (texture streaming)
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER            0x88EC
+#endif
+#ifndef GL_UNPACK_ALIGNMENT
+#define GL_UNPACK_ALIGNMENT               0x0CF5
+#endif
+#ifndef GL_PIXEL_PACK_BUFFER
+#define GL_PIXEL_PACK_BUFFER              0x88EB
+#endif
+#ifndef GL_PACK_ALIGNMENT
+#define GL_PACK_ALIGNMENT                 0x0D05
+#endif
+#ifndef GL_STREAM_READ
+#define GL_STREAM_READ                    0x88E1
+#endif
+#ifndef GL_MAP_READ_BIT
+#define GL_MAP_READ_BIT                   0x0001
+#endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT                  0x0002
+#endif
+#ifndef GL_MAP_INVALIDATE_RANGE_BIT
+#define GL_MAP_INVALIDATE_RANGE_BIT       0x0004
+#endif
+#ifndef GL_MAP_UNSYNCHRONIZED_BIT
+#define GL_MAP_UNSYNCHRONIZED_BIT         0x0020
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT             0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT               0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
+#endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED                0x911B
+#endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED                    0x911D
+#endif
+#ifndef GL_MAJOR_VERSION
+#define GL_MAJOR_VERSION                  0x821B
+#endif
+#ifndef GL_MINOR_VERSION
+#define GL_MINOR_VERSION                  0x821C
+#endif
+#ifndef GL_NUM_EXTENSIONS
+#define GL_NUM_EXTENSIONS                 0x821D
+#endif
+#ifndef GL_TEXTURE_MAX_LEVEL
+#define GL_TEXTURE_MAX_LEVEL              0x813D
+#endif
+#ifndef GL_LINEAR_MIPMAP_LINEAR
+#define GL_LINEAR_MIPMAP_LINEAR           0x2703
+#endif
+// Block-compressed formats (S3TC, RGTC, BPTC, ETC2, ASTC)
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT  0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT  0x83F2
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT  0x83F3
+#endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+#define GL_COMPRESSED_RED_RGTC1           0x8DBB
+#endif
+#ifndef GL_COMPRESSED_RG_RGTC2
+#define GL_COMPRESSED_RG_RGTC2            0x8DBD
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM     0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
+#define GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT 0x8E8F
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2           0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC      0x9278
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR   0x93B0
+#endif
+// Framebuffer objects (GL 3.0 / ES 3.0)
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER                    0x8D40
+#endif
+#ifndef GL_READ_FRAMEBUFFER
+#define GL_READ_FRAMEBUFFER               0x8CA8
+#endif
+#ifndef GL_DRAW_FRAMEBUFFER
+#define GL_DRAW_FRAMEBUFFER               0x8CA9
+#endif
+#ifndef GL_FRAMEBUFFER_BINDING
+#define GL_FRAMEBUFFER_BINDING            0x8CA6
+#endif
+#ifndef GL_READ_FRAMEBUFFER_BINDING
+#define GL_READ_FRAMEBUFFER_BINDING       0x8CAA
+#endif
+#ifndef GL_DRAW_FRAMEBUFFER_BINDING
+#define GL_DRAW_FRAMEBUFFER_BINDING       0x8CA6
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0              0x8CE0
+#endif
 
 // Load additional GL function pointers not in the stripped loader
 typedef void (APIENTRYP PFNGLUNIFORM1FVPROC) (GLint location, GLsizei count, const GLfloat *value);
@@ -173,6 +287,41 @@ typedef void (APIENTRYP PFNGLGENSAMPLERSPROC)         (GLsizei count, GLuint *sa
 typedef void (APIENTRYP PFNGLDELETESAMPLERSPROC)      (GLsizei count, const GLuint *samplers);
 typedef void (APIENTRYP PFNGLBINDSAMPLERPROC)         (GLuint unit, GLuint sampler);
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIPROC)   (GLuint sampler, GLenum pname, GLint param);
+// Buffer mapping (GL 3.0), persistent storage (GL 4.4 / GL_ARB_buffer_storage) and sync objects (GL 3.2).
+// GLsync is not declared by the stripped loader, hence the _LOCAL names for the sync entry points.
+typedef struct ImPlatform_GLsync_T* ImPlatform_GLsync;
+typedef void      (APIENTRYP PFNGLBUFFERSTORAGEPROC)        (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+typedef void*     (APIENTRYP PFNGLMAPBUFFERRANGEPROC)       (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC)          (GLenum target);
+typedef ImPlatform_GLsync (APIENTRYP PFNGLFENCESYNCPROC_LOCAL) (GLenum condition, GLbitfield flags);
+typedef GLenum    (APIENTRYP PFNGLCLIENTWAITSYNCPROC_LOCAL) (ImPlatform_GLsync sync, GLbitfield flags, uint64_t timeout);
+typedef void      (APIENTRYP PFNGLDELETESYNCPROC_LOCAL)     (ImPlatform_GLsync sync);
+// Framebuffer objects and blits (GL 3.0 / ES 3.0)
+typedef void      (APIENTRYP PFNGLGENFRAMEBUFFERSPROC_LOCAL)      (GLsizei n, GLuint *framebuffers);
+typedef void      (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC_LOCAL)   (GLsizei n, const GLuint *framebuffers);
+typedef void      (APIENTRYP PFNGLBINDFRAMEBUFFERPROC_LOCAL)      (GLenum target, GLuint framebuffer);
+typedef void      (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef void      (APIENTRYP PFNGLBLITFRAMEBUFFERPROC_LOCAL)      (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+// Mipmap generation (GL 3.0 / ES 3.0)
+typedef void      (APIENTRYP PFNGLGENERATEMIPMAPPROC_LOCAL) (GLenum target);
+// Instanced drawing (GL 3.3 / ES 3.0)
+typedef void      (APIENTRYP PFNGLVERTEXATTRIBDIVISORPROC_LOCAL)   (GLuint index, GLuint divisor);
+typedef void      (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDPROC_LOCAL) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+// Base vertex (GL 3.2 / ES 3.2) and multi-draw indirect (GL 4.3 / GL_ARB_multi_draw_indirect)
+typedef void      (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC_LOCAL) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
+typedef void      (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL)       (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+// Uniform reflection (GL 2.0 / ES 2.0) and uniform buffers (GL 3.1 / ES 3.0)
+typedef void      (APIENTRYP PFNGLGETACTIVEUNIFORMPROC_LOCAL) (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+typedef void      (APIENTRYP PFNGLGETACTIVEUNIFORMSIVPROC_LOCAL)       (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
+typedef void      (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKIVPROC_LOCAL)   (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
+typedef void      (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC_LOCAL) (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
+typedef void      (APIENTRYP PFNGLUNIFORMBLOCKBINDINGPROC_LOCAL)       (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+typedef void      (APIENTRYP PFNGLBINDBUFFERRANGEPROC_LOCAL)           (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+// Parallel shader compilation (GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile)
+typedef void      (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_LOCAL) (GLuint count);
+// Compressed texture upload (GL 1.3 / ES 2.0)
+typedef void      (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE2DPROC_LOCAL)    (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+typedef void      (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC_LOCAL) (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
 
 static PFNGLUNIFORM1FVPROC glUniform1fv_Ptr = NULL;
 static PFNGLUNIFORM2FVPROC glUniform2fv_Ptr = NULL;
@@ -184,6 +333,35 @@ static PFNGLGENSAMPLERSPROC       glGenSamplers_Ptr       = NULL;
 static PFNGLDELETESAMPLERSPROC    glDeleteSamplers_Ptr    = NULL;
 static PFNGLBINDSAMPLERPROC       glBindSampler_Ptr       = NULL;
 static PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri_Ptr = NULL;
+static PFNGLBUFFERSTORAGEPROC        glBufferStorage_Ptr  = NULL;
+static PFNGLMAPBUFFERRANGEPROC       glMapBufferRange_Ptr = NULL;
+static PFNGLUNMAPBUFFERPROC          glUnmapBuffer_Ptr    = NULL;
+static PFNGLFENCESYNCPROC_LOCAL      glFenceSync_Ptr      = NULL;
+static PFNGLCLIENTWAITSYNCPROC_LOCAL glClientWaitSync_Ptr = NULL;
+static PFNGLDELETESYNCPROC_LOCAL     glDeleteSync_Ptr     = NULL;
+static PFNGLGENERATEMIPMAPPROC_LOCAL glGenerateMipmap_Ptr = NULL;
+static PFNGLGENFRAMEBUFFERSPROC_LOCAL      glGenFramebuffers_Ptr      = NULL;
+static PFNGLDELETEFRAMEBUFFERSPROC_LOCAL   glDeleteFramebuffers_Ptr   = NULL;
+static PFNGLBINDFRAMEBUFFERPROC_LOCAL      glBindFramebuffer_Ptr      = NULL;
+static PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL glFramebufferTexture2D_Ptr = NULL;
+static PFNGLBLITFRAMEBUFFERPROC_LOCAL      glBlitFramebuffer_Ptr      = NULL;
+static PFNGLVERTEXATTRIBDIVISORPROC_LOCAL   glVertexAttribDivisor_Ptr   = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDPROC_LOCAL glDrawElementsInstanced_Ptr = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC_LOCAL glDrawElementsInstancedBaseVertex_Ptr = NULL;
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL       glMultiDrawElementsIndirect_Ptr       = NULL;
+static bool g_HasMultiDrawIndirect = false; // glMultiDrawElementsIndirect usable on this context
+static PFNGLGETACTIVEUNIFORMPROC_LOCAL glGetActiveUniform_Ptr = NULL;
+static PFNGLGETACTIVEUNIFORMSIVPROC_LOCAL       glGetActiveUniformsiv_Ptr       = NULL;
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC_LOCAL   glGetActiveUniformBlockiv_Ptr   = NULL;
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC_LOCAL glGetActiveUniformBlockName_Ptr = NULL;
+static PFNGLUNIFORMBLOCKBINDINGPROC_LOCAL       glUniformBlockBinding_Ptr       = NULL;
+static PFNGLBINDBUFFERRANGEPROC_LOCAL           glBindBufferRange_Ptr           = NULL;
+static bool   g_HasUniformBuffers = false;      // Uniform blocks can be reflected and bound (GL 3.1 / ES 3.0)
+static GLint  g_UniformBufferAlignment = 256;   // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_LOCAL glMaxShaderCompilerThreads_Ptr = NULL;
+static bool   g_HasParallelShaderCompile = false; // GL_COMPLETION_STATUS_KHR can be polled
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC_LOCAL    glCompressedTexImage2D_Ptr    = NULL;
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC_LOCAL glCompressedTexSubImage2D_Ptr = NULL;
 
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
     // Need to link with opengl32.lib
@@ -203,27 +381,106 @@ static ImPlatform_GfxData_OpenGL3 g_GfxData = {};
 unsigned int g_ImPlatform_BackbufferW = 0;
 unsigned int g_ImPlatform_BackbufferH = 0;
 
-// Render texture tracking
-struct ImPlatform_RTTracking_GL {
-    GLuint       tex;
-    unsigned int width, height;
-    ImPlatform_RTTracking_GL* next;
-};
-static ImPlatform_RTTracking_GL* g_RTTrackingHead = nullptr;
-
 // Saved GL state for Begin/EndRenderToTexture
 static GLint g_SavedFBO      = 0;
 static GLint g_SavedViewport[4] = {};
-static GLuint g_RTFbo        = 0;
+static GLuint g_RTFbo        = 0;   // Framebuffer of the render texture being drawn to, owned by its texture info
+
+// Framebuffers reused by ImPlatform_CopyTexture for textures that have none of their own
+static GLuint g_BlitFbos[2]     = {};   // Read, draw
+static GLuint g_BlitFboTex[2]   = {};   // Texture attached to each, 0 if none
 
 // Cached draw data for custom shader callbacks (needed for multi-viewport support)
 static ImDrawData* g_CurrentDrawData = nullptr;
+// True while ImGui draw data is being rendered (draw callbacks run)
+static bool g_RenderingDrawData = false;
+
+// Shader constants pushed while the frame is built, read back by their draw callbacks.
+// Reset when the next frame starts.
+static ImPlatform_FrameArena g_ShaderConstantsArena = {};
+static ImDrawList* g_CustomShaderDrawList = nullptr;  // Draw list of the open BeginCustomShader
+static GLuint g_ShaderConstantsBuffer = 0;            // Used when the transient ring is unavailable
+
+// Texture format cache, filled at creation so updates never query the driver.
+// Bucketed by texture name.
+struct ImPlatform_TexInfo_GL {
+    GLuint       tex;
+    GLenum       format;
+    GLenum       type;
+    int          bytes_per_pixel;
+    unsigned int width, height;
+    ImU64        version;           // ImImageBuffer::version last uploaded
+    bool         has_version;
+    unsigned int mip_levels;
+    bool         mips_dirty;        // Level 0 changed, the chain is regenerated before the next render
+    ImPlatform_PixelFormat pixel_format;
+    GLint        internal_format;
+    unsigned int block_bytes;       // Block-compressed: bytes per 4x4 block, 0 otherwise
+    bool         render_target;     // Created by ImPlatform_CreateRenderTexture
+    GLuint       fbo;               // Render targets: framebuffer with the texture attached, created on first use
+    ImPlatform_TexInfo_GL* next;
+};
+#define IMPLATFORM_GL_TEXINFO_BUCKETS 64
+static ImPlatform_TexInfo_GL* g_TexInfoBuckets[IMPLATFORM_GL_TEXINFO_BUCKETS] = {};
+static int g_MipsDirtyCount = 0;
+
+// Texture streaming ring: one pixel buffer object used as a ring, persistently
+// mapped when GL_ARB_buffer_storage is available. Ring space is recycled with
+// fences inserted once per frame. The ring grows on demand, this is only the
+// initial allocation.
+#ifndef IMPLATFORM_GL_STREAMING_RING_SIZE
+#define IMPLATFORM_GL_STREAMING_RING_SIZE (32u * 1024u * 1024u)
+#endif
+#define IMPLATFORM_GL_MAX_UPLOAD_FENCES 8
+struct ImPlatform_UploadFence_GL {
+    ImPlatform_GLsync sync;
+    uint64_t          ringEnd;      // Ring position covered by this fence
+};
+struct ImPlatform_StreamRing_GL {
+    bool           supported;       // PBO + map range + sync objects available
+    bool           persistent;      // GL_ARB_buffer_storage persistent coherent mapping
+    GLuint         pbo;
+    unsigned char* mapped;          // Persistent mapping, NULL when mapping per upload
+    size_t         capacity;
+    uint64_t       head;            // Monotonic byte positions, buffer offset = position % capacity
+    uint64_t       tail;
+    uint64_t       fencedHead;
+    ImPlatform_UploadFence_GL fences[IMPLATFORM_GL_MAX_UPLOAD_FENCES];
+    int            fenceFirst;
+    int            fenceCount;
+};
+static ImPlatform_StreamRing_GL g_StreamRing = {};
 
-// Sampler override state - [filter][wrap]: filter 0=Nearest 1=Linear, wrap 0=Clamp 1=Wrap 2=Mirror
-static GLuint g_Samplers[2][3]  = {};
+// Upload opened by ImPlatform_BeginTextureUpload
+struct ImPlatform_OpenUpload_GL {
+    ImPlatform_TexInfo_GL* info;
+    size_t       offset;
+    unsigned int x, y, width, height;
+};
+static ImPlatform_OpenUpload_GL g_OpenUpload = {};
+
+static void ImPlatform_GL_PushUploadFence(void);
+static void ImPlatform_GL_RetireUploads(void);
+static void ImPlatform_GL_FlushMips(void);
+static void ImPlatform_GL_DestroyStreaming(void);
+static void ImPlatform_GL_DestroyFramebuffers(void);
+static void ImPlatform_GL_EndTransientFrame(void);
+static void ImPlatform_GL_DestroyTransient(void);
+static void ImPlatform_GL_DestroyShaderConstants(void);
+static void ImPlatform_GL_DispatchReadbacks(void);
+static void ImPlatform_GL_DestroyReadbacks(void);
+
+// Sampler override state - [filter][wrap]: filter 0=Nearest 1=Linear 2=LinearMipLinear, wrap 0=Clamp 1=Wrap 2=Mirror
+static GLuint g_Samplers[3][3]  = {};
 static GLuint g_SamplerStack[8] = {};
 static int    g_SamplerDepth    = 0;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+// Block-compressed formats the context samples natively, indexed from ImPlatform_PixelFormat_BC1
+static bool g_CompressedSupported[ImPlatform_PixelFormat_ASTC_4x4 - ImPlatform_PixelFormat_BC1 + 1] = {};
+static void ImPlatform_GL_DetectCompressedFormats(int version);
+#endif
+
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
 static HGLRC g_hRC = NULL; // Shared GL context for main window
 static int g_Width = 1280;
@@ -385,6 +642,16 @@ IMPLATFORM_API bool ImPlatform_InitGfx(void)
     if (!ImGui_ImplOpenGL3_Init(glsl_version))
         return false;
 
+    // Program binaries are only valid for the driver that produced them
+    {
+        const char* vendor   = (const char*)glGetString(GL_VENDOR);
+        const char* renderer = (const char*)glGetString(GL_RENDERER);
+        const char* version  = (const char*)glGetString(GL_VERSION);
+        char device_id[512];
+        snprintf(device_id, sizeof(device_id), "%s|%s|%s", vendor ? vendor : "", renderer ? renderer : "", version ? version : "");
+        ImPlatform_ShaderCacheOpen("opengl3", device_id, strlen(device_id));
+    }
+
     // Load additional GL function pointers not in the stripped loader
     glUniform1fv_Ptr = (PFNGLUNIFORM1FVPROC)imgl3wGetProcAddress("glUniform1fv");
     glUniform2fv_Ptr = (PFNGLUNIFORM2FVPROC)imgl3wGetProcAddress("glUniform2fv");
@@ -398,17 +665,109 @@ IMPLATFORM_API bool ImPlatform_InitGfx(void)
     glBindSampler_Ptr       = (PFNGLBINDSAMPLERPROC)imgl3wGetProcAddress("glBindSampler");
     glSamplerParameteri_Ptr = (PFNGLSAMPLERPARAMETERIPROC)imgl3wGetProcAddress("glSamplerParameteri");
 
-    // Create 6 sampler objects for all filter/wrap combinations (GL 3.3+)
+    glBufferStorage_Ptr  = (PFNGLBUFFERSTORAGEPROC)imgl3wGetProcAddress("glBufferStorage");
+    glMapBufferRange_Ptr = (PFNGLMAPBUFFERRANGEPROC)imgl3wGetProcAddress("glMapBufferRange");
+    glUnmapBuffer_Ptr    = (PFNGLUNMAPBUFFERPROC)imgl3wGetProcAddress("glUnmapBuffer");
+    glFenceSync_Ptr      = (PFNGLFENCESYNCPROC_LOCAL)imgl3wGetProcAddress("glFenceSync");
+    glClientWaitSync_Ptr = (PFNGLCLIENTWAITSYNCPROC_LOCAL)imgl3wGetProcAddress("glClientWaitSync");
+    glDeleteSync_Ptr     = (PFNGLDELETESYNCPROC_LOCAL)imgl3wGetProcAddress("glDeleteSync");
+    glGenerateMipmap_Ptr = (PFNGLGENERATEMIPMAPPROC_LOCAL)imgl3wGetProcAddress("glGenerateMipmap");
+    glGenFramebuffers_Ptr      = (PFNGLGENFRAMEBUFFERSPROC_LOCAL)imgl3wGetProcAddress("glGenFramebuffers");
+    glDeleteFramebuffers_Ptr   = (PFNGLDELETEFRAMEBUFFERSPROC_LOCAL)imgl3wGetProcAddress("glDeleteFramebuffers");
+    glBindFramebuffer_Ptr      = (PFNGLBINDFRAMEBUFFERPROC_LOCAL)imgl3wGetProcAddress("glBindFramebuffer");
+    glFramebufferTexture2D_Ptr = (PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL)imgl3wGetProcAddress("glFramebufferTexture2D");
+    glBlitFramebuffer_Ptr      = (PFNGLBLITFRAMEBUFFERPROC_LOCAL)imgl3wGetProcAddress("glBlitFramebuffer");
+    glVertexAttribDivisor_Ptr   = (PFNGLVERTEXATTRIBDIVISORPROC_LOCAL)imgl3wGetProcAddress("glVertexAttribDivisor");
+    glDrawElementsInstanced_Ptr = (PFNGLDRAWELEMENTSINSTANCEDPROC_LOCAL)imgl3wGetProcAddress("glDrawElementsInstanced");
+    glDrawElementsInstancedBaseVertex_Ptr = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC_LOCAL)imgl3wGetProcAddress("glDrawElementsInstancedBaseVertex");
+    glMultiDrawElementsIndirect_Ptr       = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC_LOCAL)imgl3wGetProcAddress("glMultiDrawElementsIndirect");
+    glGetActiveUniform_Ptr = (PFNGLGETACTIVEUNIFORMPROC_LOCAL)imgl3wGetProcAddress("glGetActiveUniform");
+    glGetActiveUniformsiv_Ptr       = (PFNGLGETACTIVEUNIFORMSIVPROC_LOCAL)imgl3wGetProcAddress("glGetActiveUniformsiv");
+    glGetActiveUniformBlockiv_Ptr   = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC_LOCAL)imgl3wGetProcAddress("glGetActiveUniformBlockiv");
+    glGetActiveUniformBlockName_Ptr = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC_LOCAL)imgl3wGetProcAddress("glGetActiveUniformBlockName");
+    glUniformBlockBinding_Ptr       = (PFNGLUNIFORMBLOCKBINDINGPROC_LOCAL)imgl3wGetProcAddress("glUniformBlockBinding");
+    glBindBufferRange_Ptr           = (PFNGLBINDBUFFERRANGEPROC_LOCAL)imgl3wGetProcAddress("glBindBufferRange");
+    glMaxShaderCompilerThreads_Ptr = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_LOCAL)imgl3wGetProcAddress("glMaxShaderCompilerThreadsKHR");
+    if (!glMaxShaderCompilerThreads_Ptr)
+        glMaxShaderCompilerThreads_Ptr = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC_LOCAL)imgl3wGetProcAddress("glMaxShaderCompilerThreadsARB");
+    glCompressedTexImage2D_Ptr    = (PFNGLCOMPRESSEDTEXIMAGE2DPROC_LOCAL)imgl3wGetProcAddress("glCompressedTexImage2D");
+    glCompressedTexSubImage2D_Ptr = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC_LOCAL)imgl3wGetProcAddress("glCompressedTexSubImage2D");
+
+    // Texture streaming needs GL 3.2 (sync objects), persistent mapping needs GL 4.4 or GL_ARB_buffer_storage,
+    // multi-draw indirect needs GL 4.3 or GL_ARB_multi_draw_indirect, parallel shader compilation
+    // is only exposed as an extension.
+    // Entry points can resolve on older contexts, so check the version as well.
+    {
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        const int version = major * 10 + minor;
+#if defined(__EMSCRIPTEN__) || defined(IMGUI_IMPL_OPENGL_ES2)
+        g_StreamRing.supported = false; // WebGL / ES2: no buffer mapping
+#elif defined(IMGUI_IMPL_OPENGL_ES3)
+        g_StreamRing.supported = version >= 30 && glMapBufferRange_Ptr && glUnmapBuffer_Ptr && glFenceSync_Ptr && glClientWaitSync_Ptr && glDeleteSync_Ptr;
+#else
+        g_StreamRing.supported = version >= 32 && glMapBufferRange_Ptr && glUnmapBuffer_Ptr && glFenceSync_Ptr && glClientWaitSync_Ptr && glDeleteSync_Ptr;
+#endif
+        bool has_buffer_storage = version >= 44;
+#if defined(__EMSCRIPTEN__) || defined(IMGUI_IMPL_OPENGL_ES2) || defined(IMGUI_IMPL_OPENGL_ES3)
+        bool has_multi_draw_indirect = false;
+#else
+        bool has_multi_draw_indirect = version >= 43;
+#endif
+        bool has_parallel_shader_compile = false;
+        if (version >= 30)
+        {
+            GLint ext_count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &ext_count);
+            for (GLint i = 0; i < ext_count; i++)
+            {
+                const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+                if (!ext)
+                    continue;
+                if (strcmp(ext, "GL_ARB_buffer_storage") == 0)
+                    has_buffer_storage = true;
+                else if (strcmp(ext, "GL_ARB_multi_draw_indirect") == 0 && version >= 40)
+                    has_multi_draw_indirect = true;
+                else if (strcmp(ext, "GL_KHR_parallel_shader_compile") == 0 || strcmp(ext, "GL_ARB_parallel_shader_compile") == 0)
+                    has_parallel_shader_compile = true;
+            }
+        }
+        g_HasParallelShaderCompile = has_parallel_shader_compile;
+        if (g_HasParallelShaderCompile && glMaxShaderCompilerThreads_Ptr)
+            glMaxShaderCompilerThreads_Ptr(0xFFFFFFFFu); // Let the driver pick
+        g_StreamRing.persistent = g_StreamRing.supported && has_buffer_storage && glBufferStorage_Ptr;
+        g_HasMultiDrawIndirect = has_multi_draw_indirect && glMultiDrawElementsIndirect_Ptr;
+#if defined(__EMSCRIPTEN__) || defined(IMGUI_IMPL_OPENGL_ES3)
+        const bool has_uniform_buffers = version >= 30;
+#else
+        const bool has_uniform_buffers = version >= 31;
+#endif
+        g_HasUniformBuffers = has_uniform_buffers && glGetActiveUniformsiv_Ptr && glGetActiveUniformBlockiv_Ptr &&
+                              glGetActiveUniformBlockName_Ptr && glUniformBlockBinding_Ptr && glBindBufferRange_Ptr;
+        if (g_HasUniformBuffers)
+        {
+            glGetIntegerv(0x8A34 /*GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT*/, &g_UniformBufferAlignment);
+            if (g_UniformBufferAlignment <= 0)
+                g_UniformBufferAlignment = 256;
+        }
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+        ImPlatform_GL_DetectCompressedFormats(version);
+#endif
+    }
+
+    // Create 9 sampler objects for all filter/wrap combinations (GL 3.3+)
     if (glGenSamplers_Ptr && glSamplerParameteri_Ptr)
     {
-        static const GLint kMinMag[2] = { 0x2600 /*GL_NEAREST*/, 0x2601 /*GL_LINEAR*/ };
+        static const GLint kMin[3]    = { 0x2600 /*GL_NEAREST*/, 0x2601 /*GL_LINEAR*/, 0x2703 /*GL_LINEAR_MIPMAP_LINEAR*/ };
+        static const GLint kMag[3]    = { 0x2600 /*GL_NEAREST*/, 0x2601 /*GL_LINEAR*/, 0x2601 /*GL_LINEAR*/ };
         static const GLint kWrap[3]   = { 0x812F /*GL_CLAMP_TO_EDGE*/, 0x2901 /*GL_REPEAT*/, 0x8370 /*GL_MIRRORED_REPEAT*/ };
-        for (int f = 0; f < 2; ++f)
+        for (int f = 0; f < 3; ++f)
         for (int w = 0; w < 3; ++w)
         {
             glGenSamplers_Ptr(1, &g_Samplers[f][w]);
-            glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2801 /*GL_TEXTURE_MIN_FILTER*/, kMinMag[f]);
-            glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2800 /*GL_TEXTURE_MAG_FILTER*/, kMinMag[f]);
+            glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2801 /*GL_TEXTURE_MIN_FILTER*/, kMin[f]);
+            glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2800 /*GL_TEXTURE_MAG_FILTER*/, kMag[f]);
             glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2802 /*GL_TEXTURE_WRAP_S*/,     kWrap[w]);
             glSamplerParameteri_Ptr(g_Samplers[f][w], 0x2803 /*GL_TEXTURE_WRAP_T*/,     kWrap[w]);
         }
@@ -445,6 +804,11 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplOpenGL3_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
+    ImPlatform_GL_DispatchReadbacks();
+
+    // Every viewport of the previous frame has been rendered
+    ImPlatform_FrameArena_Reset(&g_ShaderConstantsArena);
 }
 
 // ImPlatform API - GfxAPIClear
@@ -452,15 +816,21 @@ IMPLATFORM_API bool ImPlatform_GfxAPIClear(ImVec4 const vClearColor)
 {
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
     glViewport(0, 0, g_Width, g_Height);
+    g_ImPlatform_BackbufferW = (unsigned int)g_Width;
+    g_ImPlatform_BackbufferH = (unsigned int)g_Height;
 #elif defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_GLFW)
     // GLFW handles viewport through framebuffer size callback
     int display_w, display_h;
     glfwGetFramebufferSize(ImPlatform_App_GetGLFWWindow(), &display_w, &display_h);
     glViewport(0, 0, display_w, display_h);
+    g_ImPlatform_BackbufferW = (unsigned int)display_w;
+    g_ImPlatform_BackbufferH = (unsigned int)display_h;
 #elif defined(IM_CURRENT_PLATFORM) && ((IM_CURRENT_PLATFORM == IM_PLATFORM_SDL2) || (IM_CURRENT_PLATFORM == IM_PLATFORM_SDL3))
     // SDL handles viewport through display size
     ImGuiIO& io = ImGui::GetIO();
     glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
+    g_ImPlatform_BackbufferW = (unsigned int)io.DisplaySize.x;
+    g_ImPlatform_BackbufferH = (unsigned int)io.DisplaySize.y;
 #endif
 
     glClearColor(vClearColor.x, vClearColor.y, vClearColor.z, vClearColor.w);
@@ -477,7 +847,13 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
     // Cache draw data for custom shader callbacks
     g_CurrentDrawData = draw_data;
 
+    ImPlatform_GL_FlushMips();
+    g_RenderingDrawData = true;
     ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    g_RenderingDrawData = false;
+
+    // Video capture: blits the backbuffer and queues its readback
+    ImPlatform_Capture_EndFrame();
     return true;
 }
 
@@ -494,8 +870,10 @@ static void ImPlatform_RendererRenderWindowWrapper(ImGuiViewport* viewport, void
     g_CurrentDrawData = viewport->DrawData;
 
     // Call the original ImGui OpenGL3 renderer
+    g_RenderingDrawData = true;
     if (g_OriginalRendererRenderWindow)
         g_OriginalRendererRenderWindow(viewport, renderer_arg);
+    g_RenderingDrawData = false;
 }
 
 IMPLATFORM_API void ImPlatform_GfxViewportPre(void)
@@ -545,6 +923,11 @@ IMPLATFORM_API void ImPlatform_GfxViewportPost(void)
 // ImPlatform API - GfxAPISwapBuffer
 IMPLATFORM_API bool ImPlatform_GfxAPISwapBuffer(void)
 {
+    // Fence this frame's texture uploads and recycle ring space the GPU is done with
+    ImPlatform_GL_PushUploadFence();
+    ImPlatform_GL_RetireUploads();
+    ImPlatform_GL_EndTransientFrame();
+
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
     ::SwapBuffers(g_MainWindow.hDC);
 #elif defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_GLFW)
@@ -566,11 +949,20 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
     if (glDeleteSamplers_Ptr)
-        for (int f = 0; f < 2; ++f)
+        for (int f = 0; f < 3; ++f)
         for (int w = 0; w < 3; ++w)
             if (g_Samplers[f][w]) { glDeleteSamplers_Ptr(1, &g_Samplers[f][w]); g_Samplers[f][w] = 0; }
 
+    ImPlatform_GL_DestroyReadbacks();
+    ImPlatform_GL_DestroyFramebuffers();
+    ImPlatform_GL_DestroyStreaming();
+    ImPlatform_GL_DestroyTransient();
+    ImPlatform_GL_DestroyShaderConstants();
+    ImPlatform_ShaderCacheClose();
+
     ImGui_ImplOpenGL3_Shutdown();
 
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
@@ -903,6 +1295,69 @@ static void ImPlatform_GetOpenGLFormat(ImPlatform_PixelFormat format, GLint* out
         *out_type = GL_INT;
         *out_channels = 1;
         break;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Compressed formats upload through glCompressedTex(Sub)Image2D, format/type/channels are unused
+    case ImPlatform_PixelFormat_BC1:
+        *out_internal_format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC2:
+        *out_internal_format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC3:
+        *out_internal_format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC4:
+        *out_internal_format = GL_COMPRESSED_RED_RGTC1;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC5:
+        *out_internal_format = GL_COMPRESSED_RG_RGTC2;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_internal_format = GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_BC7:
+        *out_internal_format = GL_COMPRESSED_RGBA_BPTC_UNORM;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_ETC2_RGB8:
+        *out_internal_format = GL_COMPRESSED_RGB8_ETC2;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_ETC2_RGBA8:
+        *out_internal_format = GL_COMPRESSED_RGBA8_ETC2_EAC;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
+    case ImPlatform_PixelFormat_ASTC_4x4:
+        *out_internal_format = GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+        *out_format = GL_RGBA;
+        *out_type = GL_UNSIGNED_BYTE;
+        *out_channels = 4;
+        break;
 #endif
     default:
         *out_internal_format = GL_RGBA8;
@@ -913,6 +1368,386 @@ static void ImPlatform_GetOpenGLFormat(ImPlatform_PixelFormat format, GLint* out
     }
 }
 
+// Bytes per pixel of client data for a format/type pair returned by ImPlatform_GetOpenGLFormat
+static int ImPlatform_GetGLBytesPerPixel(GLenum type, int channels)
+{
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:                           return channels;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:                     return channels * 2;
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_24_8:              return 4;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+    default:                                return channels * 4; // GL_FLOAT, GL_INT, GL_UNSIGNED_INT
+    }
+}
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+// Compressed formats come from core versions and extensions (WebGL exposes them as GL_WEBGL_*)
+static void ImPlatform_GL_DetectCompressedFormats(int version)
+{
+    bool s3tc = false, rgtc = false, bptc = false, etc2 = false, astc = false;
+#if defined(__EMSCRIPTEN__) || defined(IMGUI_IMPL_OPENGL_ES2) || defined(IMGUI_IMPL_OPENGL_ES3)
+    etc2 = version >= 30;
+#else
+    rgtc = version >= 30;
+    bptc = version >= 42;
+    etc2 = version >= 43;
+#endif
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    GLint ext_count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &ext_count);
+    for (GLint i = 0; i < ext_count; i++)
+    {
+        const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (!ext)
+            continue;
+        s3tc |= strstr(ext, "texture_compression_s3tc") != NULL || strstr(ext, "compressed_texture_s3tc") != NULL;
+        rgtc |= strstr(ext, "texture_compression_rgtc") != NULL;
+        bptc |= strstr(ext, "texture_compression_bptc") != NULL;
+        etc2 |= strcmp(ext, "GL_ARB_ES3_compatibility") == 0 || strstr(ext, "compressed_texture_etc") != NULL;
+        astc |= strstr(ext, "texture_compression_astc_ldr") != NULL || strstr(ext, "compressed_texture_astc") != NULL;
+    }
+#endif
+    if (!glCompressedTexImage2D_Ptr || !glCompressedTexSubImage2D_Ptr)
+        s3tc = rgtc = bptc = etc2 = astc = false;
+
+    bool* sup = g_CompressedSupported;
+    sup[ImPlatform_PixelFormat_BC1 - ImPlatform_PixelFormat_BC1]        = s3tc;
+    sup[ImPlatform_PixelFormat_BC2 - ImPlatform_PixelFormat_BC1]        = s3tc;
+    sup[ImPlatform_PixelFormat_BC3 - ImPlatform_PixelFormat_BC1]        = s3tc;
+    sup[ImPlatform_PixelFormat_BC4 - ImPlatform_PixelFormat_BC1]        = rgtc;
+    sup[ImPlatform_PixelFormat_BC5 - ImPlatform_PixelFormat_BC1]        = rgtc;
+    sup[ImPlatform_PixelFormat_BC6H - ImPlatform_PixelFormat_BC1]       = bptc;
+    sup[ImPlatform_PixelFormat_BC7 - ImPlatform_PixelFormat_BC1]        = bptc;
+    sup[ImPlatform_PixelFormat_ETC2_RGB8 - ImPlatform_PixelFormat_BC1]  = etc2;
+    sup[ImPlatform_PixelFormat_ETC2_RGBA8 - ImPlatform_PixelFormat_BC1] = etc2;
+    sup[ImPlatform_PixelFormat_ASTC_4x4 - ImPlatform_PixelFormat_BC1]   = astc;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// Texture format cache
+// ----------------------------------------------------------------------------
+
+static ImPlatform_TexInfo_GL* ImPlatform_GL_FindTexInfo(GLuint tex)
+{
+    for (ImPlatform_TexInfo_GL* e = g_TexInfoBuckets[tex % IMPLATFORM_GL_TEXINFO_BUCKETS]; e; e = e->next)
+        if (e->tex == tex)
+            return e;
+    return NULL;
+}
+
+static void ImPlatform_GL_AddTexInfo(GLuint tex, ImPlatform_PixelFormat pixel_format, unsigned int width, unsigned int height)
+{
+    GLint internal_format;
+    int channels;
+    ImPlatform_TexInfo_GL* e = new ImPlatform_TexInfo_GL();
+    ImPlatform_GetOpenGLFormat(pixel_format, &internal_format, &e->format, &e->type, &channels);
+    e->tex             = tex;
+    e->pixel_format    = pixel_format;
+    e->internal_format = internal_format;
+    e->block_bytes     = ImPlatform_CompressedBlockBytes(pixel_format);
+    e->bytes_per_pixel = e->block_bytes ? 0 : ImPlatform_GetGLBytesPerPixel(e->type, channels);
+    e->width           = width;
+    e->height          = height;
+    e->next            = g_TexInfoBuckets[tex % IMPLATFORM_GL_TEXINFO_BUCKETS];
+    g_TexInfoBuckets[tex % IMPLATFORM_GL_TEXINFO_BUCKETS] = e;
+}
+
+static void ImPlatform_GL_RemoveTexInfo(GLuint tex)
+{
+    ImPlatform_TexInfo_GL** link = &g_TexInfoBuckets[tex % IMPLATFORM_GL_TEXINFO_BUCKETS];
+    while (*link)
+    {
+        ImPlatform_TexInfo_GL* e = *link;
+        if (e->tex == tex)
+        {
+            if (g_OpenUpload.info == e)
+            {
+                // Abandon the open upload
+                if (!g_StreamRing.mapped)
+                {
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_StreamRing.pbo);
+                    glUnmapBuffer_Ptr(GL_PIXEL_UNPACK_BUFFER);
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                }
+                g_OpenUpload.info = NULL;
+            }
+            if (e->mips_dirty)
+                g_MipsDirtyCount--;
+            if (e->fbo)
+                glDeleteFramebuffers_Ptr(1, &e->fbo);
+            *link = e->next;
+            delete e;
+            return;
+        }
+        link = &e->next;
+    }
+}
+
+// Mip chains are regenerated once per frame however many updates touched level 0
+static void ImPlatform_GL_MarkMipsDirty(ImPlatform_TexInfo_GL* info)
+{
+    if (info->mip_levels > 1 && !info->mips_dirty)
+    {
+        info->mips_dirty = true;
+        g_MipsDirtyCount++;
+    }
+}
+
+static void ImPlatform_GL_FlushMips(void)
+{
+    if (g_MipsDirtyCount == 0)
+        return;
+    for (int b = 0; b < IMPLATFORM_GL_TEXINFO_BUCKETS; b++)
+        for (ImPlatform_TexInfo_GL* e = g_TexInfoBuckets[b]; e; e = e->next)
+            if (e->mips_dirty)
+            {
+                glBindTexture(GL_TEXTURE_2D, e->tex);
+                glGenerateMipmap_Ptr(GL_TEXTURE_2D);
+                e->mips_dirty = false;
+            }
+    g_MipsDirtyCount = 0;
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// ----------------------------------------------------------------------------
+// Texture streaming ring (pixel buffer object)
+// ----------------------------------------------------------------------------
+// ImPlatform_Begin/EndTextureUpload (and ImPlatform_UpdateTexture on top of
+// them) write into the ring and source glTexSubImage2D from the bound PBO, so
+// the driver DMAs asynchronously instead of copying client memory on the
+// render thread. A fence is inserted at the end of every frame that uploaded
+// something; ring space is reused once its fence has signaled. Mapping is
+// persistent+coherent with GL_ARB_buffer_storage, otherwise each upload maps
+// its range with GL_MAP_UNSYNCHRONIZED_BIT (safe, the fences guard reuse).
+
+static bool ImPlatform_GL_CreateStreamBuffer(size_t capacity)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    glGenBuffers(1, &ring->pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->pbo);
+    ring->mapped = NULL;
+    if (ring->persistent)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage_Ptr(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)capacity, NULL, flags);
+        ring->mapped = (unsigned char*)glMapBufferRange_Ptr(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)capacity, flags);
+        if (!ring->mapped)
+        {
+            // Immutable storage can't be respecified, start over with a mutable buffer
+            fprintf(stderr, "[ImPlatform] OpenGL: Persistent mapping failed, using per-upload mapping\n");
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &ring->pbo);
+            ring->persistent = false;
+            glGenBuffers(1, &ring->pbo);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->pbo);
+        }
+    }
+    if (!ring->persistent)
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)capacity, NULL, GL_STREAM_DRAW);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    ring->capacity = capacity;
+    ring->head = ring->tail = ring->fencedHead = 0;
+    return ring->pbo != 0;
+}
+
+static void ImPlatform_GL_DestroyStreamBuffer(void)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    if (!ring->pbo)
+        return;
+    if (ring->mapped)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->pbo);
+        glUnmapBuffer_Ptr(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        ring->mapped = NULL;
+    }
+    glDeleteBuffers(1, &ring->pbo);
+    ring->pbo = 0;
+    ring->capacity = 0;
+}
+
+// Retires the oldest fence. Non-blocking unless `block` is set. Returns true if a fence was retired.
+static bool ImPlatform_GL_RetireOldestUpload(bool block)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    if (ring->fenceCount == 0)
+        return false;
+    ImPlatform_UploadFence_GL* f = &ring->fences[ring->fenceFirst];
+    GLenum result;
+    if (block)
+    {
+        do { result = glClientWaitSync_Ptr(f->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull); }
+        while (result == GL_TIMEOUT_EXPIRED);
+    }
+    else
+    {
+        result = glClientWaitSync_Ptr(f->sync, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+            return false;
+    }
+    if (result == GL_WAIT_FAILED)
+        fprintf(stderr, "[ImPlatform] OpenGL: glClientWaitSync failed on upload fence\n");
+    glDeleteSync_Ptr(f->sync);
+    ring->tail = f->ringEnd;
+    ring->fenceFirst = (ring->fenceFirst + 1) % IMPLATFORM_GL_MAX_UPLOAD_FENCES;
+    ring->fenceCount--;
+    return true;
+}
+
+static void ImPlatform_GL_PushUploadFence(void)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    if (!ring->pbo || ring->head == ring->fencedHead)
+        return;
+    if (ring->fenceCount == IMPLATFORM_GL_MAX_UPLOAD_FENCES)
+        ImPlatform_GL_RetireOldestUpload(true); // Too many frames queued
+    ImPlatform_UploadFence_GL* f = &ring->fences[(ring->fenceFirst + ring->fenceCount) % IMPLATFORM_GL_MAX_UPLOAD_FENCES];
+    f->sync = glFenceSync_Ptr(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    f->ringEnd = ring->head;
+    ring->fenceCount++;
+    ring->fencedHead = ring->head;
+}
+
+static void ImPlatform_GL_RetireUploads(void)
+{
+    while (ImPlatform_GL_RetireOldestUpload(false)) {}
+}
+
+// Reserves `size` bytes in the ring and returns the buffer offset. Blocks only
+// when the GPU is more than a ring's worth of uploads behind.
+static bool ImPlatform_GL_StreamAlloc(size_t size, size_t* out_offset)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    const size_t alignment = 16; // Multiple of every GL pixel type size
+
+    if (size + alignment > ring->capacity)
+    {
+        // Grow: wait for everything in flight, then reallocate
+        size_t capacity = ring->capacity ? ring->capacity : (size_t)IMPLATFORM_GL_STREAMING_RING_SIZE;
+        while (capacity < size + alignment)
+            capacity *= 2;
+        ImPlatform_GL_PushUploadFence();
+        while (ImPlatform_GL_RetireOldestUpload(true)) {}
+        ImPlatform_GL_DestroyStreamBuffer();
+        if (!ImPlatform_GL_CreateStreamBuffer(capacity))
+            return false;
+    }
+
+    for (;;)
+    {
+        size_t offset = (size_t)(ring->head % ring->capacity);
+        size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+        uint64_t pos = ring->head + (aligned - offset);
+        if (aligned + size > ring->capacity)
+        {
+            // Skip the end of the buffer and wrap around to offset 0
+            pos = ring->head + (ring->capacity - offset);
+            aligned = 0;
+        }
+        if (pos + size - ring->tail <= ring->capacity)
+        {
+            ring->head = pos + size;
+            *out_offset = aligned;
+            return true;
+        }
+
+        // Out of room: wait for the oldest fenced frame, fencing the current uploads if needed
+        if (ring->fenceCount == 0)
+            ImPlatform_GL_PushUploadFence();
+        if (!ImPlatform_GL_RetireOldestUpload(true))
+            return false;
+    }
+}
+
+static void ImPlatform_GL_DestroyStreaming(void)
+{
+    ImPlatform_StreamRing_GL* ring = &g_StreamRing;
+    while (ring->fenceCount > 0)
+    {
+        glDeleteSync_Ptr(ring->fences[ring->fenceFirst].sync);
+        ring->fenceFirst = (ring->fenceFirst + 1) % IMPLATFORM_GL_MAX_UPLOAD_FENCES;
+        ring->fenceCount--;
+    }
+    ImPlatform_GL_DestroyStreamBuffer();
+    memset(&g_OpenUpload, 0, sizeof(g_OpenUpload));
+
+    for (int i = 0; i < IMPLATFORM_GL_TEXINFO_BUCKETS; i++)
+    {
+        while (g_TexInfoBuckets[i])
+        {
+            ImPlatform_TexInfo_GL* e = g_TexInfoBuckets[i];
+            g_TexInfoBuckets[i] = e->next;
+            delete e;
+        }
+    }
+}
+
+#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
+#define IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH 1
+#else
+#define IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH 0   // WebGL 1 / ES2: rows must be tightly packed
+#endif
+
+// glTexSubImage2D from either client memory or the bound PBO offset.
+// row_length: source row pitch in pixels, 0 for tightly packed rows.
+static void ImPlatform_GL_TexSubImage(ImPlatform_TexInfo_GL* info, unsigned int x, unsigned int y,
+                                      unsigned int width, unsigned int height, const void* pixels,
+                                      unsigned int row_length = 0)
+{
+    glBindTexture(GL_TEXTURE_2D, info->tex);
+#if IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)row_length);
+#else
+    IM_ASSERT(row_length == 0 || row_length == width);
+#endif
+    const bool unaligned_rows = (((row_length ? row_length : width) * info->bytes_per_pixel) & 3) != 0;
+    if (unaligned_rows)
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, info->format, info->type, pixels);
+    if (unaligned_rows)
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+#if IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH
+    if (row_length)
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+    ImPlatform_GL_MarkMipsDirty(info);
+}
+
+// Reserves `size` bytes in the streaming ring and returns a CPU pointer to them
+// (persistent mapping, or a per-upload unsynchronized map). NULL when streaming
+// is unavailable or an ImPlatform_BeginTextureUpload is still open.
+// Pair with ImPlatform_GL_UnmapStream before sourcing the PBO.
+static void* ImPlatform_GL_MapStream(size_t size, size_t* out_offset)
+{
+    if (!g_StreamRing.supported || g_OpenUpload.info || !ImPlatform_GL_StreamAlloc(size, out_offset))
+        return NULL;
+    if (g_StreamRing.mapped)
+        return g_StreamRing.mapped + *out_offset;
+
+    // The ring fences guarantee the range is no longer read by the GPU
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_StreamRing.pbo);
+    void* dst = glMapBufferRange_Ptr(GL_PIXEL_UNPACK_BUFFER, (GLintptr)*out_offset, (GLsizeiptr)size,
+                                     GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return dst;
+}
+
+// Leaves the ring bound to GL_PIXEL_UNPACK_BUFFER; unbind after the texture copy
+static void ImPlatform_GL_UnmapStream(void)
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_StreamRing.pbo);
+    if (!g_StreamRing.mapped)
+        glUnmapBuffer_Ptr(GL_PIXEL_UNPACK_BUFFER);
+}
+
 IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned int width, unsigned int height)
 {
     ImPlatform_TextureDesc desc;
@@ -923,6 +1758,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -938,11 +1774,19 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigne
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return 0; }
 
-IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
 {
-    if (!desc || !pixel_data)
-        return 0;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+        return g_CompressedSupported[format - ImPlatform_PixelFormat_BC1];
+#endif
+    (void)format;
+    return true;
+}
 
+// row_length: source row pitch in pixels, 0 for tightly packed rows
+static GLuint ImPlatform_GL_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc, unsigned int row_length)
+{
     GLint internal_format;
     GLenum format;
     GLenum type;
@@ -953,9 +1797,16 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     glGenTextures(1, &texture_id);
     glBindTexture(GL_TEXTURE_2D, texture_id);
 
+    // Levels past the base one are allocated and filled by glGenerateMipmap (not for compressed formats)
+    const bool compressed = ImPlatform_CompressedBlockBytes(desc->format) != 0;
+    const unsigned int mip_levels = glGenerateMipmap_Ptr && !compressed ? ImPlatform_TextureMipCount(desc) : 1;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)mip_levels - 1);
+
     // Set filtering
     GLint min_filter = (desc->min_filter == ImPlatform_TextureFilter_Nearest) ? GL_NEAREST : GL_LINEAR;
     GLint mag_filter = (desc->mag_filter == ImPlatform_TextureFilter_Nearest) ? GL_NEAREST : GL_LINEAR;
+    if (desc->min_filter == ImPlatform_TextureFilter_LinearMipLinear && mip_levels > 1)
+        min_filter = GL_LINEAR_MIPMAP_LINEAR;
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min_filter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag_filter);
 
@@ -976,24 +1827,99 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap_s);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap_t);
 
-#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (compressed)
+    {
+        // Blocks are always tightly packed
+        glCompressedTexImage2D_Ptr(GL_TEXTURE_2D, 0, (GLenum)internal_format, desc->width, desc->height, 0,
+                                   (GLsizei)ImPlatform_CompressedSize(desc->format, desc->width, desc->height), pixel_data);
+    }
+    else
+#endif
+    {
+#if IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)row_length);
+#endif
+        const bool unaligned_rows = (((row_length ? row_length : desc->width) * ImPlatform_GetGLBytesPerPixel(type, channels)) & 3) != 0;
+        if (unaligned_rows)
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        // Upload texture data
+        glTexImage2D(GL_TEXTURE_2D, 0, internal_format, desc->width, desc->height, 0, format, type, pixel_data);
+
+        if (unaligned_rows)
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+#if IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH
+        if (row_length)
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
+    }
 
-    // Upload texture data
-    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, desc->width, desc->height, 0, format, type, pixel_data);
+    // Cache format/type so updates don't have to query them back
+    ImPlatform_GL_AddTexInfo(texture_id, desc->format, desc->width, desc->height);
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(texture_id);
+    info->mip_levels = mip_levels;
+    ImPlatform_GL_MarkMipsDirty(info);
 
-    return (ImTextureID)(intptr_t)texture_id;
+    return texture_id;
 }
 
-IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void* pixel_data,
-                                              unsigned int x, unsigned int y,
-                                              unsigned int width, unsigned int height)
+IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
 {
-    if (!texture_id || !pixel_data)
+    if (!desc)
+        return 0;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(desc->format) && !ImPlatform_SupportsPixelFormat(desc->format))
+        return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+#endif
+
+    return (ImTextureID)(intptr_t)ImPlatform_GL_CreateTexture(pixel_data, desc, 0);
+}
+
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID texture_id, unsigned int x, unsigned int y,
+                                                   unsigned int width, unsigned int height)
+{
+    if (!texture_id || !g_StreamRing.supported || g_OpenUpload.info)
+        return NULL;
+
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo((GLuint)(intptr_t)texture_id);
+    if (!info || info->block_bytes || width == 0 || height == 0 || x + width > info->width || y + height > info->height)
+        return NULL;
+
+    size_t offset;
+    void* dst = ImPlatform_GL_MapStream((size_t)width * height * info->bytes_per_pixel, &offset);
+    if (!dst)
+        return NULL;
+
+    g_OpenUpload.info   = info;
+    g_OpenUpload.offset = offset;
+    g_OpenUpload.x      = x;
+    g_OpenUpload.y      = y;
+    g_OpenUpload.width  = width;
+    g_OpenUpload.height = height;
+    return dst;
+}
+
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID texture_id)
+{
+    ImPlatform_TexInfo_GL* info = g_OpenUpload.info;
+    if (!texture_id || !info || info->tex != (GLuint)(intptr_t)texture_id)
         return false;
+    g_OpenUpload.info = NULL;
 
-    GLuint tex = (GLuint)(intptr_t)texture_id;
+    ImPlatform_GL_UnmapStream();
+    ImPlatform_GL_TexSubImage(info, g_OpenUpload.x, g_OpenUpload.y, g_OpenUpload.width, g_OpenUpload.height,
+                              (const void*)(intptr_t)g_OpenUpload.offset);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return true;
+}
+
+// Legacy path for textures not created through ImPlatform (no cached format)
+static bool ImPlatform_GL_UpdateForeignTexture(GLuint tex, const void* pixel_data,
+                                               unsigned int x, unsigned int y,
+                                               unsigned int width, unsigned int height)
+{
     glBindTexture(GL_TEXTURE_2D, tex);
 
     // Get texture format info
@@ -1030,6 +1956,149 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     return true;
 }
 
+IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void* pixel_data,
+                                              unsigned int x, unsigned int y,
+                                              unsigned int width, unsigned int height)
+{
+    if (!texture_id || !pixel_data)
+        return false;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
+    GLuint tex = (GLuint)(intptr_t)texture_id;
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(tex);
+    if (!info)
+        return ImPlatform_GL_UpdateForeignTexture(tex, pixel_data, x, y, width, height);
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (info->block_bytes)
+    {
+        if (!ImPlatform_CompressedRegionValid(x, y, width, height, info->width, info->height))
+            return false;
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glCompressedTexSubImage2D_Ptr(GL_TEXTURE_2D, 0, x, y, width, height, (GLenum)info->internal_format,
+                                      (GLsizei)ImPlatform_CompressedSize(info->pixel_format, width, height), pixel_data);
+        return true;
+    }
+#endif
+
+    // Stream through the PBO ring: one memcpy, the texture copy happens asynchronously
+    if (void* dst = ImPlatform_BeginTextureUpload(texture_id, x, y, width, height))
+    {
+        memcpy(dst, pixel_data, (size_t)width * height * info->bytes_per_pixel);
+        return ImPlatform_EndTextureUpload(texture_id);
+    }
+
+    ImPlatform_GL_TexSubImage(info, x, y, width, height, pixel_data);
+    return true;
+}
+
+// Source row pitch in pixels GL can consume in place, or -1 if the layout needs a repack
+static int ImPlatform_GL_ImageBufferRowLength(const ImImageBuffer* buffer)
+{
+    if (ImPlatform_ImageBufferNeedsConversion(buffer))
+        return -1;
+    switch (ImPlatform_ImageBufferClassify(buffer))
+    {
+    case ImPlatform_ImageBufferLayout_Tight:
+        return 0;
+#if IMPLATFORM_GL_HAS_UNPACK_ROW_LENGTH
+    case ImPlatform_ImageBufferLayout_RowPitch:
+        return (int)(buffer->y_stride_bytes / (ptrdiff_t)ImPlatform_ImageBufferPixelBytes(buffer));
+#endif
+    default:
+        return -1;
+    }
+}
+
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc)
+{
+    ImPlatform_PixelFormat pixel_format;
+    if (!ImPlatform_ImageBufferResolveFormat(buffer, desc, &pixel_format))
+        return 0;
+
+    ImPlatform_TextureDesc d = desc ? *desc : ImPlatform_TextureDesc_Default(buffer->width, buffer->height);
+    d.width  = buffer->width;
+    d.height = buffer->height;
+    d.format = pixel_format;
+
+    GLuint tex;
+    int row_length = ImPlatform_GL_ImageBufferRowLength(buffer);
+    if (row_length >= 0)
+    {
+        tex = ImPlatform_GL_CreateTexture(ImPlatform_ImageBufferPixel(buffer, 0, 0), &d, (unsigned int)row_length);
+    }
+    else
+    {
+        const size_t pixel_bytes = ImPlatform_ImageBufferUploadPixelBytes(buffer);
+        void* tight = malloc(pixel_bytes * buffer->width * buffer->height);
+        if (!tight)
+            return 0;
+        ImPlatform_ImageBufferCopyTight(buffer, tight, pixel_bytes);
+        tex = ImPlatform_GL_CreateTexture(tight, &d, 0);
+        free(tight);
+    }
+
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(tex);
+    info->version     = buffer->version;
+    info->has_version = true;
+    return (ImTextureID)(intptr_t)tex;
+}
+
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer)
+{
+    if (!texture_id || !buffer || !buffer->host)
+        return false;
+
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo((GLuint)(intptr_t)texture_id);
+    if (!info || buffer->width != info->width || buffer->height != info->height ||
+        ImPlatform_ImageBufferUploadPixelBytes(buffer) != (size_t)info->bytes_per_pixel)
+        return false;
+    if (info->has_version && info->version == buffer->version)
+        return true; // Unchanged since the last upload
+
+    const int    row_length  = ImPlatform_GL_ImageBufferRowLength(buffer);
+    const size_t pixel_bytes = ImPlatform_ImageBufferUploadPixelBytes(buffer);
+    const size_t tight_size  = pixel_bytes * buffer->width * buffer->height;
+    // Pitched sources go through the ring as is (one memcpy, ROW_LENGTH) unless the
+    // padding would more than double the copy, e.g. a narrow ROI of a wide image
+    const size_t span_size   = row_length > 0 ? (size_t)buffer->y_stride_bytes * (buffer->height - 1) + pixel_bytes * buffer->width : tight_size;
+    const bool   copy_span   = row_length >= 0 && span_size <= tight_size * 2;
+
+    size_t offset;
+    if (void* dst = ImPlatform_GL_MapStream(copy_span ? span_size : tight_size, &offset))
+    {
+        if (copy_span)
+            memcpy(dst, ImPlatform_ImageBufferPixel(buffer, 0, 0), span_size);
+        else
+            ImPlatform_ImageBufferCopyTight(buffer, dst, pixel_bytes);
+        ImPlatform_GL_UnmapStream();
+        ImPlatform_GL_TexSubImage(info, 0, 0, buffer->width, buffer->height, (const void*)(intptr_t)offset,
+                                  copy_span ? (unsigned int)row_length : 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    else if (row_length >= 0)
+    {
+        ImPlatform_GL_TexSubImage(info, 0, 0, buffer->width, buffer->height, ImPlatform_ImageBufferPixel(buffer, 0, 0), (unsigned int)row_length);
+    }
+    else
+    {
+        void* tight = malloc(tight_size);
+        if (!tight)
+            return false;
+        ImPlatform_ImageBufferCopyTight(buffer, tight, pixel_bytes);
+        ImPlatform_GL_TexSubImage(info, 0, 0, buffer->width, buffer->height, tight);
+        free(tight);
+    }
+
+    info->version     = buffer->version;
+    info->has_version = true;
+    return true;
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc)
@@ -1051,47 +2120,97 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_Textu
     glTexImage2D(GL_TEXTURE_2D, 0, internal_format, desc->width, desc->height, 0, format, type, NULL);
     glBindTexture(GL_TEXTURE_2D, 0);
 
-    ImPlatform_RTTracking_GL* entry = new ImPlatform_RTTracking_GL();
-    entry->tex    = tex;
-    entry->width  = desc->width;
-    entry->height = desc->height;
-    entry->next   = g_RTTrackingHead;
-    g_RTTrackingHead = entry;
+    ImPlatform_GL_AddTexInfo(tex, desc->format, desc->width, desc->height);
+    ImPlatform_GL_FindTexInfo(tex)->render_target = true;
 
     return (ImTextureID)(intptr_t)tex;
 }
 
+// Framebuffer with `info` as color attachment. Render textures keep their own, other
+// textures share the blit framebuffer of `blit_slot`, re-targeted only when the
+// texture changes. Binds it to `target`.
+static GLuint ImPlatform_GL_BindTextureFbo(GLenum target, ImPlatform_TexInfo_GL* info, GLuint tex, int blit_slot)
+{
+    if (info && info->render_target)
+    {
+        const bool created = info->fbo == 0;
+        if (created)
+            glGenFramebuffers_Ptr(1, &info->fbo);
+        glBindFramebuffer_Ptr(target, info->fbo);
+        if (created)
+            glFramebufferTexture2D_Ptr(target, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+        return info->fbo;
+    }
+
+    if (!g_BlitFbos[blit_slot])
+        glGenFramebuffers_Ptr(1, &g_BlitFbos[blit_slot]);
+    glBindFramebuffer_Ptr(target, g_BlitFbos[blit_slot]);
+    if (g_BlitFboTex[blit_slot] != tex)
+    {
+        glFramebufferTexture2D_Ptr(target, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+        g_BlitFboTex[blit_slot] = tex;
+    }
+    return g_BlitFbos[blit_slot];
+}
+
+// Called before `tex` is deleted: a blit framebuffer would otherwise keep its storage alive
+static void ImPlatform_GL_ForgetBlitTexture(GLuint tex)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (g_BlitFboTex[i] != tex)
+            continue;
+        GLint saved_read = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &saved_read);
+        glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, g_BlitFbos[i]);
+        glFramebufferTexture2D_Ptr(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, (GLuint)saved_read);
+        g_BlitFboTex[i] = 0;
+    }
+}
+
+static void ImPlatform_GL_DestroyFramebuffers(void)
+{
+    if (!glDeleteFramebuffers_Ptr)
+        return;
+    for (int i = 0; i < 2; i++)
+    {
+        if (g_BlitFbos[i])
+            glDeleteFramebuffers_Ptr(1, &g_BlitFbos[i]);
+        g_BlitFbos[i] = 0;
+        g_BlitFboTex[i] = 0;
+    }
+    for (int b = 0; b < IMPLATFORM_GL_TEXINFO_BUCKETS; b++)
+        for (ImPlatform_TexInfo_GL* e = g_TexInfoBuckets[b]; e; e = e->next)
+            if (e->fbo)
+            {
+                glDeleteFramebuffers_Ptr(1, &e->fbo);
+                e->fbo = 0;
+            }
+    g_RTFbo = 0;
+}
+
 IMPLATFORM_API bool ImPlatform_BeginRenderToTexture(ImTextureID texture)
 {
-    if (!texture)
+    if (!texture || g_RTFbo)
         return false;
 
     GLuint tex = (GLuint)(intptr_t)texture;
 
-    ImPlatform_RTTracking_GL* entry = g_RTTrackingHead;
-    while (entry) { if (entry->tex == tex) break; entry = entry->next; }
-    if (!entry) return false;
-
-    // Load FBO functions via proc address (same pattern as CopyTexture)
-    typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC_LOCAL)(GLsizei, GLuint*);
-    typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC_LOCAL)(GLenum, GLuint);
-    typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL)(GLenum, GLenum, GLenum, GLuint, GLint);
-    static PFNGLGENFRAMEBUFFERSPROC_LOCAL     glGenFramebuffers_fn     = (PFNGLGENFRAMEBUFFERSPROC_LOCAL)ImGui_ImplOpenGL3_GetProcAddress("glGenFramebuffers");
-    static PFNGLBINDFRAMEBUFFERPROC_LOCAL     glBindFramebuffer_fn     = (PFNGLBINDFRAMEBUFFERPROC_LOCAL)ImGui_ImplOpenGL3_GetProcAddress("glBindFramebuffer");
-    static PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL glFramebufferTexture2D_fn = (PFNGLFRAMEBUFFERTEXTURE2DPROC_LOCAL)ImGui_ImplOpenGL3_GetProcAddress("glFramebufferTexture2D");
-    if (!glGenFramebuffers_fn || !glBindFramebuffer_fn || !glFramebufferTexture2D_fn)
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(tex);
+    if (!info || !info->render_target)
+        return false;
+    if (!glGenFramebuffers_Ptr || !glBindFramebuffer_Ptr || !glFramebufferTexture2D_Ptr)
         return false;
 
     // Save current state
     glGetIntegerv(GL_FRAMEBUFFER_BINDING, &g_SavedFBO);
     glGetIntegerv(GL_VIEWPORT, g_SavedViewport);
 
-    // Create and bind FBO targeting the render texture
-    glGenFramebuffers_fn(1, &g_RTFbo);
-    glBindFramebuffer_fn(GL_FRAMEBUFFER, g_RTFbo);
-    glFramebufferTexture2D_fn(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    // The framebuffer is created once per render texture, later passes only bind it
+    g_RTFbo = ImPlatform_GL_BindTextureFbo(GL_FRAMEBUFFER, info, tex, 0);
 
-    glViewport(0, 0, (GLsizei)entry->width, (GLsizei)entry->height);
+    glViewport(0, 0, (GLsizei)info->width, (GLsizei)info->height);
 
     glClearColor(0.f, 0.f, 0.f, 0.f);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -1103,21 +2222,44 @@ IMPLATFORM_API void ImPlatform_EndRenderToTexture(void)
 {
     if (!g_RTFbo)
         return;
-
-    typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC_LOCAL)(GLenum, GLuint);
-    typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC_LOCAL)(GLsizei, const GLuint*);
-    static PFNGLBINDFRAMEBUFFERPROC_LOCAL   glBindFramebuffer_fn   = (PFNGLBINDFRAMEBUFFERPROC_LOCAL)ImGui_ImplOpenGL3_GetProcAddress("glBindFramebuffer");
-    static PFNGLDELETEFRAMEBUFFERSPROC_LOCAL glDeleteFramebuffers_fn = (PFNGLDELETEFRAMEBUFFERSPROC_LOCAL)ImGui_ImplOpenGL3_GetProcAddress("glDeleteFramebuffers");
-
-    if (glDeleteFramebuffers_fn) glDeleteFramebuffers_fn(1, &g_RTFbo);
     g_RTFbo = 0;
 
-    if (glBindFramebuffer_fn) glBindFramebuffer_fn(GL_FRAMEBUFFER, (GLuint)g_SavedFBO);
+    glBindFramebuffer_Ptr(GL_FRAMEBUFFER, (GLuint)g_SavedFBO);
 
     glViewport(g_SavedViewport[0], g_SavedViewport[1], g_SavedViewport[2], g_SavedViewport[3]);
 }
 
-IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst) { (void)dst; return false; }
+IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst)
+{
+    if (!dst || !g_ImPlatform_BackbufferW || !g_ImPlatform_BackbufferH)
+        return false;
+    if (!glGenFramebuffers_Ptr || !glBindFramebuffer_Ptr || !glFramebufferTexture2D_Ptr || !glBlitFramebuffer_Ptr)
+        return false;
+
+    GLuint dstTex = (GLuint)(intptr_t)dst;
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(dstTex);
+    if (!info || info->block_bytes)
+        return false;
+
+    GLint saved_read = 0, saved_draw = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &saved_read);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &saved_draw);
+
+    glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, 0);
+    ImPlatform_GL_BindTextureFbo(GL_DRAW_FRAMEBUFFER, info, dstTex, 1);
+
+    const GLint src_w = (GLint)g_ImPlatform_BackbufferW;
+    const GLint src_h = (GLint)g_ImPlatform_BackbufferH;
+    const bool  same_size = src_w == (GLint)info->width && src_h == (GLint)info->height;
+    glBlitFramebuffer_Ptr(0, 0, src_w, src_h, 0, 0, (GLint)info->width, (GLint)info->height,
+                          GL_COLOR_BUFFER_BIT, same_size ? GL_NEAREST : GL_LINEAR);
+
+    glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, (GLuint)saved_read);
+    glBindFramebuffer_Ptr(GL_DRAW_FRAMEBUFFER, (GLuint)saved_draw);
+
+    ImPlatform_GL_MarkMipsDirty(info);
+    return true;
+}
 IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height)
 {
     if (width)  *width  = g_ImPlatform_BackbufferW;
@@ -1128,65 +2270,47 @@ IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     if (!dst || !src)
         return false;
+    if (!glGenFramebuffers_Ptr || !glBindFramebuffer_Ptr || !glFramebufferTexture2D_Ptr || !glBlitFramebuffer_Ptr)
+        return false;
 
     GLuint srcTex = (GLuint)(intptr_t)src;
     GLuint dstTex = (GLuint)(intptr_t)dst;
+    ImPlatform_TexInfo_GL* src_info = ImPlatform_GL_FindTexInfo(srcTex);
+    ImPlatform_TexInfo_GL* dst_info = ImPlatform_GL_FindTexInfo(dstTex);
 
-    // Get source texture dimensions
+    // Get source texture dimensions (queried only for textures created elsewhere)
     GLint width = 0, height = 0;
-    glBindTexture(GL_TEXTURE_2D, srcTex);
-    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (src_info)
+    {
+        width  = (GLint)src_info->width;
+        height = (GLint)src_info->height;
+    }
+    else
+    {
+        glBindTexture(GL_TEXTURE_2D, srcTex);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
 
     if (width <= 0 || height <= 0)
         return false;
 
     // Use FBO blit: attach src to READ, dst to DRAW, then blit
-#ifndef GL_FRAMEBUFFER
-#define GL_FRAMEBUFFER 0x8D40
-#endif
-#ifndef GL_READ_FRAMEBUFFER
-#define GL_READ_FRAMEBUFFER 0x8CA8
-#endif
-#ifndef GL_DRAW_FRAMEBUFFER
-#define GL_DRAW_FRAMEBUFFER 0x8CA9
-#endif
-#ifndef GL_COLOR_ATTACHMENT0
-#define GL_COLOR_ATTACHMENT0 0x8CE0
-#endif
-#ifndef GL_COLOR_BUFFER_BIT
-#define GL_COLOR_BUFFER_BIT 0x00004000
-#endif
-
-    typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint* framebuffers);
-    typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
-    typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
-    typedef void (APIENTRYP PFNGLBLITFRAMEBUFFERPROC)(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
-    typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n, const GLuint* framebuffers);
+    GLint saved_read = 0, saved_draw = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &saved_read);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &saved_draw);
 
-    static PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers_fn = (PFNGLGENFRAMEBUFFERSPROC)ImGui_ImplOpenGL3_GetProcAddress("glGenFramebuffers");
-    static PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer_fn = (PFNGLBINDFRAMEBUFFERPROC)ImGui_ImplOpenGL3_GetProcAddress("glBindFramebuffer");
-    static PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D_fn = (PFNGLFRAMEBUFFERTEXTURE2DPROC)ImGui_ImplOpenGL3_GetProcAddress("glFramebufferTexture2D");
-    static PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer_fn = (PFNGLBLITFRAMEBUFFERPROC)ImGui_ImplOpenGL3_GetProcAddress("glBlitFramebuffer");
-    static PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers_fn = (PFNGLDELETEFRAMEBUFFERSPROC)ImGui_ImplOpenGL3_GetProcAddress("glDeleteFramebuffers");
+    ImPlatform_GL_BindTextureFbo(GL_READ_FRAMEBUFFER, src_info, srcTex, 0);
+    ImPlatform_GL_BindTextureFbo(GL_DRAW_FRAMEBUFFER, dst_info, dstTex, 1);
 
-    if (!glGenFramebuffers_fn || !glBindFramebuffer_fn || !glFramebufferTexture2D_fn || !glBlitFramebuffer_fn || !glDeleteFramebuffers_fn)
-        return false;
+    glBlitFramebuffer_Ptr(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
 
-    GLuint fbos[2] = { 0, 0 };
-    glGenFramebuffers_fn(2, fbos);
+    glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, (GLuint)saved_read);
+    glBindFramebuffer_Ptr(GL_DRAW_FRAMEBUFFER, (GLuint)saved_draw);
 
-    glBindFramebuffer_fn(GL_READ_FRAMEBUFFER, fbos[0]);
-    glFramebufferTexture2D_fn(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, srcTex, 0);
-
-    glBindFramebuffer_fn(GL_DRAW_FRAMEBUFFER, fbos[1]);
-    glFramebufferTexture2D_fn(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dstTex, 0);
-
-    glBlitFramebuffer_fn(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
-
-    glBindFramebuffer_fn(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers_fn(2, fbos);
+    if (dst_info)
+        ImPlatform_GL_MarkMipsDirty(dst_info);
 
     return true;
 }
@@ -1196,10 +2320,198 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
     GLuint tex = (GLuint)(intptr_t)texture_id;
+    ImPlatform_GL_ForgetBlitTexture(tex);
+    ImPlatform_GL_RemoveTexInfo(tex);
     glDeleteTextures(1, &tex);
 }
 
+// ----------------------------------------------------------------------------
+// Asynchronous readback
+// ----------------------------------------------------------------------------
+// glReadPixels into a pixel pack buffer returns as soon as the copy is queued.
+// A fence tells when it landed; the buffer is mapped only then, so nothing stalls.
+// Pack buffers of freed readbacks are kept by size, a readback per frame reuses them.
+
+struct ImPlatform_Readback_t {
+    GLuint            pbo;
+    ImPlatform_GLsync sync;             // Cleared once signaled
+    const void*       pixels;           // Mapped pack buffer, set once the fence signaled
+    bool              failed;
+    unsigned int      width, height, row_pitch;
+    ImPlatform_ReadbackCallback callback;
+    void*             user_data;
+    ImPlatform_Readback_t* next;
+};
+static ImPlatform_Readback_t* g_Readbacks = NULL;
+
+#define IMPLATFORM_GL_READBACK_POOL 8
+struct ImPlatform_ReadbackBuffer_GL {
+    GLuint     pbo;
+    GLsizeiptr size;
+};
+static ImPlatform_ReadbackBuffer_GL g_ReadbackPool[IMPLATFORM_GL_READBACK_POOL];
+static int g_ReadbackPoolCount = 0;
+
+// Returns true once the readback is done, mapping its buffer on completion
+static bool ImPlatform_GL_PollReadback(ImPlatform_Readback_t* rb)
+{
+    if (!rb->sync)
+        return true;
+    GLenum result = glClientWaitSync_Ptr(rb->sync, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED)
+        return false;
+    glDeleteSync_Ptr(rb->sync);
+    rb->sync = 0;
+    if (result != GL_WAIT_FAILED)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        rb->pixels = glMapBufferRange_Ptr(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)rb->row_pitch * rb->height, GL_MAP_READ_BIT);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    rb->failed = rb->pixels == NULL;
+    return true;
+}
+
+static void ImPlatform_GL_FreeReadback(ImPlatform_Readback_t* rb)
+{
+    if (rb->pixels)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        glUnmapBuffer_Ptr(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    if (rb->sync)
+        glDeleteSync_Ptr(rb->sync);
+    // A pending glReadPixels into the buffer is ordered before any later one
+    if (g_ReadbackPoolCount < IMPLATFORM_GL_READBACK_POOL)
+    {
+        g_ReadbackPool[g_ReadbackPoolCount].pbo  = rb->pbo;
+        g_ReadbackPool[g_ReadbackPoolCount].size = (GLsizeiptr)rb->row_pitch * rb->height;
+        g_ReadbackPoolCount++;
+    }
+    else
+    {
+        glDeleteBuffers(1, &rb->pbo);
+    }
+    free(rb);
+}
+
+// Runs the callbacks of completed readbacks and frees them
+static void ImPlatform_GL_DispatchReadbacks(void)
+{
+    ImPlatform_Readback_t** link = &g_Readbacks;
+    while (ImPlatform_Readback_t* rb = *link)
+    {
+        if (!rb->callback || !ImPlatform_GL_PollReadback(rb))
+        {
+            link = &rb->next;
+            continue;
+        }
+        *link = rb->next;
+        rb->callback(rb->failed ? NULL : rb->pixels, rb->width, rb->height, rb->row_pitch, rb->user_data);
+        ImPlatform_GL_FreeReadback(rb);
+    }
+}
+
+static void ImPlatform_GL_DestroyReadbacks(void)
+{
+    while (ImPlatform_Readback_t* rb = g_Readbacks)
+    {
+        g_Readbacks = rb->next;
+        ImPlatform_GL_FreeReadback(rb);
+    }
+    for (int i = 0; i < g_ReadbackPoolCount; i++)
+        glDeleteBuffers(1, &g_ReadbackPool[i].pbo);
+    g_ReadbackPoolCount = 0;
+}
+
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID texture, unsigned int x, unsigned int y,
+                                                              unsigned int width, unsigned int height,
+                                                              ImPlatform_ReadbackCallback callback, void* user_data)
+{
+    if (!texture || !g_StreamRing.supported || !glBindFramebuffer_Ptr || !glFramebufferTexture2D_Ptr)
+        return NULL;
+
+    GLuint tex = (GLuint)(intptr_t)texture;
+    ImPlatform_TexInfo_GL* info = ImPlatform_GL_FindTexInfo(tex);
+    if (!info || info->block_bytes || x >= info->width || y >= info->height)
+        return NULL;
+    if (width == 0)  width  = info->width - x;
+    if (height == 0) height = info->height - y;
+    if (width > info->width - x || height > info->height - y)
+        return NULL;
+
+    ImPlatform_Readback_t* rb = (ImPlatform_Readback_t*)calloc(1, sizeof(ImPlatform_Readback_t));
+    if (!rb)
+        return NULL;
+    rb->width     = width;
+    rb->height    = height;
+    rb->row_pitch = (width * (unsigned int)info->bytes_per_pixel + 3u) & ~3u; // GL_PACK_ALIGNMENT 4
+    rb->callback  = callback;
+    rb->user_data = user_data;
+
+    const GLsizeiptr size = (GLsizeiptr)rb->row_pitch * height;
+    for (int i = 0; i < g_ReadbackPoolCount; i++)
+        if (g_ReadbackPool[i].size == size)
+        {
+            rb->pbo = g_ReadbackPool[i].pbo;
+            g_ReadbackPool[i] = g_ReadbackPool[--g_ReadbackPoolCount];
+            break;
+        }
+    if (rb->pbo)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+    }
+    else
+    {
+        glGenBuffers(1, &rb->pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    }
+
+    GLint saved_read = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &saved_read);
+    ImPlatform_GL_BindTextureFbo(GL_READ_FRAMEBUFFER, info, tex, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels((GLint)x, (GLint)y, (GLsizei)width, (GLsizei)height, info->format, info->type, (void*)0);
+    glBindFramebuffer_Ptr(GL_READ_FRAMEBUFFER, (GLuint)saved_read);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    rb->sync = glFenceSync_Ptr(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    rb->next = g_Readbacks;
+    g_Readbacks = rb;
+    return rb;
+}
+
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback readback)
+{
+    return readback && ImPlatform_GL_PollReadback(readback);
+}
+
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback readback, unsigned int* out_row_pitch)
+{
+    if (!readback || !ImPlatform_GL_PollReadback(readback) || readback->failed)
+        return NULL;
+    if (out_row_pitch)
+        *out_row_pitch = readback->row_pitch;
+    return readback->pixels;
+}
+
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback readback)
+{
+    for (ImPlatform_Readback_t** link = &g_Readbacks; *link; link = &(*link)->next)
+        if (*link == readback)
+        {
+            *link = readback->next;
+            ImPlatform_GL_FreeReadback(readback);
+            return;
+        }
+}
+
 // ============================================================================
 // Custom Vertex/Index Buffer Management API - OpenGL3 Implementation
 // ============================================================================
@@ -1213,6 +2525,10 @@ struct ImPlatform_BufferData_GL
     ImPlatform_VertexBufferDesc vb_desc; // Vertex buffer descriptor (for updates)
     ImPlatform_IndexBufferDesc ib_desc;  // Index buffer descriptor (for updates)
     ImPlatform_VertexAttribute* attributes; // Cached attribute array
+    GLintptr vertex_offset;              // Byte offset of vertex 0 in vbo (transient buffers)
+    GLintptr index_offset;               // Byte offset of index 0 in ibo (transient buffers)
+    unsigned int instance_attribs;       // Instance attributes currently enabled in vao, after the vertex ones
+    bool transient;                      // Owned by the transient allocator, recycled every frame
 };
 
 // Helper to convert buffer usage to GL usage hint
@@ -1270,6 +2586,24 @@ static void ImPlatform_GetGLVertexFormat(ImPlatform_VertexFormat format, GLenum*
     }
 }
 
+// Points the attributes of the bound VAO at the bound GL_ARRAY_BUFFER, starting at base_offset.
+// Attribute i goes to location first_location + i.
+static void ImPlatform_GL_SetupVertexAttributes(const ImPlatform_VertexBufferDesc* desc, size_t base_offset, GLuint first_location = 0)
+{
+    for (unsigned int i = 0; i < desc->attribute_count; i++)
+    {
+        const ImPlatform_VertexAttribute* attr = &desc->attributes[i];
+
+        GLenum type;
+        GLint size_components;
+        GLboolean normalized;
+        ImPlatform_GetGLVertexFormat(attr->format, &type, &size_components, &normalized);
+
+        glEnableVertexAttribArray(first_location + i);
+        glVertexAttribPointer(first_location + i, size_components, type, normalized, desc->vertex_stride, (void*)(intptr_t)(base_offset + attr->offset));
+    }
+}
+
 IMPLATFORM_API ImPlatform_VertexBuffer ImPlatform_CreateVertexBuffer(const void* vertex_data, const ImPlatform_VertexBufferDesc* desc)
 {
     if (!desc || !vertex_data)
@@ -1300,18 +2634,7 @@ IMPLATFORM_API ImPlatform_VertexBuffer ImPlatform_CreateVertexBuffer(const void*
     glBufferData(GL_ARRAY_BUFFER, size, vertex_data, usage);
 
     // Setup vertex attributes
-    for (unsigned int i = 0; i < desc->attribute_count; i++)
-    {
-        const ImPlatform_VertexAttribute* attr = &desc->attributes[i];
-
-        GLenum type;
-        GLint size_components;
-        GLboolean normalized;
-        ImPlatform_GetGLVertexFormat(attr->format, &type, &size_components, &normalized);
-
-        glEnableVertexAttribArray(i);
-        glVertexAttribPointer(i, size_components, type, normalized, desc->vertex_stride, (void*)(intptr_t)attr->offset);
-    }
+    ImPlatform_GL_SetupVertexAttributes(desc, 0);
 
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -1341,6 +2664,8 @@ IMPLATFORM_API void ImPlatform_DestroyVertexBuffer(ImPlatform_VertexBuffer buffe
         return;
 
     ImPlatform_BufferData_GL* buf = (ImPlatform_BufferData_GL*)buffer;
+    if (buf->transient)
+        return; // Owned by the frame
 
     if (buf->vbo)
         glDeleteBuffers(1, &buf->vbo);
@@ -1399,6 +2724,8 @@ IMPLATFORM_API void ImPlatform_DestroyIndexBuffer(ImPlatform_IndexBuffer buffer)
         return;
 
     ImPlatform_BufferData_GL* buf = (ImPlatform_BufferData_GL*)buffer;
+    if (buf->transient)
+        return; // Owned by the frame
 
     if (buf->ibo)
         glDeleteBuffers(1, &buf->ibo);
@@ -1406,9 +2733,308 @@ IMPLATFORM_API void ImPlatform_DestroyIndexBuffer(ImPlatform_IndexBuffer buffer)
     delete buf;
 }
 
+// ----------------------------------------------------------------------------
+// Transient geometry
+// ----------------------------------------------------------------------------
+// One buffer split in IMPLATFORM_GL_TRANSIENT_FRAMES regions used round robin,
+// one per frame, with a linear allocator inside the current region. A region is
+// fenced when its frame is swapped and waited on before it is written again,
+// which only blocks when the GPU is that many frames behind. With
+// GL_ARB_buffer_storage the whole buffer is persistently mapped and callers
+// write straight into it; otherwise they write into a CPU copy of the region
+// that is flushed with an unsynchronized map before each draw.
+
+#ifndef IMPLATFORM_GL_TRANSIENT_REGION_SIZE
+#define IMPLATFORM_GL_TRANSIENT_REGION_SIZE (4u * 1024u * 1024u)   // Per frame, grows on demand
+#endif
+#define IMPLATFORM_GL_TRANSIENT_FRAMES 3
+
+struct ImPlatform_Transient_GL {
+    GLuint         buffer;
+    unsigned char* mapped;          // Persistent mapping of the whole buffer
+    unsigned char* shadow;          // Without persistent mapping: CPU copy of the current region
+    size_t         regionSize;
+    size_t         wantedRegionSize; // Set when a region overflows, applied at the next frame
+    int            region;          // Region of the current frame
+    bool           regionReady;     // The region's fence has been waited on this frame
+    size_t         head;            // Bytes allocated in the current region
+    size_t         flushed;         // Bytes of the region already copied from `shadow`
+    unsigned int   frame;           // Incremented when a region is retired, identifies this frame's allocations
+    ImPlatform_GLsync fences[IMPLATFORM_GL_TRANSIENT_FRAMES];
+    ImPlatform_BufferData_GL** handles;  // Pooled handles, the first handleCount belong to this frame
+    int            handleCount;
+    int            handleCapacity;
+};
+static ImPlatform_Transient_GL g_Transient = {};
+
+static bool ImPlatform_GL_CreateTransientBuffer(size_t region_size)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    const size_t capacity = region_size * IMPLATFORM_GL_TRANSIENT_FRAMES;
+    glGenBuffers(1, &t->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, t->buffer);
+    t->mapped = NULL;
+    if (g_StreamRing.persistent)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage_Ptr(GL_ARRAY_BUFFER, (GLsizeiptr)capacity, NULL, flags);
+        t->mapped = (unsigned char*)glMapBufferRange_Ptr(GL_ARRAY_BUFFER, 0, (GLsizeiptr)capacity, flags);
+        if (!t->mapped)
+        {
+            // Immutable storage can't be respecified, start over with a mutable buffer
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glDeleteBuffers(1, &t->buffer);
+            glGenBuffers(1, &t->buffer);
+            glBindBuffer(GL_ARRAY_BUFFER, t->buffer);
+        }
+    }
+    if (!t->mapped)
+    {
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)capacity, NULL, GL_STREAM_DRAW);
+        t->shadow = (unsigned char*)malloc(region_size);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    t->regionSize = region_size;
+    t->region = 0;
+    t->regionReady = true;
+    t->head = t->flushed = 0;
+    if (!t->buffer || (!t->mapped && !t->shadow))
+    {
+        fprintf(stderr, "[ImPlatform] OpenGL: Failed to create the %llu byte transient geometry buffer\n", (unsigned long long)capacity);
+        return false;
+    }
+    return true;
+}
+
+static void ImPlatform_GL_DestroyTransientBuffer(void)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    for (int i = 0; i < IMPLATFORM_GL_TRANSIENT_FRAMES; i++)
+    {
+        if (t->fences[i])
+            glDeleteSync_Ptr(t->fences[i]);
+        t->fences[i] = NULL;
+    }
+    if (t->mapped)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, t->buffer);
+        glUnmapBuffer_Ptr(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        t->mapped = NULL;
+    }
+    if (t->buffer)
+        glDeleteBuffers(1, &t->buffer);
+    t->buffer = 0;
+    free(t->shadow);
+    t->shadow = NULL;
+}
+
+static void ImPlatform_GL_WaitTransientFence(int region)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    if (!t->fences[region])
+        return;
+    GLenum result;
+    do { result = glClientWaitSync_Ptr(t->fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull); }
+    while (result == GL_TIMEOUT_EXPIRED);
+    if (result == GL_WAIT_FAILED)
+        fprintf(stderr, "[ImPlatform] OpenGL: glClientWaitSync failed on transient geometry fence\n");
+    glDeleteSync_Ptr(t->fences[region]);
+    t->fences[region] = NULL;
+}
+
+// Reserves `size` bytes in the current region, `alignment` (a power of two) aligned.
+// Returns the CPU write pointer and the byte offset in the GL buffer, NULL when the
+// region is exhausted.
+static unsigned char* ImPlatform_GL_TransientAlloc(size_t size, size_t alignment, size_t* out_offset)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    if (!g_StreamRing.supported)
+        return NULL;
+    if (!t->buffer && !ImPlatform_GL_CreateTransientBuffer(t->wantedRegionSize ? t->wantedRegionSize : (size_t)IMPLATFORM_GL_TRANSIENT_REGION_SIZE))
+        return NULL;
+    if (!t->regionReady)
+    {
+        ImPlatform_GL_WaitTransientFence(t->region);
+        t->regionReady = true;
+    }
+
+    size_t aligned = (t->head + alignment - 1) & ~(alignment - 1);
+    if (size == 0 || aligned + size > t->regionSize)
+    {
+        size_t wanted = t->wantedRegionSize > t->regionSize ? t->wantedRegionSize : t->regionSize;
+        while (wanted < aligned + size)
+            wanted *= 2;
+        if (size && t->wantedRegionSize < wanted)
+        {
+            fprintf(stderr, "[ImPlatform] OpenGL: Transient geometry region full, growing to %llu bytes next frame\n", (unsigned long long)wanted);
+            t->wantedRegionSize = wanted;
+        }
+        return NULL;
+    }
+    t->head = aligned + size;
+    *out_offset = (size_t)t->region * t->regionSize + aligned;
+    return t->mapped ? t->mapped + *out_offset : t->shadow + aligned;
+}
+
+static ImPlatform_BufferData_GL* ImPlatform_GL_TransientHandle(void)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    if (t->handleCount == t->handleCapacity)
+    {
+        int new_capacity = t->handleCapacity ? t->handleCapacity * 2 : 16;
+        void* new_handles = realloc(t->handles, sizeof(ImPlatform_BufferData_GL*) * new_capacity);
+        if (!new_handles)
+            return NULL;
+        t->handles = (ImPlatform_BufferData_GL**)new_handles;
+        memset(t->handles + t->handleCapacity, 0, sizeof(ImPlatform_BufferData_GL*) * (new_capacity - t->handleCapacity));
+        t->handleCapacity = new_capacity;
+    }
+    ImPlatform_BufferData_GL*& handle = t->handles[t->handleCount];
+    if (!handle)
+    {
+        handle = new ImPlatform_BufferData_GL();
+        memset(handle, 0, sizeof(ImPlatform_BufferData_GL));
+        handle->transient = true;
+    }
+    t->handleCount++;
+    return handle;
+}
+
+// Copies what was allocated since the last flush into the GL buffer (no-op when persistently mapped)
+static void ImPlatform_GL_FlushTransient(void)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    if (!t->shadow || t->flushed == t->head)
+        return;
+    // The region's fence was waited on, the GPU no longer reads this range
+    glBindBuffer(GL_ARRAY_BUFFER, t->buffer);
+    void* dst = glMapBufferRange_Ptr(GL_ARRAY_BUFFER, (GLintptr)((size_t)t->region * t->regionSize + t->flushed), (GLsizeiptr)(t->head - t->flushed),
+                                     GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (dst)
+    {
+        memcpy(dst, t->shadow + t->flushed, t->head - t->flushed);
+        glUnmapBuffer_Ptr(GL_ARRAY_BUFFER);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    t->flushed = t->head;
+}
+
+// Fences the frame's region and moves on to the next one
+static void ImPlatform_GL_EndTransientFrame(void)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    t->handleCount = 0;
+    if (!t->buffer)
+        return;
+
+    if (t->head > 0)
+        t->fences[t->region] = glFenceSync_Ptr(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    t->region = (t->region + 1) % IMPLATFORM_GL_TRANSIENT_FRAMES;
+    t->frame++;
+    t->regionReady = false;
+    t->head = t->flushed = 0;
+
+    if (t->wantedRegionSize > t->regionSize)
+    {
+        for (int i = 0; i < IMPLATFORM_GL_TRANSIENT_FRAMES; i++)
+            ImPlatform_GL_WaitTransientFence(i);
+        ImPlatform_GL_DestroyTransientBuffer();
+        ImPlatform_GL_CreateTransientBuffer(t->wantedRegionSize);
+    }
+}
+
+static void ImPlatform_GL_DestroyTransient(void)
+{
+    ImPlatform_Transient_GL* t = &g_Transient;
+    ImPlatform_GL_DestroyTransientBuffer();
+    for (int i = 0; i < t->handleCapacity; i++)
+    {
+        if (!t->handles[i])
+            continue;
+        if (t->handles[i]->vao)
+            glDeleteVertexArrays(1, &t->handles[i]->vao);
+        delete[] t->handles[i]->attributes;
+        delete t->handles[i];
+    }
+    free(t->handles);
+    const unsigned int frame = t->frame;
+    memset(t, 0, sizeof(*t));
+    t->frame = frame + 1;
+}
+
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* desc, ImPlatform_VertexBuffer* out_buffer)
+{
+    if (!desc || !out_buffer)
+        return NULL;
+    *out_buffer = NULL;
+
+    size_t offset;
+    unsigned char* dst = ImPlatform_GL_TransientAlloc((size_t)desc->vertex_count * desc->vertex_stride, 16, &offset);
+    ImPlatform_BufferData_GL* buffer = dst ? ImPlatform_GL_TransientHandle() : NULL;
+    if (!buffer)
+        return NULL;
+
+    if (!buffer->vao)
+        glGenVertexArrays(1, &buffer->vao);
+    glBindVertexArray(buffer->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, g_Transient.buffer);
+    // The pooled VAO may carry attributes (and instance divisors) from a previous frame's layout
+    for (unsigned int i = desc->attribute_count; i < buffer->vb_desc.attribute_count + buffer->instance_attribs; i++)
+        glDisableVertexAttribArray(i);
+    ImPlatform_GL_SetupVertexAttributes(desc, offset);
+    if (glVertexAttribDivisor_Ptr)
+        for (unsigned int i = 0; i < desc->attribute_count; i++)
+            glVertexAttribDivisor_Ptr(i, 0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Attributes are kept for use as an instance buffer
+    delete[] buffer->attributes;
+    buffer->attributes = NULL;
+    if (desc->attribute_count > 0 && desc->attributes)
+    {
+        buffer->attributes = new ImPlatform_VertexAttribute[desc->attribute_count];
+        memcpy(buffer->attributes, desc->attributes, sizeof(ImPlatform_VertexAttribute) * desc->attribute_count);
+    }
+
+    buffer->vbo = g_Transient.buffer;
+    buffer->vertex_offset = (GLintptr)offset;
+    buffer->instance_attribs = 0;
+    buffer->vb_desc = *desc;
+    buffer->vb_desc.usage = ImPlatform_BufferUsage_Stream;
+    buffer->vb_desc.attributes = buffer->attributes;
+    *out_buffer = (ImPlatform_VertexBuffer)buffer;
+    return dst;
+}
+
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int index_count, ImPlatform_IndexFormat format, ImPlatform_IndexBuffer* out_buffer)
+{
+    if (!out_buffer)
+        return NULL;
+    *out_buffer = NULL;
+
+    size_t offset;
+    size_t index_size = (format == ImPlatform_IndexFormat_UInt16) ? sizeof(uint16_t) : sizeof(uint32_t);
+    unsigned char* dst = ImPlatform_GL_TransientAlloc(index_count * index_size, 16, &offset);
+    ImPlatform_BufferData_GL* buffer = dst ? ImPlatform_GL_TransientHandle() : NULL;
+    if (!buffer)
+        return NULL;
+
+    buffer->ibo = g_Transient.buffer;
+    buffer->index_offset = (GLintptr)offset;
+    buffer->ib_desc.index_count = index_count;
+    buffer->ib_desc.format = format;
+    buffer->ib_desc.usage = ImPlatform_BufferUsage_Stream;
+    *out_buffer = (ImPlatform_IndexBuffer)buffer;
+    return dst;
+}
+
 // Global state for currently bound buffers
 static ImPlatform_BufferData_GL* g_BoundVertexBuffer = NULL;
 static ImPlatform_BufferData_GL* g_BoundIndexBuffer = NULL;
+static ImPlatform_BufferData_GL* g_BoundInstanceBuffer = NULL;
 
 IMPLATFORM_API void ImPlatform_BindBuffers(ImPlatform_VertexBuffer vertex_buffer, ImPlatform_IndexBuffer index_buffer)
 {
@@ -1427,28 +3053,254 @@ IMPLATFORM_API void ImPlatform_BindBuffers(ImPlatform_VertexBuffer vertex_buffer
     }
 }
 
-IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned int index_count, unsigned int start_index)
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer instance_buffer)
+{
+    g_BoundInstanceBuffer = (ImPlatform_BufferData_GL*)instance_buffer;
+}
+
+// Points the instance attributes of the bound vertex buffer's VAO at `instance`
+// (placed after the vertex attributes), or disables them when `instance` is NULL.
+// start_instance offsets the instance data, matching base instance semantics.
+static void ImPlatform_GL_SetupInstanceAttributes(ImPlatform_BufferData_GL* vb, const ImPlatform_BufferData_GL* instance, unsigned int start_instance)
+{
+    const GLuint first_location = vb->vb_desc.attribute_count;
+    const unsigned int count = instance ? instance->vb_desc.attribute_count : 0;
+    for (unsigned int i = count; i < vb->instance_attribs; i++)
+        glDisableVertexAttribArray(first_location + i);
+    vb->instance_attribs = count;
+    if (!instance)
+        return;
+
+    const size_t base_offset = (size_t)instance->vertex_offset + (size_t)start_instance * instance->vb_desc.vertex_stride;
+    const GLuint divisor = instance->vb_desc.instance_step_rate ? instance->vb_desc.instance_step_rate : 1;
+    glBindBuffer(GL_ARRAY_BUFFER, instance->vbo);
+    ImPlatform_GL_SetupVertexAttributes(&instance->vb_desc, base_offset, first_location);
+    for (unsigned int i = 0; i < count; i++)
+        glVertexAttribDivisor_Ptr(first_location + i, divisor);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Resolves the draw parameters shared by the indexed draw entry points
+static bool ImPlatform_GL_PrepareIndexedDraw(unsigned int primitive_type, unsigned int* index_count, unsigned int start_index,
+                                             GLenum* out_mode, GLenum* out_index_type, const void** out_indices)
 {
     if (!g_BoundVertexBuffer || !g_BoundIndexBuffer)
+        return false;
+
+    // Map primitive type
+    GLenum mode = GL_TRIANGLES;
+    if (primitive_type == 1)
+        mode = GL_LINES;
+    else if (primitive_type == 2)
+        mode = GL_POINTS;
+
+    // Determine index type
+    GLenum index_type = (g_BoundIndexBuffer->ib_desc.format == ImPlatform_IndexFormat_UInt16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    unsigned int index_size = (index_type == GL_UNSIGNED_SHORT) ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    // Use all indices if count is 0 (index_count is NULL for indirect draws)
+    if (index_count && *index_count == 0)
+        *index_count = g_BoundIndexBuffer->ib_desc.index_count;
+
+    // Transient geometry written since the last draw must reach the buffer first
+    ImPlatform_GL_FlushTransient();
+
+    *out_mode = mode;
+    *out_index_type = index_type;
+    *out_indices = (const void*)(intptr_t)(g_BoundIndexBuffer->index_offset + start_index * index_size);
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned int index_count, unsigned int start_index)
+{
+    GLenum mode, index_type;
+    const void* indices;
+    if (!ImPlatform_GL_PrepareIndexedDraw(primitive_type, &index_count, start_index, &mode, &index_type, &indices))
+        return;
+
+    // Instance attributes left enabled by an instanced draw would otherwise stay in the VAO
+    if (g_BoundVertexBuffer->instance_attribs)
+        ImPlatform_GL_SetupInstanceAttributes(g_BoundVertexBuffer, NULL, 0);
+
+    // Draw
+    glDrawElements(mode, index_count, index_type, indices);
+}
+
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int primitive_type, unsigned int index_count, unsigned int start_index,
+                                                    unsigned int instance_count, unsigned int start_instance)
+{
+    if (instance_count == 0 || !glDrawElementsInstanced_Ptr || (g_BoundInstanceBuffer && !glVertexAttribDivisor_Ptr))
         return;
 
-    // Map primitive type
-    GLenum mode = GL_TRIANGLES;
-    if (primitive_type == 1)
-        mode = GL_LINES;
-    else if (primitive_type == 2)
-        mode = GL_POINTS;
+    GLenum mode, index_type;
+    const void* indices;
+    if (!ImPlatform_GL_PrepareIndexedDraw(primitive_type, &index_count, start_index, &mode, &index_type, &indices))
+        return;
+
+    // Re-pointed every draw: the instance buffer and start_instance are free to change between draws
+    ImPlatform_GL_SetupInstanceAttributes(g_BoundVertexBuffer, g_BoundInstanceBuffer, start_instance);
+
+    glDrawElementsInstanced_Ptr(mode, (GLsizei)index_count, index_type, indices, (GLsizei)instance_count);
+}
+
+// ----------------------------------------------------------------------------
+// Indirect draws
+// ----------------------------------------------------------------------------
+// The records always have a CPU copy. With glMultiDrawElementsIndirect they are
+// also stored in a GL_DRAW_INDIRECT_BUFFER and a batch is a single call; without
+// it (and for transient index buffers, whose index offset can't be expressed in
+// the records) the batch is drawn record by record.
+
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+
+struct ImPlatform_IndirectBufferData_GL
+{
+    GLuint buffer;                       // GL_DRAW_INDIRECT_BUFFER, 0 without multi-draw indirect
+    ImPlatform_DrawIndexedIndirectArgs* args; // CPU copy of the records
+    unsigned int draw_count;             // Number of records
+};
+
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* args, unsigned int draw_count, ImPlatform_BufferUsage usage)
+{
+    if (!args || draw_count == 0)
+        return NULL;
+
+    ImPlatform_IndirectBufferData_GL* buffer = new ImPlatform_IndirectBufferData_GL();
+    memset(buffer, 0, sizeof(ImPlatform_IndirectBufferData_GL));
+    buffer->draw_count = draw_count;
+    buffer->args = new ImPlatform_DrawIndexedIndirectArgs[draw_count];
+    memcpy(buffer->args, args, sizeof(ImPlatform_DrawIndexedIndirectArgs) * draw_count);
+
+    if (g_HasMultiDrawIndirect)
+    {
+        glGenBuffers(1, &buffer->buffer);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->buffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(ImPlatform_DrawIndexedIndirectArgs) * draw_count, args, ImPlatform_GetGLBufferUsage(usage));
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
+    return (ImPlatform_IndirectBuffer)buffer;
+}
+
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer buffer, const ImPlatform_DrawIndexedIndirectArgs* args, unsigned int offset, unsigned int count)
+{
+    if (!buffer || !args)
+        return false;
+
+    ImPlatform_IndirectBufferData_GL* buf = (ImPlatform_IndirectBufferData_GL*)buffer;
+    if (offset > buf->draw_count || count > buf->draw_count - offset)
+        return false;
+
+    memcpy(buf->args + offset, args, sizeof(ImPlatform_DrawIndexedIndirectArgs) * count);
+    if (buf->buffer)
+    {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buf->buffer);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, sizeof(ImPlatform_DrawIndexedIndirectArgs) * offset, sizeof(ImPlatform_DrawIndexedIndirectArgs) * count, args);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer buffer)
+{
+    if (!buffer)
+        return;
+
+    ImPlatform_IndirectBufferData_GL* buf = (ImPlatform_IndirectBufferData_GL*)buffer;
+    if (buf->buffer)
+        glDeleteBuffers(1, &buf->buffer);
+    delete[] buf->args;
+
+    delete buf;
+}
+
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int primitive_type, ImPlatform_IndirectBuffer indirect_buffer, unsigned int first_draw, unsigned int draw_count)
+{
+    ImPlatform_IndirectBufferData_GL* buf = (ImPlatform_IndirectBufferData_GL*)indirect_buffer;
+    if (!buf || first_draw >= buf->draw_count)
+        return;
+    if (draw_count > buf->draw_count - first_draw)
+        draw_count = buf->draw_count - first_draw;
+    if (draw_count == 0)
+        return;
+
+    GLenum mode, index_type;
+    const void* indices;
+    if (!ImPlatform_GL_PrepareIndexedDraw(primitive_type, NULL, 0, &mode, &index_type, &indices))
+        return;
+
+    ImPlatform_BufferData_GL* vb = g_BoundVertexBuffer;
+    ImPlatform_BufferData_GL* instance = g_BoundInstanceBuffer;
+    if (instance && !glVertexAttribDivisor_Ptr)
+        return;
+
+    if (buf->buffer && g_BoundIndexBuffer->index_offset == 0)
+    {
+        // start_instance is applied to the instance attributes by GL itself
+        if (instance || vb->instance_attribs)
+            ImPlatform_GL_SetupInstanceAttributes(vb, instance, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buf->buffer);
+        glMultiDrawElementsIndirect_Ptr(mode, index_type, (const void*)(intptr_t)(sizeof(ImPlatform_DrawIndexedIndirectArgs) * first_draw),
+                                        (GLsizei)draw_count, (GLsizei)sizeof(ImPlatform_DrawIndexedIndirectArgs));
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        return;
+    }
+
+    // Record by record. Base vertex without glDrawElementsInstancedBaseVertex (ES 3.0 /
+    // WebGL 2) and start_instance are emulated by offsetting the attribute pointers.
+    const size_t index_size = (index_type == GL_UNSIGNED_SHORT) ? sizeof(uint16_t) : sizeof(uint32_t);
+    const bool instanced = glDrawElementsInstanced_Ptr != NULL;
+    if (!instance && vb->instance_attribs)
+        ImPlatform_GL_SetupInstanceAttributes(vb, NULL, 0);
+    unsigned int bound_start_instance = 0;
+    bool instance_set = false;
+    int bound_base_vertex = 0;
+    for (unsigned int i = first_draw; i < first_draw + draw_count; i++)
+    {
+        const ImPlatform_DrawIndexedIndirectArgs* args = &buf->args[i];
+        if (args->index_count == 0 || args->instance_count == 0)
+            continue;
+        if (!instanced && (args->instance_count != 1 || instance))
+            continue;
+
+        if (instance && (!instance_set || args->start_instance != bound_start_instance))
+        {
+            ImPlatform_GL_SetupInstanceAttributes(vb, instance, args->start_instance);
+            bound_start_instance = args->start_instance;
+            instance_set = true;
+        }
 
-    // Determine index type
-    GLenum index_type = (g_BoundIndexBuffer->ib_desc.format == ImPlatform_IndexFormat_UInt16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
-    unsigned int index_size = (index_type == GL_UNSIGNED_SHORT) ? sizeof(uint16_t) : sizeof(uint32_t);
+        const void* first = (const void*)((intptr_t)indices + (intptr_t)(args->start_index * index_size));
+        if (glDrawElementsInstancedBaseVertex_Ptr)
+        {
+            glDrawElementsInstancedBaseVertex_Ptr(mode, (GLsizei)args->index_count, index_type, first, (GLsizei)args->instance_count, args->base_vertex);
+            continue;
+        }
 
-    // Use all indices if count is 0
-    if (index_count == 0)
-        index_count = g_BoundIndexBuffer->ib_desc.index_count;
+        if (args->base_vertex != bound_base_vertex)
+        {
+            intptr_t base_offset = (intptr_t)vb->vertex_offset + (intptr_t)args->base_vertex * (intptr_t)vb->vb_desc.vertex_stride;
+            if (base_offset < 0)
+                continue;
+            glBindBuffer(GL_ARRAY_BUFFER, vb->vbo);
+            ImPlatform_GL_SetupVertexAttributes(&vb->vb_desc, (size_t)base_offset);
+            bound_base_vertex = args->base_vertex;
+        }
+        if (instanced)
+            glDrawElementsInstanced_Ptr(mode, (GLsizei)args->index_count, index_type, first, (GLsizei)args->instance_count);
+        else
+            glDrawElements(mode, (GLsizei)args->index_count, index_type, first);
+    }
 
-    // Draw
-    glDrawElements(mode, index_count, index_type, (void*)(intptr_t)(start_index * index_size));
+    if (bound_base_vertex != 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vb->vbo);
+        ImPlatform_GL_SetupVertexAttributes(&vb->vb_desc, (size_t)vb->vertex_offset);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 // ============================================================================
@@ -1476,6 +3328,24 @@ struct ImPlatform_UniformData_GL
     char name[64];
     float data[16];  // Support up to mat4
     unsigned int size;
+    GLint location;  // Resolved when the uniform is first stored, -1 if not active
+};
+
+// Uniform block (GLSL `uniform Name { ... };`) backed by a uniform buffer. Members
+// are written into a CPU copy laid out as reported by the program (std140 unless
+// the shader asks otherwise), which is uploaded once per change into the transient
+// ring and bound with glBindBufferRange.
+struct ImPlatform_UniformBlock_GL
+{
+    GLuint binding;                      // Uniform buffer binding point
+    size_t size;                         // GL_UNIFORM_BLOCK_DATA_SIZE
+    unsigned char* data;                 // CPU copy of the block
+    ImPlatform_ShaderNameTable members;  // Member name -> byte offset (size = bytes the member spans)
+    bool dirty;                          // Changed since the last upload
+    unsigned int upload_frame;           // Transient frame of the last ring upload
+    size_t upload_offset;                // Offset of that upload in the transient buffer
+    GLuint fallback_buffer;              // Own buffer when the transient ring is unavailable
+    bool on_fallback;                    // The last upload went to fallback_buffer
 };
 
 struct ImPlatform_ShaderProgramData_GL
@@ -1483,10 +3353,45 @@ struct ImPlatform_ShaderProgramData_GL
     GLuint program_id;
     GLuint vertex_shader;
     GLuint fragment_shader;
-    ImPlatform_UniformData_GL uniforms[8];  // Support up to 8 uniforms
+    ImPlatform_UniformData_GL uniforms[8];  // Support up to 8 uniforms outside of uniform blocks
     int uniform_count;
+    ImPlatform_ShaderNameTable locations;   // Active uniform name -> location, reflected at link time
+    GLint proj_mtx_location;                // "ProjMtx", -1 if not active
+    ImPlatform_UniformBlock_GL* blocks;     // Active uniform blocks
+    int block_count;
+    bool link_pending;                      // Created by ImPlatform_CreateShaderProgramAsync, link not checked yet
+    bool link_failed;
+    char* cache_name;                       // Program binary to save once the pending link completes
+    char* cache_key;
 };
 
+// Program last bound by ImPlatform_BindShaderProgram, target of ImPlatform_PushShaderConstants
+static ImPlatform_ShaderProgramData_GL* g_ActiveProgram = nullptr;
+// Drawn in place of programs whose link is still pending
+static ImPlatform_ShaderProgramData_GL* g_FallbackProgram = nullptr;
+
+#ifndef GL_ACTIVE_UNIFORMS
+#define GL_ACTIVE_UNIFORMS 0x8B86
+#endif
+#ifndef GL_ACTIVE_UNIFORM_MAX_LENGTH
+#define GL_ACTIVE_UNIFORM_MAX_LENGTH 0x8B87
+#endif
+#ifndef GL_UNIFORM_BUFFER
+#define GL_UNIFORM_BUFFER                 0x8A11
+#endif
+#ifndef GL_ACTIVE_UNIFORM_BLOCKS
+#define GL_UNIFORM_TYPE                   0x8A37
+#define GL_UNIFORM_SIZE                   0x8A38
+#define GL_UNIFORM_BLOCK_INDEX            0x8A3A
+#define GL_UNIFORM_OFFSET                 0x8A3B
+#define GL_UNIFORM_ARRAY_STRIDE           0x8A3C
+#define GL_UNIFORM_MATRIX_STRIDE          0x8A3D
+#define GL_UNIFORM_BLOCK_BINDING          0x8A3F
+#define GL_UNIFORM_BLOCK_DATA_SIZE        0x8A40
+#define GL_UNIFORM_BLOCK_NAME_LENGTH      0x8A41
+#define GL_ACTIVE_UNIFORM_BLOCKS          0x8A36
+#endif
+
 // Global state for uniform block batching
 static ImPlatform_ShaderProgram g_CurrentUniformBlockProgram = nullptr;
 
@@ -1498,12 +3403,15 @@ struct ImPlatform_CallbackData_GL
     ImVec2 DisplaySize;
 };
 
-// Helper to compile a shader and check for errors
-static GLuint ImPlatform_CompileShader_GL(GLenum shader_type, const char* source)
+// Helper to compile a shader and check for errors. Without `wait` the status is
+// not queried, so the driver may keep compiling; errors surface when linking.
+static GLuint ImPlatform_CompileShader_GL(GLenum shader_type, const char* source, bool wait)
 {
     GLuint shader = glCreateShader(shader_type);
     glShaderSource(shader, 1, &source, NULL);
     glCompileShader(shader);
+    if (!wait)
+        return shader;
 
     // Check for compilation errors
     GLint success;
@@ -1560,7 +3468,8 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
         return NULL;
     }
 
-    GLuint shader_id = ImPlatform_CompileShader_GL(shader_type, desc->source_code);
+    const bool wait = (desc->compile_flags & IMPLATFORM_SHADER_COMPILE_ASYNC) == 0;
+    GLuint shader_id = ImPlatform_CompileShader_GL(shader_type, desc->source_code, wait);
     if (shader_id == 0)
         return NULL;
 
@@ -1619,15 +3528,15 @@ IMPLATFORM_API void ImPlatform_DestroyShader(ImPlatform_Shader shader)
 static const char kGLProgramBinaryMagic[4] = { 'I', 'P', 'G', 'L' };
 
 // Try to load a cached linked program from disk into `out_program`.
-// out_cache_path receives the computed path (so the caller can save on miss).
+// out_cache_name receives the computed entry name (so the caller can save on miss).
 // Returns true on successful load + link.
 static bool ImPlatform_GL_TryLoadCachedProgram(
     const ImPlatform_ShaderData_GL* vs_data,
     const ImPlatform_ShaderData_GL* fs_data,
     GLuint program,
-    char* out_cache_path, size_t out_cache_path_size)
+    char* out_cache_name, size_t out_cache_name_size)
 {
-    out_cache_path[0] = '\0';
+    out_cache_name[0] = '\0';
     if (!vs_data->cache_key || !fs_data->cache_key) return false;
 
     // Combined cache key: hash both sources + both entry points.
@@ -1637,11 +3546,11 @@ static bool ImPlatform_GL_TryLoadCachedProgram(
         fs_data->source_code, strlen(fs_data->source_code), fs_data->entry_point, "gl_fs");
     unsigned long long combined = vs_hash ^ (fs_hash * 1099511628211ull);
 
-    ImPlatform_ShaderCacheBuildPath(out_cache_path, out_cache_path_size,
+    ImPlatform_ShaderCacheBuildName(out_cache_name, out_cache_name_size,
                                     vs_data->cache_key, "program", "glbin", combined);
 
     size_t file_size = 0;
-    void* file_data = ImPlatform_ShaderCacheLoad(out_cache_path, &file_size);
+    void* file_data = ImPlatform_ShaderCacheLoad(out_cache_name, &file_size);
     if (!file_data || file_size < 12) { if (file_data) free(file_data); return false; }
 
     const unsigned char* p = (const unsigned char*)file_data;
@@ -1673,9 +3582,9 @@ static bool ImPlatform_GL_TryLoadCachedProgram(
 }
 
 // Save the linked program binary to disk.
-static void ImPlatform_GL_SaveProgramBinary(GLuint program, const char* cache_path, const char* cache_key)
+static void ImPlatform_GL_SaveProgramBinary(GLuint program, const char* cache_name, const char* cache_key)
 {
-    if (!cache_path || !cache_path[0]) return;
+    if (!cache_name || !cache_name[0]) return;
 
     GLint binary_length = 0;
     glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_length);
@@ -1700,7 +3609,7 @@ static void ImPlatform_GL_SaveProgramBinary(GLuint program, const char* cache_pa
     memcpy(file_data + 12, binary_data,          (size_t)actual_len);
     free(binary_data);
 
-    if (ImPlatform_ShaderCacheSave(cache_path, file_data, file_size))
+    if (ImPlatform_ShaderCacheSave(cache_name, file_data, file_size))
     {
         fprintf(stderr, "[ImPlatform shader cache] SAVE %s/program (GL binary %d bytes)\n",
                 cache_key ? cache_key : "?", (int)actual_len);
@@ -1708,7 +3617,286 @@ static void ImPlatform_GL_SaveProgramBinary(GLuint program, const char* cache_pa
     free(file_data);
 }
 
-IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+static void ImPlatform_GL_FreeUniformBlocks(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    for (int i = 0; i < program_data->block_count; i++)
+    {
+        ImPlatform_UniformBlock_GL* block = &program_data->blocks[i];
+        ImPlatform_ShaderNameTable_Free(&block->members);
+        free(block->data);
+        if (block->fallback_buffer)
+            glDeleteBuffers(1, &block->fallback_buffer);
+    }
+    free(program_data->blocks);
+    program_data->blocks = NULL;
+    program_data->block_count = 0;
+}
+
+// Bytes spanned by a block member: the whole array for arrays, every column for matrices
+static size_t ImPlatform_GL_UniformMemberSize(GLenum type, GLint array_size, GLint array_stride, GLint matrix_stride, size_t space_left)
+{
+    size_t element_size = 0;
+    switch (type)
+    {
+    case 0x1406: /*GL_FLOAT*/ case 0x1404: /*GL_INT*/ case 0x1405: /*GL_UNSIGNED_INT*/ case 0x8B56: /*GL_BOOL*/
+        element_size = 4; break;
+    case 0x8B50: /*GL_FLOAT_VEC2*/ case 0x8B53: /*GL_INT_VEC2*/ case 0x8DC6: /*GL_UNSIGNED_INT_VEC2*/
+        element_size = 8; break;
+    case 0x8B51: /*GL_FLOAT_VEC3*/ case 0x8B54: /*GL_INT_VEC3*/ case 0x8DC7: /*GL_UNSIGNED_INT_VEC3*/
+        element_size = 12; break;
+    case 0x8B52: /*GL_FLOAT_VEC4*/ case 0x8B55: /*GL_INT_VEC4*/ case 0x8DC8: /*GL_UNSIGNED_INT_VEC4*/
+        element_size = 16; break;
+    case 0x8B5A: /*GL_FLOAT_MAT2*/ case 0x8B65: /*GL_FLOAT_MAT2x3*/ case 0x8B66: /*GL_FLOAT_MAT2x4*/
+        element_size = 2 * (size_t)matrix_stride; break;
+    case 0x8B5B: /*GL_FLOAT_MAT3*/ case 0x8B67: /*GL_FLOAT_MAT3x2*/ case 0x8B68: /*GL_FLOAT_MAT3x4*/
+        element_size = 3 * (size_t)matrix_stride; break;
+    case 0x8B5C: /*GL_FLOAT_MAT4*/ case 0x8B69: /*GL_FLOAT_MAT4x2*/ case 0x8B6A: /*GL_FLOAT_MAT4x3*/
+        element_size = 4 * (size_t)matrix_stride; break;
+    default:
+        return space_left;
+    }
+    size_t size = array_stride > 0 ? (size_t)array_stride * (size_t)(array_size - 1) + element_size : element_size;
+    return size < space_left ? size : space_left;
+}
+
+// Fills the program's uniform blocks from the active uniform blocks. The first block on
+// binding 0 keeps it, other blocks without an explicit binding get the lowest binding point
+// no block uses. Members are reachable by their GL name and, for "Block.member", by "member" alone.
+static void ImPlatform_GL_ReflectUniformBlocks(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    ImPlatform_GL_FreeUniformBlocks(program_data);
+    if (!g_HasUniformBuffers)
+        return;
+
+    const GLuint program = program_data->program_id;
+    GLint block_count = 0, uniform_count = 0, max_length = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &block_count);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+    if (block_count <= 0 || uniform_count <= 0 || max_length <= 0)
+        return;
+
+    program_data->blocks = (ImPlatform_UniformBlock_GL*)calloc((size_t)block_count, sizeof(ImPlatform_UniformBlock_GL));
+    if (!program_data->blocks)
+        return;
+    program_data->block_count = block_count;
+    for (GLint i = 0; i < block_count; i++)
+    {
+        GLint binding = 0;
+        glGetActiveUniformBlockiv_Ptr(program, (GLuint)i, GL_UNIFORM_BLOCK_BINDING, &binding);
+        program_data->blocks[i].binding = (GLuint)binding;
+    }
+    GLuint next_binding = 1;
+    bool zero_taken = false;
+    for (GLint i = 0; i < block_count; i++)
+    {
+        ImPlatform_UniformBlock_GL* block = &program_data->blocks[i];
+        if (block->binding == 0 && !zero_taken)
+            zero_taken = true;
+        else if (block->binding == 0)
+        {
+            // Explicit bindings were all read above, so the first unused one is free for good
+            for (GLint j = 0; j < block_count; j++)
+                if (program_data->blocks[j].binding == next_binding)
+                {
+                    next_binding++;
+                    j = -1;
+                }
+            block->binding = next_binding++;
+            glUniformBlockBinding_Ptr(program, (GLuint)i, block->binding);
+        }
+
+        GLint data_size = 0;
+        glGetActiveUniformBlockiv_Ptr(program, (GLuint)i, GL_UNIFORM_BLOCK_DATA_SIZE, &data_size);
+        block->size = data_size > 0 ? (size_t)data_size : 0;
+        block->data = (unsigned char*)calloc(1, block->size ? block->size : 1);
+        block->dirty = true;
+    }
+
+    GLuint* indices = (GLuint*)malloc(sizeof(GLuint) * (size_t)uniform_count);
+    GLint* params = (GLint*)malloc(sizeof(GLint) * (size_t)uniform_count * 6);
+    GLchar* name = (GLchar*)malloc((size_t)max_length);
+    if (indices && params && name)
+    {
+        for (GLint i = 0; i < uniform_count; i++)
+            indices[i] = (GLuint)i;
+        GLint* block_index  = params;
+        GLint* offset       = params + uniform_count;
+        GLint* type         = params + uniform_count * 2;
+        GLint* array_size   = params + uniform_count * 3;
+        GLint* array_stride = params + uniform_count * 4;
+        GLint* matrix_stride = params + uniform_count * 5;
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_BLOCK_INDEX, block_index);
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_OFFSET, offset);
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_TYPE, type);
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_SIZE, array_size);
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_ARRAY_STRIDE, array_stride);
+        glGetActiveUniformsiv_Ptr(program, uniform_count, indices, GL_UNIFORM_MATRIX_STRIDE, matrix_stride);
+        for (GLint i = 0; i < uniform_count; i++)
+        {
+            if (block_index[i] < 0 || block_index[i] >= block_count || offset[i] < 0)
+                continue;
+            ImPlatform_UniformBlock_GL* block = &program_data->blocks[block_index[i]];
+            if ((size_t)offset[i] >= block->size)
+                continue;
+
+            GLsizei length = 0;
+            GLint unused_size = 0;
+            GLenum unused_type = 0;
+            glGetActiveUniform_Ptr(program, (GLuint)i, max_length, &length, &unused_size, &unused_type, name);
+            if (length <= 0)
+                continue;
+
+            // Arrays are reported as "name[0]"
+            if (length > 3 && strcmp(name + length - 3, "[0]") == 0)
+                length -= 3;
+            const unsigned int member_size = (unsigned int)ImPlatform_GL_UniformMemberSize((GLenum)type[i], array_size[i], array_stride[i],
+                                                                                          matrix_stride[i], block->size - (size_t)offset[i]);
+            ImPlatform_ShaderNameTable_AddN(&block->members, name, (size_t)length, offset[i], member_size);
+            const char* dot = strrchr(name, '.');
+            if (dot && dot < name + length)
+                ImPlatform_ShaderNameTable_AddN(&block->members, dot + 1, (size_t)(name + length - (dot + 1)), offset[i], member_size);
+        }
+    }
+    free(indices);
+    free(params);
+    free(name);
+}
+
+// Writes `name` into the uniform block declaring it. Returns false when no block does.
+static bool ImPlatform_GL_SetBlockUniform(ImPlatform_ShaderProgramData_GL* program_data, const char* name, const void* data, unsigned int size)
+{
+    for (int i = 0; i < program_data->block_count; i++)
+    {
+        ImPlatform_UniformBlock_GL* block = &program_data->blocks[i];
+        const ImPlatform_ShaderNameEntry* member = ImPlatform_ShaderNameTable_Find(&block->members, name);
+        if (!member)
+            continue;
+        const size_t copy_size = size < member->size ? size : member->size;
+        if (memcmp(block->data + member->value, data, copy_size) != 0)
+        {
+            memcpy(block->data + member->value, data, copy_size);
+            block->dirty = true;
+        }
+        return true;
+    }
+    return false;
+}
+
+// Binds the program's uniform blocks. A block is copied into the transient ring
+// when it changed (or wasn't uploaded yet this frame), so draws in flight keep
+// the contents they were recorded with; otherwise the previous range is rebound.
+static void ImPlatform_GL_BindUniformBlocks(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    for (int i = 0; i < program_data->block_count; i++)
+    {
+        ImPlatform_UniformBlock_GL* block = &program_data->blocks[i];
+        if (block->size == 0)
+            continue;
+
+        // The ring is tried first on every upload, the fallback only covers failed allocations
+        if (block->dirty || block->upload_frame != g_Transient.frame || block->on_fallback)
+        {
+            size_t offset = 0;
+            unsigned char* dst = ImPlatform_GL_TransientAlloc(block->size, (size_t)g_UniformBufferAlignment, &offset);
+            if (dst)
+            {
+                memcpy(dst, block->data, block->size);
+                ImPlatform_GL_FlushTransient();
+                block->upload_frame = g_Transient.frame;
+                block->upload_offset = offset;
+                block->dirty = false;
+                block->on_fallback = false;
+            }
+            else
+            {
+                // No ring (WebGL / ES without mapping) or a full region: a buffer of the
+                // block's own, orphaned on every change
+                if (!block->fallback_buffer)
+                    glGenBuffers(1, &block->fallback_buffer);
+                glBindBuffer(GL_UNIFORM_BUFFER, block->fallback_buffer);
+                // Its contents are stale if the ring took uploads in between
+                if (block->dirty || !block->on_fallback)
+                {
+                    glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)block->size, NULL, GL_STREAM_DRAW);
+                    glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr)block->size, block->data);
+                    block->dirty = false;
+                    block->on_fallback = true;
+                }
+                glBindBuffer(GL_UNIFORM_BUFFER, 0);
+                glBindBufferRange_Ptr(GL_UNIFORM_BUFFER, block->binding, block->fallback_buffer, 0, (GLsizeiptr)block->size);
+                continue;
+            }
+        }
+        glBindBufferRange_Ptr(GL_UNIFORM_BUFFER, block->binding, g_Transient.buffer, (GLintptr)block->upload_offset, (GLsizeiptr)block->size);
+    }
+}
+
+// Fills the program's location table from its active uniforms. Arrays are
+// reachable both as "name" and "name[0]", like glGetUniformLocation.
+static void ImPlatform_GL_ReflectUniforms(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    ImPlatform_ShaderNameTable_Free(&program_data->locations);
+    ImPlatform_GL_ReflectUniformBlocks(program_data);
+
+    GLint uniform_count = 0, max_length = 0;
+    glGetProgramiv(program_data->program_id, GL_ACTIVE_UNIFORMS, &uniform_count);
+    glGetProgramiv(program_data->program_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+    if (glGetActiveUniform_Ptr && uniform_count > 0 && max_length > 0)
+    {
+        GLchar* name = (GLchar*)malloc((size_t)max_length);
+        for (GLint i = 0; name && i < uniform_count; i++)
+        {
+            GLsizei length = 0;
+            GLint array_size = 0;
+            GLenum type = 0;
+            glGetActiveUniform_Ptr(program_data->program_id, (GLuint)i, max_length, &length, &array_size, &type, name);
+            GLint location = glGetUniformLocation(program_data->program_id, name);
+            if (length <= 0 || location == -1)
+                continue; // Uniform block members have no location
+
+            ImPlatform_ShaderNameTable_AddN(&program_data->locations, name, (size_t)length, location, 0);
+            if (length > 3 && strcmp(name + length - 3, "[0]") == 0)
+                ImPlatform_ShaderNameTable_AddN(&program_data->locations, name, (size_t)length - 3, location, 0);
+        }
+        free(name);
+    }
+
+    const ImPlatform_ShaderNameEntry* proj = ImPlatform_ShaderNameTable_Find(&program_data->locations, "ProjMtx");
+    program_data->proj_mtx_location = proj ? proj->value : -1;
+}
+
+static GLint ImPlatform_GL_FindUniformLocation(const ImPlatform_ShaderProgramData_GL* program_data, const char* name)
+{
+    const ImPlatform_ShaderNameEntry* entry = ImPlatform_ShaderNameTable_Find(&program_data->locations, name);
+    return entry ? entry->value : -1;
+}
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// Logs why `program` failed to link, including the compile log of its shaders
+// (compiles started without waiting are only checked here)
+static void ImPlatform_GL_LogLinkFailure(GLuint program, GLuint vertex_shader, GLuint fragment_shader)
+{
+    char info_log[512];
+    const GLuint shaders[2] = { vertex_shader, fragment_shader };
+    for (int i = 0; i < 2; i++)
+    {
+        GLint compiled = GL_TRUE;
+        glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &compiled);
+        if (!compiled)
+        {
+            glGetShaderInfoLog(shaders[i], 512, NULL, info_log);
+            fprintf(stderr, "Shader compilation failed: %s\n", info_log);
+        }
+    }
+    glGetProgramInfoLog(program, 512, NULL, info_log);
+    fprintf(stderr, "Shader program linking failed: %s\n", info_log);
+}
+
+static ImPlatform_ShaderProgramData_GL* ImPlatform_GL_CreateProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader, bool async)
 {
     if (!vertex_shader || !fragment_shader)
         return NULL;
@@ -1729,13 +3917,13 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
     }
 
     // 1) Try to load the pre-linked program binary from disk
-    char cache_path[512];
-    cache_path[0] = '\0';
+    char cache_name[512];
+    cache_name[0] = '\0';
     bool cache_hit = false;
     if (cache_enabled)
     {
         cache_hit = ImPlatform_GL_TryLoadCachedProgram(vs_data, fs_data, program,
-                                                       cache_path, sizeof(cache_path));
+                                                       cache_name, sizeof(cache_name));
     }
 
     // 2) Cache miss (or no cache_key): attach shaders and link normally
@@ -1748,20 +3936,35 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
         glAttachShader(program, fs_data->shader_id);
         glLinkProgram(program);
 
+        // Async: the link is checked (and the binary saved) by ImPlatform_GL_PollProgram
+        if (async)
+        {
+            ImPlatform_ShaderProgramData_GL* program_data = new ImPlatform_ShaderProgramData_GL();
+            program_data->program_id = program;
+            program_data->vertex_shader = vs_data->shader_id;
+            program_data->fragment_shader = fs_data->shader_id;
+            program_data->proj_mtx_location = -1;
+            program_data->link_pending = true;
+            if (cache_enabled)
+            {
+                program_data->cache_name = ImPlatform_StrDup_GL(cache_name);
+                program_data->cache_key = ImPlatform_StrDup_GL(vs_data->cache_key);
+            }
+            return program_data;
+        }
+
         GLint success;
         glGetProgramiv(program, GL_LINK_STATUS, &success);
         if (!success)
         {
-            char info_log[512];
-            glGetProgramInfoLog(program, 512, NULL, info_log);
-            fprintf(stderr, "Shader program linking failed: %s\n", info_log);
+            ImPlatform_GL_LogLinkFailure(program, vs_data->shader_id, fs_data->shader_id);
             glDeleteProgram(program);
             return NULL;
         }
 
         // 3) Save the linked binary for next launch
         if (cache_enabled)
-            ImPlatform_GL_SaveProgramBinary(program, cache_path, vs_data->cache_key);
+            ImPlatform_GL_SaveProgramBinary(program, cache_name, vs_data->cache_key);
     }
 
     ImPlatform_ShaderProgramData_GL* program_data = new ImPlatform_ShaderProgramData_GL();
@@ -1769,8 +3972,86 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
     program_data->vertex_shader = vs_data->shader_id;
     program_data->fragment_shader = fs_data->shader_id;
     program_data->uniform_count = 0;
+    ImPlatform_GL_ReflectUniforms(program_data);
+
+    return program_data;
+}
+
+// Completes an asynchronous link: checks it, saves the program binary and reflects
+// the program. Uniforms stored meanwhile are moved into their block or resolved.
+// Returns whether the program is usable; never blocks with GL_KHR_parallel_shader_compile.
+static bool ImPlatform_GL_PollProgram(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    if (!program_data->link_pending)
+        return !program_data->link_failed;
+
+    if (g_HasParallelShaderCompile)
+    {
+        GLint done = GL_FALSE;
+        glGetProgramiv(program_data->program_id, GL_COMPLETION_STATUS_KHR, &done);
+        if (!done)
+            return false;
+    }
+
+    program_data->link_pending = false;
+    GLint success = GL_FALSE;
+    glGetProgramiv(program_data->program_id, GL_LINK_STATUS, &success);
+    if (success && program_data->cache_name)
+        ImPlatform_GL_SaveProgramBinary(program_data->program_id, program_data->cache_name, program_data->cache_key);
+    free(program_data->cache_name);
+    free(program_data->cache_key);
+    program_data->cache_name = NULL;
+    program_data->cache_key = NULL;
+    if (!success)
+    {
+        ImPlatform_GL_LogLinkFailure(program_data->program_id, program_data->vertex_shader, program_data->fragment_shader);
+        program_data->link_failed = true;
+        return false;
+    }
+
+    ImPlatform_GL_ReflectUniforms(program_data);
+    int kept = 0;
+    for (int i = 0; i < program_data->uniform_count; i++)
+    {
+        ImPlatform_UniformData_GL* uniform = &program_data->uniforms[i];
+        if (ImPlatform_GL_SetBlockUniform(program_data, uniform->name, uniform->data, uniform->size))
+            continue;
+        uniform->location = ImPlatform_GL_FindUniformLocation(program_data, uniform->name);
+        program_data->uniforms[kept++] = *uniform;
+    }
+    program_data->uniform_count = kept;
+    return true;
+}
+
+// Program to draw with in place of `program_data`: itself once linked, else the
+// fallback program, else NULL (ImGui's default shader stays bound)
+static ImPlatform_ShaderProgramData_GL* ImPlatform_GL_ResolveProgram(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    if (ImPlatform_GL_PollProgram(program_data))
+        return program_data;
+    if (g_FallbackProgram && g_FallbackProgram != program_data && ImPlatform_GL_PollProgram(g_FallbackProgram))
+        return g_FallbackProgram;
+    return NULL;
+}
+
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+{
+    return (ImPlatform_ShaderProgram)ImPlatform_GL_CreateProgram(vertex_shader, fragment_shader, false);
+}
+
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+{
+    return (ImPlatform_ShaderProgram)ImPlatform_GL_CreateProgram(vertex_shader, fragment_shader, true);
+}
+
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program)
+{
+    return program && ImPlatform_GL_PollProgram((ImPlatform_ShaderProgramData_GL*)program);
+}
 
-    return (ImPlatform_ShaderProgram)program_data;
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram program)
+{
+    g_FallbackProgram = (ImPlatform_ShaderProgramData_GL*)program;
 }
 
 IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram program)
@@ -1790,6 +4071,14 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
 
         glDeleteProgram(program_data->program_id);
     }
+    ImPlatform_ShaderNameTable_Free(&program_data->locations);
+    ImPlatform_GL_FreeUniformBlocks(program_data);
+    free(program_data->cache_name);
+    free(program_data->cache_key);
+    if (g_ActiveProgram == program_data)
+        g_ActiveProgram = nullptr;
+    if (g_FallbackProgram == program_data)
+        g_FallbackProgram = nullptr;
 
     delete program_data;
 }
@@ -1799,19 +4088,28 @@ IMPLATFORM_API void ImPlatform_BindShaderProgram(ImPlatform_ShaderProgram progra
     if (!program)
     {
         glUseProgram(0);
+        g_ActiveProgram = nullptr;
         return;
     }
 
-    ImPlatform_ShaderProgramData_GL* program_data = (ImPlatform_ShaderProgramData_GL*)program;
-    glUseProgram(program_data->program_id);
+    ImPlatform_ShaderProgramData_GL* program_data = ImPlatform_GL_ResolveProgram((ImPlatform_ShaderProgramData_GL*)program);
+    glUseProgram(program_data ? program_data->program_id : 0);
+    g_ActiveProgram = program_data;
 }
 
 IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram program, const char* name, const void* data, unsigned int size)
 {
-    if (!program || !name || !data || size > sizeof(float) * 16)
+    if (!program || !name || !data)
         return false;
 
     ImPlatform_ShaderProgramData_GL* program_data = (ImPlatform_ShaderProgramData_GL*)program;
+    ImPlatform_GL_PollProgram(program_data); // Stored by name until a pending link completes
+
+    // Members of uniform blocks have no size restriction
+    if (ImPlatform_GL_SetBlockUniform(program_data, name, data, size))
+        return true;
+    if (size > sizeof(float) * 16)
+        return false;
 
     // Find existing uniform or add new one
     int uniform_index = -1;
@@ -1833,6 +4131,7 @@ IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram program
         uniform_index = program_data->uniform_count++;
         strncpy(program_data->uniforms[uniform_index].name, name, 63);
         program_data->uniforms[uniform_index].name[63] = '\0';
+        program_data->uniforms[uniform_index].location = ImPlatform_GL_FindUniformLocation(program_data, name);
     }
 
     // Store uniform data
@@ -1885,7 +4184,7 @@ IMPLATFORM_API bool ImPlatform_SetShaderTexture(ImPlatform_ShaderProgram program
     glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)texture);
 
     // For shaders without explicit binding (legacy sampler uniforms), set the unit.
-    GLint location = glGetUniformLocation(program_data->program_id, name);
+    GLint location = ImPlatform_GL_FindUniformLocation(program_data, name);
     if (location != -1)
         glUniform1i(location, slot);
 
@@ -1896,16 +4195,52 @@ IMPLATFORM_API bool ImPlatform_SetShaderTexture(ImPlatform_ShaderProgram program
 // Custom Shader DrawList Integration
 // ============================================================================
 
+// Uploads the projection and the stored uniforms of the bound program. Locations
+// were resolved when the program was linked / the uniforms stored.
+static void ImPlatform_GL_ApplyUniforms(ImPlatform_ShaderProgramData_GL* program_data, const float* projection)
+{
+    if (program_data->proj_mtx_location != -1)
+        glUniformMatrix4fv(program_data->proj_mtx_location, 1, GL_FALSE, projection);
+    else if (program_data->block_count > 0)
+        ImPlatform_GL_SetBlockUniform(program_data, "ProjMtx", projection, sizeof(float) * 16);
+    ImPlatform_GL_BindUniformBlocks(program_data);
+
+    for (int i = 0; i < program_data->uniform_count; i++)
+    {
+        const ImPlatform_UniformData_GL* uniform = &program_data->uniforms[i];
+        GLint location = uniform->location;
+
+        if (location == -1)
+            continue;
+
+        unsigned int size = uniform->size;
+        const float* data = uniform->data;
+
+        if (size == sizeof(float) * 1)
+            glUniform1fv_Ptr(location, 1, data);
+        else if (size == sizeof(float) * 2)
+            glUniform2fv_Ptr(location, 1, data);
+        else if (size == sizeof(float) * 3)
+            glUniform3fv_Ptr(location, 1, data);
+        else if (size == sizeof(float) * 4)
+            glUniform4fv_Ptr(location, 1, data);
+        else if (size == sizeof(float) * 16)
+            glUniformMatrix4fv(location, 1, GL_FALSE, data);
+    }
+}
+
 // ImDrawCallback handler to activate a custom shader
 static void ImPlatform_SetCustomShader(const ImDrawList* parent_list, const ImDrawCmd* cmd)
 {
     ImPlatform_ShaderProgram program = (ImPlatform_ShaderProgram)cmd->UserCallbackData;
     if (!program) return;
 
-    ImPlatform_ShaderProgramData_GL* program_data = (ImPlatform_ShaderProgramData_GL*)program;
+    // Programs still linking draw with the fallback program, or keep ImGui's shader
+    ImPlatform_ShaderProgramData_GL* program_data = ImPlatform_GL_ResolveProgram((ImPlatform_ShaderProgramData_GL*)program);
+    if (!program_data) return;
 
     // Bind the shader program
-    ImPlatform_BindShaderProgram(program);
+    ImPlatform_BindShaderProgram(program_data);
 
     // Use cached draw data for correct viewport projection in multi-viewport mode
     ImDrawData* draw_data = g_CurrentDrawData;
@@ -1923,44 +4258,18 @@ static void ImPlatform_SetCustomShader(const ImDrawList* parent_list, const ImDr
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
 
-    // Apply projection matrix
-    GLint proj_loc = glGetUniformLocation(program_data->program_id, "ProjMtx");
-    if (proj_loc != -1)
-        glUniformMatrix4fv(proj_loc, 1, GL_FALSE, &ortho_projection[0][0]);
-
-    // Apply all stored uniforms
-    for (int i = 0; i < program_data->uniform_count; i++)
-    {
-        ImPlatform_UniformData_GL* uniform = &program_data->uniforms[i];
-        GLint location = glGetUniformLocation(program_data->program_id, uniform->name);
-
-        if (location == -1)
-            continue;
-
-        unsigned int size = uniform->size;
-        const float* data = uniform->data;
-
-        if (size == sizeof(float) * 1)
-            glUniform1fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 2)
-            glUniform2fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 3)
-            glUniform3fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 4)
-            glUniform4fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 16)
-            glUniformMatrix4fv(location, 1, GL_FALSE, data);
-    }
+    ImPlatform_GL_ApplyUniforms(program_data, &ortho_projection[0][0]);
 }
 
 // Activate a custom shader immediately (for use inside draw callbacks).
 IMPLATFORM_API void ImPlatform_BeginCustomShader_Render(ImPlatform_ShaderProgram program)
 {
     if (!program) return;
-    ImPlatform_ShaderProgramData_GL* program_data = (ImPlatform_ShaderProgramData_GL*)program;
+    ImPlatform_ShaderProgramData_GL* program_data = ImPlatform_GL_ResolveProgram((ImPlatform_ShaderProgramData_GL*)program);
+    if (!program_data) return;
 
     // Bind the shader program
-    ImPlatform_BindShaderProgram(program);
+    ImPlatform_BindShaderProgram(program_data);
 
     // Use cached draw data for correct viewport projection in multi-viewport mode
     ImDrawData* draw_data = g_CurrentDrawData;
@@ -1980,34 +4289,7 @@ IMPLATFORM_API void ImPlatform_BeginCustomShader_Render(ImPlatform_ShaderProgram
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
 
-    // Apply projection matrix
-    GLint proj_loc = glGetUniformLocation(program_data->program_id, "ProjMtx");
-    if (proj_loc != -1)
-        glUniformMatrix4fv(proj_loc, 1, GL_FALSE, &ortho_projection[0][0]);
-
-    // Apply all stored uniforms
-    for (int i = 0; i < program_data->uniform_count; i++)
-    {
-        ImPlatform_UniformData_GL* uniform = &program_data->uniforms[i];
-        GLint location = glGetUniformLocation(program_data->program_id, uniform->name);
-
-        if (location == -1)
-            continue;
-
-        unsigned int size = uniform->size;
-        const float* data = uniform->data;
-
-        if (size == sizeof(float) * 1)
-            glUniform1fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 2)
-            glUniform2fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 3)
-            glUniform3fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 4)
-            glUniform4fv_Ptr(location, 1, data);
-        else if (size == sizeof(float) * 16)
-            glUniformMatrix4fv(location, 1, GL_FALSE, data);
-    }
+    ImPlatform_GL_ApplyUniforms(program_data, &ortho_projection[0][0]);
 }
 
 IMPLATFORM_API void ImPlatform_BeginCustomShader(ImDrawList* draw, ImPlatform_ShaderProgram shader)
@@ -2017,6 +4299,7 @@ IMPLATFORM_API void ImPlatform_BeginCustomShader(ImDrawList* draw, ImPlatform_Sh
 
     // Just pass the shader program - we'll get viewport info in the callback
     draw->AddCallback(&ImPlatform_SetCustomShader, shader);
+    g_CustomShaderDrawList = draw;
 }
 
 IMPLATFORM_API void ImPlatform_EndCustomShader(ImDrawList* draw)
@@ -2025,17 +4308,126 @@ IMPLATFORM_API void ImPlatform_EndCustomShader(ImDrawList* draw)
         return;
 
     draw->AddCallback(ImDrawCallback_ResetRenderState, NULL);
+    if (g_CustomShaderDrawList == draw)
+        g_CustomShaderDrawList = nullptr;
+}
+
+// Constants captured at build time, stored in g_ShaderConstantsArena
+struct ImPlatform_ShaderConstants_GL
+{
+    unsigned int size;
+    // size bytes follow
+};
+
+// Uniform block receiving pushed constants: the first one not declaring ProjMtx,
+// so a block shared with the projection keeps it.
+static ImPlatform_UniformBlock_GL* ImPlatform_GL_GetConstantsBlock(ImPlatform_ShaderProgramData_GL* program_data)
+{
+    if (!program_data || program_data->block_count == 0)
+        return NULL;
+    for (int i = 0; i < program_data->block_count; i++)
+    {
+        ImPlatform_UniformBlock_GL* block = &program_data->blocks[i];
+        if (block->size > 0 && !ImPlatform_ShaderNameTable_Find(&block->members, "ProjMtx"))
+            return block;
+    }
+    return program_data->blocks[0].size > 0 ? &program_data->blocks[0] : NULL;
+}
+
+// Binds a range holding the block's stored contents with `data` over its first bytes.
+// The block's own data is left untouched, so ImPlatform_GL_BindUniformBlocks restores it.
+static bool ImPlatform_GL_BindShaderConstants(const void* data, unsigned int size)
+{
+    ImPlatform_UniformBlock_GL* block = ImPlatform_GL_GetConstantsBlock(g_ActiveProgram);
+    if (!block)
+        return false;
+
+    const size_t copy_size = size < block->size ? size : block->size;
+    size_t offset = 0;
+    unsigned char* dst = ImPlatform_GL_TransientAlloc(block->size, (size_t)g_UniformBufferAlignment, &offset);
+    if (dst)
+    {
+        memcpy(dst, block->data, block->size);
+        memcpy(dst, data, copy_size);
+        ImPlatform_GL_FlushTransient();
+        glBindBufferRange_Ptr(GL_UNIFORM_BUFFER, block->binding, g_Transient.buffer, (GLintptr)offset, (GLsizeiptr)block->size);
+        return true;
+    }
+
+    // No ring: orphan a shared buffer for every push
+    if (!g_ShaderConstantsBuffer)
+        glGenBuffers(1, &g_ShaderConstantsBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, g_ShaderConstantsBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)block->size, NULL, GL_STREAM_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr)block->size, block->data);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr)copy_size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferRange_Ptr(GL_UNIFORM_BUFFER, block->binding, g_ShaderConstantsBuffer, 0, (GLsizeiptr)block->size);
+    return true;
+}
+
+static void ImPlatform_GL_PushShaderConstantsCallback(const ImDrawList* parent_list, const ImDrawCmd* cmd)
+{
+    (void)parent_list;
+    const ImPlatform_ShaderConstants_GL* constants = (const ImPlatform_ShaderConstants_GL*)cmd->UserCallbackData;
+    ImPlatform_GL_BindShaderConstants(constants + 1, constants->size);
+}
+
+static void ImPlatform_GL_PopShaderConstantsCallback(const ImDrawList* parent_list, const ImDrawCmd* cmd)
+{
+    (void)parent_list; (void)cmd;
+    if (g_ActiveProgram)
+        ImPlatform_GL_BindUniformBlocks(g_ActiveProgram);
+}
+
+static void ImPlatform_GL_DestroyShaderConstants(void)
+{
+    ImPlatform_FrameArena_Free(&g_ShaderConstantsArena);
+    if (g_ShaderConstantsBuffer)
+    {
+        glDeleteBuffers(1, &g_ShaderConstantsBuffer);
+        g_ShaderConstantsBuffer = 0;
+    }
+    g_CustomShaderDrawList = nullptr;
 }
 
+// Inside a draw callback the constants are bound right away. While the frame is
+// built they are copied into the frame arena and bound by a callback of the draw
+// list given to ImPlatform_BeginCustomShader, each in its own ring range.
 IMPLATFORM_API void* ImPlatform_PushShaderConstants(const void* data, unsigned int size)
 {
-    (void)data; (void)size;
-    return nullptr;
+    if (!data || size == 0)
+        return nullptr;
+
+    if (g_RenderingDrawData)
+        return ImPlatform_GL_BindShaderConstants(data, size) ? (void*)g_ActiveProgram : nullptr;
+
+    if (!g_CustomShaderDrawList)
+        return nullptr;
+
+    ImPlatform_ShaderConstants_GL* constants = (ImPlatform_ShaderConstants_GL*)ImPlatform_FrameArena_Alloc(&g_ShaderConstantsArena, sizeof(ImPlatform_ShaderConstants_GL) + size);
+    if (!constants)
+        return nullptr;
+    constants->size = size;
+    memcpy(constants + 1, data, size);
+    g_CustomShaderDrawList->AddCallback(&ImPlatform_GL_PushShaderConstantsCallback, constants);
+    return constants;
 }
 
 IMPLATFORM_API void ImPlatform_PopShaderConstants(void* handle)
 {
-    (void)handle;
+    if (!handle)
+        return;
+
+    if (g_RenderingDrawData)
+    {
+        if (g_ActiveProgram)
+            ImPlatform_GL_BindUniformBlocks(g_ActiveProgram);
+        return;
+    }
+
+    if (g_CustomShaderDrawList)
+        g_CustomShaderDrawList->AddCallback(&ImPlatform_GL_PopShaderConstantsCallback, NULL);
 }
 
 // ============================================================================
@@ -2058,7 +4450,7 @@ IMPLATFORM_API void ImPlatform_PushSampler(ImPlatform_TextureFilter filter, ImPl
             int enc = (int)(uintptr_t)cmd->UserCallbackData;
             int f = (enc >> 8) & 0xFF;
             int w = enc & 0xFF;
-            if (f < 2 && w < 3 && g_Samplers[f][w])
+            if (f < 3 && w < 3 && g_Samplers[f][w])
                 glBindSampler_Ptr(0, g_Samplers[f][w]);
         }, (void*)encoded);
 }
@@ -9,6 +9,10 @@
 #include "../imgui/backends/imgui_impl_vulkan.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #if defined(IM_CURRENT_PLATFORM) && (IM_CURRENT_PLATFORM == IM_PLATFORM_WIN32)
     #include <vulkan/vulkan_win32.h>
@@ -36,6 +40,16 @@ static VkAllocationCallbacks* g_Allocator = NULL;
 // call, and serialized back to disk on cleanup.
 static VkPipelineCache g_VulkanPipelineCache = VK_NULL_HANDLE;
 
+// Render pass custom shader pipelines are created against. It is compatible with the main
+// window's (same color format, one sample) but owned by ImPlatform, so pipeline worker threads
+// never read the swapchain's pass while a resize destroys and recreates it.
+static VkRenderPass g_PipelineRenderPass = VK_NULL_HANDLE;
+
+// Swapchain image usage. Transfer source lets ImPlatform_CopyBackbuffer blit from the backbuffer.
+#ifndef IMPLATFORM_VULKAN_SWAPCHAIN_USAGE
+#define IMPLATFORM_VULKAN_SWAPCHAIN_USAGE (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT)
+#endif
+
 // Render texture tracking
 struct ImPlatform_RTTracking_Vulkan {
     VkImage             image;
@@ -45,10 +59,9 @@ struct ImPlatform_RTTracking_Vulkan {
     VkDescriptorSet     descriptorSet;
     VkRenderPass        renderPass;
     VkFramebuffer       framebuffer;
-    VkCommandPool       commandPool;
-    VkCommandBuffer     commandBuffer;
     unsigned int        width, height;
     VkFormat            format;
+    int                 bytesPerPixel;
     ImPlatform_RTTracking_Vulkan* next;
 };
 static ImPlatform_RTTracking_Vulkan* g_RTTrackingHead  = NULL;
@@ -56,18 +69,169 @@ static ImPlatform_RTTracking_Vulkan* g_ActiveRTEntry   = NULL;
 static ImGui_ImplVulkanH_Window g_MainWindowData;  // Don't use = {} - let constructor run!
 static bool g_SwapChainRebuild = false;
 static uint32_t g_QueueFamily = (uint32_t)-1;
+static VkPhysicalDeviceFeatures g_EnabledFeatures = {};
+
+// Custom data shares the fragment push constant range with the projection (offset 64, 64 bytes max)
+#define IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET 64
+#define IMPLATFORM_VULKAN_MAX_SHADER_CONSTANTS 64
 
-// Uniform block API state
+// Uniform block API state. Programs without reflected members get their uniforms
+// packed in call order into g_UniformBlockData.
 static ImPlatform_ShaderProgram g_CurrentUniformBlockProgram = nullptr;
-static void* g_UniformBlockData = nullptr;
+static unsigned char g_UniformBlockData[IMPLATFORM_VULKAN_MAX_SHADER_CONSTANTS];
 static size_t g_UniformBlockSize = 0;
 
 // Current command buffer for custom shader rendering
 static VkCommandBuffer g_CurrentCommandBuffer = VK_NULL_HANDLE;
 
+// Program bound by the last custom shader callback, and the pipeline bound since
+struct ImPlatform_ShaderProgramData_Vulkan;
+static ImPlatform_ShaderProgramData_Vulkan* g_CurrentProgram = NULL;
+static VkPipeline g_CurrentPipeline = VK_NULL_HANDLE;
+
 // Current draw data for custom shader rendering (needed for multi-viewport)
 static ImDrawData* g_CurrentDrawData = nullptr;
 
+// Shader constants pushed while the frame is built, read back by their draw callbacks.
+// Reset when the next frame starts (push constants are copied into the command buffer).
+static ImPlatform_FrameArena g_ShaderConstantsArena = {};
+static ImDrawList* g_CustomShaderDrawList = nullptr;  // Draw list of the open BeginCustomShader
+
+// Size of the persistently mapped staging ring used by ImPlatform_UpdateTexture.
+// The ring grows on demand, this is only the initial allocation.
+#ifndef IMPLATFORM_VULKAN_STAGING_RING_SIZE
+#define IMPLATFORM_VULKAN_STAGING_RING_SIZE (64u * 1024u * 1024u)
+#endif
+#define IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT 16
+
+// Texture tracking (ImTextureID is the VkDescriptorSet returned by ImGui_ImplVulkan_AddTexture)
+struct ImPlatform_TexTracking_Vulkan {
+    VkDescriptorSet     descriptorSet;
+    VkImage             image;
+    VkDeviceMemory      imageMemory;
+    VkImageView         imageView;
+    VkSampler           sampler;
+    VkFormat            format;
+    int                 bytesPerPixel;      // Bytes per texel on the GPU
+    int                 srcBytesPerPixel;   // Bytes per pixel supplied by the caller (3 for RGB8 stored as RGBA8)
+    unsigned int        width, height;
+    uint32_t            mipLevels;          // Levels 1..N are regenerated from level 0 after each upload
+    ImPlatform_PixelFormat pixelFormat;
+    unsigned int        blockBytes;         // Block-compressed: bytes per 4x4 block (bytesPerPixel is 0), 0 otherwise
+    ImU64               version;            // ImImageBuffer::version last uploaded
+    bool                hasVersion;
+    uint64_t            retireSerial;       // Only used once queued for deferred destruction
+    ImPlatform_TexTracking_Vulkan* next;
+};
+static ImPlatform_TexTracking_Vulkan* g_TexTrackingHead = NULL;
+static ImPlatform_TexTracking_Vulkan* g_TexGarbageHead  = NULL;
+
+// Per swapchain frame submission tracking. Frames are indexed like
+// g_MainWindowData.Frames and fenced by their Fence. Every submitted frame
+// gets a monotonically increasing serial so resources can be recycled once
+// the GPU is known to be done with them.
+struct ImPlatform_FrameTracking_Vulkan {
+    bool        inFlight;
+    uint64_t    serial;
+    uint64_t    ringEnd;    // Staging ring position consumed by this frame
+};
+static ImPlatform_FrameTracking_Vulkan g_FrameTracking[IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT] = {};
+static uint64_t g_SubmitSerial      = 0;
+static uint64_t g_CompletedSerial   = 0;
+static int      g_RecordingFrame    = -1;
+static uint64_t g_RecordingRingEnd  = 0;
+
+// Offscreen passes are recorded into a shared command buffer that is submitted
+// ahead of the frame command buffer, in the same batch. Slots are recycled once
+// the serial of the frame they were submitted with has completed.
+struct ImPlatform_RTCommands_Vulkan {
+    VkCommandBuffer commandBuffer;
+    uint64_t        retireSerial;
+};
+static VkCommandPool g_RTCommandPool = VK_NULL_HANDLE;
+static ImPlatform_RTCommands_Vulkan g_RTCommands[IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT] = {};
+static int g_RTRecordingSlot = -1;  // Slot recording the passes of the next submit, -1 if none
+static int g_RTNextSlot      = 0;
+
+// Upload queued in the staging ring, recorded at the start of the next frame.
+// Buffer copies leave `image` null and target dstBuffer/dstOffset instead.
+struct ImPlatform_PendingUpload_Vulkan {
+    VkImage         image;
+    VkBuffer        dstBuffer;
+    VkDeviceSize    dstOffset;
+    VkDeviceSize    bufferOffset;
+    VkDeviceSize    size;
+    VkDeviceSize    alignment;
+    uint32_t        rowLength;      // Source row pitch in texels, 0 when tightly packed
+    unsigned int    x, y, width, height;
+    uint32_t        mipLevels;      // Mip chain of the destination image
+    unsigned int    imageWidth, imageHeight;
+};
+
+// Persistently mapped staging ring. head/tail are monotonic byte positions,
+// the buffer offset is position % capacity.
+struct ImPlatform_StagingRing_Vulkan {
+    VkBuffer        buffer;
+    VkDeviceMemory  memory;
+    unsigned char*  mapped;
+    VkDeviceSize    capacity;
+    uint64_t        head;
+    uint64_t        tail;
+    ImPlatform_PendingUpload_Vulkan* pending;
+    int             pendingCount;
+    int             pendingCapacity;
+};
+static ImPlatform_StagingRing_Vulkan g_StagingRing = {};
+
+// Vertex/index buffers are sub-allocated from large blocks, see ImPlatform_BufferHeap_Alloc
+#ifndef IMPLATFORM_VULKAN_BUFFER_BLOCK_SIZE
+#define IMPLATFORM_VULKAN_BUFFER_BLOCK_SIZE (16u * 1024u * 1024u)
+#endif
+// Sub-allocation granularity, covers the 4 byte offset alignment of
+// vkCmdCopyBuffer and of 32-bit index buffers
+#define IMPLATFORM_VULKAN_BUFFER_ALIGNMENT 16
+
+struct ImPlatform_BufferRange_Vulkan {
+    VkDeviceSize    offset;
+    VkDeviceSize    size;
+};
+
+struct ImPlatform_BufferBlock_Vulkan {
+    VkBuffer        buffer;         // Spans the whole block
+    VkDeviceMemory  memory;
+    VkDeviceSize    size;
+    bool            hostVisible;
+    unsigned char*  mapped;         // Persistently mapped, host visible blocks only
+    ImPlatform_BufferRange_Vulkan* free;    // Sorted by offset, never adjacent
+    int             freeCount;
+    int             freeCapacity;
+    ImPlatform_BufferBlock_Vulkan* next;
+};
+static ImPlatform_BufferBlock_Vulkan* g_BufferBlockHead = NULL;
+
+// Range released while a frame in flight may still read it
+struct ImPlatform_BufferGarbage_Vulkan {
+    ImPlatform_BufferBlock_Vulkan* block;
+    VkDeviceSize    offset;
+    VkDeviceSize    size;
+    uint64_t        retireSerial;
+    ImPlatform_BufferGarbage_Vulkan* next;
+};
+static ImPlatform_BufferGarbage_Vulkan* g_BufferGarbageHead = NULL;
+
+static void ImPlatform_Vulkan_BeginFrameUploads(VkCommandBuffer command_buffer, uint32_t frame_index);
+static void ImPlatform_Vulkan_RecordMipChain(VkCommandBuffer command_buffer, VkImage image, unsigned int width, unsigned int height,
+                                             uint32_t mip_levels, VkImageLayout lower_layout);
+static void ImPlatform_Vulkan_EndFrameUploads(uint32_t frame_index);
+static void ImPlatform_Vulkan_RetireAllFrames(void);
+static void ImPlatform_Vulkan_DestroyUploadResources(void);
+static void ImPlatform_Vulkan_DestroyRTCommands(void);
+static void ImPlatform_Vulkan_StopPipelineWorkers(void);
+static void ImPlatform_Vulkan_RecordFrameCopies(VkCommandBuffer command_buffer, VkImage backbuffer);
+static void ImPlatform_Vulkan_SubmitReadbacks(void);
+static void ImPlatform_Vulkan_DispatchReadbacks(void);
+static void ImPlatform_Vulkan_DestroyReadbacks(void);
+
 // Helper functions
 static void check_vk_result(VkResult err)
 {
@@ -110,13 +274,14 @@ static bool IsExtensionAvailable(const VkExtensionProperties* properties, uint32
 // The driver embeds a 32-byte header that begins with a 4-byte header length,
 // a 4-byte cache header version, a 4-byte vendor ID, a 4-byte device ID, and
 // a 16-byte pipeline cache UUID. vkCreatePipelineCache will reject the data
-// if any of those fields don't match the current device, so we don't need to
-// hash source or track driver versions ourselves.
+// if any of those fields don't match the current device; the blob is stored in
+// the shader cache pack, opened with the same identity so a GPU or driver change
+// discards the pack instead of handing stale data to the driver.
 
-static void ImPlatform_Vulkan_BuildPipelineCachePath(char* out_path, size_t out_size)
+static void ImPlatform_Vulkan_BuildPipelineCacheName(char* out_name, size_t out_size)
 {
     // cache_key="vulkan_global", entry="pipeline", ext="cache", hash=0
-    ImPlatform_ShaderCacheBuildPath(out_path, out_size,
+    ImPlatform_ShaderCacheBuildName(out_name, out_size,
                                     "vulkan_global", "pipeline", "cache", 0);
 }
 
@@ -125,11 +290,20 @@ static void ImPlatform_Vulkan_InitPipelineCache(VkDevice device)
     if (g_VulkanPipelineCache != VK_NULL_HANDLE)
         return;
 
-    char cache_path[512];
-    ImPlatform_Vulkan_BuildPipelineCachePath(cache_path, sizeof(cache_path));
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(g_GfxData.physicalDevice, &props);
+    unsigned char device_id[12 + VK_UUID_SIZE];
+    memcpy(device_id + 0, &props.vendorID, 4);
+    memcpy(device_id + 4, &props.deviceID, 4);
+    memcpy(device_id + 8, &props.driverVersion, 4);
+    memcpy(device_id + 12, props.pipelineCacheUUID, VK_UUID_SIZE);
+    ImPlatform_ShaderCacheOpen("vulkan", device_id, sizeof(device_id));
+
+    char cache_name[512];
+    ImPlatform_Vulkan_BuildPipelineCacheName(cache_name, sizeof(cache_name));
 
     size_t data_size = 0;
-    void* data = ImPlatform_ShaderCacheLoad(cache_path, &data_size);
+    void* data = ImPlatform_ShaderCacheLoad(cache_name, &data_size);
 
     VkPipelineCacheCreateInfo info = {};
     info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
@@ -184,10 +358,10 @@ static void ImPlatform_Vulkan_SavePipelineCache(VkDevice device)
         return;
     }
 
-    char cache_path[512];
-    ImPlatform_Vulkan_BuildPipelineCachePath(cache_path, sizeof(cache_path));
+    char cache_name[512];
+    ImPlatform_Vulkan_BuildPipelineCacheName(cache_name, sizeof(cache_name));
 
-    if (ImPlatform_ShaderCacheSave(cache_path, data, data_size))
+    if (ImPlatform_ShaderCacheSave(cache_name, data, data_size))
     {
         fprintf(stderr, "[ImPlatform shader cache] VK pipeline cache: saved %zu bytes to disk\n", data_size);
     }
@@ -315,12 +489,24 @@ static bool SetupVulkan(const char** instance_extensions, uint32_t instance_exte
         queue_info.queueCount = 1;
         queue_info.pQueuePriorities = queue_priority;
 
+        // Block-compressed texture families are opt-in device features
+        VkPhysicalDeviceFeatures supported_features = {};
+        vkGetPhysicalDeviceFeatures(g_GfxData.physicalDevice, &supported_features);
+        g_EnabledFeatures = VkPhysicalDeviceFeatures();
+        g_EnabledFeatures.textureCompressionBC       = supported_features.textureCompressionBC;
+        g_EnabledFeatures.textureCompressionETC2     = supported_features.textureCompressionETC2;
+        g_EnabledFeatures.textureCompressionASTC_LDR = supported_features.textureCompressionASTC_LDR;
+        // Batched indirect draws (see ImPlatform_MultiDrawIndexedIndirect)
+        g_EnabledFeatures.multiDrawIndirect          = supported_features.multiDrawIndirect;
+        g_EnabledFeatures.drawIndirectFirstInstance  = supported_features.drawIndirectFirstInstance;
+
         VkDeviceCreateInfo create_info = {};
         create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         create_info.queueCreateInfoCount = 1;
         create_info.pQueueCreateInfos = &queue_info;
         create_info.enabledExtensionCount = device_extensions_count;
         create_info.ppEnabledExtensionNames = device_extensions;
+        create_info.pEnabledFeatures = &g_EnabledFeatures;
         err = vkCreateDevice(g_GfxData.physicalDevice, &create_info, g_Allocator, &g_GfxData.device);
         check_vk_result(err);
         vkGetDeviceQueue(g_GfxData.device, g_QueueFamily, 0, &g_GfxData.queue);
@@ -402,7 +588,7 @@ bool ImPlatform_Gfx_CreateDevice_Vulkan(void* hWnd, ImPlatform_GfxData_Vulkan* p
 
     // Create SwapChain, RenderPass, Framebuffer, etc.
     ImGui_ImplVulkanH_CreateOrResizeWindow(pData->instance, pData->physicalDevice, pData->device,
-        &g_MainWindowData, g_QueueFamily, g_Allocator, 1280, 720, pData->minImageCount, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        &g_MainWindowData, g_QueueFamily, g_Allocator, 1280, 720, pData->minImageCount, IMPLATFORM_VULKAN_SWAPCHAIN_USAGE);
 
     return true;
 }
@@ -458,7 +644,7 @@ bool ImPlatform_Gfx_CreateDevice_Vulkan(void* pWindow, ImPlatform_GfxData_Vulkan
 
     // Create SwapChain, RenderPass, Framebuffer, etc.
     ImGui_ImplVulkanH_CreateOrResizeWindow(pData->instance, pData->physicalDevice, pData->device,
-        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, IMPLATFORM_VULKAN_SWAPCHAIN_USAGE);
 
     return true;
 }
@@ -520,7 +706,7 @@ bool ImPlatform_Gfx_CreateDevice_Vulkan(void* pWindow, ImPlatform_GfxData_Vulkan
 
     // Create SwapChain, RenderPass, Framebuffer, etc.
     ImGui_ImplVulkanH_CreateOrResizeWindow(pData->instance, pData->physicalDevice, pData->device,
-        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, IMPLATFORM_VULKAN_SWAPCHAIN_USAGE);
 
     return true;
 }
@@ -583,7 +769,7 @@ bool ImPlatform_Gfx_CreateDevice_Vulkan(void* pWindow, ImPlatform_GfxData_Vulkan
 
     // Create SwapChain, RenderPass, Framebuffer, etc.
     ImGui_ImplVulkanH_CreateOrResizeWindow(pData->instance, pData->physicalDevice, pData->device,
-        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+        &g_MainWindowData, g_QueueFamily, g_Allocator, w, h, pData->minImageCount, IMPLATFORM_VULKAN_SWAPCHAIN_USAGE);
 
     return true;
 }
@@ -595,6 +781,7 @@ void ImPlatform_Gfx_CleanupDevice_Vulkan(ImPlatform_GfxData_Vulkan* pData)
     // Serialize and tear down the pipeline cache before the device goes away.
     ImPlatform_Vulkan_SavePipelineCache(pData->device);
     ImPlatform_Vulkan_DestroyPipelineCache(pData->device);
+    ImPlatform_ShaderCacheClose();
 
     vkDestroyDescriptorPool(pData->device, pData->descriptorPool, g_Allocator);
 
@@ -631,6 +818,47 @@ IMPLATFORM_API bool ImPlatform_InitGfxAPI(void)
 #endif
 }
 
+// Mirrors the pass ImGui_ImplVulkanH_CreateOrResizeWindow builds for the main window. The surface
+// format is picked once at window creation and swapchain rebuilds keep it, so the pass is created
+// once for the lifetime of the window.
+static bool ImPlatform_Vulkan_CreatePipelineRenderPass(VkFormat format)
+{
+    VkAttachmentDescription attachment = {};
+    attachment.format         = format;
+    attachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp         = g_MainWindowData.ClearEnable ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkAttachmentReference color_ref = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments    = &color_ref;
+
+    VkSubpassDependency dep = {};
+    dep.srcSubpass    = VK_SUBPASS_EXTERNAL;
+    dep.dstSubpass    = 0;
+    dep.srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dep.dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dep.srcAccessMask = 0;
+    dep.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo rp_info = {};
+    rp_info.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    rp_info.attachmentCount = 1;
+    rp_info.pAttachments    = &attachment;
+    rp_info.subpassCount    = 1;
+    rp_info.pSubpasses      = &subpass;
+    rp_info.dependencyCount = 1;
+    rp_info.pDependencies   = &dep;
+    return vkCreateRenderPass(g_GfxData.device, &rp_info, g_Allocator, &g_PipelineRenderPass) == VK_SUCCESS;
+}
+
 // ImPlatform API - InitGfx
 IMPLATFORM_API bool ImPlatform_InitGfx(void)
 {
@@ -660,6 +888,8 @@ IMPLATFORM_API bool ImPlatform_InitGfx(void)
 
     if (!ImGui_ImplVulkan_Init(&init_info))
         return false;
+    if (!ImPlatform_Vulkan_CreatePipelineRenderPass(g_MainWindowData.SurfaceFormat.format))
+        return false;
 
     // Create a default white 1x1 texture for custom shaders
     // This will be used as the default texture (binding 0) in custom shader descriptor sets
@@ -794,9 +1024,12 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 
         if (width > 0 && height > 0)
         {
+            // Frame fences are recreated with the swapchain, retire what they guarded first
+            ImPlatform_Vulkan_RetireAllFrames();
+
             ImGui_ImplVulkan_SetMinImageCount(g_GfxData.minImageCount);
             ImGui_ImplVulkanH_CreateOrResizeWindow(g_GfxData.instance, g_GfxData.physicalDevice, g_GfxData.device,
-                &g_MainWindowData, g_QueueFamily, g_Allocator, width, height, g_GfxData.minImageCount, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+                &g_MainWindowData, g_QueueFamily, g_Allocator, width, height, g_GfxData.minImageCount, IMPLATFORM_VULKAN_SWAPCHAIN_USAGE);
             g_MainWindowData.FrameIndex = 0;
             g_SwapChainRebuild = false;
         }
@@ -809,6 +1042,10 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplVulkan_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
+    ImPlatform_Vulkan_DispatchReadbacks();
+
+    ImPlatform_FrameArena_Reset(&g_ShaderConstantsArena);
 }
 
 // ImPlatform API - GfxAPIClear
@@ -828,6 +1065,9 @@ IMPLATFORM_API bool ImPlatform_GfxAPIClear(ImVec4 const vClearColor)
         return false;
     check_vk_result(err);
 
+    g_ImPlatform_BackbufferW = (unsigned int)g_MainWindowData.Width;
+    g_ImPlatform_BackbufferH = (unsigned int)g_MainWindowData.Height;
+
     // Wait for fence from previous frame
     ImGui_ImplVulkanH_Frame* fd = &g_MainWindowData.Frames[g_MainWindowData.FrameIndex];
     err = vkWaitForFences(g_GfxData.device, 1, &fd->Fence, VK_TRUE, UINT64_MAX);
@@ -845,6 +1085,9 @@ IMPLATFORM_API bool ImPlatform_GfxAPIClear(ImVec4 const vClearColor)
     err = vkBeginCommandBuffer(fd->CommandBuffer, &info);
     check_vk_result(err);
 
+    // Record queued texture uploads (must happen outside the render pass)
+    ImPlatform_Vulkan_BeginFrameUploads(fd->CommandBuffer, g_MainWindowData.FrameIndex);
+
     VkRenderPassBeginInfo render_info = {};
     render_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
     render_info.renderPass = g_MainWindowData.RenderPass;
@@ -877,9 +1120,17 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
 
     // Clear command buffer reference
     g_CurrentCommandBuffer = VK_NULL_HANDLE;
+    g_CurrentProgram = NULL;
+    g_CurrentPipeline = VK_NULL_HANDLE;
+
+    // Video capture: queues its backbuffer copy and readback, recorded just below
+    ImPlatform_Capture_EndFrame();
 
     vkCmdEndRenderPass(fd->CommandBuffer);
 
+    // Backbuffer copies and readbacks requested during the frame
+    ImPlatform_Vulkan_RecordFrameCopies(fd->CommandBuffer, fd->Backbuffer);
+
     VkResult err = vkEndCommandBuffer(fd->CommandBuffer);
     check_vk_result(err);
 
@@ -916,8 +1167,25 @@ IMPLATFORM_API bool ImPlatform_GfxAPISwapBuffer(void)
     VkSemaphore image_acquired_semaphore = g_MainWindowData.FrameSemaphores[g_MainWindowData.SemaphoreIndex].ImageAcquiredSemaphore;
     VkSemaphore render_complete_semaphore = g_MainWindowData.FrameSemaphores[g_MainWindowData.SemaphoreIndex].RenderCompleteSemaphore;
 
+    // Offscreen passes recorded since the last submit go first, in their own batch so
+    // they do not wait for the swapchain image. Their render passes end with a
+    // barrier to shader-read, which orders them before the frame sampling them.
+    VkSubmitInfo infos[2] = {};
+    uint32_t info_count = 0;
+    VkResult err;
+    if (g_RTRecordingSlot >= 0)
+    {
+        IM_ASSERT(g_ActiveRTEntry == NULL && "ImPlatform_EndRenderToTexture() was not called");
+        err = vkEndCommandBuffer(g_RTCommands[g_RTRecordingSlot].commandBuffer);
+        check_vk_result(err);
+        VkSubmitInfo* rt_info = &infos[info_count++];
+        rt_info->sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        rt_info->commandBufferCount = 1;
+        rt_info->pCommandBuffers = &g_RTCommands[g_RTRecordingSlot].commandBuffer;
+    }
+
     VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    VkSubmitInfo info = {};
+    VkSubmitInfo& info = infos[info_count++];
     info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     info.waitSemaphoreCount = 1;
     info.pWaitSemaphores = &image_acquired_semaphore;
@@ -927,9 +1195,18 @@ IMPLATFORM_API bool ImPlatform_GfxAPISwapBuffer(void)
     info.signalSemaphoreCount = 1;
     info.pSignalSemaphores = &render_complete_semaphore;
 
-    VkResult err = vkQueueSubmit(g_GfxData.queue, 1, &info, fd->Fence);
+    // The fence signals once every batch of the call has completed
+    err = vkQueueSubmit(g_GfxData.queue, info_count, infos, fd->Fence);
     check_vk_result(err);
 
+    ImPlatform_Vulkan_EndFrameUploads(g_MainWindowData.FrameIndex);
+    if (g_RTRecordingSlot >= 0)
+    {
+        g_RTCommands[g_RTRecordingSlot].retireSerial = g_SubmitSerial;
+        g_RTRecordingSlot = -1;
+    }
+    ImPlatform_Vulkan_SubmitReadbacks();
+
     VkPresentInfoKHR present_info = {};
     present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     present_info.waitSemaphoreCount = 1;
@@ -963,6 +1240,17 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
+
+    // Pipeline workers use the device
+    ImPlatform_Vulkan_StopPipelineWorkers();
+    if (g_PipelineRenderPass != VK_NULL_HANDLE)
+    {
+        vkDestroyRenderPass(g_GfxData.device, g_PipelineRenderPass, g_Allocator);
+        g_PipelineRenderPass = VK_NULL_HANDLE;
+    }
+
     // Clean up default texture resources
     if (g_GfxData.defaultSampler != VK_NULL_HANDLE)
     {
@@ -985,6 +1273,13 @@ IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
         g_GfxData.defaultImageMemory = VK_NULL_HANDLE;
     }
 
+    // Staging ring and tracked textures (the device is idle at this point)
+    ImPlatform_Vulkan_DestroyUploadResources();
+    ImPlatform_Vulkan_DestroyRTCommands();
+    ImPlatform_Vulkan_DestroyReadbacks();
+    ImPlatform_FrameArena_Free(&g_ShaderConstantsArena);
+    g_CustomShaderDrawList = nullptr;
+
     ImGui_ImplVulkan_Shutdown();
     ImGui_ImplVulkanH_DestroyWindow(g_GfxData.instance, g_GfxData.device, &g_MainWindowData, g_Allocator);
     ImPlatform_Gfx_CleanupDevice_Vulkan(&g_GfxData);
@@ -1104,6 +1399,39 @@ static VkFormat ImPlatform_GetVulkanFormat(ImPlatform_PixelFormat format, int* o
     case ImPlatform_PixelFormat_R32I:
         *out_bytes_per_pixel = 4;
         return VK_FORMAT_R32_SINT;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: no per-texel size, see ImPlatform_CompressedBlockBytes
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC2_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC3_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_BC4:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC4_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_BC5:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC5_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+    case ImPlatform_PixelFormat_BC7:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_BC7_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_ETC2_RGB8:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_ETC2_RGBA8:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+    case ImPlatform_PixelFormat_ASTC_4x4:
+        *out_bytes_per_pixel = 0;
+        return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
 #endif
     default:
         *out_bytes_per_pixel = 4;
@@ -1124,613 +1452,2486 @@ static uint32_t ImPlatform_FindMemoryType(VkMemoryPropertyFlags properties, uint
     return 0xFFFFFFFF; // Unable to find memoryType
 }
 
-IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned int width, unsigned int height)
-{
-    ImPlatform_TextureDesc desc;
-    desc.width = width;
-    desc.height = height;
-    desc.format = ImPlatform_PixelFormat_RGBA8;
-    desc.min_filter = ImPlatform_TextureFilter_Linear;
-    desc.mag_filter = ImPlatform_TextureFilter_Linear;
-    desc.wrap_u = ImPlatform_TextureWrap_Clamp;
-    desc.wrap_v = ImPlatform_TextureWrap_Clamp;
-    return desc;
-}
-
-// Texture3D stub for Vulkan.
-IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigned int w, unsigned int h, unsigned int d)
+// ----------------------------------------------------------------------------
+// Vertex/index buffer heap
+// ----------------------------------------------------------------------------
+// Drivers cap the number of live VkDeviceMemory allocations, so buffers are
+// carved out of large blocks instead. Each block is covered by one VkBuffer and
+// an ImPlatform buffer is only a (block, offset) pair, which is all
+// vkCmdBindVertexBuffers / vkCmdBindIndexBuffer need. Static buffers live in
+// DEVICE_LOCAL blocks filled through the staging ring; Dynamic and Stream
+// buffers live in persistently mapped HOST_VISIBLE | HOST_COHERENT blocks.
+
+static void ImPlatform_BufferHeap_DestroyBlock(ImPlatform_BufferBlock_Vulkan* block)
 {
-    ImPlatform_TextureDesc3D x; x.width = w; x.height = h; x.depth = d;
-    x.format = ImPlatform_PixelFormat_RGBA8;
-    x.min_filter = ImPlatform_TextureFilter_Linear; x.mag_filter = ImPlatform_TextureFilter_Linear;
-    x.wrap_u = x.wrap_v = x.wrap_w = ImPlatform_TextureWrap_Clamp;
-    return x;
+    if (block->mapped)                  vkUnmapMemory(g_GfxData.device, block->memory);
+    if (block->buffer != VK_NULL_HANDLE) vkDestroyBuffer(g_GfxData.device, block->buffer, g_Allocator);
+    if (block->memory != VK_NULL_HANDLE) vkFreeMemory(g_GfxData.device, block->memory, g_Allocator);
+    free(block->free);
+    delete block;
 }
-IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
-IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return NULL; }
 
-IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
+static ImPlatform_BufferBlock_Vulkan* ImPlatform_BufferHeap_CreateBlock(VkDeviceSize size, bool host_visible)
 {
-    if (!desc || !pixel_data || !g_GfxData.device)
+    ImPlatform_BufferBlock_Vulkan* block = new ImPlatform_BufferBlock_Vulkan();
+    memset(block, 0, sizeof(*block));
+    block->size = size;
+    block->hostVisible = host_visible;
+
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(g_GfxData.device, &buffer_info, g_Allocator, &block->buffer) != VK_SUCCESS)
+    {
+        ImPlatform_BufferHeap_DestroyBlock(block);
         return NULL;
+    }
 
-    int bytes_per_pixel;
-    VkFormat format = ImPlatform_GetVulkanFormat(desc->format, &bytes_per_pixel);
-    VkDeviceSize upload_size = desc->width * desc->height * bytes_per_pixel;
-
-    VkResult err;
+    VkMemoryRequirements mem_req;
+    vkGetBufferMemoryRequirements(g_GfxData.device, block->buffer, &mem_req);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_req.size;
+    alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(host_visible ? (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+                                                                        : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_req.memoryTypeBits);
+    void* map = NULL;
+    if (alloc_info.memoryTypeIndex == 0xFFFFFFFF ||
+        vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &block->memory) != VK_SUCCESS ||
+        vkBindBufferMemory(g_GfxData.device, block->buffer, block->memory, 0) != VK_SUCCESS ||
+        (host_visible && vkMapMemory(g_GfxData.device, block->memory, 0, VK_WHOLE_SIZE, 0, &map) != VK_SUCCESS))
+    {
+        ImPlatform_BufferHeap_DestroyBlock(block);
+        return NULL;
+    }
+    block->mapped = (unsigned char*)map;
 
-    // Create staging buffer
-    VkBuffer staging_buffer;
-    VkDeviceMemory staging_memory;
+    block->free = (ImPlatform_BufferRange_Vulkan*)malloc(sizeof(ImPlatform_BufferRange_Vulkan) * 4);
+    if (!block->free)
     {
-        VkBufferCreateInfo buffer_info = {};
-        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        buffer_info.size = upload_size;
-        buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        err = vkCreateBuffer(g_GfxData.device, &buffer_info, g_Allocator, &staging_buffer);
-        if (err != VK_SUCCESS)
-            return NULL;
+        ImPlatform_BufferHeap_DestroyBlock(block);
+        return NULL;
+    }
+    block->freeCapacity = 4;
+    block->freeCount = 1;
+    block->free[0].offset = 0;
+    block->free[0].size = size;
+    return block;
+}
 
-        VkMemoryRequirements mem_req;
-        vkGetBufferMemoryRequirements(g_GfxData.device, staging_buffer, &mem_req);
+static VkDeviceSize ImPlatform_BufferHeap_AlignSize(VkDeviceSize size)
+{
+    return (size + IMPLATFORM_VULKAN_BUFFER_ALIGNMENT - 1) & ~(VkDeviceSize)(IMPLATFORM_VULKAN_BUFFER_ALIGNMENT - 1);
+}
 
-        VkMemoryAllocateInfo alloc_info = {};
-        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        alloc_info.allocationSize = mem_req.size;
-        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, mem_req.memoryTypeBits);
-        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &staging_memory);
-        if (err != VK_SUCCESS)
+// First fit over the blocks of the requested kind. A new block is added when
+// none has room; requests larger than a block get a block of their own.
+static ImPlatform_BufferBlock_Vulkan* ImPlatform_BufferHeap_Alloc(VkDeviceSize size, bool host_visible, VkDeviceSize* out_offset)
+{
+    size = ImPlatform_BufferHeap_AlignSize(size ? size : 1);
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        for (ImPlatform_BufferBlock_Vulkan* block = g_BufferBlockHead; block; block = block->next)
         {
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            return NULL;
+            if (block->hostVisible != host_visible)
+                continue;
+            for (int i = 0; i < block->freeCount; i++)
+            {
+                ImPlatform_BufferRange_Vulkan* range = &block->free[i];
+                if (range->size < size)
+                    continue;
+                *out_offset = range->offset;
+                range->offset += size;
+                range->size -= size;
+                if (range->size == 0)
+                {
+                    memmove(range, range + 1, sizeof(*range) * (block->freeCount - i - 1));
+                    block->freeCount--;
+                }
+                return block;
+            }
         }
-
-        err = vkBindBufferMemory(g_GfxData.device, staging_buffer, staging_memory, 0);
-        if (err != VK_SUCCESS)
+        if (attempt > 0)
+            break;
+
+        VkDeviceSize block_size = IMPLATFORM_VULKAN_BUFFER_BLOCK_SIZE;
+        if (block_size < size)
+            block_size = size;
+        ImPlatform_BufferBlock_Vulkan* block = ImPlatform_BufferHeap_CreateBlock(block_size, host_visible);
+        if (!block)
         {
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            fprintf(stderr, "[ImPlatform] Vulkan: Failed to allocate %llu byte %s buffer block\n",
+                    (unsigned long long)block_size, host_visible ? "host visible" : "device local");
             return NULL;
         }
+        block->next = g_BufferBlockHead;
+        g_BufferBlockHead = block;
     }
+    return NULL;
+}
 
-    // Upload to staging buffer
+// Returns a range to its block immediately, the GPU must be done with it
+static void ImPlatform_BufferHeap_Free(ImPlatform_BufferBlock_Vulkan* block, VkDeviceSize offset, VkDeviceSize size)
+{
+    size = ImPlatform_BufferHeap_AlignSize(size ? size : 1);
+
+    int i = 0;
+    while (i < block->freeCount && block->free[i].offset < offset)
+        i++;
+    bool merge_prev = i > 0 && block->free[i - 1].offset + block->free[i - 1].size == offset;
+    bool merge_next = i < block->freeCount && offset + size == block->free[i].offset;
+    if (merge_prev && merge_next)
     {
-        void* map = NULL;
-        err = vkMapMemory(g_GfxData.device, staging_memory, 0, upload_size, 0, &map);
-        if (err != VK_SUCCESS)
-        {
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
-        }
-        memcpy(map, pixel_data, upload_size);
-        VkMappedMemoryRange range[1] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = staging_memory;
-        range[0].size = upload_size;
-        err = vkFlushMappedMemoryRanges(g_GfxData.device, 1, range);
-        vkUnmapMemory(g_GfxData.device, staging_memory);
-        if (err != VK_SUCCESS)
+        block->free[i - 1].size += size + block->free[i].size;
+        memmove(&block->free[i], &block->free[i + 1], sizeof(ImPlatform_BufferRange_Vulkan) * (block->freeCount - i - 1));
+        block->freeCount--;
+    }
+    else if (merge_prev)
+    {
+        block->free[i - 1].size += size;
+    }
+    else if (merge_next)
+    {
+        block->free[i].offset = offset;
+        block->free[i].size += size;
+    }
+    else
+    {
+        if (block->freeCount == block->freeCapacity)
         {
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
+            int new_capacity = block->freeCapacity * 2;
+            void* new_free = realloc(block->free, sizeof(ImPlatform_BufferRange_Vulkan) * new_capacity);
+            if (!new_free)
+                return; // The range is lost until the block goes away
+            block->free = (ImPlatform_BufferRange_Vulkan*)new_free;
+            block->freeCapacity = new_capacity;
         }
+        memmove(&block->free[i + 1], &block->free[i], sizeof(ImPlatform_BufferRange_Vulkan) * (block->freeCount - i));
+        block->free[i].offset = offset;
+        block->free[i].size = size;
+        block->freeCount++;
     }
 
-    // Create the Image
-    VkImage image;
-    VkDeviceMemory image_memory;
+    // Release blocks that became empty, keeping one of each kind around
+    if (block->freeCount != 1 || block->free[0].size != block->size)
+        return;
+    ImPlatform_BufferBlock_Vulkan** link = &g_BufferBlockHead;
+    ImPlatform_BufferBlock_Vulkan** block_link = NULL;
+    bool has_sibling = false;
+    for (; *link; link = &(*link)->next)
     {
-        VkImageCreateInfo image_info = {};
-        image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        image_info.imageType = VK_IMAGE_TYPE_2D;
-        image_info.format = format;
-        image_info.extent.width = desc->width;
-        image_info.extent.height = desc->height;
-        image_info.extent.depth = 1;
-        image_info.mipLevels = 1;
-        image_info.arrayLayers = 1;
-        image_info.samples = VK_SAMPLE_COUNT_1_BIT;
-        image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
-        image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-        image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        err = vkCreateImage(g_GfxData.device, &image_info, g_Allocator, &image);
-        if (err != VK_SUCCESS)
-        {
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
-        }
+        if (*link == block)
+            block_link = link;
+        else if ((*link)->hostVisible == block->hostVisible)
+            has_sibling = true;
+    }
+    if (has_sibling && block_link)
+    {
+        *block_link = block->next;
+        ImPlatform_BufferHeap_DestroyBlock(block);
+    }
+}
 
-        VkMemoryRequirements mem_req;
-        vkGetImageMemoryRequirements(g_GfxData.device, image, &mem_req);
+// Frees a range once the frame with `retire_serial` has completed on the GPU
+static void ImPlatform_BufferHeap_Retire(ImPlatform_BufferBlock_Vulkan* block, VkDeviceSize offset, VkDeviceSize size, uint64_t retire_serial)
+{
+    if (retire_serial <= g_CompletedSerial)
+    {
+        ImPlatform_BufferHeap_Free(block, offset, size);
+        return;
+    }
+    ImPlatform_BufferGarbage_Vulkan* g = new ImPlatform_BufferGarbage_Vulkan();
+    g->block = block;
+    g->offset = offset;
+    g->size = size;
+    g->retireSerial = retire_serial;
+    g->next = g_BufferGarbageHead;
+    g_BufferGarbageHead = g;
+}
 
-        VkMemoryAllocateInfo alloc_info = {};
-        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        alloc_info.allocationSize = mem_req.size;
-        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_req.memoryTypeBits);
-        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &image_memory);
-        if (err != VK_SUCCESS)
+static void ImPlatform_BufferHeap_CollectGarbage(void)
+{
+    ImPlatform_BufferGarbage_Vulkan** link = &g_BufferGarbageHead;
+    while (*link)
+    {
+        ImPlatform_BufferGarbage_Vulkan* g = *link;
+        if (g->retireSerial <= g_CompletedSerial)
         {
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
+            *link = g->next;
+            ImPlatform_BufferHeap_Free(g->block, g->offset, g->size);
+            delete g;
         }
-
-        err = vkBindImageMemory(g_GfxData.device, image, image_memory, 0);
-        if (err != VK_SUCCESS)
+        else
         {
-            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
+            link = &g->next;
         }
     }
+}
 
-    // Create the Image View
-    VkImageView image_view;
+static void ImPlatform_BufferHeap_Destroy(void)
+{
+    while (g_BufferGarbageHead)
     {
-        VkImageViewCreateInfo view_info = {};
-        view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-        view_info.image = image;
-        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        view_info.format = format;
-        view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        view_info.subresourceRange.levelCount = 1;
-        view_info.subresourceRange.layerCount = 1;
-        err = vkCreateImageView(g_GfxData.device, &view_info, g_Allocator, &image_view);
-        if (err != VK_SUCCESS)
-        {
-            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
-        }
+        ImPlatform_BufferGarbage_Vulkan* g = g_BufferGarbageHead;
+        g_BufferGarbageHead = g->next;
+        delete g;
     }
-
-    // Create sampler
-    VkSampler sampler;
+    while (g_BufferBlockHead)
     {
-        VkSamplerCreateInfo sampler_info = {};
-        sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        sampler_info.magFilter = (desc->mag_filter == ImPlatform_TextureFilter_Nearest) ? VK_FILTER_NEAREST : VK_FILTER_LINEAR;
-        sampler_info.minFilter = (desc->min_filter == ImPlatform_TextureFilter_Nearest) ? VK_FILTER_NEAREST : VK_FILTER_LINEAR;
-        sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        ImPlatform_BufferBlock_Vulkan* block = g_BufferBlockHead;
+        g_BufferBlockHead = block->next;
+        ImPlatform_BufferHeap_DestroyBlock(block);
+    }
+}
 
-        VkSamplerAddressMode wrap_u = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        VkSamplerAddressMode wrap_v = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        if (desc->wrap_u == ImPlatform_TextureWrap_Repeat)
-            wrap_u = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        else if (desc->wrap_u == ImPlatform_TextureWrap_Mirror)
-            wrap_u = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
-        if (desc->wrap_v == ImPlatform_TextureWrap_Repeat)
-            wrap_v = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        else if (desc->wrap_v == ImPlatform_TextureWrap_Mirror)
-            wrap_v = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+// ----------------------------------------------------------------------------
+// Texture registry, frame retirement and staging ring
+// ----------------------------------------------------------------------------
+// ImPlatform_UpdateTexture only memcpy's into a persistently mapped ring and
+// queues the copy. Queued copies are recorded at the top of the next frame's
+// command buffer (before the main render pass, see ImPlatform_GfxAPIClear) and
+// the ring space is recycled once that frame's fence has been waited on. The
+// queue is never drained for an update.
 
-        sampler_info.addressModeU = wrap_u;
-        sampler_info.addressModeV = wrap_v;
-        sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        sampler_info.minLod = -1000;
-        sampler_info.maxLod = 1000;
-        sampler_info.maxAnisotropy = 1.0f;
+static ImPlatform_TexTracking_Vulkan* ImPlatform_Vulkan_FindTexture(VkDescriptorSet descriptor_set)
+{
+    for (ImPlatform_TexTracking_Vulkan* e = g_TexTrackingHead; e; e = e->next)
+        if (e->descriptorSet == descriptor_set)
+            return e;
+    return NULL;
+}
+
+static void ImPlatform_Vulkan_DestroyTrackedTexture(ImPlatform_TexTracking_Vulkan* e)
+{
+    if (e->sampler)     vkDestroySampler(g_GfxData.device, e->sampler, g_Allocator);
+    if (e->imageView)   vkDestroyImageView(g_GfxData.device, e->imageView, g_Allocator);
+    if (e->image)       vkDestroyImage(g_GfxData.device, e->image, g_Allocator);
+    if (e->imageMemory) vkFreeMemory(g_GfxData.device, e->imageMemory, g_Allocator);
+    delete e;
+}
+
+// Destroy textures and buffer ranges whose last possible use has completed on the GPU
+static void ImPlatform_Vulkan_CollectGarbage(void)
+{
+    ImPlatform_BufferHeap_CollectGarbage();
+
+    ImPlatform_TexTracking_Vulkan** link = &g_TexGarbageHead;
+    while (*link)
+    {
+        ImPlatform_TexTracking_Vulkan* e = *link;
+        if (e->retireSerial <= g_CompletedSerial)
+        {
+            *link = e->next;
+            ImPlatform_Vulkan_DestroyTrackedTexture(e);
+        }
+        else
+        {
+            link = &e->next;
+        }
+    }
+}
+
+// Called once the fence of `frame_index` is known to be signaled
+static void ImPlatform_Vulkan_RetireFrame(uint32_t frame_index)
+{
+    ImPlatform_FrameTracking_Vulkan* ft = &g_FrameTracking[frame_index];
+    if (!ft->inFlight)
+        return;
+    ft->inFlight = false;
+    if (ft->serial > g_CompletedSerial)
+        g_CompletedSerial = ft->serial;
+    if (ft->ringEnd > g_StagingRing.tail)
+        g_StagingRing.tail = ft->ringEnd;
+}
+
+// Blocks on the oldest submitted frame. Returns false if nothing is in flight.
+static bool ImPlatform_Vulkan_WaitOldestFrame(void)
+{
+    int oldest = -1;
+    for (int i = 0; i < IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT; i++)
+        if (g_FrameTracking[i].inFlight && (oldest < 0 || g_FrameTracking[i].serial < g_FrameTracking[oldest].serial))
+            oldest = i;
+    if (oldest < 0)
+        return false;
+
+    VkResult err = vkWaitForFences(g_GfxData.device, 1, &g_MainWindowData.Frames[oldest].Fence, VK_TRUE, UINT64_MAX);
+    check_vk_result(err);
+    ImPlatform_Vulkan_RetireFrame((uint32_t)oldest);
+    return true;
+}
+
+static void ImPlatform_Vulkan_RetireAllFrames(void)
+{
+    vkDeviceWaitIdle(g_GfxData.device);
+    for (uint32_t i = 0; i < IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT; i++)
+        ImPlatform_Vulkan_RetireFrame(i);
+    // A frame recorded but never submitted (swapchain lost) consumed nothing
+    g_RecordingFrame = -1;
+    g_CompletedSerial = g_SubmitSerial;
+    ImPlatform_Vulkan_CollectGarbage();
+}
+
+static bool ImPlatform_StagingRing_CreateBuffer(VkDeviceSize capacity, VkBuffer* out_buffer, VkDeviceMemory* out_memory, unsigned char** out_mapped)
+{
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = capacity;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkResult err = vkCreateBuffer(g_GfxData.device, &buffer_info, g_Allocator, out_buffer);
+    if (err != VK_SUCCESS)
+        return false;
+
+    VkMemoryRequirements mem_req;
+    vkGetBufferMemoryRequirements(g_GfxData.device, *out_buffer, &mem_req);
+
+    // HOST_COHERENT so writes never need vkFlushMappedMemoryRanges
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_req.size;
+    alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mem_req.memoryTypeBits);
+    err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, out_memory);
+    if (err != VK_SUCCESS)
+    {
+        vkDestroyBuffer(g_GfxData.device, *out_buffer, g_Allocator);
+        return false;
+    }
+
+    void* map = NULL;
+    if (vkBindBufferMemory(g_GfxData.device, *out_buffer, *out_memory, 0) != VK_SUCCESS ||
+        vkMapMemory(g_GfxData.device, *out_memory, 0, VK_WHOLE_SIZE, 0, &map) != VK_SUCCESS)
+    {
+        vkDestroyBuffer(g_GfxData.device, *out_buffer, g_Allocator);
+        vkFreeMemory(g_GfxData.device, *out_memory, g_Allocator);
+        return false;
+    }
+    *out_mapped = (unsigned char*)map;
+    return true;
+}
+
+// Reallocates the ring with room for at least `min_free` more bytes. Only
+// possible when the GPU no longer references the current buffer; uploads that
+// are queued but not yet recorded are carried over.
+static bool ImPlatform_StagingRing_Grow(VkDeviceSize min_free)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    if (g_RecordingFrame >= 0)
+    {
+        fprintf(stderr, "[ImPlatform] Vulkan: Staging ring full while a frame is being recorded, upload dropped\n");
+        return false;
+    }
+
+    VkDeviceSize used = 0;
+    for (int i = 0; i < ring->pendingCount; i++)
+        used += ring->pending[i].size + ring->pending[i].alignment;
+    VkDeviceSize new_capacity = ring->capacity ? ring->capacity : (VkDeviceSize)IMPLATFORM_VULKAN_STAGING_RING_SIZE;
+    while (new_capacity < used + min_free)
+        new_capacity *= 2;
+
+    VkBuffer new_buffer;
+    VkDeviceMemory new_memory;
+    unsigned char* new_mapped;
+    if (!ImPlatform_StagingRing_CreateBuffer(new_capacity, &new_buffer, &new_memory, &new_mapped))
+    {
+        fprintf(stderr, "[ImPlatform] Vulkan: Failed to allocate %llu byte staging ring\n", (unsigned long long)new_capacity);
+        return false;
+    }
+
+    VkDeviceSize write = 0;
+    for (int i = 0; i < ring->pendingCount; i++)
+    {
+        ImPlatform_PendingUpload_Vulkan* p = &ring->pending[i];
+        write = (write + p->alignment - 1) / p->alignment * p->alignment;
+        memcpy(new_mapped + write, ring->mapped + p->bufferOffset, (size_t)p->size);
+        p->bufferOffset = write;
+        write += p->size;
+    }
+
+    if (ring->buffer != VK_NULL_HANDLE)
+    {
+        vkUnmapMemory(g_GfxData.device, ring->memory);
+        vkDestroyBuffer(g_GfxData.device, ring->buffer, g_Allocator);
+        vkFreeMemory(g_GfxData.device, ring->memory, g_Allocator);
+    }
+
+    ring->buffer = new_buffer;
+    ring->memory = new_memory;
+    ring->mapped = new_mapped;
+    ring->capacity = new_capacity;
+    ring->head = write;
+    ring->tail = 0;
+    for (int i = 0; i < IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT; i++)
+        g_FrameTracking[i].ringEnd = 0;
+    return true;
+}
+
+// Reserves `size` bytes in the staging ring. Returns the mapped write pointer
+// and the matching buffer offset, or NULL if no room could be made.
+static unsigned char* ImPlatform_StagingRing_Alloc(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* out_offset)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    if (ring->buffer == VK_NULL_HANDLE && !ImPlatform_StagingRing_Grow(size + alignment))
+        return NULL;
+
+    for (;;)
+    {
+        VkDeviceSize offset = (VkDeviceSize)(ring->head % ring->capacity);
+        VkDeviceSize aligned = (offset + alignment - 1) / alignment * alignment;
+        uint64_t pos = ring->head + (aligned - offset);
+        if (aligned + size > ring->capacity)
+        {
+            // Skip the end of the buffer and wrap around to offset 0
+            pos = ring->head + (ring->capacity - offset);
+            aligned = 0;
+        }
+        if (pos + size - ring->tail <= ring->capacity)
+        {
+            ring->head = pos + size;
+            *out_offset = aligned;
+            return ring->mapped + aligned;
+        }
+
+        // Out of room: recycle the oldest frame still in flight, grow once none are left
+        if (!ImPlatform_Vulkan_WaitOldestFrame() && !ImPlatform_StagingRing_Grow(size + alignment))
+            return NULL;
+    }
+}
+
+// Downsamples level 0 into levels 1..mip_levels-1 with a chain of linear blits.
+// Expects level 0 in TRANSFER_DST_OPTIMAL with the transfer writes pending and the
+// other levels in `lower_layout`; leaves the whole chain in SHADER_READ_ONLY_OPTIMAL.
+static void ImPlatform_Vulkan_RecordMipChain(VkCommandBuffer command_buffer, VkImage image, unsigned int width, unsigned int height,
+                                             uint32_t mip_levels, VkImageLayout lower_layout)
+{
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+
+    int32_t src_w = (int32_t)width, src_h = (int32_t)height;
+    for (uint32_t level = 1; level < mip_levels; level++)
+    {
+        int32_t dst_w = src_w > 1 ? src_w / 2 : 1;
+        int32_t dst_h = src_h > 1 ? src_h / 2 : 1;
+
+        // Previous level: written -> blit source. This level: -> blit destination.
+        VkImageMemoryBarrier pre[2] = { barrier, barrier };
+        pre[0].subresourceRange.baseMipLevel = level - 1;
+        pre[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pre[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        pre[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        pre[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        pre[1].subresourceRange.baseMipLevel = level;
+        pre[1].oldLayout = lower_layout;
+        pre[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        pre[1].srcAccessMask = 0;
+        pre[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, NULL, 0, NULL, 2, pre);
+
+        VkImageBlit blit = {};
+        blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.srcSubresource.mipLevel = level - 1;
+        blit.srcSubresource.layerCount = 1;
+        blit.srcOffsets[1].x = src_w;
+        blit.srcOffsets[1].y = src_h;
+        blit.srcOffsets[1].z = 1;
+        blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.dstSubresource.mipLevel = level;
+        blit.dstSubresource.layerCount = 1;
+        blit.dstOffsets[1].x = dst_w;
+        blit.dstOffsets[1].y = dst_h;
+        blit.dstOffsets[1].z = 1;
+        vkCmdBlitImage(command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                       image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+        // Previous level is final
+        VkImageMemoryBarrier post = barrier;
+        post.subresourceRange.baseMipLevel = level - 1;
+        post.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        post.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        post.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        post.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, NULL, 0, NULL, 1, &post);
+
+        src_w = dst_w;
+        src_h = dst_h;
+    }
+
+    // Last level was only written
+    barrier.subresourceRange.baseMipLevel = mip_levels - 1;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+// Records the queued buffer copies. Earlier frames may still fetch from the
+// destination ranges, and copies into the same range must land in order.
+static void ImPlatform_Vulkan_RecordBufferCopies(VkCommandBuffer command_buffer)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    int batch_start = -1;
+    for (int i = 0; i < ring->pendingCount; i++)
+    {
+        const ImPlatform_PendingUpload_Vulkan* p = &ring->pending[i];
+        if (p->image != VK_NULL_HANDLE)
+            continue;
+
+        VkMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        if (batch_start < 0)
+        {
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+            batch_start = i;
+        }
+        else
+        {
+            for (int j = batch_start; j < i; j++)
+            {
+                const ImPlatform_PendingUpload_Vulkan* q = &ring->pending[j];
+                if (q->image == VK_NULL_HANDLE && q->dstBuffer == p->dstBuffer &&
+                    q->dstOffset < p->dstOffset + p->size && p->dstOffset < q->dstOffset + q->size)
+                {
+                    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                    vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+                    batch_start = i;
+                    break;
+                }
+            }
+        }
+
+        VkBufferCopy region = {};
+        region.srcOffset = p->bufferOffset;
+        region.dstOffset = p->dstOffset;
+        region.size = p->size;
+        vkCmdCopyBuffer(command_buffer, ring->buffer, p->dstBuffer, 1, &region);
+    }
+    if (batch_start < 0)
+        return;
+
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+    vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 1, &barrier, 0, NULL, 0, NULL);
+}
+
+// Records the copies queued in the staging ring. They are consumed by the next submit.
+static void ImPlatform_Vulkan_RecordPendingUploads(VkCommandBuffer command_buffer)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    ImPlatform_Vulkan_RecordBufferCopies(command_buffer);
+    for (int i = 0; i < ring->pendingCount; i++)
+    {
+        const ImPlatform_PendingUpload_Vulkan* p = &ring->pending[i];
+        if (p->image == VK_NULL_HANDLE)
+            continue; // Buffer copy, recorded above
+
+        VkImageMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = p->image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.layerCount = 1;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+
+        VkBufferImageCopy region = {};
+        region.bufferOffset = p->bufferOffset;
+        region.bufferRowLength = p->rowLength;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset.x = (int32_t)p->x;
+        region.imageOffset.y = (int32_t)p->y;
+        region.imageExtent.width = p->width;
+        region.imageExtent.height = p->height;
+        region.imageExtent.depth = 1;
+        vkCmdCopyBufferToImage(command_buffer, ring->buffer, p->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        // Rebuild the mip chain once, after the last copy into this image this frame
+        if (p->mipLevels > 1)
+        {
+            bool last = true;
+            for (int j = i + 1; j < ring->pendingCount && last; j++)
+                last = ring->pending[j].image != p->image;
+            if (last)
+            {
+                ImPlatform_Vulkan_RecordMipChain(command_buffer, p->image, p->imageWidth, p->imageHeight,
+                                                 p->mipLevels, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+                continue;
+            }
+        }
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+    }
+    ring->pendingCount = 0;
+}
+
+static void ImPlatform_Vulkan_BeginFrameUploads(VkCommandBuffer command_buffer, uint32_t frame_index)
+{
+    IM_ASSERT(frame_index < IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT);
+
+    // The caller just waited on this frame's fence
+    ImPlatform_Vulkan_RetireFrame(frame_index);
+    ImPlatform_Vulkan_CollectGarbage();
+
+    ImPlatform_Vulkan_RecordPendingUploads(command_buffer);
+
+    // Also covers uploads recorded earlier by offscreen passes of this submit
+    g_RecordingFrame = (int)frame_index;
+    g_RecordingRingEnd = g_StagingRing.head;
+}
+
+static void ImPlatform_Vulkan_EndFrameUploads(uint32_t frame_index)
+{
+    if (g_RecordingFrame != (int)frame_index)
+        return;
+
+    ImPlatform_FrameTracking_Vulkan* ft = &g_FrameTracking[frame_index];
+    ft->inFlight = true;
+    ft->serial = ++g_SubmitSerial;
+    ft->ringEnd = g_RecordingRingEnd;
+    g_RecordingFrame = -1;
+}
+
+static void ImPlatform_Vulkan_DestroyUploadResources(void)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    if (ring->buffer != VK_NULL_HANDLE)
+    {
+        vkUnmapMemory(g_GfxData.device, ring->memory);
+        vkDestroyBuffer(g_GfxData.device, ring->buffer, g_Allocator);
+        vkFreeMemory(g_GfxData.device, ring->memory, g_Allocator);
+    }
+    free(ring->pending);
+    memset(ring, 0, sizeof(*ring));
+
+    // Vertex/index buffers still alive are dangling from here on
+    ImPlatform_BufferHeap_Destroy();
+
+    while (g_TexGarbageHead)
+    {
+        ImPlatform_TexTracking_Vulkan* e = g_TexGarbageHead;
+        g_TexGarbageHead = e->next;
+        ImPlatform_Vulkan_DestroyTrackedTexture(e);
+    }
+    // Descriptor sets go away with ImGui's descriptor pool
+    while (g_TexTrackingHead)
+    {
+        ImPlatform_TexTracking_Vulkan* e = g_TexTrackingHead;
+        g_TexTrackingHead = e->next;
+        ImPlatform_Vulkan_DestroyTrackedTexture(e);
+    }
+    memset(g_FrameTracking, 0, sizeof(g_FrameTracking));
+    g_RecordingFrame = -1;
+}
+
+// Bytes per pixel of the data the caller hands in for `format`
+static int ImPlatform_Vulkan_SourceBytesPerPixel(ImPlatform_PixelFormat format, int gpu_bytes_per_pixel)
+{
+    if (format == ImPlatform_PixelFormat_RGB8)
+        return 3;
+#if IMPLATFORM_GFX_SUPPORT_SRGB_FORMATS
+    if (format == ImPlatform_PixelFormat_RGB8_SRGB)
+        return 3;
+#endif
+    return gpu_bytes_per_pixel;
+}
+
+// Expands tightly packed RGB rows into RGBA (alpha = 1) for formats Vulkan stores as RGBA
+static void ImPlatform_Vulkan_CopyPixels(unsigned char* dst, const unsigned char* src, size_t pixel_count, int src_bpp, int dst_bpp)
+{
+    if (src_bpp == dst_bpp)
+        memcpy(dst, src, pixel_count * (size_t)dst_bpp);
+    else
+        ImPlatform_Convert_RGB8ToRGBA8(dst, src, pixel_count);
+}
+
+// How an ImImageBuffer lands in staging memory: the source rows as is, consumed
+// through bufferRowLength, or repacked tight when the layout can't be expressed
+// (flips, planar) or the padding would more than double the copy (narrow ROI).
+struct ImPlatform_ImageBufferStaging_Vulkan {
+    VkDeviceSize    size;
+    uint32_t        rowLength;
+    bool            copySpan;
+};
+
+static ImPlatform_ImageBufferStaging_Vulkan ImPlatform_Vulkan_PlanImageBuffer(const ImImageBuffer* buffer, int dst_bpp)
+{
+    ImPlatform_ImageBufferStaging_Vulkan plan = {};
+    const size_t pixel_bytes = ImPlatform_ImageBufferPixelBytes(buffer);
+    const VkDeviceSize tight_size = (VkDeviceSize)buffer->width * buffer->height * dst_bpp;
+    plan.size = tight_size;
+    if (pixel_bytes != (size_t)dst_bpp || ImPlatform_ImageBufferNeedsConversion(buffer))
+        return plan;
+
+    switch (ImPlatform_ImageBufferClassify(buffer))
+    {
+    case ImPlatform_ImageBufferLayout_Tight:
+        plan.copySpan = true;
+        break;
+    case ImPlatform_ImageBufferLayout_RowPitch:
+    {
+        VkDeviceSize span = (VkDeviceSize)buffer->y_stride_bytes * (buffer->height - 1) + pixel_bytes * buffer->width;
+        if (span <= tight_size * 2)
+        {
+            plan.size = span;
+            plan.rowLength = (uint32_t)(buffer->y_stride_bytes / (ptrdiff_t)pixel_bytes);
+            plan.copySpan = true;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return plan;
+}
+
+static void ImPlatform_Vulkan_FillImageBuffer(unsigned char* dst, const ImImageBuffer* buffer, int dst_bpp, const ImPlatform_ImageBufferStaging_Vulkan* plan)
+{
+    if (plan->copySpan)
+        memcpy(dst, ImPlatform_ImageBufferPixel(buffer, 0, 0), (size_t)plan->size);
+    else
+        ImPlatform_ImageBufferCopyTight(buffer, dst, (size_t)dst_bpp);
+}
+
+IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned int width, unsigned int height)
+{
+    ImPlatform_TextureDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = ImPlatform_PixelFormat_RGBA8;
+    desc.min_filter = ImPlatform_TextureFilter_Linear;
+    desc.mag_filter = ImPlatform_TextureFilter_Linear;
+    desc.wrap_u = ImPlatform_TextureWrap_Clamp;
+    desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
+    return desc;
+}
+
+// Texture3D stub for Vulkan.
+IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigned int w, unsigned int h, unsigned int d)
+{
+    ImPlatform_TextureDesc3D x; x.width = w; x.height = h; x.depth = d;
+    x.format = ImPlatform_PixelFormat_RGBA8;
+    x.min_filter = ImPlatform_TextureFilter_Linear; x.mag_filter = ImPlatform_TextureFilter_Linear;
+    x.wrap_u = x.wrap_v = x.wrap_w = ImPlatform_TextureWrap_Clamp;
+    return x;
+}
+IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
+IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return NULL; }
+
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        VkBool32 feature;
+        if (format == ImPlatform_PixelFormat_ETC2_RGB8 || format == ImPlatform_PixelFormat_ETC2_RGBA8)
+            feature = g_EnabledFeatures.textureCompressionETC2;
+        else if (format == ImPlatform_PixelFormat_ASTC_4x4)
+            feature = g_EnabledFeatures.textureCompressionASTC_LDR;
+        else
+            feature = g_EnabledFeatures.textureCompressionBC;
+        if (!feature || !g_GfxData.physicalDevice)
+            return false;
+
+        int bytes_per_pixel;
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(g_GfxData.physicalDevice, ImPlatform_GetVulkanFormat(format, &bytes_per_pixel), &props);
+        return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+    }
+#endif
+    (void)format;
+    return true;
+}
+
+// Pixels come either from tightly packed `pixel_data` or from `buffer`.
+// With neither, the image is only transitioned and its content is undefined.
+static ImPlatform_TexTracking_Vulkan* ImPlatform_Vulkan_CreateTexture(const void* pixel_data, const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc)
+{
+    int bytes_per_pixel;
+    VkFormat format = ImPlatform_GetVulkanFormat(desc->format, &bytes_per_pixel);
+    int src_bytes_per_pixel = ImPlatform_Vulkan_SourceBytesPerPixel(desc->format, bytes_per_pixel);
+    const unsigned int block_bytes = ImPlatform_CompressedBlockBytes(desc->format);
+    VkDeviceSize upload_size = (VkDeviceSize)desc->width * desc->height * bytes_per_pixel;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (block_bytes)
+        upload_size = (VkDeviceSize)ImPlatform_CompressedSize(desc->format, desc->width, desc->height);
+#endif
+    ImPlatform_ImageBufferStaging_Vulkan plan = {};
+    if (buffer)
+    {
+        plan = ImPlatform_Vulkan_PlanImageBuffer(buffer, bytes_per_pixel);
+        upload_size = plan.size;
+    }
+
+    bool has_pixels = pixel_data != NULL || buffer != NULL;
+
+    // Mips are blitted from level 0, which needs linear blit support for the format (never for compressed ones)
+    uint32_t mip_levels = block_bytes ? 1 : ImPlatform_TextureMipCount(desc);
+    if (mip_levels > 1)
+    {
+        const VkFormatFeatureFlags needed = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(g_GfxData.physicalDevice, format, &props);
+        if ((props.optimalTilingFeatures & needed) != needed)
+            mip_levels = 1;
+    }
+
+    VkResult err;
+
+    // Create staging buffer (vkDestroyBuffer/vkFreeMemory accept null handles)
+    VkBuffer staging_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory staging_memory = VK_NULL_HANDLE;
+    if (has_pixels)
+    {
+        VkBufferCreateInfo buffer_info = {};
+        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_info.size = upload_size;
+        buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        err = vkCreateBuffer(g_GfxData.device, &buffer_info, g_Allocator, &staging_buffer);
+        if (err != VK_SUCCESS)
+            return NULL;
+
+        VkMemoryRequirements mem_req;
+        vkGetBufferMemoryRequirements(g_GfxData.device, staging_buffer, &mem_req);
+
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = mem_req.size;
+        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, mem_req.memoryTypeBits);
+        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &staging_memory);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            return NULL;
+        }
+
+        err = vkBindBufferMemory(g_GfxData.device, staging_buffer, staging_memory, 0);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Upload to staging buffer
+    if (has_pixels)
+    {
+        void* map = NULL;
+        err = vkMapMemory(g_GfxData.device, staging_memory, 0, upload_size, 0, &map);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+        if (buffer)
+            ImPlatform_Vulkan_FillImageBuffer((unsigned char*)map, buffer, bytes_per_pixel, &plan);
+        else if (block_bytes)
+            memcpy(map, pixel_data, (size_t)upload_size);
+        else
+            ImPlatform_Vulkan_CopyPixels((unsigned char*)map, (const unsigned char*)pixel_data,
+                                         (size_t)desc->width * desc->height, src_bytes_per_pixel, bytes_per_pixel);
+        VkMappedMemoryRange range[1] = {};
+        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range[0].memory = staging_memory;
+        range[0].size = upload_size;
+        err = vkFlushMappedMemoryRanges(g_GfxData.device, 1, range);
+        vkUnmapMemory(g_GfxData.device, staging_memory);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create the Image
+    VkImage image;
+    VkDeviceMemory image_memory;
+    {
+        VkImageCreateInfo image_info = {};
+        image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        image_info.imageType = VK_IMAGE_TYPE_2D;
+        image_info.format = format;
+        image_info.extent.width = desc->width;
+        image_info.extent.height = desc->height;
+        image_info.extent.depth = 1;
+        image_info.mipLevels = mip_levels;
+        image_info.arrayLayers = 1;
+        image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        // Transfer source for mip generation and readback
+        image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        err = vkCreateImage(g_GfxData.device, &image_info, g_Allocator, &image);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+
+        VkMemoryRequirements mem_req;
+        vkGetImageMemoryRequirements(g_GfxData.device, image, &mem_req);
+
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = mem_req.size;
+        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_req.memoryTypeBits);
+        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &image_memory);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+
+        err = vkBindImageMemory(g_GfxData.device, image, image_memory, 0);
+        if (err != VK_SUCCESS)
+        {
+            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create the Image View
+    VkImageView image_view;
+    {
+        VkImageViewCreateInfo view_info = {};
+        view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        view_info.image = image;
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = format;
+        view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        view_info.subresourceRange.levelCount = mip_levels;
+        view_info.subresourceRange.layerCount = 1;
+        err = vkCreateImageView(g_GfxData.device, &view_info, g_Allocator, &image_view);
+        if (err != VK_SUCCESS)
+        {
+            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create sampler
+    VkSampler sampler;
+    {
+        VkSamplerCreateInfo sampler_info = {};
+        sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        sampler_info.magFilter = (desc->mag_filter == ImPlatform_TextureFilter_Nearest) ? VK_FILTER_NEAREST : VK_FILTER_LINEAR;
+        sampler_info.minFilter = (desc->min_filter == ImPlatform_TextureFilter_Nearest) ? VK_FILTER_NEAREST : VK_FILTER_LINEAR;
+        sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+
+        VkSamplerAddressMode wrap_u = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        VkSamplerAddressMode wrap_v = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        if (desc->wrap_u == ImPlatform_TextureWrap_Repeat)
+            wrap_u = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        else if (desc->wrap_u == ImPlatform_TextureWrap_Mirror)
+            wrap_u = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+        if (desc->wrap_v == ImPlatform_TextureWrap_Repeat)
+            wrap_v = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        else if (desc->wrap_v == ImPlatform_TextureWrap_Mirror)
+            wrap_v = VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+
+        sampler_info.addressModeU = wrap_u;
+        sampler_info.addressModeV = wrap_v;
+        sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        sampler_info.minLod = -1000;
+        // Only LinearMipLinear samples below level 0
+        sampler_info.maxLod = (desc->min_filter == ImPlatform_TextureFilter_LinearMipLinear) ? 1000.0f : 0.0f;
+        sampler_info.maxAnisotropy = 1.0f;
+        err = vkCreateSampler(g_GfxData.device, &sampler_info, g_Allocator, &sampler);
+        if (err != VK_SUCCESS)
+        {
+            vkDestroyImageView(g_GfxData.device, image_view, g_Allocator);
+            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create descriptor set
+    VkDescriptorSet descriptor_set = (VkDescriptorSet)ImGui_ImplVulkan_AddTexture(sampler, image_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    // Upload to GPU using command buffer
+    {
+        VkCommandBuffer command_buffer = g_MainWindowData.Frames[g_MainWindowData.FrameIndex].CommandBuffer;
+
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        err = vkBeginCommandBuffer(command_buffer, &begin_info);
+        if (err != VK_SUCCESS)
+        {
+            // Cleanup and return null
+            ImGui_ImplVulkan_RemoveTexture(descriptor_set);
+            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
+            vkDestroyImageView(g_GfxData.device, image_view, g_Allocator);
+            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+            return NULL;
+        }
+
+        // Transition to transfer dst
+        {
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image;
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.levelCount = mip_levels;
+            barrier.subresourceRange.layerCount = 1;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+        }
+
+        // Copy buffer to image
+        if (has_pixels)
+        {
+            VkBufferImageCopy region = {};
+            region.bufferRowLength = plan.rowLength;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent.width = desc->width;
+            region.imageExtent.height = desc->height;
+            region.imageExtent.depth = 1;
+            vkCmdCopyBufferToImage(command_buffer, staging_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        }
+
+        // Transition to shader read (generating the mip chain on the way)
+        if (has_pixels && mip_levels > 1)
+        {
+            ImPlatform_Vulkan_RecordMipChain(command_buffer, image, desc->width, desc->height, mip_levels, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        }
+        else
+        {
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image;
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.levelCount = mip_levels;
+            barrier.subresourceRange.layerCount = 1;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+        }
+
+        vkEndCommandBuffer(command_buffer);
+
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+        err = vkQueueSubmit(g_GfxData.queue, 1, &submit_info, VK_NULL_HANDLE);
+        vkQueueWaitIdle(g_GfxData.queue); // Wait for upload to complete
+    }
+
+    // Cleanup staging resources
+    vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
+    vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+
+    // Track the texture so it can be updated and released later.
+    // The descriptor set is the handle we return.
+    ImPlatform_TexTracking_Vulkan* entry = new ImPlatform_TexTracking_Vulkan;
+    memset(entry, 0, sizeof(*entry));
+    entry->descriptorSet    = descriptor_set;
+    entry->image            = image;
+    entry->imageMemory      = image_memory;
+    entry->imageView        = image_view;
+    entry->sampler          = sampler;
+    entry->format           = format;
+    entry->bytesPerPixel    = bytes_per_pixel;
+    entry->srcBytesPerPixel = src_bytes_per_pixel;
+    entry->width            = desc->width;
+    entry->height           = desc->height;
+    entry->mipLevels        = mip_levels;
+    entry->pixelFormat      = desc->format;
+    entry->blockBytes       = block_bytes;
+    entry->next             = g_TexTrackingHead;
+    g_TexTrackingHead       = entry;
+
+    return entry;
+}
+
+IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
+{
+    if (!desc || !g_GfxData.device)
+        return NULL;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(desc->format) && !ImPlatform_SupportsPixelFormat(desc->format))
+        return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+#endif
+
+    ImPlatform_TexTracking_Vulkan* entry = ImPlatform_Vulkan_CreateTexture(pixel_data, NULL, desc);
+    return entry ? (ImTextureID)entry->descriptorSet : NULL;
+}
+
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc)
+{
+    ImPlatform_PixelFormat pixel_format;
+    if (!g_GfxData.device || !ImPlatform_ImageBufferResolveFormat(buffer, desc, &pixel_format))
+        return NULL;
+
+    ImPlatform_TextureDesc d = desc ? *desc : ImPlatform_TextureDesc_Default(buffer->width, buffer->height);
+    d.width  = buffer->width;
+    d.height = buffer->height;
+    d.format = pixel_format;
+
+    ImPlatform_TexTracking_Vulkan* entry = ImPlatform_Vulkan_CreateTexture(NULL, buffer, &d);
+    if (!entry)
+        return NULL;
+    entry->version    = buffer->version;
+    entry->hasVersion = true;
+    return (ImTextureID)entry->descriptorSet;
+}
+
+// Reserves ring space for a sub-rect of `tex`. The copy is queued by ImPlatform_Vulkan_QueueUpload.
+// row_length: source row pitch in texels, 0 for tightly packed rows.
+static unsigned char* ImPlatform_Vulkan_AllocUpload(ImPlatform_TexTracking_Vulkan* tex, unsigned int x, unsigned int y,
+                                                    unsigned int width, unsigned int height, uint32_t row_length,
+                                                    ImPlatform_PendingUpload_Vulkan* out_upload)
+{
+    if (width == 0 || height == 0 || x + width > tex->width || y + height > tex->height)
+        return NULL;
+
+    VkDeviceSize alignment, size;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (tex->blockBytes)
+    {
+        // Whole blocks, tightly packed; block sizes are multiples of 4
+        if (row_length || !ImPlatform_CompressedRegionValid(x, y, width, height, tex->width, tex->height))
+            return NULL;
+        alignment = tex->blockBytes;
+        size = (VkDeviceSize)ImPlatform_CompressedSize(tex->pixelFormat, width, height);
+    }
+    else
+#endif
+    {
+        // vkCmdCopyBufferToImage wants bufferOffset aligned to both the texel size and 4
+        alignment = (VkDeviceSize)tex->bytesPerPixel;
+        while (alignment % 4)
+            alignment += tex->bytesPerPixel;
+        size = (row_length ? (VkDeviceSize)row_length * (height - 1) + width : (VkDeviceSize)width * height) * tex->bytesPerPixel;
+    }
+
+    VkDeviceSize offset;
+    unsigned char* dst = ImPlatform_StagingRing_Alloc(size, alignment, &offset);
+    if (!dst)
+        return NULL;
+
+    out_upload->image = tex->image;
+    out_upload->bufferOffset = offset;
+    out_upload->size = size;
+    out_upload->alignment = alignment;
+    out_upload->rowLength = row_length;
+    out_upload->x = x;
+    out_upload->y = y;
+    out_upload->width = width;
+    out_upload->height = height;
+    out_upload->mipLevels = tex->mipLevels;
+    out_upload->imageWidth = tex->width;
+    out_upload->imageHeight = tex->height;
+    return dst;
+}
+
+static bool ImPlatform_Vulkan_QueueUpload(const ImPlatform_PendingUpload_Vulkan* upload)
+{
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    if (ring->pendingCount == ring->pendingCapacity)
+    {
+        int new_capacity = ring->pendingCapacity ? ring->pendingCapacity * 2 : 16;
+        void* new_pending = realloc(ring->pending, sizeof(ImPlatform_PendingUpload_Vulkan) * new_capacity);
+        if (!new_pending)
+            return false;
+        ring->pending = (ImPlatform_PendingUpload_Vulkan*)new_pending;
+        ring->pendingCapacity = new_capacity;
+    }
+    ring->pending[ring->pendingCount++] = *upload;
+    return true;
+}
+
+// Streams a sub-rect through the staging ring. The copy is recorded at the start
+// of the next frame, so the new content is visible from that frame on.
+IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void* pixel_data,
+                                              unsigned int x, unsigned int y,
+                                              unsigned int width, unsigned int height)
+{
+    if (!texture_id || !pixel_data || !g_GfxData.device)
+        return false;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
+    ImPlatform_TexTracking_Vulkan* tex = ImPlatform_Vulkan_FindTexture((VkDescriptorSet)texture_id);
+    if (!tex)
+        return false;
+
+    ImPlatform_PendingUpload_Vulkan upload;
+    unsigned char* dst = ImPlatform_Vulkan_AllocUpload(tex, x, y, width, height, 0, &upload);
+    if (!dst)
+        return false;
+    if (tex->blockBytes)
+        memcpy(dst, pixel_data, (size_t)upload.size);
+    else
+        ImPlatform_Vulkan_CopyPixels(dst, (const unsigned char*)pixel_data, (size_t)width * height, tex->srcBytesPerPixel, tex->bytesPerPixel);
+    return ImPlatform_Vulkan_QueueUpload(&upload);
+}
+
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer)
+{
+    if (!texture_id || !buffer || !buffer->host || !g_GfxData.device)
+        return false;
+
+    ImPlatform_TexTracking_Vulkan* tex = ImPlatform_Vulkan_FindTexture((VkDescriptorSet)texture_id);
+    if (!tex || buffer->width != tex->width || buffer->height != tex->height ||
+        ImPlatform_ImageBufferUploadPixelBytes(buffer) != (size_t)tex->srcBytesPerPixel)
+        return false;
+    if (tex->hasVersion && tex->version == buffer->version)
+        return true; // Unchanged since the last upload
+
+    ImPlatform_ImageBufferStaging_Vulkan plan = ImPlatform_Vulkan_PlanImageBuffer(buffer, tex->bytesPerPixel);
+    ImPlatform_PendingUpload_Vulkan upload;
+    unsigned char* dst = ImPlatform_Vulkan_AllocUpload(tex, 0, 0, buffer->width, buffer->height, plan.rowLength, &upload);
+    if (!dst)
+        return false;
+    ImPlatform_Vulkan_FillImageBuffer(dst, buffer, tex->bytesPerPixel, &plan);
+    if (!ImPlatform_Vulkan_QueueUpload(&upload))
+        return false;
+
+    tex->version    = buffer->version;
+    tex->hasVersion = true;
+    return true;
+}
+
+// Upload opened by ImPlatform_BeginTextureUpload
+static ImPlatform_PendingUpload_Vulkan g_OpenUpload = {};
+static VkDescriptorSet g_OpenUploadTexture = VK_NULL_HANDLE;
+
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID texture_id, unsigned int x, unsigned int y,
+                                                   unsigned int width, unsigned int height)
+{
+    if (!texture_id || !g_GfxData.device || g_OpenUploadTexture != VK_NULL_HANDLE)
+        return NULL;
+
+    // The caller writes the GPU layout directly, formats expanded on upload can't stream
+    ImPlatform_TexTracking_Vulkan* tex = ImPlatform_Vulkan_FindTexture((VkDescriptorSet)texture_id);
+    if (!tex || tex->blockBytes || tex->srcBytesPerPixel != tex->bytesPerPixel)
+        return NULL;
+
+    unsigned char* dst = ImPlatform_Vulkan_AllocUpload(tex, x, y, width, height, 0, &g_OpenUpload);
+    if (dst)
+        g_OpenUploadTexture = tex->descriptorSet;
+    return dst;
+}
+
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID texture_id)
+{
+    if (!texture_id || (VkDescriptorSet)texture_id != g_OpenUploadTexture)
+        return false;
+    g_OpenUploadTexture = VK_NULL_HANDLE;
+    return ImPlatform_Vulkan_QueueUpload(&g_OpenUpload);
+}
+
+IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
+{
+    if (!desc || !g_GfxData.device)
+        return NULL;
+
+    int bytes_per_pixel;
+    VkFormat format = ImPlatform_GetVulkanFormat(desc->format, &bytes_per_pixel);
+    VkResult err;
+
+    // Create image
+    VkImage image;
+    VkDeviceMemory imageMemory;
+    {
+        VkImageCreateInfo image_info = {};
+        image_info.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        image_info.imageType     = VK_IMAGE_TYPE_2D;
+        image_info.format        = format;
+        image_info.extent        = { desc->width, desc->height, 1 };
+        image_info.mipLevels     = 1;
+        image_info.arrayLayers   = 1;
+        image_info.samples       = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling        = VK_IMAGE_TILING_OPTIMAL;
+        image_info.usage         = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                                   VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        image_info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        err = vkCreateImage(g_GfxData.device, &image_info, g_Allocator, &image);
+        if (err != VK_SUCCESS) return NULL;
+
+        VkMemoryRequirements mem_req;
+        vkGetImageMemoryRequirements(g_GfxData.device, image, &mem_req);
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize  = mem_req.size;
+        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_req.memoryTypeBits);
+        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &imageMemory);
+        if (err != VK_SUCCESS) { vkDestroyImage(g_GfxData.device, image, g_Allocator); return NULL; }
+        vkBindImageMemory(g_GfxData.device, image, imageMemory, 0);
+    }
+
+    // Create image view
+    VkImageView imageView;
+    {
+        VkImageViewCreateInfo view_info = {};
+        view_info.sType                           = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        view_info.image                           = image;
+        view_info.viewType                        = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format                          = format;
+        view_info.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        view_info.subresourceRange.levelCount     = 1;
+        view_info.subresourceRange.layerCount     = 1;
+        err = vkCreateImageView(g_GfxData.device, &view_info, g_Allocator, &imageView);
+        if (err != VK_SUCCESS) {
+            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create sampler
+    VkSampler sampler;
+    {
+        VkSamplerCreateInfo sampler_info = {};
+        sampler_info.sType      = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        sampler_info.magFilter  = VK_FILTER_LINEAR;
+        sampler_info.minFilter  = VK_FILTER_LINEAR;
+        sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        sampler_info.maxAnisotropy = 1.0f;
+        sampler_info.minLod = -1000;
+        sampler_info.maxLod = 1000;
         err = vkCreateSampler(g_GfxData.device, &sampler_info, g_Allocator, &sampler);
+        if (err != VK_SUCCESS) {
+            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
+            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create render pass
+    VkRenderPass renderPass;
+    {
+        VkAttachmentDescription attachment = {};
+        attachment.format         = format;
+        attachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+        attachment.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+        attachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachment.finalLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL; // To shader-read in EndRenderToTexture
+
+        VkAttachmentReference color_ref = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments    = &color_ref;
+
+        VkSubpassDependency dep = {};
+        dep.srcSubpass    = VK_SUBPASS_EXTERNAL;
+        dep.dstSubpass    = 0;
+        dep.srcStageMask  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dep.dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dep.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        dep.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+        VkRenderPassCreateInfo rp_info = {};
+        rp_info.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        rp_info.attachmentCount = 1;
+        rp_info.pAttachments    = &attachment;
+        rp_info.subpassCount    = 1;
+        rp_info.pSubpasses      = &subpass;
+        rp_info.dependencyCount = 1;
+        rp_info.pDependencies   = &dep;
+        err = vkCreateRenderPass(g_GfxData.device, &rp_info, g_Allocator, &renderPass);
+        if (err != VK_SUCCESS) {
+            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
+            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
+            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Create framebuffer
+    VkFramebuffer framebuffer;
+    {
+        VkFramebufferCreateInfo fb_info = {};
+        fb_info.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        fb_info.renderPass      = renderPass;
+        fb_info.attachmentCount = 1;
+        fb_info.pAttachments    = &imageView;
+        fb_info.width           = desc->width;
+        fb_info.height          = desc->height;
+        fb_info.layers          = 1;
+        err = vkCreateFramebuffer(g_GfxData.device, &fb_info, g_Allocator, &framebuffer);
+        if (err != VK_SUCCESS) {
+            vkDestroyRenderPass(g_GfxData.device, renderPass, g_Allocator);
+            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
+            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
+            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
+            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+            return NULL;
+        }
+    }
+
+    // Register with ImGui for use as a shader input
+    VkDescriptorSet descriptorSet = (VkDescriptorSet)ImGui_ImplVulkan_AddTexture(
+        sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    ImPlatform_RTTracking_Vulkan* entry = new ImPlatform_RTTracking_Vulkan();
+    entry->image         = image;
+    entry->imageMemory   = imageMemory;
+    entry->imageView     = imageView;
+    entry->sampler       = sampler;
+    entry->descriptorSet = descriptorSet;
+    entry->renderPass    = renderPass;
+    entry->framebuffer   = framebuffer;
+    entry->width         = desc->width;
+    entry->height        = desc->height;
+    entry->format        = format;
+    entry->bytesPerPixel = bytes_per_pixel;
+    entry->next          = g_RTTrackingHead;
+    g_RTTrackingHead     = entry;
+
+    return (ImTextureID)descriptorSet;
+}
+
+// Returns the command buffer collecting the offscreen passes of the next submit,
+// opening a slot of the ring on the first pass
+static VkCommandBuffer ImPlatform_Vulkan_GetRTCommandBuffer(void)
+{
+    if (g_RTRecordingSlot >= 0)
+        return g_RTCommands[g_RTRecordingSlot].commandBuffer;
+
+    VkResult err;
+    if (g_RTCommandPool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_info = {};
+        pool_info.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_info.queueFamilyIndex = g_QueueFamily;
+        pool_info.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        err = vkCreateCommandPool(g_GfxData.device, &pool_info, g_Allocator, &g_RTCommandPool);
         if (err != VK_SUCCESS)
         {
-            vkDestroyImageView(g_GfxData.device, image_view, g_Allocator);
-            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
+            g_RTCommandPool = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
         }
     }
 
-    // Create descriptor set
-    VkDescriptorSet descriptor_set = (VkDescriptorSet)ImGui_ImplVulkan_AddTexture(sampler, image_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    ImPlatform_RTCommands_Vulkan* slot = &g_RTCommands[g_RTNextSlot];
+    if (slot->commandBuffer == VK_NULL_HANDLE)
+    {
+        VkCommandBufferAllocateInfo alloc_info = {};
+        alloc_info.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.commandPool        = g_RTCommandPool;
+        alloc_info.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        err = vkAllocateCommandBuffers(g_GfxData.device, &alloc_info, &slot->commandBuffer);
+        if (err != VK_SUCCESS)
+        {
+            slot->commandBuffer = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+    }
 
-    // Upload to GPU using command buffer
+    // Only blocks when the GPU is a whole ring of submits behind
+    while (slot->retireSerial > g_CompletedSerial && ImPlatform_Vulkan_WaitOldestFrame()) {}
+
+    vkResetCommandBuffer(slot->commandBuffer, 0);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    err = vkBeginCommandBuffer(slot->commandBuffer, &begin_info);
+    if (err != VK_SUCCESS)
+        return VK_NULL_HANDLE;
+
+    // Texture updates queued so far land before the passes that may sample them
+    ImPlatform_Vulkan_RecordPendingUploads(slot->commandBuffer);
+
+    g_RTRecordingSlot = g_RTNextSlot;
+    g_RTNextSlot = (g_RTNextSlot + 1) % IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT;
+    return slot->commandBuffer;
+}
+
+static void ImPlatform_Vulkan_DestroyRTCommands(void)
+{
+    // Frees the command buffers with it, recording or not
+    if (g_RTCommandPool != VK_NULL_HANDLE)
+        vkDestroyCommandPool(g_GfxData.device, g_RTCommandPool, g_Allocator);
+    g_RTCommandPool = VK_NULL_HANDLE;
+    memset(g_RTCommands, 0, sizeof(g_RTCommands));
+    g_RTRecordingSlot = -1;
+    g_RTNextSlot = 0;
+    g_ActiveRTEntry = NULL;
+}
+
+// Passes are recorded, not submitted: any number of them per frame costs no host
+// wait, they reach the GPU with the next ImPlatform_GfxAPISwapBuffer.
+IMPLATFORM_API bool ImPlatform_BeginRenderToTexture(ImTextureID texture)
+{
+    if (!texture || !g_GfxData.device || g_ActiveRTEntry)
+        return false;
+
+    VkDescriptorSet ds = (VkDescriptorSet)texture;
+    ImPlatform_RTTracking_Vulkan* entry = g_RTTrackingHead;
+    while (entry) { if (entry->descriptorSet == ds) break; entry = entry->next; }
+    if (!entry) return false;
+
+    VkCommandBuffer command_buffer = ImPlatform_Vulkan_GetRTCommandBuffer();
+    if (command_buffer == VK_NULL_HANDLE)
+        return false;
+
+    // Begin render pass (loadOp = CLEAR handles the clear, its external dependency
+    // orders the write after earlier reads of the texture)
+    VkClearValue clear_value = {};
+    VkRenderPassBeginInfo rp_info = {};
+    rp_info.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rp_info.renderPass               = entry->renderPass;
+    rp_info.framebuffer              = entry->framebuffer;
+    rp_info.renderArea.extent.width  = entry->width;
+    rp_info.renderArea.extent.height = entry->height;
+    rp_info.clearValueCount          = 1;
+    rp_info.pClearValues             = &clear_value;
+    vkCmdBeginRenderPass(command_buffer, &rp_info, VK_SUBPASS_CONTENTS_INLINE);
+
+    VkViewport viewport = { 0, 0, (float)entry->width, (float)entry->height, 0.f, 1.f };
+    vkCmdSetViewport(command_buffer, 0, 1, &viewport);
+
+    VkRect2D scissor = { {0, 0}, {entry->width, entry->height} };
+    vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+
+    g_ActiveRTEntry = entry;
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_EndRenderToTexture(void)
+{
+    if (!g_ActiveRTEntry || g_RTRecordingSlot < 0) return;
+
+    ImPlatform_RTTracking_Vulkan* entry = g_ActiveRTEntry;
+    g_ActiveRTEntry = NULL;
+
+    VkCommandBuffer command_buffer = g_RTCommands[g_RTRecordingSlot].commandBuffer;
+    vkCmdEndRenderPass(command_buffer);
+
+    // Make the pass visible to fragment shaders of the passes and frame that follow
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = entry->image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+    barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+}
+
+// ----------------------------------------------------------------------------
+// Backbuffer copies and asynchronous readback
+// ----------------------------------------------------------------------------
+// Both are recorded into the frame command buffer after the main render pass
+// (see ImPlatform_GfxAPIRender). Readbacks land in a host-visible buffer and are
+// complete once the serial of the frame they were submitted with has retired;
+// fences are only polled, never waited on. Buffers of freed readbacks stay mapped
+// in a small pool keyed by size, so a readback per frame allocates nothing.
+
+#define IMPLATFORM_VULKAN_MAX_BACKBUFFER_COPIES 8
+static VkDescriptorSet g_BackbufferCopies[IMPLATFORM_VULKAN_MAX_BACKBUFFER_COPIES] = {};
+static int g_BackbufferCopyCount = 0;
+
+enum ImPlatform_ReadbackState_Vulkan {
+    ImPlatform_ReadbackState_Queued,        // Recorded with the next frame
+    ImPlatform_ReadbackState_Recorded,      // In the frame command buffer, not submitted yet
+    ImPlatform_ReadbackState_InFlight,      // Submitted with frame `serial`
+    ImPlatform_ReadbackState_Ready,
+    ImPlatform_ReadbackState_Failed
+};
+
+struct ImPlatform_Readback_t {
+    VkBuffer        buffer;
+    VkDeviceMemory  memory;
+    void*           mapped;
+    bool            coherent;
+    VkImage         image;
+    unsigned int    x, y, width, height, row_pitch;
+    ImPlatform_ReadbackState_Vulkan state;
+    uint64_t        serial;
+    bool            released;       // Freed by the first ImPlatform_GfxAPINewFrame after the GPU is done with it
+    ImPlatform_ReadbackCallback callback;
+    void*           user_data;
+    ImPlatform_Readback_t* next;
+};
+static ImPlatform_Readback_t* g_Readbacks = NULL;
+
+#define IMPLATFORM_VULKAN_READBACK_POOL 8
+struct ImPlatform_ReadbackBuffer_Vulkan {
+    VkBuffer        buffer;
+    VkDeviceMemory  memory;
+    void*           mapped;
+    bool            coherent;
+    VkDeviceSize    size;
+};
+static ImPlatform_ReadbackBuffer_Vulkan g_ReadbackPool[IMPLATFORM_VULKAN_READBACK_POOL] = {};
+static int g_ReadbackPoolCount = 0;
+
+// Image behind a texture or render texture
+struct ImPlatform_ImageRef_Vulkan {
+    VkImage         image;
+    unsigned int    width, height;
+    uint32_t        mipLevels;
+    int             bytesPerPixel;  // 0 for block-compressed textures
+};
+
+static bool ImPlatform_Vulkan_ResolveImage(ImTextureID texture_id, ImPlatform_ImageRef_Vulkan* out)
+{
+    VkDescriptorSet ds = (VkDescriptorSet)texture_id;
+    if (ImPlatform_TexTracking_Vulkan* tex = ImPlatform_Vulkan_FindTexture(ds))
     {
-        VkCommandBuffer command_buffer = g_MainWindowData.Frames[g_MainWindowData.FrameIndex].CommandBuffer;
+        out->image         = tex->image;
+        out->width         = tex->width;
+        out->height        = tex->height;
+        out->mipLevels     = tex->mipLevels;
+        out->bytesPerPixel = tex->bytesPerPixel;
+        return true;
+    }
+    for (ImPlatform_RTTracking_Vulkan* rt = g_RTTrackingHead; rt; rt = rt->next)
+        if (rt->descriptorSet == ds)
+        {
+            out->image         = rt->image;
+            out->width         = rt->width;
+            out->height        = rt->height;
+            out->mipLevels     = 1;
+            out->bytesPerPixel = rt->bytesPerPixel;
+            return true;
+        }
+    return false;
+}
 
-        VkCommandBufferBeginInfo begin_info = {};
-        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        begin_info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        err = vkBeginCommandBuffer(command_buffer, &begin_info);
-        if (err != VK_SUCCESS)
+static void ImPlatform_Vulkan_RecordFrameCopies(VkCommandBuffer command_buffer, VkImage backbuffer)
+{
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+
+    if (g_BackbufferCopyCount > 0)
+    {
+        // The main render pass left the backbuffer ready to present
+        VkImageMemoryBarrier src = barrier;
+        src.image = backbuffer;
+        src.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        src.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        src.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        src.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, NULL, 0, NULL, 1, &src);
+
+        for (int i = 0; i < g_BackbufferCopyCount; i++)
         {
-            // Cleanup and return null
-            ImGui_ImplVulkan_RemoveTexture(descriptor_set);
-            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
-            vkDestroyImageView(g_GfxData.device, image_view, g_Allocator);
-            vkFreeMemory(g_GfxData.device, image_memory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-            vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
-            return NULL;
+            ImPlatform_ImageRef_Vulkan dst;
+            if (!ImPlatform_Vulkan_ResolveImage((ImTextureID)g_BackbufferCopies[i], &dst))
+                continue;
+
+            // Level 0 is overwritten entirely: the frame's earlier reads only have to finish
+            VkImageMemoryBarrier pre = barrier;
+            pre.image = dst.image;
+            pre.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            pre.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            pre.srcAccessMask = 0;
+            pre.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 0, 0, NULL, 0, NULL, 1, &pre);
+
+            // A blit converts from the swapchain format and scales to the destination
+            VkImageBlit blit = {};
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.layerCount = 1;
+            blit.srcOffsets[1].x = (int32_t)g_MainWindowData.Width;
+            blit.srcOffsets[1].y = (int32_t)g_MainWindowData.Height;
+            blit.srcOffsets[1].z = 1;
+            blit.dstSubresource = blit.srcSubresource;
+            blit.dstOffsets[1].x = (int32_t)dst.width;
+            blit.dstOffsets[1].y = (int32_t)dst.height;
+            blit.dstOffsets[1].z = 1;
+            const bool same_size = dst.width == (unsigned int)g_MainWindowData.Width && dst.height == (unsigned int)g_MainWindowData.Height;
+            vkCmdBlitImage(command_buffer, backbuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           dst.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, same_size ? VK_FILTER_NEAREST : VK_FILTER_LINEAR);
+
+            if (dst.mipLevels > 1)
+            {
+                ImPlatform_Vulkan_RecordMipChain(command_buffer, dst.image, dst.width, dst.height, dst.mipLevels,
+                                                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+                continue;
+            }
+            VkImageMemoryBarrier post = barrier;
+            post.image = dst.image;
+            post.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            post.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            post.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            post.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, NULL, 0, NULL, 1, &post);
         }
+        g_BackbufferCopyCount = 0;
+
+        VkImageMemoryBarrier present = barrier;
+        present.image = backbuffer;
+        present.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        present.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        present.srcAccessMask = 0;
+        present.dstAccessMask = 0;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, NULL, 0, NULL, 1, &present);
+    }
 
-        // Transition to transfer dst
+    // Readbacks go last so they see this frame's uploads and backbuffer copies.
+    // Recorded but never submitted ones (swapchain lost) are recorded again.
+    bool recorded = false;
+    for (ImPlatform_Readback_t* rb = g_Readbacks; rb; rb = rb->next)
+    {
+        if (rb->released || (rb->state != ImPlatform_ReadbackState_Queued && rb->state != ImPlatform_ReadbackState_Recorded))
+            continue;
+
+        VkImageMemoryBarrier pre = barrier;
+        pre.image = rb->image;
+        pre.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        pre.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        pre.srcAccessMask = 0;
+        pre.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, NULL, 0, NULL, 1, &pre);
+
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset.x = (int32_t)rb->x;
+        region.imageOffset.y = (int32_t)rb->y;
+        region.imageExtent.width = rb->width;
+        region.imageExtent.height = rb->height;
+        region.imageExtent.depth = 1;
+        vkCmdCopyImageToBuffer(command_buffer, rb->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, rb->buffer, 1, &region);
+
+        VkImageMemoryBarrier post = barrier;
+        post.image = rb->image;
+        post.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        post.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        post.srcAccessMask = 0;
+        post.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, NULL, 0, NULL, 1, &post);
+
+        rb->state = ImPlatform_ReadbackState_Recorded;
+        recorded = true;
+    }
+    if (recorded)
+    {
+        VkMemoryBarrier host = {};
+        host.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        host.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        host.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                             0, 1, &host, 0, NULL, 0, NULL);
+    }
+}
+
+// Called once the frame command buffer has been submitted
+static void ImPlatform_Vulkan_SubmitReadbacks(void)
+{
+    for (ImPlatform_Readback_t* rb = g_Readbacks; rb; rb = rb->next)
+        if (rb->state == ImPlatform_ReadbackState_Recorded)
         {
-            VkImageMemoryBarrier barrier = {};
-            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.image = image;
-            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            barrier.subresourceRange.levelCount = 1;
-            barrier.subresourceRange.layerCount = 1;
-            barrier.srcAccessMask = 0;
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+            rb->state = ImPlatform_ReadbackState_InFlight;
+            rb->serial = g_SubmitSerial;
         }
+}
 
-        // Copy buffer to image
+// Returns true once the readback is done. Retires the frames whose fence has
+// signaled, without waiting on any.
+static bool ImPlatform_Vulkan_PollReadback(ImPlatform_Readback_t* rb)
+{
+    if (rb->state == ImPlatform_ReadbackState_InFlight)
+    {
+        for (uint32_t i = 0; i < IMPLATFORM_VULKAN_MAX_FRAMES_IN_FLIGHT && rb->serial > g_CompletedSerial; i++)
+            if (g_FrameTracking[i].inFlight && vkGetFenceStatus(g_GfxData.device, g_MainWindowData.Frames[i].Fence) == VK_SUCCESS)
+                ImPlatform_Vulkan_RetireFrame(i);
+        if (rb->serial > g_CompletedSerial)
+            return false;
+        if (!rb->coherent)
         {
-            VkBufferImageCopy region = {};
-            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            region.imageSubresource.layerCount = 1;
-            region.imageExtent.width = desc->width;
-            region.imageExtent.height = desc->height;
-            region.imageExtent.depth = 1;
-            vkCmdCopyBufferToImage(command_buffer, staging_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+            VkMappedMemoryRange range = {};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = rb->memory;
+            range.size = VK_WHOLE_SIZE;
+            vkInvalidateMappedMemoryRanges(g_GfxData.device, 1, &range);
         }
+        rb->state = ImPlatform_ReadbackState_Ready;
+    }
+    return rb->state == ImPlatform_ReadbackState_Ready || rb->state == ImPlatform_ReadbackState_Failed;
+}
 
-        // Transition to shader read
+// Only called once the GPU is done with the buffer, which can then be reused as is
+static void ImPlatform_Vulkan_FreeReadback(ImPlatform_Readback_t* rb)
+{
+    if (rb->mapped && g_ReadbackPoolCount < IMPLATFORM_VULKAN_READBACK_POOL)
+    {
+        ImPlatform_ReadbackBuffer_Vulkan* pooled = &g_ReadbackPool[g_ReadbackPoolCount++];
+        pooled->buffer   = rb->buffer;
+        pooled->memory   = rb->memory;
+        pooled->mapped   = rb->mapped;
+        pooled->coherent = rb->coherent;
+        pooled->size     = (VkDeviceSize)rb->row_pitch * rb->height;
+        delete rb;
+        return;
+    }
+    if (rb->mapped) vkUnmapMemory(g_GfxData.device, rb->memory);
+    if (rb->buffer) vkDestroyBuffer(g_GfxData.device, rb->buffer, g_Allocator);
+    if (rb->memory) vkFreeMemory(g_GfxData.device, rb->memory, g_Allocator);
+    delete rb;
+}
+
+// Runs the callbacks of completed readbacks, frees completed and released ones
+static void ImPlatform_Vulkan_DispatchReadbacks(void)
+{
+    ImPlatform_Readback_t** link = &g_Readbacks;
+    while (ImPlatform_Readback_t* rb = *link)
+    {
+        const bool done = ImPlatform_Vulkan_PollReadback(rb);
+        const bool keep = rb->released ? (!done && rb->state == ImPlatform_ReadbackState_InFlight)
+                                       : (!done || !rb->callback);
+        if (keep)
         {
-            VkImageMemoryBarrier barrier = {};
-            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier.image = image;
-            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            barrier.subresourceRange.levelCount = 1;
-            barrier.subresourceRange.layerCount = 1;
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+            link = &rb->next;
+            continue;
         }
+        *link = rb->next;
+        if (!rb->released)
+            rb->callback(rb->state == ImPlatform_ReadbackState_Ready ? rb->mapped : NULL,
+                         rb->width, rb->height, rb->row_pitch, rb->user_data);
+        ImPlatform_Vulkan_FreeReadback(rb);
+    }
+}
 
-        vkEndCommandBuffer(command_buffer);
+static void ImPlatform_Vulkan_DestroyReadbacks(void)
+{
+    while (ImPlatform_Readback_t* rb = g_Readbacks)
+    {
+        g_Readbacks = rb->next;
+        ImPlatform_Vulkan_FreeReadback(rb);
+    }
+    for (int i = 0; i < g_ReadbackPoolCount; i++)
+    {
+        ImPlatform_ReadbackBuffer_Vulkan* pooled = &g_ReadbackPool[i];
+        vkUnmapMemory(g_GfxData.device, pooled->memory);
+        vkDestroyBuffer(g_GfxData.device, pooled->buffer, g_Allocator);
+        vkFreeMemory(g_GfxData.device, pooled->memory, g_Allocator);
+    }
+    g_ReadbackPoolCount = 0;
+    g_BackbufferCopyCount = 0;
+}
 
-        VkSubmitInfo submit_info = {};
-        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submit_info.commandBufferCount = 1;
-        submit_info.pCommandBuffers = &command_buffer;
-        err = vkQueueSubmit(g_GfxData.queue, 1, &submit_info, VK_NULL_HANDLE);
-        vkQueueWaitIdle(g_GfxData.queue); // Wait for upload to complete
+// Called when a texture is destroyed. Copies already recorded keep the image
+// alive through its deferred destruction.
+static void ImPlatform_Vulkan_ForgetFrameCopies(VkDescriptorSet descriptor_set, VkImage image)
+{
+    int kept = 0;
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+        if (g_BackbufferCopies[i] != descriptor_set)
+            g_BackbufferCopies[kept++] = g_BackbufferCopies[i];
+    g_BackbufferCopyCount = kept;
+
+    for (ImPlatform_Readback_t* rb = g_Readbacks; rb; rb = rb->next)
+        if (rb->image == image && rb->state == ImPlatform_ReadbackState_Queued)
+            rb->state = ImPlatform_ReadbackState_Failed;
+}
+
+IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst)
+{
+    ImPlatform_ImageRef_Vulkan ref;
+    if (!dst || !ImPlatform_Vulkan_ResolveImage(dst, &ref) || ref.bytesPerPixel == 0)
+        return false;
+
+    VkDescriptorSet descriptor_set = (VkDescriptorSet)dst;
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+        if (g_BackbufferCopies[i] == descriptor_set)
+            return true;
+    if (g_BackbufferCopyCount == IMPLATFORM_VULKAN_MAX_BACKBUFFER_COPIES)
+        return false;
+    g_BackbufferCopies[g_BackbufferCopyCount++] = descriptor_set;
+    return true;
+}
+
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID texture, unsigned int x, unsigned int y,
+                                                              unsigned int width, unsigned int height,
+                                                              ImPlatform_ReadbackCallback callback, void* user_data)
+{
+    ImPlatform_ImageRef_Vulkan ref;
+    if (!texture || !g_GfxData.device || !ImPlatform_Vulkan_ResolveImage(texture, &ref) || ref.bytesPerPixel == 0)
+        return NULL;
+    if (x >= ref.width || y >= ref.height)
+        return NULL;
+    if (width == 0)  width  = ref.width - x;
+    if (height == 0) height = ref.height - y;
+    if (width > ref.width - x || height > ref.height - y)
+        return NULL;
+
+    ImPlatform_Readback_t* rb = new ImPlatform_Readback_t();
+    rb->image     = ref.image;
+    rb->x         = x;
+    rb->y         = y;
+    rb->width     = width;
+    rb->height    = height;
+    rb->row_pitch = width * (unsigned int)ref.bytesPerPixel;
+    rb->state     = ImPlatform_ReadbackState_Queued;
+    rb->callback  = callback;
+    rb->user_data = user_data;
+
+    const VkDeviceSize size = (VkDeviceSize)rb->row_pitch * height;
+    for (int i = 0; i < g_ReadbackPoolCount; i++)
+        if (g_ReadbackPool[i].size == size)
+        {
+            rb->buffer   = g_ReadbackPool[i].buffer;
+            rb->memory   = g_ReadbackPool[i].memory;
+            rb->mapped   = g_ReadbackPool[i].mapped;
+            rb->coherent = g_ReadbackPool[i].coherent;
+            g_ReadbackPool[i] = g_ReadbackPool[--g_ReadbackPoolCount];
+            rb->next = g_Readbacks;
+            g_Readbacks = rb;
+            return rb;
+        }
+
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(g_GfxData.device, &buffer_info, g_Allocator, &rb->buffer) != VK_SUCCESS)
+    {
+        delete rb;
+        return NULL;
     }
 
-    // Cleanup staging resources
-    vkDestroyBuffer(g_GfxData.device, staging_buffer, g_Allocator);
-    vkFreeMemory(g_GfxData.device, staging_memory, g_Allocator);
+    // Cached memory makes CPU reads fast, coherent is the fallback every device has
+    VkMemoryRequirements mem_req;
+    vkGetBufferMemoryRequirements(g_GfxData.device, rb->buffer, &mem_req);
+    uint32_t memory_type = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, mem_req.memoryTypeBits);
+    if (memory_type == 0xFFFFFFFF)
+        memory_type = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, mem_req.memoryTypeBits);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_req.size;
+    alloc_info.memoryTypeIndex = memory_type;
+    if (memory_type == 0xFFFFFFFF ||
+        vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &rb->memory) != VK_SUCCESS ||
+        vkBindBufferMemory(g_GfxData.device, rb->buffer, rb->memory, 0) != VK_SUCCESS ||
+        vkMapMemory(g_GfxData.device, rb->memory, 0, VK_WHOLE_SIZE, 0, &rb->mapped) != VK_SUCCESS)
+    {
+        ImPlatform_Vulkan_FreeReadback(rb);
+        return NULL;
+    }
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    vkGetPhysicalDeviceMemoryProperties(g_GfxData.physicalDevice, &memory_properties);
+    rb->coherent = (memory_properties.memoryTypes[memory_type].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+    rb->next = g_Readbacks;
+    g_Readbacks = rb;
+    return rb;
+}
+
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback readback)
+{
+    return readback && ImPlatform_Vulkan_PollReadback(readback);
+}
+
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback readback, unsigned int* out_row_pitch)
+{
+    if (!readback || !ImPlatform_Vulkan_PollReadback(readback) || readback->state != ImPlatform_ReadbackState_Ready)
+        return NULL;
+    if (out_row_pitch)
+        *out_row_pitch = readback->row_pitch;
+    return readback->mapped;
+}
+
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback readback)
+{
+    if (!readback)
+        return;
+    // A submitted copy may still be writing the buffer
+    readback->released = true;
+    readback->callback = NULL;
+}
+IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height)
+{
+    if (width)  *width  = g_ImPlatform_BackbufferW;
+    if (height) *height = g_ImPlatform_BackbufferH;
+}
 
-    // Note: We're leaking image and image_memory here as we have no way to track them
-    // A production implementation would need a texture registry
-    // The descriptor set is the handle we return
+IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
+{
+    // Vulkan texture copy requires proper image tracking which is not yet implemented
+    // in this backend (see DestroyTexture note below).
+    (void)dst; (void)src;
+    return false;
+}
+
+IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
+{
+    if (!texture_id)
+        return;
+
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
+
+    // Remove from ImGui's texture registry
+    VkDescriptorSet descriptor_set = (VkDescriptorSet)texture_id;
+    ImGui_ImplVulkan_RemoveTexture(descriptor_set);
+
+    // Unlink from the texture registry
+    ImPlatform_TexTracking_Vulkan** link = &g_TexTrackingHead;
+    while (*link && (*link)->descriptorSet != descriptor_set)
+        link = &(*link)->next;
+    ImPlatform_TexTracking_Vulkan* entry = *link;
+    if (!entry)
+        return;
+    *link = entry->next;
+
+    // Drop uploads that have not been recorded yet
+    ImPlatform_StagingRing_Vulkan* ring = &g_StagingRing;
+    int kept = 0;
+    for (int i = 0; i < ring->pendingCount; i++)
+        if (ring->pending[i].image != entry->image)
+            ring->pending[kept++] = ring->pending[i];
+    ring->pendingCount = kept;
+    ImPlatform_Vulkan_ForgetFrameCopies(descriptor_set, entry->image);
+
+    // Frames already submitted (and the one being recorded) may still sample the
+    // image: release it once the next submission has retired.
+    entry->retireSerial = g_SubmitSerial + 1;
+    entry->next = g_TexGarbageHead;
+    g_TexGarbageHead = entry;
+}
+
+// ============================================================================
+// Custom Vertex/Index Buffer Management API - Vulkan Implementation
+// ============================================================================
+// Buffers are ranges of the buffer heap. Static buffers are device local and
+// updated through the staging ring: the copy is recorded at the start of the
+// next frame. Dynamic/Stream buffers are written straight into mapped memory;
+// when a frame in flight may still read the current range, the buffer is
+// renamed to a fresh range and the old one retired with that frame.
+// Draws have to be issued from an ImGui draw callback, between
+// ImPlatform_BeginCustomShader and ImPlatform_EndCustomShader. They use the
+// custom shader's pipeline, specialised for the buffers' vertex layout and the
+// primitive type (see ImPlatform_Vulkan_BindDrawPipeline). Vertex buffers
+// without attributes are fetched as ImDrawVert.
+
+struct ImPlatform_BufferData_Vulkan
+{
+    ImPlatform_BufferBlock_Vulkan* block;
+    VkDeviceSize offset;                 // Start of the buffer inside block->buffer
+    VkDeviceSize size;                   // Bytes
+    uint64_t lastUseSerial;              // Serial of the last frame that drew from [block, offset]
+    unsigned char* shadow;               // Dynamic/Stream: CPU copy of the contents, used when renaming
+    ImPlatform_VertexBufferDesc vb_desc; // Vertex buffer descriptor (for updates)
+    ImPlatform_IndexBufferDesc ib_desc;  // Index buffer descriptor (for updates)
+    ImPlatform_VertexAttribute* attributes; // Cached attribute array
+    unsigned int draw_count;             // Indirect buffers: number of ImPlatform_DrawIndexedIndirectArgs records
+};
+
+static ImPlatform_BufferData_Vulkan* g_BoundVertexBuffer = NULL;
+static ImPlatform_BufferData_Vulkan* g_BoundIndexBuffer = NULL;
+static ImPlatform_BufferData_Vulkan* g_BoundInstanceBuffer = NULL;
+
+static bool ImPlatform_Vulkan_BindDrawPipeline(const ImPlatform_BufferData_Vulkan* vb, const ImPlatform_BufferData_Vulkan* instance, unsigned int primitive_type);
 
-    return (ImTextureID)descriptor_set;
+static unsigned int ImPlatform_Vulkan_IndexSize(ImPlatform_IndexFormat format)
+{
+    return format == ImPlatform_IndexFormat_UInt16 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+// Serial of the frame that will record uploads queued now
+static uint64_t ImPlatform_Vulkan_NextUploadSerial(void)
+{
+    return g_SubmitSerial + (g_RecordingFrame >= 0 ? 2 : 1);
 }
 
-IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID /*texture_id*/, const void* /*pixel_data*/,
-                                              unsigned int /*x*/, unsigned int /*y*/,
-                                              unsigned int /*width*/, unsigned int /*height*/)
+// Queues a copy of `size` bytes into [dst_buffer, dst_offset] through the staging ring
+static bool ImPlatform_Vulkan_QueueBufferUpload(VkBuffer dst_buffer, VkDeviceSize dst_offset, const void* data, VkDeviceSize size)
 {
-    // Vulkan texture updates require staging buffers and command lists
-    // This is complex and not implemented yet
-    return false;
+    ImPlatform_PendingUpload_Vulkan upload = {};
+    unsigned char* dst = ImPlatform_StagingRing_Alloc(size, 4, &upload.bufferOffset);
+    if (!dst)
+        return false;
+    memcpy(dst, data, (size_t)size);
+    upload.dstBuffer = dst_buffer;
+    upload.dstOffset = dst_offset;
+    upload.size = size;
+    upload.alignment = 4;
+    return ImPlatform_Vulkan_QueueUpload(&upload);
 }
 
-IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
+static ImPlatform_BufferData_Vulkan* ImPlatform_Vulkan_CreateBuffer(const void* data, VkDeviceSize size, ImPlatform_BufferUsage usage)
 {
-    if (!desc || !g_GfxData.device)
+    if (!g_GfxData.device || size == 0)
         return NULL;
 
-    int bytes_per_pixel;
-    VkFormat format = ImPlatform_GetVulkanFormat(desc->format, &bytes_per_pixel);
-    VkResult err;
-
-    // Create image
-    VkImage image;
-    VkDeviceMemory imageMemory;
+    bool host_visible = usage != ImPlatform_BufferUsage_Static;
+    ImPlatform_BufferData_Vulkan* buffer = new ImPlatform_BufferData_Vulkan();
+    memset(buffer, 0, sizeof(ImPlatform_BufferData_Vulkan));
+    buffer->size = size;
+    buffer->block = ImPlatform_BufferHeap_Alloc(size, host_visible, &buffer->offset);
+    if (!buffer->block)
     {
-        VkImageCreateInfo image_info = {};
-        image_info.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        image_info.imageType     = VK_IMAGE_TYPE_2D;
-        image_info.format        = format;
-        image_info.extent        = { desc->width, desc->height, 1 };
-        image_info.mipLevels     = 1;
-        image_info.arrayLayers   = 1;
-        image_info.samples       = VK_SAMPLE_COUNT_1_BIT;
-        image_info.tiling        = VK_IMAGE_TILING_OPTIMAL;
-        image_info.usage         = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
-        image_info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
-        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        err = vkCreateImage(g_GfxData.device, &image_info, g_Allocator, &image);
-        if (err != VK_SUCCESS) return NULL;
-
-        VkMemoryRequirements mem_req;
-        vkGetImageMemoryRequirements(g_GfxData.device, image, &mem_req);
-        VkMemoryAllocateInfo alloc_info = {};
-        alloc_info.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        alloc_info.allocationSize  = mem_req.size;
-        alloc_info.memoryTypeIndex = ImPlatform_FindMemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_req.memoryTypeBits);
-        err = vkAllocateMemory(g_GfxData.device, &alloc_info, g_Allocator, &imageMemory);
-        if (err != VK_SUCCESS) { vkDestroyImage(g_GfxData.device, image, g_Allocator); return NULL; }
-        vkBindImageMemory(g_GfxData.device, image, imageMemory, 0);
+        delete buffer;
+        return NULL;
     }
 
-    // Create image view
-    VkImageView imageView;
+    if (host_visible)
     {
-        VkImageViewCreateInfo view_info = {};
-        view_info.sType                           = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-        view_info.image                           = image;
-        view_info.viewType                        = VK_IMAGE_VIEW_TYPE_2D;
-        view_info.format                          = format;
-        view_info.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-        view_info.subresourceRange.levelCount     = 1;
-        view_info.subresourceRange.layerCount     = 1;
-        err = vkCreateImageView(g_GfxData.device, &view_info, g_Allocator, &imageView);
-        if (err != VK_SUCCESS) {
-            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
+        buffer->shadow = (unsigned char*)malloc((size_t)size);
+        if (!buffer->shadow)
+        {
+            ImPlatform_BufferHeap_Free(buffer->block, buffer->offset, size);
+            delete buffer;
             return NULL;
         }
+        memcpy(buffer->shadow, data, (size_t)size);
+        memcpy(buffer->block->mapped + buffer->offset, data, (size_t)size);
     }
-
-    // Create sampler
-    VkSampler sampler;
+    else if (!ImPlatform_Vulkan_QueueBufferUpload(buffer->block->buffer, buffer->offset, data, size))
     {
-        VkSamplerCreateInfo sampler_info = {};
-        sampler_info.sType      = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        sampler_info.magFilter  = VK_FILTER_LINEAR;
-        sampler_info.minFilter  = VK_FILTER_LINEAR;
-        sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-        sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-        sampler_info.maxAnisotropy = 1.0f;
-        sampler_info.minLod = -1000;
-        sampler_info.maxLod = 1000;
-        err = vkCreateSampler(g_GfxData.device, &sampler_info, g_Allocator, &sampler);
-        if (err != VK_SUCCESS) {
-            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
-            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            return NULL;
-        }
+        ImPlatform_BufferHeap_Free(buffer->block, buffer->offset, size);
+        delete buffer;
+        return NULL;
     }
+    return buffer;
+}
 
-    // Create render pass
-    VkRenderPass renderPass;
+static bool ImPlatform_Vulkan_UpdateBuffer(ImPlatform_BufferData_Vulkan* buffer, const void* data, VkDeviceSize byte_offset, VkDeviceSize byte_size)
+{
+    if (byte_size == 0)
+        return true;
+    if (byte_offset + byte_size > buffer->size)
+        return false;
+
+    if (!buffer->shadow)
+        return ImPlatform_Vulkan_QueueBufferUpload(buffer->block->buffer, buffer->offset + byte_offset, data, byte_size);
+
+    memcpy(buffer->shadow + byte_offset, data, (size_t)byte_size);
+    if (buffer->lastUseSerial <= g_CompletedSerial)
     {
-        VkAttachmentDescription attachment = {};
-        attachment.format         = format;
-        attachment.samples        = VK_SAMPLE_COUNT_1_BIT;
-        attachment.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
-        attachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
-        attachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-        attachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
-        attachment.finalLayout    = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        memcpy(buffer->block->mapped + buffer->offset + byte_offset, data, (size_t)byte_size);
+        return true;
+    }
 
-        VkAttachmentReference color_ref = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    // Still referenced by a frame in flight: rename to a fresh range
+    VkDeviceSize offset;
+    ImPlatform_BufferBlock_Vulkan* block = ImPlatform_BufferHeap_Alloc(buffer->size, true, &offset);
+    if (!block)
+        return false;
+    memcpy(block->mapped + offset, buffer->shadow, (size_t)buffer->size);
+    ImPlatform_BufferHeap_Retire(buffer->block, buffer->offset, buffer->size, buffer->lastUseSerial);
+    buffer->block = block;
+    buffer->offset = offset;
+    buffer->lastUseSerial = 0;
+    return true;
+}
 
-        VkSubpassDescription subpass = {};
-        subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
-        subpass.colorAttachmentCount = 1;
-        subpass.pColorAttachments    = &color_ref;
+static void ImPlatform_Vulkan_DestroyBuffer(ImPlatform_BufferData_Vulkan* buffer)
+{
+    if (g_BoundVertexBuffer == buffer)
+        g_BoundVertexBuffer = NULL;
+    if (g_BoundIndexBuffer == buffer)
+        g_BoundIndexBuffer = NULL;
+    if (g_BoundInstanceBuffer == buffer)
+        g_BoundInstanceBuffer = NULL;
+
+    // Static buffers may still have a copy queued into their range
+    uint64_t retire_serial = buffer->lastUseSerial;
+    if (!buffer->shadow && retire_serial < ImPlatform_Vulkan_NextUploadSerial())
+        retire_serial = ImPlatform_Vulkan_NextUploadSerial();
+    ImPlatform_BufferHeap_Retire(buffer->block, buffer->offset, buffer->size, retire_serial);
+
+    free(buffer->shadow);
+    delete[] buffer->attributes;
+    delete buffer;
+}
 
-        VkSubpassDependency dep = {};
-        dep.srcSubpass    = VK_SUBPASS_EXTERNAL;
-        dep.dstSubpass    = 0;
-        dep.srcStageMask  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-        dep.dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dep.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-        dep.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+IMPLATFORM_API ImPlatform_VertexBuffer ImPlatform_CreateVertexBuffer(const void* vertex_data, const ImPlatform_VertexBufferDesc* desc)
+{
+    if (!desc || !vertex_data)
+        return NULL;
 
-        VkRenderPassCreateInfo rp_info = {};
-        rp_info.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-        rp_info.attachmentCount = 1;
-        rp_info.pAttachments    = &attachment;
-        rp_info.subpassCount    = 1;
-        rp_info.pSubpasses      = &subpass;
-        rp_info.dependencyCount = 1;
-        rp_info.pDependencies   = &dep;
-        err = vkCreateRenderPass(g_GfxData.device, &rp_info, g_Allocator, &renderPass);
-        if (err != VK_SUCCESS) {
-            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
-            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
-            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            return NULL;
-        }
-    }
+    ImPlatform_BufferData_Vulkan* buffer = ImPlatform_Vulkan_CreateBuffer(vertex_data, (VkDeviceSize)desc->vertex_count * desc->vertex_stride, desc->usage);
+    if (!buffer)
+        return NULL;
+    buffer->vb_desc = *desc;
 
-    // Create framebuffer
-    VkFramebuffer framebuffer;
+    // Copy attribute array
+    if (desc->attribute_count > 0 && desc->attributes)
     {
-        VkFramebufferCreateInfo fb_info = {};
-        fb_info.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-        fb_info.renderPass      = renderPass;
-        fb_info.attachmentCount = 1;
-        fb_info.pAttachments    = &imageView;
-        fb_info.width           = desc->width;
-        fb_info.height          = desc->height;
-        fb_info.layers          = 1;
-        err = vkCreateFramebuffer(g_GfxData.device, &fb_info, g_Allocator, &framebuffer);
-        if (err != VK_SUCCESS) {
-            vkDestroyRenderPass(g_GfxData.device, renderPass, g_Allocator);
-            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
-            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
-            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            return NULL;
-        }
+        buffer->attributes = new ImPlatform_VertexAttribute[desc->attribute_count];
+        memcpy(buffer->attributes, desc->attributes, sizeof(ImPlatform_VertexAttribute) * desc->attribute_count);
+        buffer->vb_desc.attributes = buffer->attributes;
     }
 
-    // Create dedicated command pool + command buffer for standalone rendering
-    VkCommandPool commandPool;
-    VkCommandBuffer commandBuffer;
-    {
-        VkCommandPoolCreateInfo pool_info = {};
-        pool_info.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        pool_info.queueFamilyIndex = g_QueueFamily;
-        pool_info.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        err = vkCreateCommandPool(g_GfxData.device, &pool_info, g_Allocator, &commandPool);
-        if (err != VK_SUCCESS) {
-            vkDestroyFramebuffer(g_GfxData.device, framebuffer, g_Allocator);
-            vkDestroyRenderPass(g_GfxData.device, renderPass, g_Allocator);
-            vkDestroySampler(g_GfxData.device, sampler, g_Allocator);
-            vkDestroyImageView(g_GfxData.device, imageView, g_Allocator);
-            vkFreeMemory(g_GfxData.device, imageMemory, g_Allocator);
-            vkDestroyImage(g_GfxData.device, image, g_Allocator);
-            return NULL;
-        }
+    return (ImPlatform_VertexBuffer)buffer;
+}
 
-        VkCommandBufferAllocateInfo alloc_info = {};
-        alloc_info.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        alloc_info.commandPool        = commandPool;
-        alloc_info.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        alloc_info.commandBufferCount = 1;
-        vkAllocateCommandBuffers(g_GfxData.device, &alloc_info, &commandBuffer);
-    }
+IMPLATFORM_API bool ImPlatform_UpdateVertexBuffer(ImPlatform_VertexBuffer buffer, const void* vertex_data, unsigned int offset, unsigned int count)
+{
+    if (!buffer || !vertex_data)
+        return false;
 
-    // Register with ImGui for use as a shader input
-    VkDescriptorSet descriptorSet = (VkDescriptorSet)ImGui_ImplVulkan_AddTexture(
-        sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    ImPlatform_BufferData_Vulkan* buf = (ImPlatform_BufferData_Vulkan*)buffer;
+    VkDeviceSize stride = buf->vb_desc.vertex_stride;
+    return ImPlatform_Vulkan_UpdateBuffer(buf, vertex_data, offset * stride, count * stride);
+}
 
-    ImPlatform_RTTracking_Vulkan* entry = new ImPlatform_RTTracking_Vulkan();
-    entry->image         = image;
-    entry->imageMemory   = imageMemory;
-    entry->imageView     = imageView;
-    entry->sampler       = sampler;
-    entry->descriptorSet = descriptorSet;
-    entry->renderPass    = renderPass;
-    entry->framebuffer   = framebuffer;
-    entry->commandPool   = commandPool;
-    entry->commandBuffer = commandBuffer;
-    entry->width         = desc->width;
-    entry->height        = desc->height;
-    entry->format        = format;
-    entry->next          = g_RTTrackingHead;
-    g_RTTrackingHead     = entry;
+IMPLATFORM_API void ImPlatform_DestroyVertexBuffer(ImPlatform_VertexBuffer buffer)
+{
+    if (!buffer)
+        return;
 
-    return (ImTextureID)descriptorSet;
+    ImPlatform_Vulkan_DestroyBuffer((ImPlatform_BufferData_Vulkan*)buffer);
 }
 
-IMPLATFORM_API bool ImPlatform_BeginRenderToTexture(ImTextureID texture)
+IMPLATFORM_API ImPlatform_IndexBuffer ImPlatform_CreateIndexBuffer(const void* index_data, const ImPlatform_IndexBufferDesc* desc)
+{
+    if (!desc || !index_data)
+        return NULL;
+
+    ImPlatform_BufferData_Vulkan* buffer = ImPlatform_Vulkan_CreateBuffer(index_data, (VkDeviceSize)desc->index_count * ImPlatform_Vulkan_IndexSize(desc->format), desc->usage);
+    if (!buffer)
+        return NULL;
+    buffer->ib_desc = *desc;
+
+    return (ImPlatform_IndexBuffer)buffer;
+}
+
+IMPLATFORM_API bool ImPlatform_UpdateIndexBuffer(ImPlatform_IndexBuffer buffer, const void* index_data, unsigned int offset, unsigned int count)
 {
-    if (!texture || !g_GfxData.device)
+    if (!buffer || !index_data)
         return false;
 
-    VkDescriptorSet ds = (VkDescriptorSet)texture;
-    ImPlatform_RTTracking_Vulkan* entry = g_RTTrackingHead;
-    while (entry) { if (entry->descriptorSet == ds) break; entry = entry->next; }
-    if (!entry) return false;
+    ImPlatform_BufferData_Vulkan* buf = (ImPlatform_BufferData_Vulkan*)buffer;
+    VkDeviceSize index_size = ImPlatform_Vulkan_IndexSize(buf->ib_desc.format);
+    return ImPlatform_Vulkan_UpdateBuffer(buf, index_data, offset * index_size, count * index_size);
+}
 
-    // Begin the dedicated command buffer
-    vkResetCommandBuffer(entry->commandBuffer, 0);
-    VkCommandBufferBeginInfo begin_info = {};
-    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    VkResult err = vkBeginCommandBuffer(entry->commandBuffer, &begin_info);
-    if (err != VK_SUCCESS) return false;
+IMPLATFORM_API void ImPlatform_DestroyIndexBuffer(ImPlatform_IndexBuffer buffer)
+{
+    if (!buffer)
+        return;
 
-    // Begin render pass (loadOp = CLEAR handles the clear)
-    VkClearValue clear_value = {};
-    VkRenderPassBeginInfo rp_info = {};
-    rp_info.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    rp_info.renderPass               = entry->renderPass;
-    rp_info.framebuffer              = entry->framebuffer;
-    rp_info.renderArea.extent.width  = entry->width;
-    rp_info.renderArea.extent.height = entry->height;
-    rp_info.clearValueCount          = 1;
-    rp_info.pClearValues             = &clear_value;
-    vkCmdBeginRenderPass(entry->commandBuffer, &rp_info, VK_SUBPASS_CONTENTS_INLINE);
+    ImPlatform_Vulkan_DestroyBuffer((ImPlatform_BufferData_Vulkan*)buffer);
+}
 
-    VkViewport viewport = { 0, 0, (float)entry->width, (float)entry->height, 0.f, 1.f };
-    vkCmdSetViewport(entry->commandBuffer, 0, 1, &viewport);
+IMPLATFORM_API void ImPlatform_BindVertexBuffer(ImPlatform_VertexBuffer vertex_buffer)
+{
+    g_BoundVertexBuffer = (ImPlatform_BufferData_Vulkan*)vertex_buffer;
+}
 
-    VkRect2D scissor = { {0, 0}, {entry->width, entry->height} };
-    vkCmdSetScissor(entry->commandBuffer, 0, 1, &scissor);
+IMPLATFORM_API void ImPlatform_BindIndexBuffer(ImPlatform_IndexBuffer index_buffer)
+{
+    g_BoundIndexBuffer = (ImPlatform_BufferData_Vulkan*)index_buffer;
+}
 
-    g_ActiveRTEntry = entry;
+// Only records the bindings: Dynamic/Stream buffers may be renamed by an
+// update, the ranges are resolved when the draw is recorded.
+IMPLATFORM_API void ImPlatform_BindBuffers(ImPlatform_VertexBuffer vertex_buffer, ImPlatform_IndexBuffer index_buffer)
+{
+    ImPlatform_BindVertexBuffer(vertex_buffer);
+    ImPlatform_BindIndexBuffer(index_buffer);
+}
+
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer instance_buffer)
+{
+    g_BoundInstanceBuffer = (ImPlatform_BufferData_Vulkan*)instance_buffer;
+}
+
+// Binds the pipeline and the bound buffers for a draw, reading per-instance data
+// from `instance` when set
+static bool ImPlatform_Vulkan_PrepareDraw(unsigned int primitive_type, ImPlatform_BufferData_Vulkan* instance)
+{
+    VkCommandBuffer command_buffer = g_CurrentCommandBuffer;
+    if (!ImPlatform_Vulkan_BindDrawPipeline(g_BoundVertexBuffer, instance, primitive_type))
+        return false;
+
+    VkBuffer buffers[2] = { g_BoundVertexBuffer->block->buffer, instance ? instance->block->buffer : VK_NULL_HANDLE };
+    VkDeviceSize offsets[2] = { g_BoundVertexBuffer->offset, instance ? instance->offset : 0 };
+    vkCmdBindVertexBuffers(command_buffer, 0, instance ? 2 : 1, buffers, offsets);
+    VkIndexType index_type = g_BoundIndexBuffer->ib_desc.format == ImPlatform_IndexFormat_UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    vkCmdBindIndexBuffer(command_buffer, g_BoundIndexBuffer->block->buffer, g_BoundIndexBuffer->offset, index_type);
+
+    // The frame being recorded will be submitted with the next serial
+    g_BoundVertexBuffer->lastUseSerial = g_SubmitSerial + 1;
+    g_BoundIndexBuffer->lastUseSerial = g_SubmitSerial + 1;
+    if (instance)
+        instance->lastUseSerial = g_SubmitSerial + 1;
     return true;
 }
 
-IMPLATFORM_API void ImPlatform_EndRenderToTexture(void)
+// Records an indexed draw of the bound buffers
+static void ImPlatform_Vulkan_DrawIndexed(unsigned int primitive_type, unsigned int index_count, unsigned int start_index,
+                                          ImPlatform_BufferData_Vulkan* instance, unsigned int instance_count, unsigned int start_instance)
 {
-    if (!g_ActiveRTEntry) return;
+    if (!g_BoundVertexBuffer || !g_BoundIndexBuffer || g_CurrentCommandBuffer == VK_NULL_HANDLE || instance_count == 0)
+        return;
 
-    ImPlatform_RTTracking_Vulkan* entry = g_ActiveRTEntry;
-    g_ActiveRTEntry = NULL;
+    // Use all indices if count is 0
+    unsigned int total = g_BoundIndexBuffer->ib_desc.index_count;
+    if (index_count == 0)
+        index_count = total;
+    if (start_index >= total)
+        return;
+    if (index_count > total - start_index)
+        index_count = total - start_index;
+
+    if (!ImPlatform_Vulkan_PrepareDraw(primitive_type, instance))
+        return;
+
+    vkCmdDrawIndexed(g_CurrentCommandBuffer, index_count, instance_count, start_index, 0, start_instance);
+}
+
+IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned int index_count, unsigned int start_index)
+{
+    ImPlatform_Vulkan_DrawIndexed(primitive_type, index_count, start_index, NULL, 1, 0);
+}
+
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int primitive_type, unsigned int index_count, unsigned int start_index,
+                                                    unsigned int instance_count, unsigned int start_instance)
+{
+    ImPlatform_Vulkan_DrawIndexed(primitive_type, index_count, start_index, g_BoundInstanceBuffer, instance_count, start_instance);
+}
+
+// Indirect buffers live in the same heap as vertex/index buffers. A batch is one
+// vkCmdDrawIndexedIndirect when the device has multiDrawIndirect, one call per
+// record otherwise (the arguments are still read by the GPU).
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* args, unsigned int draw_count, ImPlatform_BufferUsage usage)
+{
+    if (!args || draw_count == 0)
+        return NULL;
+
+    ImPlatform_BufferData_Vulkan* buffer = ImPlatform_Vulkan_CreateBuffer(args, (VkDeviceSize)draw_count * sizeof(ImPlatform_DrawIndexedIndirectArgs), usage);
+    if (!buffer)
+        return NULL;
+    buffer->draw_count = draw_count;
 
-    vkCmdEndRenderPass(entry->commandBuffer);
-    vkEndCommandBuffer(entry->commandBuffer);
+    return (ImPlatform_IndirectBuffer)buffer;
+}
+
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer buffer, const ImPlatform_DrawIndexedIndirectArgs* args, unsigned int offset, unsigned int count)
+{
+    if (!buffer || !args)
+        return false;
 
-    VkSubmitInfo submit_info = {};
-    submit_info.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.commandBufferCount = 1;
-    submit_info.pCommandBuffers    = &entry->commandBuffer;
-    vkQueueSubmit(g_GfxData.queue, 1, &submit_info, VK_NULL_HANDLE);
-    vkQueueWaitIdle(g_GfxData.queue);
+    ImPlatform_BufferData_Vulkan* buf = (ImPlatform_BufferData_Vulkan*)buffer;
+    const VkDeviceSize stride = sizeof(ImPlatform_DrawIndexedIndirectArgs);
+    return ImPlatform_Vulkan_UpdateBuffer(buf, args, offset * stride, count * stride);
 }
 
-IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst) { (void)dst; return false; }
-IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height)
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer buffer)
 {
-    if (width)  *width  = g_ImPlatform_BackbufferW;
-    if (height) *height = g_ImPlatform_BackbufferH;
-}
+    if (!buffer)
+        return;
 
-IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
-{
-    // Vulkan texture copy requires proper image tracking which is not yet implemented
-    // in this backend (see DestroyTexture note below).
-    (void)dst; (void)src;
-    return false;
+    ImPlatform_Vulkan_DestroyBuffer((ImPlatform_BufferData_Vulkan*)buffer);
 }
 
-IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int primitive_type, ImPlatform_IndirectBuffer indirect_buffer, unsigned int first_draw, unsigned int draw_count)
 {
-    if (!texture_id)
+    ImPlatform_BufferData_Vulkan* buf = (ImPlatform_BufferData_Vulkan*)indirect_buffer;
+    if (!buf || !g_BoundVertexBuffer || !g_BoundIndexBuffer || g_CurrentCommandBuffer == VK_NULL_HANDLE || first_draw >= buf->draw_count)
+        return;
+    if (draw_count > buf->draw_count - first_draw)
+        draw_count = buf->draw_count - first_draw;
+    if (draw_count == 0)
         return;
 
-    // Remove from ImGui's texture registry
-    VkDescriptorSet descriptor_set = (VkDescriptorSet)texture_id;
-    ImGui_ImplVulkan_RemoveTexture(descriptor_set);
+    if (!ImPlatform_Vulkan_PrepareDraw(primitive_type, g_BoundInstanceBuffer))
+        return;
 
-    // Note: We're not cleaning up the image, image_memory, image_view, or sampler
-    // because we don't track them. A production implementation would need proper tracking.
+    buf->lastUseSerial = g_SubmitSerial + 1;
+    const uint32_t stride = (uint32_t)sizeof(ImPlatform_DrawIndexedIndirectArgs);
+    // 65535 is the minimum maxDrawIndirectCount guaranteed with multiDrawIndirect
+    const unsigned int max_batch = g_EnabledFeatures.multiDrawIndirect ? 65535u : 1u;
+    VkDeviceSize offset = buf->offset + (VkDeviceSize)first_draw * stride;
+    while (draw_count > 0)
+    {
+        unsigned int batch = draw_count < max_batch ? draw_count : max_batch;
+        vkCmdDrawIndexedIndirect(g_CurrentCommandBuffer, buf->block->buffer, offset, batch, stride);
+        offset += (VkDeviceSize)batch * stride;
+        draw_count -= batch;
+    }
 }
 
-// ============================================================================
-// Custom Vertex/Index Buffer Management API - Vulkan (Stubs)
-// ============================================================================
-
-IMPLATFORM_API ImPlatform_VertexBuffer ImPlatform_CreateVertexBuffer(const void* /*vertex_data*/, const ImPlatform_VertexBufferDesc* /*desc*/) { return NULL; }
-IMPLATFORM_API bool ImPlatform_UpdateVertexBuffer(ImPlatform_VertexBuffer /*vertex_buffer*/, const void* /*vertex_data*/, unsigned int /*vertex_count*/, unsigned int /*offset*/) { return false; }
-IMPLATFORM_API void ImPlatform_DestroyVertexBuffer(ImPlatform_VertexBuffer /*vertex_buffer*/) {}
-IMPLATFORM_API ImPlatform_IndexBuffer ImPlatform_CreateIndexBuffer(const void* /*index_data*/, const ImPlatform_IndexBufferDesc* /*desc*/) { return NULL; }
-IMPLATFORM_API bool ImPlatform_UpdateIndexBuffer(ImPlatform_IndexBuffer /*index_buffer*/, const void* /*index_data*/, unsigned int /*index_count*/, unsigned int /*offset*/) { return false; }
-IMPLATFORM_API void ImPlatform_DestroyIndexBuffer(ImPlatform_IndexBuffer /*index_buffer*/) {}
-IMPLATFORM_API void ImPlatform_BindVertexBuffer(ImPlatform_VertexBuffer /*vertex_buffer*/) {}
-IMPLATFORM_API void ImPlatform_BindIndexBuffer(ImPlatform_IndexBuffer /*index_buffer*/) {}
-IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/) {}
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
 
 // ============================================================================
 // Custom Shader System - Vulkan
@@ -1741,10 +3942,192 @@ struct ImPlatform_ShaderData_Vulkan
 {
     VkShaderModule shaderModule;
     ImPlatform_ShaderStage stage;
+    ImPlatform_ShaderNameTable members;  // Push constant members past the projection: name -> offset from 64, size
+    unsigned int members_end;            // End of the last reflected member, relative to offset 64
+    int refs;                            // The handle plus each program built from the module
+};
+
+// Drops a reference; the module goes once neither the handle nor a program uses it
+static void ImPlatform_Vulkan_ReleaseShaderData(ImPlatform_ShaderData_Vulkan* shader_data)
+{
+    IM_ASSERT(shader_data->refs > 0);
+    if (--shader_data->refs > 0)
+        return;
+    if (shader_data->shaderModule)
+        vkDestroyShaderModule(g_GfxData.device, shader_data->shaderModule, g_Allocator);
+    ImPlatform_ShaderNameTable_Free(&shader_data->members);
+    free(shader_data);
+}
+
+// SPIR-V opcodes, decorations and storage class used by the push constant reflection
+#define IMPLATFORM_SPV_OP_MEMBER_NAME       6
+#define IMPLATFORM_SPV_OP_TYPE_BOOL         20
+#define IMPLATFORM_SPV_OP_TYPE_INT          21
+#define IMPLATFORM_SPV_OP_TYPE_FLOAT        22
+#define IMPLATFORM_SPV_OP_TYPE_VECTOR       23
+#define IMPLATFORM_SPV_OP_TYPE_MATRIX       24
+#define IMPLATFORM_SPV_OP_TYPE_ARRAY        28
+#define IMPLATFORM_SPV_OP_TYPE_STRUCT       30
+#define IMPLATFORM_SPV_OP_TYPE_POINTER      32
+#define IMPLATFORM_SPV_OP_CONSTANT          43
+#define IMPLATFORM_SPV_OP_VARIABLE          59
+#define IMPLATFORM_SPV_OP_DECORATE          71
+#define IMPLATFORM_SPV_OP_MEMBER_DECORATE   72
+#define IMPLATFORM_SPV_DECORATION_ARRAY_STRIDE  6
+#define IMPLATFORM_SPV_DECORATION_MATRIX_STRIDE 7
+#define IMPLATFORM_SPV_DECORATION_OFFSET        35
+#define IMPLATFORM_SPV_STORAGE_PUSH_CONSTANT    9
+
+// Size in bytes of a SPIR-V type, 0 when unknown (nested structs, runtime arrays).
+// `defs` maps result ids to the word index of their defining instruction.
+static unsigned int ImPlatform_Vulkan_SpirvTypeSize(const uint32_t* words, const uint32_t* defs, const uint32_t* array_strides,
+                                                    uint32_t bound, uint32_t type_id, uint32_t matrix_stride, int depth)
+{
+    if (type_id >= bound || !defs[type_id] || depth > 8)
+        return 0;
+    const uint32_t* op = words + defs[type_id];
+    switch (op[0] & 0xFFFFu)
+    {
+    case IMPLATFORM_SPV_OP_TYPE_BOOL:
+        return 4;
+    case IMPLATFORM_SPV_OP_TYPE_INT:
+    case IMPLATFORM_SPV_OP_TYPE_FLOAT:
+        return op[2] / 8;
+    case IMPLATFORM_SPV_OP_TYPE_VECTOR:
+        return op[3] * ImPlatform_Vulkan_SpirvTypeSize(words, defs, array_strides, bound, op[2], 0, depth + 1);
+    case IMPLATFORM_SPV_OP_TYPE_MATRIX:
+        if (matrix_stride)
+            return op[3] * matrix_stride;
+        return op[3] * ImPlatform_Vulkan_SpirvTypeSize(words, defs, array_strides, bound, op[2], 0, depth + 1);
+    case IMPLATFORM_SPV_OP_TYPE_ARRAY:
+    {
+        const uint32_t length_id = op[3];
+        if (length_id >= bound || !defs[length_id] || (words[defs[length_id]] & 0xFFFFu) != IMPLATFORM_SPV_OP_CONSTANT)
+            return 0;
+        const uint32_t length = words[defs[length_id] + 3];
+        const uint32_t stride = array_strides[type_id] ? array_strides[type_id]
+                                                       : ImPlatform_Vulkan_SpirvTypeSize(words, defs, array_strides, bound, op[2], matrix_stride, depth + 1);
+        return length * stride;
+    }
+    default:
+        return 0;
+    }
+}
+
+// Records the named members of the push constant block declared by `words`. Only
+// members past the projection matrix are kept, with offsets relative to 64 (the
+// start of the data pushed by EndUniformBlock). Returns false on malformed SPIR-V.
+static bool ImPlatform_Vulkan_ReflectPushConstants(const uint32_t* words, size_t word_count, ImPlatform_ShaderData_Vulkan* shader_data)
+{
+    if (word_count < 5 || words[0] != 0x07230203u)
+        return false;
+    const uint32_t bound = words[3];
+    if (bound == 0 || bound > 0x400000u)
+        return false;
+
+    uint32_t* defs = (uint32_t*)calloc(bound, sizeof(uint32_t) * 2);
+    if (!defs)
+        return false;
+    uint32_t* array_strides = defs + bound;
+
+    // Pass 1: type / constant definitions, array strides and the push constant variable
+    uint32_t block_type = 0;
+    bool valid = true;
+    for (size_t i = 5; i < word_count;)
+    {
+        const uint32_t opcode = words[i] & 0xFFFFu;
+        const uint32_t length = words[i] >> 16;
+        if (length == 0 || i + length > word_count)
+        {
+            valid = false;
+            break;
+        }
+        const uint32_t* op = words + i;
+        if (opcode >= IMPLATFORM_SPV_OP_TYPE_BOOL && opcode <= IMPLATFORM_SPV_OP_TYPE_POINTER && length >= 2 && op[1] < bound)
+            defs[op[1]] = (uint32_t)i;
+        else if (opcode == IMPLATFORM_SPV_OP_CONSTANT && length >= 4 && op[2] < bound)
+            defs[op[2]] = (uint32_t)i;
+        else if (opcode == IMPLATFORM_SPV_OP_DECORATE && length >= 4 && op[2] == IMPLATFORM_SPV_DECORATION_ARRAY_STRIDE && op[1] < bound)
+            array_strides[op[1]] = op[3];
+        else if (opcode == IMPLATFORM_SPV_OP_VARIABLE && length >= 4 && op[3] == IMPLATFORM_SPV_STORAGE_PUSH_CONSTANT && op[1] < bound && defs[op[1]])
+            block_type = words[defs[op[1]] + 3];
+        i += length;
+    }
+
+    const uint32_t* block = (valid && block_type && block_type < bound && defs[block_type]) ? words + defs[block_type] : NULL;
+    if (block && (block[0] & 0xFFFFu) == IMPLATFORM_SPV_OP_TYPE_STRUCT)
+    {
+        const uint32_t member_count = (block[0] >> 16) - 2;
+        uint32_t* offsets = (uint32_t*)calloc(member_count ? member_count : 1, sizeof(uint32_t) * 3);
+        const uint32_t** names = (const uint32_t**)calloc(member_count ? member_count : 1, sizeof(const uint32_t*));
+        if (offsets && names)
+        {
+            uint32_t* matrix_strides = offsets + member_count;
+            uint32_t* name_lengths = offsets + member_count * 2;
+
+            // Pass 2: member names and layout decorations of the block
+            for (size_t i = 5; i < word_count; i += words[i] >> 16)
+            {
+                const uint32_t opcode = words[i] & 0xFFFFu;
+                const uint32_t length = words[i] >> 16;
+                const uint32_t* op = words + i;
+                if (length < 4 || op[1] != block_type || op[2] >= member_count)
+                    continue;
+                if (opcode == IMPLATFORM_SPV_OP_MEMBER_NAME)
+                {
+                    names[op[2]] = op + 3;
+                    name_lengths[op[2]] = (uint32_t)strnlen((const char*)(op + 3), (length - 3) * sizeof(uint32_t));
+                }
+                else if (opcode == IMPLATFORM_SPV_OP_MEMBER_DECORATE && length >= 5)
+                {
+                    if (op[3] == IMPLATFORM_SPV_DECORATION_OFFSET)
+                        offsets[op[2]] = op[4];
+                    else if (op[3] == IMPLATFORM_SPV_DECORATION_MATRIX_STRIDE)
+                        matrix_strides[op[2]] = op[4];
+                }
+            }
+
+            const uint32_t end = IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET + IMPLATFORM_VULKAN_MAX_SHADER_CONSTANTS;
+            for (uint32_t m = 0; m < member_count; m++)
+            {
+                if (!names[m] || name_lengths[m] == 0 || offsets[m] < IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET || offsets[m] >= end)
+                    continue;
+                unsigned int size = ImPlatform_Vulkan_SpirvTypeSize(words, defs, array_strides, bound, block[2 + m], matrix_strides[m], 0);
+                if (size == 0 || offsets[m] + size > end)
+                    size = end - offsets[m];
+                const unsigned int offset = offsets[m] - IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET;
+                ImPlatform_ShaderNameTable_AddN(&shader_data->members, (const char*)names[m], name_lengths[m], (int)offset, size);
+                if (offset + size > shader_data->members_end)
+                    shader_data->members_end = offset + size;
+            }
+        }
+        free(offsets);
+        free(names);
+    }
+
+    free(defs);
+    return valid;
+}
+
+#define IMPLATFORM_VULKAN_MAX_VERTEX_ATTRIBUTES 16
+
+// Topology, binding count, 2 bindings and the attributes, 3 words each
+#define IMPLATFORM_VULKAN_VARIANT_STATE_WORDS (2 + 2 * 3 + IMPLATFORM_VULKAN_MAX_VERTEX_ATTRIBUTES * 3)
+
+// Pipeline of a program specialised for a vertex layout and topology
+struct ImPlatform_PipelineVariant_Vulkan
+{
+    uint64_t key;                   // Hash of state, compared first
+    uint32_t state[IMPLATFORM_VULKAN_VARIANT_STATE_WORDS];
+    uint32_t state_size;            // Words used in state
+    VkPipeline pipeline;
+    ImPlatform_PipelineVariant_Vulkan* next;
 };
 
 struct ImPlatform_ShaderProgramData_Vulkan
 {
+    ImPlatform_ShaderData_Vulkan* vertShader;    // Referenced: variants and pipeline workers read the modules
+    ImPlatform_ShaderData_Vulkan* fragShader;    // after the user may have destroyed the shaders
     VkShaderModule vertShaderModule;
     VkShaderModule fragShaderModule;
     VkPipeline pipeline;
@@ -1757,8 +4140,14 @@ struct ImPlatform_ShaderProgramData_Vulkan
     void* uniformBufferMapped;
     size_t uniformBufferSize;
     bool uniformBufferDirty;
+    ImPlatform_ShaderNameTable uniformMembers;   // Reflected push constant members of both stages
+    ImPlatform_PipelineVariant_Vulkan* variants; // Pipelines for custom vertex layouts / topologies
+    struct ImPlatform_PipelineJob_Vulkan* pendingJob; // Pipeline being created by a worker (async programs)
 };
 
+// Drawn in place of programs whose pipeline is still being created
+static ImPlatform_ShaderProgramData_Vulkan* g_FallbackProgram = NULL;
+
 // Custom Shader System API - Vulkan
 //
 // Caching strategy:
@@ -1797,6 +4186,11 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
 
     memset(shader_data, 0, sizeof(ImPlatform_ShaderData_Vulkan));
     shader_data->stage = desc->stage;
+    shader_data->refs = 1;
+
+    // Uniform names are resolved against the push constant block once, here
+    if ((desc->bytecode_size & 3) == 0)
+        ImPlatform_Vulkan_ReflectPushConstants((const uint32_t*)desc->bytecode, desc->bytecode_size / sizeof(uint32_t), shader_data);
 
     // Create shader module from SPIR-V bytecode
     VkShaderModuleCreateInfo create_info = {};
@@ -1820,15 +4214,430 @@ IMPLATFORM_API void ImPlatform_DestroyShader(ImPlatform_Shader shader)
     if (!shader)
         return;
 
-    ImPlatform_ShaderData_Vulkan* shader_data = (ImPlatform_ShaderData_Vulkan*)shader;
+    // Programs built from the shader keep the module until they are destroyed
+    ImPlatform_Vulkan_ReleaseShaderData((ImPlatform_ShaderData_Vulkan*)shader);
+}
 
-    if (shader_data->shaderModule)
-        vkDestroyShaderModule(g_GfxData.device, shader_data->shaderModule, g_Allocator);
+// Creates a graphics pipeline for `program_data` with the given vertex input and topology
+static VkResult ImPlatform_Vulkan_CreateProgramPipeline(ImPlatform_ShaderProgramData_Vulkan* program_data,
+                                                        const VkPipelineVertexInputStateCreateInfo* vertex_info,
+                                                        VkPrimitiveTopology topology, VkPipeline* out_pipeline)
+{
+    VkPipelineShaderStageCreateInfo stage[2] = {};
+    stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage[0].module = program_data->vertShaderModule;
+    stage[0].pName = "main";
+    stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stage[1].module = program_data->fragShaderModule;
+    stage[1].pName = "main";
+
+    VkPipelineInputAssemblyStateCreateInfo ia_info = {};
+    ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    ia_info.topology = topology;
+
+    VkPipelineViewportStateCreateInfo viewport_info = {};
+    viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_info.viewportCount = 1;
+    viewport_info.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo raster_info = {};
+    raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    raster_info.polygonMode = VK_POLYGON_MODE_FILL;
+    raster_info.cullMode = VK_CULL_MODE_NONE;
+    raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    raster_info.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo ms_info = {};
+    ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    ms_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineColorBlendAttachmentState color_attachment = {};
+    color_attachment.blendEnable = VK_TRUE;
+    color_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    color_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    color_attachment.colorBlendOp = VK_BLEND_OP_ADD;
+    color_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    color_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    color_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    color_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    VkPipelineDepthStencilStateCreateInfo depth_info = {};
+    depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+
+    VkPipelineColorBlendStateCreateInfo blend_info = {};
+    blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blend_info.attachmentCount = 1;
+    blend_info.pAttachments = &color_attachment;
+
+    VkDynamicState dynamic_states[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamic_state = {};
+    dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamic_state.dynamicStateCount = 2;
+    dynamic_state.pDynamicStates = dynamic_states;
+
+    VkGraphicsPipelineCreateInfo pipeline_info = {};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_info.flags = 0; // No special flags needed
+    pipeline_info.stageCount = 2;
+    pipeline_info.pStages = stage;
+    pipeline_info.pVertexInputState = vertex_info;
+    pipeline_info.pInputAssemblyState = &ia_info;
+    pipeline_info.pViewportState = &viewport_info;
+    pipeline_info.pRasterizationState = &raster_info;
+    pipeline_info.pMultisampleState = &ms_info;
+    pipeline_info.pDepthStencilState = &depth_info;
+    pipeline_info.pColorBlendState = &blend_info;
+    pipeline_info.pDynamicState = &dynamic_state;
+    pipeline_info.layout = program_data->pipelineLayout;
+    pipeline_info.renderPass = g_PipelineRenderPass;
+    pipeline_info.subpass = 0;
+
+    // Pass the global pipeline cache so this pipeline's compiled state can
+    // be reused across runs (see ImPlatform_Vulkan_InitPipelineCache above).
+    return vkCreateGraphicsPipelines(g_GfxData.device, g_VulkanPipelineCache, 1, &pipeline_info, g_Allocator, out_pipeline);
+}
 
-    free(shader_data);
+// Creates the program's pipeline for ImDrawVert triangle lists (ImGui's vertex layout)
+static VkResult ImPlatform_Vulkan_CreateDefaultPipeline(ImPlatform_ShaderProgramData_Vulkan* program_data, VkPipeline* out_pipeline)
+{
+    VkVertexInputBindingDescription binding_desc = {};
+    binding_desc.stride = sizeof(ImDrawVert);
+    binding_desc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    VkVertexInputAttributeDescription attribute_desc[3] = {};
+    attribute_desc[0].location = 0;
+    attribute_desc[0].binding = 0;
+    attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+    attribute_desc[0].offset = offsetof(ImDrawVert, pos);
+    attribute_desc[1].location = 1;
+    attribute_desc[1].binding = 0;
+    attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+    attribute_desc[1].offset = offsetof(ImDrawVert, uv);
+    attribute_desc[2].location = 2;
+    attribute_desc[2].binding = 0;
+    attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+    attribute_desc[2].offset = offsetof(ImDrawVert, col);
+
+    VkPipelineVertexInputStateCreateInfo vertex_info = {};
+    vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_info.vertexBindingDescriptionCount = 1;
+    vertex_info.pVertexBindingDescriptions = &binding_desc;
+    vertex_info.vertexAttributeDescriptionCount = 3;
+    vertex_info.pVertexAttributeDescriptions = attribute_desc;
+
+    return ImPlatform_Vulkan_CreateProgramPipeline(program_data, &vertex_info, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, out_pipeline);
 }
 
-IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+// -----------------------------------------------------------------------------
+// Pipeline workers (ImPlatform_CreateShaderProgramAsync)
+// -----------------------------------------------------------------------------
+// Default pipelines of async programs are created on worker threads. The global
+// VkPipelineCache is internally synchronized, so the workers share it. Results are
+// picked up on the render thread when the program is next polled.
+
+enum
+{
+    ImPlatform_PipelineJobState_Queued = 0,
+    ImPlatform_PipelineJobState_Running,
+    ImPlatform_PipelineJobState_Done,
+    ImPlatform_PipelineJobState_Cancelled,
+};
+
+struct ImPlatform_PipelineJob_Vulkan
+{
+    ImPlatform_ShaderProgramData_Vulkan* program;  // Only its modules and layout are read by the worker
+    std::atomic<int> state;
+    VkResult result;
+    VkPipeline pipeline;
+    ImPlatform_PipelineJob_Vulkan* next;           // Queue link, guarded by g_PipelineWorkers.mutex
+};
+
+struct ImPlatform_PipelineWorkers_Vulkan
+{
+    std::mutex mutex;
+    std::condition_variable cond;
+    ImPlatform_PipelineJob_Vulkan* head;
+    ImPlatform_PipelineJob_Vulkan* tail;
+    std::thread* threads;
+    unsigned int thread_count;
+    bool quit;
+};
+static ImPlatform_PipelineWorkers_Vulkan g_PipelineWorkers;
+
+static void ImPlatform_Vulkan_PipelineWorker(void)
+{
+    for (;;)
+    {
+        ImPlatform_PipelineJob_Vulkan* job;
+        {
+            std::unique_lock<std::mutex> lock(g_PipelineWorkers.mutex);
+            g_PipelineWorkers.cond.wait(lock, [] { return g_PipelineWorkers.quit || g_PipelineWorkers.head != NULL; });
+            if (g_PipelineWorkers.quit)
+                return;
+            job = g_PipelineWorkers.head;
+            g_PipelineWorkers.head = job->next;
+            if (!g_PipelineWorkers.head)
+                g_PipelineWorkers.tail = NULL;
+            job->state.store(ImPlatform_PipelineJobState_Running, std::memory_order_relaxed);
+        }
+        job->result = ImPlatform_Vulkan_CreateDefaultPipeline(job->program, &job->pipeline);
+        job->state.store(ImPlatform_PipelineJobState_Done, std::memory_order_release);
+    }
+}
+
+static bool ImPlatform_Vulkan_SubmitPipelineJob(ImPlatform_PipelineJob_Vulkan* job)
+{
+    std::lock_guard<std::mutex> lock(g_PipelineWorkers.mutex);
+    if (!g_PipelineWorkers.threads)
+    {
+        // Leave a core to the render thread, pipeline creation rarely scales past a few threads
+        const unsigned int hw = std::thread::hardware_concurrency();
+        unsigned int count = hw > 1 ? hw - 1 : 1;
+        if (count > 4)
+            count = 4;
+        g_PipelineWorkers.quit = false;
+        g_PipelineWorkers.threads = new std::thread[count];
+        g_PipelineWorkers.thread_count = count;
+        for (unsigned int i = 0; i < count; i++)
+            g_PipelineWorkers.threads[i] = std::thread(ImPlatform_Vulkan_PipelineWorker);
+    }
+    job->next = NULL;
+    if (g_PipelineWorkers.tail)
+        g_PipelineWorkers.tail->next = job;
+    else
+        g_PipelineWorkers.head = job;
+    g_PipelineWorkers.tail = job;
+    g_PipelineWorkers.cond.notify_one();
+    return true;
+}
+
+// Removes a queued job or waits for a running one. The job can be deleted afterwards.
+static void ImPlatform_Vulkan_CancelPipelineJob(ImPlatform_PipelineJob_Vulkan* job)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_PipelineWorkers.mutex);
+        if (job->state.load(std::memory_order_relaxed) == ImPlatform_PipelineJobState_Queued)
+        {
+            ImPlatform_PipelineJob_Vulkan* prev = NULL;
+            for (ImPlatform_PipelineJob_Vulkan* it = g_PipelineWorkers.head; it; prev = it, it = it->next)
+            {
+                if (it != job)
+                    continue;
+                if (prev) prev->next = it->next; else g_PipelineWorkers.head = it->next;
+                if (g_PipelineWorkers.tail == it) g_PipelineWorkers.tail = prev;
+                break;
+            }
+            job->state.store(ImPlatform_PipelineJobState_Cancelled, std::memory_order_relaxed);
+        }
+    }
+    while (job->state.load(std::memory_order_acquire) == ImPlatform_PipelineJobState_Running)
+        std::this_thread::yield();
+}
+
+// Joins the workers; jobs still queued are cancelled (their programs never become ready)
+static void ImPlatform_Vulkan_StopPipelineWorkers(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_PipelineWorkers.mutex);
+        if (!g_PipelineWorkers.threads)
+            return;
+        g_PipelineWorkers.quit = true;
+        for (ImPlatform_PipelineJob_Vulkan* it = g_PipelineWorkers.head; it; it = it->next)
+            it->state.store(ImPlatform_PipelineJobState_Cancelled, std::memory_order_relaxed);
+        g_PipelineWorkers.head = g_PipelineWorkers.tail = NULL;
+    }
+    g_PipelineWorkers.cond.notify_all();
+    for (unsigned int i = 0; i < g_PipelineWorkers.thread_count; i++)
+        g_PipelineWorkers.threads[i].join();
+    delete[] g_PipelineWorkers.threads;
+    g_PipelineWorkers.threads = NULL;
+    g_PipelineWorkers.thread_count = 0;
+}
+
+// Picks up the pipeline of an async program. Returns whether the program is usable.
+static bool ImPlatform_Vulkan_PollProgram(ImPlatform_ShaderProgramData_Vulkan* program_data)
+{
+    ImPlatform_PipelineJob_Vulkan* job = program_data->pendingJob;
+    if (job)
+    {
+        if (job->state.load(std::memory_order_acquire) != ImPlatform_PipelineJobState_Done)
+            return false;
+        if (job->result == VK_SUCCESS)
+            program_data->pipeline = job->pipeline;
+        else
+            fprintf(stderr, "[ImPlatform] Vulkan: Failed to create graphics pipeline (VkResult = %d)\n", job->result);
+        program_data->pendingJob = NULL;
+        delete job;
+    }
+    return program_data->pipeline != VK_NULL_HANDLE;
+}
+
+// Program to draw with in place of `program_data`: itself once its pipeline exists,
+// else the fallback program, else NULL (ImGui's pipeline stays bound)
+static ImPlatform_ShaderProgramData_Vulkan* ImPlatform_Vulkan_ResolveProgram(ImPlatform_ShaderProgramData_Vulkan* program_data)
+{
+    if (ImPlatform_Vulkan_PollProgram(program_data))
+        return program_data;
+    if (g_FallbackProgram && g_FallbackProgram != program_data && ImPlatform_Vulkan_PollProgram(g_FallbackProgram))
+        return g_FallbackProgram;
+    return NULL;
+}
+
+static VkFormat ImPlatform_Vulkan_GetVertexFormat(ImPlatform_VertexFormat format)
+{
+    switch (format)
+    {
+    case ImPlatform_VertexFormat_Float:   return VK_FORMAT_R32_SFLOAT;
+    case ImPlatform_VertexFormat_Float2:  return VK_FORMAT_R32G32_SFLOAT;
+    case ImPlatform_VertexFormat_Float3:  return VK_FORMAT_R32G32B32_SFLOAT;
+    case ImPlatform_VertexFormat_Float4:  return VK_FORMAT_R32G32B32A32_SFLOAT;
+    case ImPlatform_VertexFormat_UByte4:  return VK_FORMAT_R8G8B8A8_UINT;
+    case ImPlatform_VertexFormat_UByte4N: return VK_FORMAT_R8G8B8A8_UNORM;
+    default:                              return VK_FORMAT_R32G32B32_SFLOAT;
+    }
+}
+
+// Appends the attributes of `desc` (ImDrawVert when it has none) for `binding`,
+// starting at *location. Returns false when they don't fit.
+static bool ImPlatform_Vulkan_AppendVertexAttributes(const ImPlatform_VertexBufferDesc* desc, uint32_t binding, uint32_t* location,
+                                                     VkVertexInputAttributeDescription* attributes, uint32_t* attribute_count)
+{
+    if (desc->attribute_count == 0)
+    {
+        static const ImPlatform_VertexAttribute kImDrawVert[3] = {
+            { ImPlatform_VertexFormat_Float2,  (unsigned int)offsetof(ImDrawVert, pos), "POSITION" },
+            { ImPlatform_VertexFormat_Float2,  (unsigned int)offsetof(ImDrawVert, uv),  "TEXCOORD" },
+            { ImPlatform_VertexFormat_UByte4N, (unsigned int)offsetof(ImDrawVert, col), "COLOR" },
+        };
+        ImPlatform_VertexBufferDesc imdrawvert = *desc;
+        imdrawvert.attributes = kImDrawVert;
+        imdrawvert.attribute_count = 3;
+        return ImPlatform_Vulkan_AppendVertexAttributes(&imdrawvert, binding, location, attributes, attribute_count);
+    }
+    if (*attribute_count + desc->attribute_count > IMPLATFORM_VULKAN_MAX_VERTEX_ATTRIBUTES)
+        return false;
+    for (unsigned int i = 0; i < desc->attribute_count; i++)
+    {
+        VkVertexInputAttributeDescription* a = &attributes[(*attribute_count)++];
+        a->location = (*location)++;
+        a->binding = binding;
+        a->format = ImPlatform_Vulkan_GetVertexFormat(desc->attributes[i].format);
+        a->offset = desc->attributes[i].offset;
+    }
+    return true;
+}
+
+// Binds the current program's pipeline for the layout of `vb` (plus `instance`)
+// and `primitive_type`. Pipelines for layouts other than ImDrawVert triangle lists
+// are created on first use and kept with the program.
+static bool ImPlatform_Vulkan_BindDrawPipeline(const ImPlatform_BufferData_Vulkan* vb, const ImPlatform_BufferData_Vulkan* instance, unsigned int primitive_type)
+{
+    ImPlatform_ShaderProgramData_Vulkan* program_data = g_CurrentProgram;
+    if (!program_data)
+        return false; // Draws need a custom shader, see ImPlatform_BeginCustomShader
+
+    VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    if (primitive_type == 1)
+        topology = VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+    else if (primitive_type == 2)
+        topology = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+
+    VkPipeline pipeline = program_data->pipeline;
+    if (instance || vb->vb_desc.attribute_count > 0 || topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+    {
+        if (instance && instance->vb_desc.instance_step_rate > 1)
+        {
+            // Needs VK_EXT_vertex_attribute_divisor, which the device is not created with
+            fprintf(stderr, "[ImPlatform] Vulkan: instance_step_rate > 1 is not supported\n");
+            return false;
+        }
+
+        VkVertexInputBindingDescription bindings[2] = {};
+        VkVertexInputAttributeDescription attributes[IMPLATFORM_VULKAN_MAX_VERTEX_ATTRIBUTES] = {};
+        uint32_t attribute_count = 0, location = 0;
+        bindings[0].binding = 0;
+        bindings[0].stride = vb->vb_desc.attribute_count ? vb->vb_desc.vertex_stride : (uint32_t)sizeof(ImDrawVert);
+        bindings[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        bool fits = ImPlatform_Vulkan_AppendVertexAttributes(&vb->vb_desc, 0, &location, attributes, &attribute_count);
+        if (instance)
+        {
+            bindings[1].binding = 1;
+            bindings[1].stride = instance->vb_desc.vertex_stride;
+            bindings[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+            fits = fits && instance->vb_desc.attribute_count > 0 &&
+                   ImPlatform_Vulkan_AppendVertexAttributes(&instance->vb_desc, 1, &location, attributes, &attribute_count);
+        }
+        if (!fits)
+        {
+            fprintf(stderr, "[ImPlatform] Vulkan: Unsupported vertex layout for draw\n");
+            return false;
+        }
+
+        // FNV-1a over everything that shapes the pipeline
+        uint32_t key_data[IMPLATFORM_VULKAN_VARIANT_STATE_WORDS];
+        uint32_t key_size = 0;
+        key_data[key_size++] = (uint32_t)topology;
+        key_data[key_size++] = instance ? 2u : 1u;
+        for (uint32_t i = 0; i < (instance ? 2u : 1u); i++)
+        {
+            key_data[key_size++] = bindings[i].binding;
+            key_data[key_size++] = bindings[i].stride;
+            key_data[key_size++] = (uint32_t)bindings[i].inputRate;
+        }
+        for (uint32_t i = 0; i < attribute_count; i++)
+        {
+            key_data[key_size++] = attributes[i].binding;
+            key_data[key_size++] = (uint32_t)attributes[i].format;
+            key_data[key_size++] = attributes[i].offset;
+        }
+        uint64_t key = 14695981039346656037ull;
+        const unsigned char* bytes = (const unsigned char*)key_data;
+        for (size_t i = 0; i < key_size * sizeof(uint32_t); i++)
+            key = (key ^ bytes[i]) * 1099511628211ull;
+
+        // The hash only filters, a hit must match the whole state
+        ImPlatform_PipelineVariant_Vulkan* variant = program_data->variants;
+        while (variant && (variant->key != key || variant->state_size != key_size ||
+                           memcmp(variant->state, key_data, key_size * sizeof(uint32_t)) != 0))
+            variant = variant->next;
+        if (!variant)
+        {
+            VkPipelineVertexInputStateCreateInfo vertex_info = {};
+            vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+            vertex_info.vertexBindingDescriptionCount = instance ? 2 : 1;
+            vertex_info.pVertexBindingDescriptions = bindings;
+            vertex_info.vertexAttributeDescriptionCount = attribute_count;
+            vertex_info.pVertexAttributeDescriptions = attributes;
+
+            VkPipeline variant_pipeline = VK_NULL_HANDLE;
+            VkResult err = ImPlatform_Vulkan_CreateProgramPipeline(program_data, &vertex_info, topology, &variant_pipeline);
+            if (err != VK_SUCCESS)
+            {
+                fprintf(stderr, "[ImPlatform] Vulkan: Failed to create graphics pipeline variant (VkResult = %d)\n", err);
+                return false;
+            }
+            variant = new ImPlatform_PipelineVariant_Vulkan();
+            variant->key = key;
+            memcpy(variant->state, key_data, key_size * sizeof(uint32_t));
+            variant->state_size = key_size;
+            variant->pipeline = variant_pipeline;
+            variant->next = program_data->variants;
+            program_data->variants = variant;
+        }
+        pipeline = variant->pipeline;
+    }
+
+    if (pipeline != g_CurrentPipeline)
+    {
+        vkCmdBindPipeline(g_CurrentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        g_CurrentPipeline = pipeline;
+    }
+    return true;
+}
+
+static ImPlatform_ShaderProgramData_Vulkan* ImPlatform_Vulkan_CreateProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader, bool async)
 {
     if (!vertex_shader || !fragment_shader)
     {
@@ -1915,108 +4724,10 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
         }
     }
 
-    // Create graphics pipeline
-    {
-        VkPipelineShaderStageCreateInfo stage[2] = {};
-        stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-        stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-        stage[0].module = program_data->vertShaderModule;
-        stage[0].pName = "main";
-        stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-        stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-        stage[1].module = program_data->fragShaderModule;
-        stage[1].pName = "main";
-
-        // Vertex input: same as ImGui (ImDrawVert)
-        VkVertexInputBindingDescription binding_desc = {};
-        binding_desc.stride = sizeof(ImDrawVert);
-        binding_desc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-        VkVertexInputAttributeDescription attribute_desc[3] = {};
-        attribute_desc[0].location = 0;
-        attribute_desc[0].binding = 0;
-        attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
-        attribute_desc[0].offset = offsetof(ImDrawVert, pos);
-        attribute_desc[1].location = 1;
-        attribute_desc[1].binding = 0;
-        attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
-        attribute_desc[1].offset = offsetof(ImDrawVert, uv);
-        attribute_desc[2].location = 2;
-        attribute_desc[2].binding = 0;
-        attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
-        attribute_desc[2].offset = offsetof(ImDrawVert, col);
-
-        VkPipelineVertexInputStateCreateInfo vertex_info = {};
-        vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertex_info.vertexBindingDescriptionCount = 1;
-        vertex_info.pVertexBindingDescriptions = &binding_desc;
-        vertex_info.vertexAttributeDescriptionCount = 3;
-        vertex_info.pVertexAttributeDescriptions = attribute_desc;
-
-        VkPipelineInputAssemblyStateCreateInfo ia_info = {};
-        ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-        ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-
-        VkPipelineViewportStateCreateInfo viewport_info = {};
-        viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-        viewport_info.viewportCount = 1;
-        viewport_info.scissorCount = 1;
-
-        VkPipelineRasterizationStateCreateInfo raster_info = {};
-        raster_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-        raster_info.polygonMode = VK_POLYGON_MODE_FILL;
-        raster_info.cullMode = VK_CULL_MODE_NONE;
-        raster_info.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-        raster_info.lineWidth = 1.0f;
-
-        VkPipelineMultisampleStateCreateInfo ms_info = {};
-        ms_info.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-        ms_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-
-        VkPipelineColorBlendAttachmentState color_attachment = {};
-        color_attachment.blendEnable = VK_TRUE;
-        color_attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-        color_attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-        color_attachment.colorBlendOp = VK_BLEND_OP_ADD;
-        color_attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-        color_attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-        color_attachment.alphaBlendOp = VK_BLEND_OP_ADD;
-        color_attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-
-        VkPipelineDepthStencilStateCreateInfo depth_info = {};
-        depth_info.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-
-        VkPipelineColorBlendStateCreateInfo blend_info = {};
-        blend_info.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-        blend_info.attachmentCount = 1;
-        blend_info.pAttachments = &color_attachment;
-
-        VkDynamicState dynamic_states[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
-        VkPipelineDynamicStateCreateInfo dynamic_state = {};
-        dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-        dynamic_state.dynamicStateCount = 2;
-        dynamic_state.pDynamicStates = dynamic_states;
-
-        VkGraphicsPipelineCreateInfo pipeline_info = {};
-        pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        pipeline_info.flags = 0; // No special flags needed
-        pipeline_info.stageCount = 2;
-        pipeline_info.pStages = stage;
-        pipeline_info.pVertexInputState = &vertex_info;
-        pipeline_info.pInputAssemblyState = &ia_info;
-        pipeline_info.pViewportState = &viewport_info;
-        pipeline_info.pRasterizationState = &raster_info;
-        pipeline_info.pMultisampleState = &ms_info;
-        pipeline_info.pDepthStencilState = &depth_info;
-        pipeline_info.pColorBlendState = &blend_info;
-        pipeline_info.pDynamicState = &dynamic_state;
-        pipeline_info.layout = program_data->pipelineLayout;
-        pipeline_info.renderPass = g_MainWindowData.RenderPass;
-        pipeline_info.subpass = 0;
-
-        // Pass the global pipeline cache so this pipeline's compiled state can
-        // be reused across runs (see ImPlatform_Vulkan_InitPipelineCache above).
-        err = vkCreateGraphicsPipelines(g_GfxData.device, g_VulkanPipelineCache, 1, &pipeline_info, g_Allocator, &program_data->pipeline);
+    // Create graphics pipeline (async programs get it from a pipeline worker once complete)
+    if (!async)
+    {
+        err = ImPlatform_Vulkan_CreateDefaultPipeline(program_data, &program_data->pipeline);
         if (err != VK_SUCCESS)
         {
             fprintf(stderr, "[ImPlatform] Vulkan: Failed to create graphics pipeline (VkResult = %d)\n", err);
@@ -2096,7 +4807,65 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
                 (void*)program_data->descriptorSet, (void*)program_data->pipelineLayout);
     }
 
-    return (ImPlatform_ShaderProgram)program_data;
+    // Merge the members reflected from both stages and preallocate the block they span
+    unsigned int members_end = 0;
+    const ImPlatform_ShaderData_Vulkan* stages[2] = { vs_data, fs_data };
+    for (int s = 0; s < 2; s++)
+    {
+        const ImPlatform_ShaderNameTable* members = &stages[s]->members;
+        for (unsigned int i = 0; i < members->capacity; i++)
+            if (members->entries[i].hash)
+                ImPlatform_ShaderNameTable_AddN(&program_data->uniformMembers, members->entries[i].name, strlen(members->entries[i].name),
+                                                members->entries[i].value, members->entries[i].size);
+        if (stages[s]->members_end > members_end)
+            members_end = stages[s]->members_end;
+    }
+    if (members_end > 0)
+    {
+        program_data->uniformBufferSize = (members_end + 3) & ~3u;
+        program_data->uniformBufferMapped = calloc(1, program_data->uniformBufferSize);
+        if (!program_data->uniformBufferMapped)
+            program_data->uniformBufferSize = 0;
+    }
+
+    // The program owns a reference to its stages, so the shaders can be destroyed right away
+    program_data->vertShader = vs_data;
+    program_data->fragShader = fs_data;
+    vs_data->refs++;
+    fs_data->refs++;
+
+    if (async)
+    {
+        ImPlatform_PipelineJob_Vulkan* job = new ImPlatform_PipelineJob_Vulkan();
+        job->program = program_data;
+        job->state.store(ImPlatform_PipelineJobState_Queued, std::memory_order_relaxed);
+        job->result = VK_NOT_READY;
+        job->pipeline = VK_NULL_HANDLE;
+        program_data->pendingJob = job;
+        ImPlatform_Vulkan_SubmitPipelineJob(job);
+    }
+
+    return program_data;
+}
+
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+{
+    return (ImPlatform_ShaderProgram)ImPlatform_Vulkan_CreateProgram(vertex_shader, fragment_shader, false);
+}
+
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader)
+{
+    return (ImPlatform_ShaderProgram)ImPlatform_Vulkan_CreateProgram(vertex_shader, fragment_shader, true);
+}
+
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program)
+{
+    return program && ImPlatform_Vulkan_PollProgram((ImPlatform_ShaderProgramData_Vulkan*)program);
+}
+
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram program)
+{
+    g_FallbackProgram = (ImPlatform_ShaderProgramData_Vulkan*)program;
 }
 
 IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram program)
@@ -2105,7 +4874,25 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
         return;
 
     ImPlatform_ShaderProgramData_Vulkan* program_data = (ImPlatform_ShaderProgramData_Vulkan*)program;
+    if (g_CurrentProgram == program_data)
+        g_CurrentProgram = NULL;
+    if (g_FallbackProgram == program_data)
+        g_FallbackProgram = NULL;
+    if (ImPlatform_PipelineJob_Vulkan* job = program_data->pendingJob)
+    {
+        ImPlatform_Vulkan_CancelPipelineJob(job);
+        if (job->pipeline)
+            vkDestroyPipeline(g_GfxData.device, job->pipeline, g_Allocator);
+        delete job;
+    }
 
+    while (program_data->variants)
+    {
+        ImPlatform_PipelineVariant_Vulkan* variant = program_data->variants;
+        program_data->variants = variant->next;
+        vkDestroyPipeline(g_GfxData.device, variant->pipeline, g_Allocator);
+        delete variant;
+    }
     if (program_data->pipeline)
         vkDestroyPipeline(g_GfxData.device, program_data->pipeline, g_Allocator);
     if (program_data->pipelineLayout)
@@ -2119,6 +4906,10 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
     // Free uniform data buffer (used for push constants, not Vulkan buffers)
     if (program_data->uniformBufferMapped)
         free(program_data->uniformBufferMapped);
+    ImPlatform_ShaderNameTable_Free(&program_data->uniformMembers);
+    // No worker or pipeline uses the modules anymore
+    ImPlatform_Vulkan_ReleaseShaderData(program_data->vertShader);
+    ImPlatform_Vulkan_ReleaseShaderData(program_data->fragShader);
 
     free(program_data);
 }
@@ -2128,10 +4919,28 @@ IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram /*progr
     // Not needed for Vulkan - shaders are bound through draw callbacks
 }
 
-IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram /*program*/, const char* /*name*/, const void* /*data*/, unsigned int /*size*/)
+// Writes `name` into the program's preallocated push constant data. Returns false
+// when the name is not a reflected member.
+static bool ImPlatform_Vulkan_WriteUniformMember(ImPlatform_ShaderProgramData_Vulkan* program_data, const char* name, const void* data, unsigned int size)
 {
-    // Not needed for Vulkan - uniforms are set through uniform blocks
-    return false;
+    const ImPlatform_ShaderNameEntry* member = ImPlatform_ShaderNameTable_Find(&program_data->uniformMembers, name);
+    if (!member || !program_data->uniformBufferMapped || (size_t)member->value >= program_data->uniformBufferSize)
+        return false;
+    size_t copy_size = size < member->size ? size : member->size;
+    if ((size_t)member->value + copy_size > program_data->uniformBufferSize)
+        copy_size = program_data->uniformBufferSize - (size_t)member->value;
+    memcpy((unsigned char*)program_data->uniformBufferMapped + member->value, data, copy_size);
+    program_data->uniformBufferDirty = true;
+    return true;
+}
+
+IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram program, const char* name, const void* data, unsigned int size)
+{
+    if (!program || !name || !data || size == 0)
+        return false;
+
+    // Only reflected members can be addressed outside of a uniform block
+    return ImPlatform_Vulkan_WriteUniformMember((ImPlatform_ShaderProgramData_Vulkan*)program, name, data, size);
 }
 
 IMPLATFORM_API bool ImPlatform_SetShaderTexture(ImPlatform_ShaderProgram /*program*/, const char* /*name*/, unsigned int /*slot*/, ImTextureID /*texture*/)
@@ -2146,31 +4955,24 @@ IMPLATFORM_API void ImPlatform_BeginUniformBlock(ImPlatform_ShaderProgram progra
         return;
 
     g_CurrentUniformBlockProgram = program;
-
-    // Free any previous block data
-    if (g_UniformBlockData)
-    {
-        free(g_UniformBlockData);
-        g_UniformBlockData = nullptr;
-        g_UniformBlockSize = 0;
-    }
+    g_UniformBlockSize = 0;
 }
 
-IMPLATFORM_API bool ImPlatform_SetUniform(const char* /*name*/, const void* data, unsigned int size)
+IMPLATFORM_API bool ImPlatform_SetUniform(const char* name, const void* data, unsigned int size)
 {
     if (!g_CurrentUniformBlockProgram || !data || size == 0)
         return false;
 
-    // Accumulate all uniforms into a single buffer
-    // Allocate or expand the buffer
-    size_t new_size = g_UniformBlockSize + size;
-    void* new_data = realloc(g_UniformBlockData, new_size);
-    if (!new_data)
-        return false;
+    // Reflected programs are written in place by name, in any order
+    ImPlatform_ShaderProgramData_Vulkan* program_data = (ImPlatform_ShaderProgramData_Vulkan*)g_CurrentUniformBlockProgram;
+    if (program_data->uniformMembers.count > 0)
+        return name && ImPlatform_Vulkan_WriteUniformMember(program_data, name, data, size);
 
-    g_UniformBlockData = new_data;
-    memcpy((char*)g_UniformBlockData + g_UniformBlockSize, data, size);
-    g_UniformBlockSize = new_size;
+    // No reflection data (e.g. stripped SPIR-V): pack in call order
+    if (g_UniformBlockSize + size > sizeof(g_UniformBlockData))
+        return false;
+    memcpy(g_UniformBlockData + g_UniformBlockSize, data, size);
+    g_UniformBlockSize += size;
 
     return true;
 }
@@ -2184,7 +4986,8 @@ IMPLATFORM_API void ImPlatform_EndUniformBlock(ImPlatform_ShaderProgram program)
 
     // Store uniform data in the program structure for later use in push constants
     // No need to create a uniform buffer anymore - we will pass this via push constants
-    if (g_UniformBlockData && g_UniformBlockSize > 0)
+    // (reflected programs were already written in place)
+    if (program_data->uniformMembers.count == 0 && g_UniformBlockSize > 0)
     {
         // Reallocate program uniform buffer to store the data
         if (program_data->uniformBufferSize != g_UniformBlockSize)
@@ -2217,10 +5020,18 @@ static void ImPlatform_SetCustomShader(const ImDrawList* parent_list, const ImDr
     if (!program || g_CurrentCommandBuffer == VK_NULL_HANDLE)
         return;
 
-    ImPlatform_ShaderProgramData_Vulkan* program_data = (ImPlatform_ShaderProgramData_Vulkan*)program;
+    // Programs still being created draw with the fallback program, or keep ImGui's pipeline
+    ImPlatform_ShaderProgramData_Vulkan* program_data = ImPlatform_Vulkan_ResolveProgram((ImPlatform_ShaderProgramData_Vulkan*)program);
+    if (!program_data)
+    {
+        g_CurrentProgram = NULL;
+        return;
+    }
 
     // Bind custom pipeline
     vkCmdBindPipeline(g_CurrentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, program_data->pipeline);
+    g_CurrentProgram = program_data;
+    g_CurrentPipeline = program_data->pipeline;
 
     // Rebind push constants (scale and translate for projection)
     // Find which viewport owns this draw list
@@ -2312,10 +5123,17 @@ IMPLATFORM_API void ImPlatform_BeginCustomShader_Render(ImPlatform_ShaderProgram
     if (!program || g_CurrentCommandBuffer == VK_NULL_HANDLE)
         return;
 
-    ImPlatform_ShaderProgramData_Vulkan* program_data = (ImPlatform_ShaderProgramData_Vulkan*)program;
+    ImPlatform_ShaderProgramData_Vulkan* program_data = ImPlatform_Vulkan_ResolveProgram((ImPlatform_ShaderProgramData_Vulkan*)program);
+    if (!program_data)
+    {
+        g_CurrentProgram = NULL;
+        return;
+    }
 
     // Bind custom pipeline
     vkCmdBindPipeline(g_CurrentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, program_data->pipeline);
+    g_CurrentProgram = program_data;
+    g_CurrentPipeline = program_data->pipeline;
 
     // Rebind push constants (scale and translate for projection)
     ImDrawData* draw_data = g_CurrentDrawData;
@@ -2365,6 +5183,7 @@ IMPLATFORM_API void ImPlatform_BeginCustomShader(ImDrawList* draw, ImPlatform_Sh
         return;
 
     draw->AddCallback(&ImPlatform_SetCustomShader, shader);
+    g_CustomShaderDrawList = draw;
 }
 
 IMPLATFORM_API void ImPlatform_EndCustomShader(ImDrawList* draw)
@@ -2373,17 +5192,90 @@ IMPLATFORM_API void ImPlatform_EndCustomShader(ImDrawList* draw)
         return;
 
     draw->AddCallback(ImDrawCallback_ResetRenderState, NULL);
+    if (g_CustomShaderDrawList == draw)
+        g_CustomShaderDrawList = nullptr;
+}
+
+// Constants captured at build time, stored in g_ShaderConstantsArena
+struct ImPlatform_ShaderConstants_Vulkan
+{
+    unsigned int size;
+    // size bytes follow
+};
+
+static void ImPlatform_Vulkan_PushShaderConstantsCallback(const ImDrawList* parent_list, const ImDrawCmd* cmd)
+{
+    (void)parent_list;
+    const ImPlatform_ShaderConstants_Vulkan* constants = (const ImPlatform_ShaderConstants_Vulkan*)cmd->UserCallbackData;
+    if (!g_CurrentProgram || g_CurrentCommandBuffer == VK_NULL_HANDLE)
+        return;
+    vkCmdPushConstants(g_CurrentCommandBuffer, g_CurrentProgram->pipelineLayout,
+                      VK_SHADER_STAGE_FRAGMENT_BIT, IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET, constants->size, constants + 1);
+}
+
+// Restores the uniform block data of the bound program
+static void ImPlatform_Vulkan_RestoreShaderConstants(void)
+{
+    ImPlatform_ShaderProgramData_Vulkan* program_data = g_CurrentProgram;
+    if (!program_data || g_CurrentCommandBuffer == VK_NULL_HANDLE)
+        return;
+    if (program_data->uniformBufferMapped && program_data->uniformBufferSize > 0)
+    {
+        vkCmdPushConstants(g_CurrentCommandBuffer, program_data->pipelineLayout,
+                          VK_SHADER_STAGE_FRAGMENT_BIT, 64,
+                          (uint32_t)program_data->uniformBufferSize, program_data->uniformBufferMapped);
+    }
+}
+
+static void ImPlatform_Vulkan_PopShaderConstantsCallback(const ImDrawList* parent_list, const ImDrawCmd* cmd)
+{
+    (void)parent_list; (void)cmd;
+    ImPlatform_Vulkan_RestoreShaderConstants();
 }
 
+// Constants are push constants over the program's uniform block data. Inside a
+// draw callback they are recorded right away; while the frame is built they are
+// copied into the frame arena and recorded by a callback of the draw list given
+// to ImPlatform_BeginCustomShader.
 IMPLATFORM_API void* ImPlatform_PushShaderConstants(const void* data, unsigned int size)
 {
-    (void)data; (void)size;
-    return nullptr;
+    if (!data || size == 0 || size > IMPLATFORM_VULKAN_MAX_SHADER_CONSTANTS || (size & 3) != 0)
+        return nullptr;
+
+    if (g_CurrentCommandBuffer != VK_NULL_HANDLE)
+    {
+        if (!g_CurrentProgram)
+            return nullptr;
+        vkCmdPushConstants(g_CurrentCommandBuffer, g_CurrentProgram->pipelineLayout,
+                          VK_SHADER_STAGE_FRAGMENT_BIT, IMPLATFORM_VULKAN_SHADER_CONSTANTS_OFFSET, size, data);
+        return g_CurrentProgram;
+    }
+
+    if (!g_CustomShaderDrawList)
+        return nullptr;
+
+    ImPlatform_ShaderConstants_Vulkan* constants = (ImPlatform_ShaderConstants_Vulkan*)ImPlatform_FrameArena_Alloc(&g_ShaderConstantsArena, sizeof(ImPlatform_ShaderConstants_Vulkan) + size);
+    if (!constants)
+        return nullptr;
+    constants->size = size;
+    memcpy(constants + 1, data, size);
+    g_CustomShaderDrawList->AddCallback(&ImPlatform_Vulkan_PushShaderConstantsCallback, constants);
+    return constants;
 }
 
 IMPLATFORM_API void ImPlatform_PopShaderConstants(void* handle)
 {
-    (void)handle;
+    if (!handle)
+        return;
+
+    if (g_CurrentCommandBuffer != VK_NULL_HANDLE)
+    {
+        ImPlatform_Vulkan_RestoreShaderConstants();
+        return;
+    }
+
+    if (g_CustomShaderDrawList)
+        g_CustomShaderDrawList->AddCallback(&ImPlatform_Vulkan_PopShaderConstantsCallback, NULL);
 }
 
 // ============================================================================
@@ -85,10 +85,12 @@ static ImPlatform_GfxData_WebGPU g_GfxData = {};
 unsigned int g_ImPlatform_BackbufferW = 0;
 unsigned int g_ImPlatform_BackbufferH = 0;
 
-// Uniform block API state
+// Uniform block API state. Programs without reflected members get their uniforms
+// packed in call order into g_UniformBlockData, which is kept between blocks.
 static ImPlatform_ShaderProgram g_CurrentUniformBlockProgram = nullptr;
-static void* g_UniformBlockData = nullptr;
+static unsigned char* g_UniformBlockData = nullptr;
 static size_t g_UniformBlockSize = 0;
+static size_t g_UniformBlockCapacity = 0;
 
 // Current draw data for custom shader rendering (needed for multi-viewport)
 static ImDrawData* g_CurrentDrawData = nullptr;
@@ -100,6 +102,15 @@ static WGPUSampler g_DefaultSampler = nullptr;
 static WGPUCommandEncoder     g_RTEncoder = nullptr;
 static WGPURenderPassEncoder  g_RTPass    = nullptr;
 
+// Mip generation: one pipeline per color format (created on first use)
+#define IMPLATFORM_WGPU_MIP_PIPELINES 8
+struct ImPlatform_MipPipeline_WebGPU { WGPUTextureFormat format; WGPURenderPipeline pipeline; };
+static WGPUShaderModule               g_MipModule         = nullptr;
+static WGPUSampler                    g_MipSampler        = nullptr;
+static WGPUBindGroupLayout            g_MipBindGroupLayout = nullptr;
+static ImPlatform_MipPipeline_WebGPU  g_MipPipelines[IMPLATFORM_WGPU_MIP_PIPELINES] = {};
+static int                            g_MipPipelineCount  = 0;
+
 // ============================================================================
 // Texture Resource Tracking
 // ============================================================================
@@ -188,13 +199,15 @@ static void ImPlatform_CreateSwapChain(unsigned int width, unsigned int height)
 {
     g_GfxData.uSurfaceWidth = width;
     g_GfxData.uSurfaceHeight = height;
+    g_ImPlatform_BackbufferW = width;
+    g_ImPlatform_BackbufferH = height;
 
 #ifdef IMPLATFORM_WGPU_SURFACE_API
     // New WebGPU API: configure surface directly
     WGPUSurfaceConfiguration config = {};
     config.device = g_GfxData.device;
     config.format = g_GfxData.swapChainFormat;
-    config.usage = WGPUTextureUsage_RenderAttachment;
+    config.usage = WGPUTextureUsage_RenderAttachment | WGPUTextureUsage_CopySrc; // CopySrc: ImPlatform_CopyBackbuffer
     config.width = width;
     config.height = height;
     config.presentMode = WGPUPresentMode_Fifo;
@@ -247,6 +260,19 @@ static void wgpu_error_callback(WGPUErrorType error_type, const char* message, v
 }
 #endif
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS && !(defined(__EMSCRIPTEN__) && !defined(IMGUI_IMPL_WEBGPU_BACKEND_DAWN))
+// Block-compressed texture families the adapter offers, requested with the device
+static size_t ImPlatform_WGPU_GetCompressionFeatures(WGPUAdapter adapter, WGPUFeatureName* out_features)
+{
+    static const WGPUFeatureName kFeatures[] = { WGPUFeatureName_TextureCompressionBC, WGPUFeatureName_TextureCompressionETC2, WGPUFeatureName_TextureCompressionASTC };
+    size_t count = 0;
+    for (WGPUFeatureName feature : kFeatures)
+        if (wgpuAdapterHasFeature(adapter, feature))
+            out_features[count++] = feature;
+    return count;
+}
+#endif
+
 bool ImPlatform_Gfx_CreateDevice_WebGPU(void* pWindow, ImPlatform_GfxData_WebGPU* pData)
 {
     // 1. Create WGPUInstance
@@ -445,6 +471,11 @@ bool ImPlatform_Gfx_CreateDevice_WebGPU(void* pWindow, ImPlatform_GfxData_WebGPU
         WGPUDeviceDescriptor device_desc = {};
         device_desc.label = WGPU_STR("ImPlatform Device");
         device_desc.uncapturedErrorCallbackInfo.callback = wgpu_error_callback;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+        WGPUFeatureName features[3];
+        device_desc.requiredFeatureCount = ImPlatform_WGPU_GetCompressionFeatures(pData->adapter, features);
+        device_desc.requiredFeatures = features;
+#endif
 
         WGPURequestDeviceCallbackInfo cb_info = {};
         cb_info.mode = WGPUCallbackMode_AllowSpontaneous;
@@ -510,6 +541,11 @@ bool ImPlatform_Gfx_CreateDevice_WebGPU(void* pWindow, ImPlatform_GfxData_WebGPU
 
         WGPUDeviceDescriptor device_desc = {};
         device_desc.label = "ImPlatform Device";
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+        WGPUFeatureName features[3];
+        device_desc.requiredFeatureCount = ImPlatform_WGPU_GetCompressionFeatures(pData->adapter, features);
+        device_desc.requiredFeatures = features;
+#endif
 
         wgpuAdapterRequestDevice(pData->adapter, &device_desc,
             [](WGPURequestDeviceStatus status, WGPUDevice device, const char* message, void* pUserData)
@@ -727,6 +763,7 @@ IMPLATFORM_API bool ImPlatform_GfxCheck(void)
 IMPLATFORM_API void ImPlatform_GfxAPINewFrame(void)
 {
     ImGui_ImplWGPU_NewFrame();
+    ImPlatform_ShaderReload_NewFrame();
 }
 
 // ImPlatform API - GfxAPIClear
@@ -737,6 +774,10 @@ IMPLATFORM_API bool ImPlatform_GfxAPIClear(ImVec4 const vClearColor)
     return true;
 }
 
+#ifdef IMPLATFORM_WGPU_SURFACE_API
+static void ImPlatform_WGPU_FlushBackbufferCopies(WGPUTexture backbuffer);
+#endif
+
 // ImPlatform API - GfxAPIRender
 IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
 {
@@ -781,6 +822,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
     ImGui_ImplWGPU_RenderDrawData(draw_data, pass);
 
     wgpuRenderPassEncoderEnd(pass);
+    ImPlatform_Capture_EndFrame();
 
     // Submit commands
     WGPUCommandBufferDescriptor cmd_desc = {};
@@ -793,6 +835,7 @@ IMPLATFORM_API bool ImPlatform_GfxAPIRender(ImVec4 const vClearColor)
     wgpuCommandEncoderRelease(encoder);
     wgpuTextureViewRelease(backbuffer);
 #ifdef IMPLATFORM_WGPU_SURFACE_API
+    ImPlatform_WGPU_FlushBackbufferCopies(surfaceTexture.texture);
     wgpuTextureRelease(surfaceTexture.texture);
 #endif
 
@@ -840,11 +883,24 @@ IMPLATFORM_API void ImPlatform_ShutdownGfxAPI(void)
         wgpuSamplerRelease(g_DefaultSampler);
         g_DefaultSampler = nullptr;
     }
+
+    for (int i = 0; i < g_MipPipelineCount; i++)
+        wgpuRenderPipelineRelease(g_MipPipelines[i].pipeline);
+    g_MipPipelineCount = 0;
+    if (g_MipBindGroupLayout) { wgpuBindGroupLayoutRelease(g_MipBindGroupLayout); g_MipBindGroupLayout = nullptr; }
+    if (g_MipSampler)         { wgpuSamplerRelease(g_MipSampler);                 g_MipSampler = nullptr; }
+    if (g_MipModule)          { wgpuShaderModuleRelease(g_MipModule);             g_MipModule = nullptr; }
 }
 
 // ImPlatform API - ShutdownWindow
 IMPLATFORM_API void ImPlatform_ShutdownWindow(void)
 {
+    // Joins the capture worker and closes its output while readbacks and textures still exist
+    ImPlatform_EndCapture();
+    free(g_UniformBlockData);
+    g_UniformBlockData = nullptr;
+    g_UniformBlockSize = g_UniformBlockCapacity = 0;
+
     ImGui_ImplWGPU_Shutdown();
     ImPlatform_Gfx_CleanupDevice_WebGPU(&g_GfxData);
 }
@@ -953,6 +1009,39 @@ static WGPUTextureFormat ImPlatform_GetWebGPUFormat(ImPlatform_PixelFormat forma
     case ImPlatform_PixelFormat_R32I:
         *out_bytes_per_pixel = 4;
         return WGPUTextureFormat_R32Sint;
+#endif
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Block-compressed: no per-texel size, see ImPlatform_CompressedBlockBytes
+    case ImPlatform_PixelFormat_BC1:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC1RGBAUnorm;
+    case ImPlatform_PixelFormat_BC2:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC2RGBAUnorm;
+    case ImPlatform_PixelFormat_BC3:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC3RGBAUnorm;
+    case ImPlatform_PixelFormat_BC4:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC4RUnorm;
+    case ImPlatform_PixelFormat_BC5:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC5RGUnorm;
+    case ImPlatform_PixelFormat_BC6H:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC6HRGBUfloat;
+    case ImPlatform_PixelFormat_BC7:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_BC7RGBAUnorm;
+    case ImPlatform_PixelFormat_ETC2_RGB8:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_ETC2RGB8Unorm;
+    case ImPlatform_PixelFormat_ETC2_RGBA8:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_ETC2RGBA8Unorm;
+    case ImPlatform_PixelFormat_ASTC_4x4:
+        *out_bytes_per_pixel = 0;
+        return WGPUTextureFormat_ASTC4x4Unorm;
 #endif
     default:
         *out_bytes_per_pixel = 4;
@@ -1003,6 +1092,7 @@ IMPLATFORM_API ImPlatform_TextureDesc ImPlatform_TextureDesc_Default(unsigned in
     desc.mag_filter = ImPlatform_TextureFilter_Linear;
     desc.wrap_u = ImPlatform_TextureWrap_Clamp;
     desc.wrap_v = ImPlatform_TextureWrap_Clamp;
+    desc.mip_levels = 1;
     return desc;
 }
 
@@ -1018,11 +1108,231 @@ IMPLATFORM_API ImPlatform_TextureDesc3D ImPlatform_TextureDesc3D_Default(unsigne
 IMPLATFORM_API bool ImPlatform_SupportsTexture3D(void) { return false; }
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture3D(const void*, const ImPlatform_TextureDesc3D*) { return NULL; }
 
+IMPLATFORM_API bool ImPlatform_SupportsPixelFormat(ImPlatform_PixelFormat format)
+{
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_CompressedBlockBytes(format))
+    {
+        if (!g_GfxData.device)
+            return false;
+        if (format == ImPlatform_PixelFormat_ETC2_RGB8 || format == ImPlatform_PixelFormat_ETC2_RGBA8)
+            return wgpuDeviceHasFeature(g_GfxData.device, WGPUFeatureName_TextureCompressionETC2);
+        if (format == ImPlatform_PixelFormat_ASTC_4x4)
+            return wgpuDeviceHasFeature(g_GfxData.device, WGPUFeatureName_TextureCompressionASTC);
+        return wgpuDeviceHasFeature(g_GfxData.device, WGPUFeatureName_TextureCompressionBC);
+    }
+#endif
+    (void)format;
+    return true;
+}
+
+// ============================================================================
+// Mipmap generation
+// ============================================================================
+// WebGPU has no built-in mip generation: each level is rendered from the
+// previous one with a fullscreen triangle and a linear sampler.
+
+static const char* g_MipShaderWGSL =
+    "@group(0) @binding(0) var src_sampler: sampler;\n"
+    "@group(0) @binding(1) var src_texture: texture_2d<f32>;\n"
+    "struct VSOut { @builtin(position) pos: vec4<f32>, @location(0) uv: vec2<f32> };\n"
+    "@vertex fn vs_main(@builtin(vertex_index) i: u32) -> VSOut {\n"
+    "    var o: VSOut;\n"
+    "    let uv = vec2<f32>(f32((i << 1u) & 2u), f32(i & 2u));\n"
+    "    o.pos = vec4<f32>(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, 0.0, 1.0);\n"
+    "    o.uv = uv;\n"
+    "    return o;\n"
+    "}\n"
+    "@fragment fn fs_main(in: VSOut) -> @location(0) vec4<f32> {\n"
+    "    return textureSample(src_texture, src_sampler, in.uv);\n"
+    "}\n";
+
+// Formats that are both filterable and renderable without optional features
+static bool ImPlatform_WGPU_CanGenerateMips(WGPUTextureFormat format)
+{
+    switch (format)
+    {
+    case WGPUTextureFormat_R8Unorm:
+    case WGPUTextureFormat_RG8Unorm:
+    case WGPUTextureFormat_RGBA8Unorm:
+    case WGPUTextureFormat_RGBA8UnormSrgb:
+    case WGPUTextureFormat_BGRA8Unorm:
+    case WGPUTextureFormat_RGB10A2Unorm:
+    case WGPUTextureFormat_R16Float:
+    case WGPUTextureFormat_RG16Float:
+    case WGPUTextureFormat_RGBA16Float:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static WGPURenderPipeline ImPlatform_WGPU_GetMipPipeline(WGPUTextureFormat format)
+{
+    for (int i = 0; i < g_MipPipelineCount; i++)
+        if (g_MipPipelines[i].format == format)
+            return g_MipPipelines[i].pipeline;
+    if (g_MipPipelineCount == IMPLATFORM_WGPU_MIP_PIPELINES)
+        return nullptr;
+
+    if (!g_MipModule)
+    {
+        WGPUShaderModuleWGSLDescriptor wgsl_desc = {};
+        wgsl_desc.chain.sType = WGPUSType_ShaderModuleWGSLDescriptor;
+        wgsl_desc.code = WGPU_STR(g_MipShaderWGSL);
+        WGPUShaderModuleDescriptor module_desc = {};
+        module_desc.nextInChain = (WGPUChainedStruct*)&wgsl_desc;
+        module_desc.label = WGPU_STR("ImPlatform Mip Generation");
+        g_MipModule = wgpuDeviceCreateShaderModule(g_GfxData.device, &module_desc);
+    }
+    if (!g_MipSampler)
+    {
+        WGPUSamplerDescriptor sampler_desc = {};
+        sampler_desc.addressModeU = WGPUAddressMode_ClampToEdge;
+        sampler_desc.addressModeV = WGPUAddressMode_ClampToEdge;
+        sampler_desc.addressModeW = WGPUAddressMode_ClampToEdge;
+        sampler_desc.magFilter = WGPUFilterMode_Linear;
+        sampler_desc.minFilter = WGPUFilterMode_Linear;
+        sampler_desc.mipmapFilter = WGPUMipmapFilterMode_Nearest;
+        sampler_desc.lodMaxClamp = 32.0f;
+        sampler_desc.maxAnisotropy = 1;
+        g_MipSampler = wgpuDeviceCreateSampler(g_GfxData.device, &sampler_desc);
+    }
+    if (!g_MipBindGroupLayout)
+    {
+        WGPUBindGroupLayoutEntry entries[2] = {};
+        entries[0].binding = 0;
+        entries[0].visibility = WGPUShaderStage_Fragment;
+        entries[0].sampler.type = WGPUSamplerBindingType_Filtering;
+        entries[1].binding = 1;
+        entries[1].visibility = WGPUShaderStage_Fragment;
+        entries[1].texture.sampleType = WGPUTextureSampleType_Float;
+        entries[1].texture.viewDimension = WGPUTextureViewDimension_2D;
+        WGPUBindGroupLayoutDescriptor layout_desc = {};
+        layout_desc.entryCount = 2;
+        layout_desc.entries = entries;
+        g_MipBindGroupLayout = wgpuDeviceCreateBindGroupLayout(g_GfxData.device, &layout_desc);
+    }
+    if (!g_MipModule || !g_MipSampler || !g_MipBindGroupLayout)
+        return nullptr;
+
+    WGPUPipelineLayoutDescriptor pipeline_layout_desc = {};
+    pipeline_layout_desc.bindGroupLayoutCount = 1;
+    pipeline_layout_desc.bindGroupLayouts = &g_MipBindGroupLayout;
+    WGPUPipelineLayout pipeline_layout = wgpuDeviceCreatePipelineLayout(g_GfxData.device, &pipeline_layout_desc);
+    if (!pipeline_layout)
+        return nullptr;
+
+    WGPUColorTargetState color_target = {};
+    color_target.format = format;
+    color_target.writeMask = WGPUColorWriteMask_All;
+
+    WGPUFragmentState fragment_state = {};
+    fragment_state.module = g_MipModule;
+    fragment_state.entryPoint = WGPU_STR("fs_main");
+    fragment_state.targetCount = 1;
+    fragment_state.targets = &color_target;
+
+    WGPURenderPipelineDescriptor pipeline_desc = {};
+    pipeline_desc.label = WGPU_STR("ImPlatform Mip Generation");
+    pipeline_desc.layout = pipeline_layout;
+    pipeline_desc.vertex.module = g_MipModule;
+    pipeline_desc.vertex.entryPoint = WGPU_STR("vs_main");
+    pipeline_desc.fragment = &fragment_state;
+    pipeline_desc.primitive.topology = WGPUPrimitiveTopology_TriangleList;
+    pipeline_desc.primitive.cullMode = WGPUCullMode_None;
+    pipeline_desc.multisample.count = 1;
+    pipeline_desc.multisample.mask = 0xFFFFFFFF;
+
+    WGPURenderPipeline pipeline = wgpuDeviceCreateRenderPipeline(g_GfxData.device, &pipeline_desc);
+    wgpuPipelineLayoutRelease(pipeline_layout);
+    if (!pipeline)
+        return nullptr;
+
+    g_MipPipelines[g_MipPipelineCount].format = format;
+    g_MipPipelines[g_MipPipelineCount].pipeline = pipeline;
+    g_MipPipelineCount++;
+    return pipeline;
+}
+
+// Rebuilds levels 1..mip_levels-1 from level 0. Submitted on the queue right away,
+// so it is ordered after any preceding wgpuQueueWriteTexture and before the next frame.
+static void ImPlatform_WGPU_GenerateMips(WGPUTexture texture, WGPUTextureFormat format, uint32_t mip_levels)
+{
+    if (mip_levels <= 1)
+        return;
+    WGPURenderPipeline pipeline = ImPlatform_WGPU_GetMipPipeline(format);
+    if (!pipeline)
+        return;
+
+    WGPUCommandEncoderDescriptor enc_desc = {};
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_GfxData.device, &enc_desc);
+
+    for (uint32_t level = 1; level < mip_levels; level++)
+    {
+        WGPUTextureViewDescriptor view_desc = {};
+        view_desc.format = format;
+        view_desc.dimension = WGPUTextureViewDimension_2D;
+        view_desc.mipLevelCount = 1;
+        view_desc.arrayLayerCount = 1;
+        view_desc.aspect = WGPUTextureAspect_All;
+        view_desc.baseMipLevel = level - 1;
+        WGPUTextureView src_view = wgpuTextureCreateView(texture, &view_desc);
+        view_desc.baseMipLevel = level;
+        WGPUTextureView dst_view = wgpuTextureCreateView(texture, &view_desc);
+
+        WGPUBindGroupEntry bg_entries[2] = {};
+        bg_entries[0].binding = 0;
+        bg_entries[0].sampler = g_MipSampler;
+        bg_entries[1].binding = 1;
+        bg_entries[1].textureView = src_view;
+        WGPUBindGroupDescriptor bg_desc = {};
+        bg_desc.layout = g_MipBindGroupLayout;
+        bg_desc.entryCount = 2;
+        bg_desc.entries = bg_entries;
+        WGPUBindGroup bind_group = wgpuDeviceCreateBindGroup(g_GfxData.device, &bg_desc);
+
+        WGPURenderPassColorAttachment color_attachment = {};
+        color_attachment.view = dst_view;
+        color_attachment.depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
+        color_attachment.loadOp = WGPULoadOp_Clear;
+        color_attachment.storeOp = WGPUStoreOp_Store;
+
+        WGPURenderPassDescriptor pass_desc = {};
+        pass_desc.colorAttachmentCount = 1;
+        pass_desc.colorAttachments = &color_attachment;
+
+        WGPURenderPassEncoder pass = wgpuCommandEncoderBeginRenderPass(encoder, &pass_desc);
+        wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+        wgpuRenderPassEncoderSetBindGroup(pass, 0, bind_group, 0, nullptr);
+        wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+        wgpuRenderPassEncoderEnd(pass);
+        wgpuRenderPassEncoderRelease(pass);
+
+        wgpuBindGroupRelease(bind_group);
+        wgpuTextureViewRelease(dst_view);
+        wgpuTextureViewRelease(src_view);
+    }
+
+    WGPUCommandBufferDescriptor cmd_desc = {};
+    WGPUCommandBuffer cmd = wgpuCommandEncoderFinish(encoder, &cmd_desc);
+    wgpuQueueSubmit(g_GfxData.queue, 1, &cmd);
+    wgpuCommandBufferRelease(cmd);
+    wgpuCommandEncoderRelease(encoder);
+}
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !pixel_data || !g_GfxData.device)
         return NULL;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    // Compressed textures must be sized in whole blocks
+    const bool compressed = ImPlatform_CompressedBlockBytes(desc->format) != 0;
+    if (compressed && (!ImPlatform_SupportsPixelFormat(desc->format) || (desc->width & 3) || (desc->height & 3)))
+        return ImPlatform_CreateTexture_DecodeCompressed(pixel_data, desc);
+#endif
+
     int bytes_per_pixel;
     WGPUTextureFormat format = ImPlatform_GetWebGPUFormat(desc->format, &bytes_per_pixel);
 
@@ -1034,14 +1344,7 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     {
         size_t pixel_count = (size_t)desc->width * desc->height;
         converted_data = (unsigned char*)malloc(pixel_count * 4);
-        const unsigned char* src = (const unsigned char*)pixel_data;
-        for (size_t i = 0; i < pixel_count; i++)
-        {
-            converted_data[i * 4 + 0] = src[i * 3 + 0];
-            converted_data[i * 4 + 1] = src[i * 3 + 1];
-            converted_data[i * 4 + 2] = src[i * 3 + 2];
-            converted_data[i * 4 + 3] = 255;
-        }
+        ImPlatform_Convert_RGB8ToRGBA8(converted_data, pixel_data, pixel_count);
         upload_data = converted_data;
     }
 
@@ -1052,10 +1355,12 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     tex_desc.size.width = desc->width;
     tex_desc.size.height = desc->height;
     tex_desc.size.depthOrArrayLayers = 1;
-    tex_desc.mipLevelCount = 1;
+    tex_desc.mipLevelCount = ImPlatform_WGPU_CanGenerateMips(format) ? ImPlatform_TextureMipCount(desc) : 1;
     tex_desc.sampleCount = 1;
     tex_desc.format = format;
     tex_desc.usage = WGPUTextureUsage_TextureBinding | WGPUTextureUsage_CopyDst;
+    if (tex_desc.mipLevelCount > 1)
+        tex_desc.usage |= WGPUTextureUsage_RenderAttachment;
 
     WGPUTexture texture = wgpuDeviceCreateTexture(g_GfxData.device, &tex_desc);
     if (!texture)
@@ -1075,23 +1380,32 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     layout.offset = 0;
     layout.bytesPerRow = desc->width * bytes_per_pixel;
     layout.rowsPerImage = desc->height;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (compressed)
+    {
+        // Rows are rows of blocks
+        layout.bytesPerRow = (uint32_t)ImPlatform_CompressedRowBytes(desc->format, desc->width);
+        layout.rowsPerImage = desc->height / 4;
+    }
+#endif
 
     WGPUExtent3D writeSize = {};
     writeSize.width = desc->width;
     writeSize.height = desc->height;
     writeSize.depthOrArrayLayers = 1;
 
-    size_t data_size = (size_t)desc->width * desc->height * bytes_per_pixel;
+    size_t data_size = (size_t)layout.bytesPerRow * layout.rowsPerImage;
     wgpuQueueWriteTexture(g_GfxData.queue, &dst, upload_data, data_size, &layout, &writeSize);
 
     free(converted_data);
+    ImPlatform_WGPU_GenerateMips(texture, format, tex_desc.mipLevelCount);
 
     // Create texture view
     WGPUTextureViewDescriptor view_desc = {};
     view_desc.format = format;
     view_desc.dimension = WGPUTextureViewDimension_2D;
     view_desc.baseMipLevel = 0;
-    view_desc.mipLevelCount = 1;
+    view_desc.mipLevelCount = tex_desc.mipLevelCount;
     view_desc.baseArrayLayer = 0;
     view_desc.arrayLayerCount = 1;
     view_desc.aspect = WGPUTextureAspect_All;
@@ -1112,7 +1426,8 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateTexture(const void* pixel_data, cons
     sampler_desc.minFilter = (desc->min_filter == ImPlatform_TextureFilter_Nearest) ? WGPUFilterMode_Nearest : WGPUFilterMode_Linear;
     sampler_desc.mipmapFilter = WGPUMipmapFilterMode_Linear;
     sampler_desc.lodMinClamp = 0.0f;
-    sampler_desc.lodMaxClamp = 1000.0f;
+    // Only LinearMipLinear samples below level 0
+    sampler_desc.lodMaxClamp = (desc->min_filter == ImPlatform_TextureFilter_LinearMipLinear) ? 1000.0f : 0.0f;
     sampler_desc.compare = WGPUCompareFunction_Undefined;
     sampler_desc.maxAnisotropy = 1;
 
@@ -1147,10 +1462,20 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     if (!texture_id || !pixel_data || !g_GfxData.queue)
         return false;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (ImPlatform_IsDecodedCompressedTexture(texture_id))
+        return ImPlatform_UpdateTexture_DecodeCompressed(texture_id, pixel_data, x, y, width, height);
+#endif
+
     WGPUTextureView view = (WGPUTextureView)texture_id;
     ImPlatform_TextureTracking_WebGPU* tracking = ImPlatform_FindTrackedTexture(view);
     if (!tracking)
         return false;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    const bool compressed = ImPlatform_CompressedBlockBytes(tracking->format) != 0;
+    if (compressed && !ImPlatform_CompressedRegionValid(x, y, width, height, tracking->width, tracking->height))
+        return false;
+#endif
 
     int bytes_per_pixel;
     WGPUTextureFormat format = ImPlatform_GetWebGPUFormat(tracking->format, &bytes_per_pixel);
@@ -1163,14 +1488,7 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     {
         size_t pixel_count = (size_t)width * height;
         converted_data = (unsigned char*)malloc(pixel_count * 4);
-        const unsigned char* src = (const unsigned char*)pixel_data;
-        for (size_t i = 0; i < pixel_count; i++)
-        {
-            converted_data[i * 4 + 0] = src[i * 3 + 0];
-            converted_data[i * 4 + 1] = src[i * 3 + 1];
-            converted_data[i * 4 + 2] = src[i * 3 + 2];
-            converted_data[i * 4 + 3] = 255;
-        }
+        ImPlatform_Convert_RGB8ToRGBA8(converted_data, pixel_data, pixel_count);
         upload_data = converted_data;
     }
 
@@ -1184,19 +1502,35 @@ IMPLATFORM_API bool ImPlatform_UpdateTexture(ImTextureID texture_id, const void*
     layout.offset = 0;
     layout.bytesPerRow = width * bytes_per_pixel;
     layout.rowsPerImage = height;
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    if (compressed)
+    {
+        layout.bytesPerRow = (uint32_t)ImPlatform_CompressedRowBytes(tracking->format, width);
+        layout.rowsPerImage = height / 4;
+    }
+#endif
 
     WGPUExtent3D writeSize = {};
     writeSize.width = width;
     writeSize.height = height;
     writeSize.depthOrArrayLayers = 1;
 
-    size_t data_size = (size_t)width * height * bytes_per_pixel;
+    size_t data_size = (size_t)layout.bytesPerRow * layout.rowsPerImage;
     wgpuQueueWriteTexture(g_GfxData.queue, &dst, upload_data, data_size, &layout, &writeSize);
 
     free(converted_data);
+    ImPlatform_WGPU_GenerateMips(tracking->texture, format, wgpuTextureGetMipLevelCount(tracking->texture));
     return true;
 }
 
+// Streaming upload is not implemented on this backend; callers fall back to ImPlatform_UpdateTexture.
+IMPLATFORM_API void* ImPlatform_BeginTextureUpload(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int) { return NULL; }
+IMPLATFORM_API bool ImPlatform_EndTextureUpload(ImTextureID) { return false; }
+
+// No strided upload path on this backend: repack tightly, then CreateTexture/UpdateTexture
+IMPLATFORM_API ImTextureID ImPlatform_CreateTextureFromImageBuffer(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc) { return ImPlatform_CreateTextureFromImageBuffer_Repack(buffer, desc); }
+IMPLATFORM_API bool ImPlatform_UpdateTextureFromImageBuffer(ImTextureID texture_id, const ImImageBuffer* buffer) { return ImPlatform_UpdateTextureFromImageBuffer_Repack(texture_id, buffer); }
+
 IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_TextureDesc* desc)
 {
     if (!desc || !g_GfxData.device)
@@ -1214,7 +1548,8 @@ IMPLATFORM_API ImTextureID ImPlatform_CreateRenderTexture(const ImPlatform_Textu
     tex_desc.mipLevelCount            = 1;
     tex_desc.sampleCount              = 1;
     tex_desc.format                   = format;
-    tex_desc.usage                    = WGPUTextureUsage_TextureBinding | WGPUTextureUsage_RenderAttachment;
+    tex_desc.usage                    = WGPUTextureUsage_TextureBinding | WGPUTextureUsage_RenderAttachment |
+                                        WGPUTextureUsage_CopySrc | WGPUTextureUsage_CopyDst;
 
     WGPUTexture texture = wgpuDeviceCreateTexture(g_GfxData.device, &tex_desc);
     if (!texture)
@@ -1305,13 +1640,96 @@ IMPLATFORM_API void ImPlatform_EndRenderToTexture(void)
     g_RTEncoder = nullptr;
 }
 
-IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst) { (void)dst; return false; }
+#ifdef IMPLATFORM_WGPU_SURFACE_API
+// Textures queued by ImPlatform_CopyBackbuffer, copied once the frame has been submitted
+#define IMPLATFORM_WGPU_MAX_BACKBUFFER_COPIES 8
+static WGPUTextureView g_BackbufferCopies[IMPLATFORM_WGPU_MAX_BACKBUFFER_COPIES] = {};
+static int g_BackbufferCopyCount = 0;
+
+// A texture to texture copy does no format conversion and no scaling
+static bool ImPlatform_WGPU_MatchesBackbuffer(const ImPlatform_TextureTracking_WebGPU* tracking)
+{
+    int bytes_per_pixel;
+    return ImPlatform_GetWebGPUFormat(tracking->format, &bytes_per_pixel) == g_GfxData.swapChainFormat &&
+           tracking->width == g_GfxData.uSurfaceWidth && tracking->height == g_GfxData.uSurfaceHeight;
+}
+
+static void ImPlatform_WGPU_FlushBackbufferCopies(WGPUTexture backbuffer)
+{
+    if (g_BackbufferCopyCount == 0)
+        return;
+
+    WGPUCommandEncoderDescriptor enc_desc = {};
+    WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(g_GfxData.device, &enc_desc);
+
+    WGPUImageCopyTexture src = {};
+    src.texture = backbuffer;
+    src.aspect = WGPUTextureAspect_All;
+    WGPUExtent3D copy_size = {};
+    copy_size.width = g_GfxData.uSurfaceWidth;
+    copy_size.height = g_GfxData.uSurfaceHeight;
+    copy_size.depthOrArrayLayers = 1;
+
+    ImPlatform_TextureTracking_WebGPU* copied[IMPLATFORM_WGPU_MAX_BACKBUFFER_COPIES];
+    int copied_count = 0;
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+    {
+        ImPlatform_TextureTracking_WebGPU* tracking = ImPlatform_FindTrackedTexture(g_BackbufferCopies[i]);
+        if (!tracking || !ImPlatform_WGPU_MatchesBackbuffer(tracking))
+            continue; // Destroyed, or the surface was resized since
+        WGPUImageCopyTexture dst = {};
+        dst.texture = tracking->texture;
+        dst.aspect = WGPUTextureAspect_All;
+        wgpuCommandEncoderCopyTextureToTexture(encoder, &src, &dst, &copy_size);
+        copied[copied_count++] = tracking;
+    }
+    g_BackbufferCopyCount = 0;
+
+    WGPUCommandBufferDescriptor cmd_desc = {};
+    WGPUCommandBuffer cmd = wgpuCommandEncoderFinish(encoder, &cmd_desc);
+    wgpuQueueSubmit(g_GfxData.queue, 1, &cmd);
+    wgpuCommandBufferRelease(cmd);
+    wgpuCommandEncoderRelease(encoder);
+
+    for (int i = 0; i < copied_count; i++)
+        ImPlatform_WGPU_GenerateMips(copied[i]->texture, g_GfxData.swapChainFormat, wgpuTextureGetMipLevelCount(copied[i]->texture));
+}
+#endif
+
+// The copy is submitted right after the frame (ImPlatform_GfxAPIRender). Needs the
+// surface API, the legacy swapchain only exposes a view of the backbuffer.
+IMPLATFORM_API bool ImPlatform_CopyBackbuffer(ImTextureID dst)
+{
+#ifdef IMPLATFORM_WGPU_SURFACE_API
+    WGPUTextureView view = (WGPUTextureView)dst;
+    ImPlatform_TextureTracking_WebGPU* tracking = dst ? ImPlatform_FindTrackedTexture(view) : nullptr;
+    if (!tracking || !ImPlatform_WGPU_MatchesBackbuffer(tracking))
+        return false;
+
+    for (int i = 0; i < g_BackbufferCopyCount; i++)
+        if (g_BackbufferCopies[i] == view)
+            return true;
+    if (g_BackbufferCopyCount == IMPLATFORM_WGPU_MAX_BACKBUFFER_COPIES)
+        return false;
+    g_BackbufferCopies[g_BackbufferCopyCount++] = view;
+    return true;
+#else
+    (void)dst;
+    return false;
+#endif
+}
 IMPLATFORM_API void ImPlatform_GetBackbufferSize(unsigned int* width, unsigned int* height)
 {
     if (width)  *width  = g_ImPlatform_BackbufferW;
     if (height) *height = g_ImPlatform_BackbufferH;
 }
 
+// Asynchronous readback is not implemented on this backend
+IMPLATFORM_API ImPlatform_Readback ImPlatform_RequestReadback(ImTextureID, unsigned int, unsigned int, unsigned int, unsigned int, ImPlatform_ReadbackCallback, void*) { return NULL; }
+IMPLATFORM_API bool ImPlatform_IsReadbackReady(ImPlatform_Readback) { return false; }
+IMPLATFORM_API const void* ImPlatform_GetReadbackData(ImPlatform_Readback, unsigned int*) { return NULL; }
+IMPLATFORM_API void ImPlatform_ReleaseReadback(ImPlatform_Readback) {}
+
 IMPLATFORM_API bool ImPlatform_CopyTexture(ImTextureID dst, ImTextureID src)
 {
     if (!dst || !src || !g_GfxData.device)
@@ -1357,6 +1775,10 @@ IMPLATFORM_API void ImPlatform_DestroyTexture(ImTextureID texture_id)
     if (!texture_id)
         return;
 
+#if IMPLATFORM_GFX_SUPPORT_COMPRESSED_FORMATS
+    ImPlatform_ForgetDecodedCompressedTexture(texture_id);
+#endif
+
     WGPUTextureView view = (WGPUTextureView)texture_id;
     ImPlatform_TextureTracking_WebGPU* tracking = ImPlatform_FindTrackedTexture(view);
     if (tracking)
@@ -1560,6 +1982,20 @@ IMPLATFORM_API void ImPlatform_DrawIndexed(unsigned int primitive_type, unsigned
     }
 }
 
+// Transient geometry is only implemented on OpenGL3
+IMPLATFORM_API void* ImPlatform_AllocTransientVertices(const ImPlatform_VertexBufferDesc* /*desc*/, ImPlatform_VertexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+IMPLATFORM_API void* ImPlatform_AllocTransientIndices(unsigned int /*index_count*/, ImPlatform_IndexFormat /*format*/, ImPlatform_IndexBuffer* out_buffer) { if (out_buffer) *out_buffer = NULL; return NULL; }
+
+// Instanced drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API void ImPlatform_BindInstanceBuffer(ImPlatform_VertexBuffer /*instance_buffer*/) {}
+IMPLATFORM_API void ImPlatform_DrawIndexedInstanced(unsigned int /*primitive_type*/, unsigned int /*index_count*/, unsigned int /*start_index*/, unsigned int /*instance_count*/, unsigned int /*start_instance*/) {}
+
+// Indirect drawing is only implemented on OpenGL3 and Vulkan
+IMPLATFORM_API ImPlatform_IndirectBuffer ImPlatform_CreateIndirectBuffer(const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*draw_count*/, ImPlatform_BufferUsage /*usage*/) { return NULL; }
+IMPLATFORM_API bool ImPlatform_UpdateIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/, const ImPlatform_DrawIndexedIndirectArgs* /*args*/, unsigned int /*offset*/, unsigned int /*count*/) { return false; }
+IMPLATFORM_API void ImPlatform_DestroyIndirectBuffer(ImPlatform_IndirectBuffer /*buffer*/) {}
+IMPLATFORM_API void ImPlatform_MultiDrawIndexedIndirect(unsigned int /*primitive_type*/, ImPlatform_IndirectBuffer /*indirect_buffer*/, unsigned int /*first_draw*/, unsigned int /*draw_count*/) {}
+
 // ============================================================================
 // Custom Shader System API - WebGPU Implementation
 // ============================================================================
@@ -1570,6 +2006,8 @@ struct ImPlatform_ShaderData_WebGPU
     WGPUShaderModule shaderModule;
     ImPlatform_ShaderStage stage;
     char* entryPoint;
+    ImPlatform_ShaderNameTable members;  // Uniform struct members past the projection: name -> offset from 64, size
+    unsigned int membersEnd;             // End of the last reflected member, relative to offset 64
 };
 
 struct ImPlatform_ShaderProgramData_WebGPU
@@ -1584,10 +2022,231 @@ struct ImPlatform_ShaderProgramData_WebGPU
     void* uniformData;       // Custom uniforms (not including projection matrix)
     size_t uniformDataSize;
     bool uniformDataDirty;
+    ImPlatform_ShaderNameTable uniformMembers; // Reflected uniform struct members of both stages
     char* vertexEntryPoint;
     char* fragmentEntryPoint;
 };
 
+// The projection matrix occupies the first 64 bytes of the uniform buffer
+#define IMPLATFORM_WGPU_SHADER_CONSTANTS_OFFSET 64
+
+// Minimal WGSL scanner used by the uniform reflection
+struct ImPlatform_WgslCursor_WebGPU
+{
+    const char* p;
+    const char* end;
+};
+
+static void ImPlatform_WGPU_WgslSkipSpace(ImPlatform_WgslCursor_WebGPU* c)
+{
+    while (c->p < c->end)
+    {
+        if (*c->p == ' ' || *c->p == '\t' || *c->p == '\r' || *c->p == '\n')
+            c->p++;
+        else if (c->p + 1 < c->end && c->p[0] == '/' && c->p[1] == '/')
+            while (c->p < c->end && *c->p != '\n') c->p++;
+        else if (c->p + 1 < c->end && c->p[0] == '/' && c->p[1] == '*')
+        {
+            c->p += 2;
+            while (c->p + 1 < c->end && !(c->p[0] == '*' && c->p[1] == '/')) c->p++;
+            c->p = c->p + 2 < c->end ? c->p + 2 : c->end;
+        }
+        else
+            break;
+    }
+}
+
+static bool ImPlatform_WGPU_WgslIsIdent(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_';
+}
+
+// Reads an identifier, returns its length (0 if none)
+static size_t ImPlatform_WGPU_WgslIdent(ImPlatform_WgslCursor_WebGPU* c, const char** out)
+{
+    ImPlatform_WGPU_WgslSkipSpace(c);
+    *out = c->p;
+    while (c->p < c->end && ImPlatform_WGPU_WgslIsIdent(*c->p))
+        c->p++;
+    return (size_t)(c->p - *out);
+}
+
+static bool ImPlatform_WGPU_WgslExpect(ImPlatform_WgslCursor_WebGPU* c, char ch)
+{
+    ImPlatform_WGPU_WgslSkipSpace(c);
+    if (c->p >= c->end || *c->p != ch)
+        return false;
+    c->p++;
+    return true;
+}
+
+static bool ImPlatform_WGPU_WgslIsWord(const char* s, size_t len, const char* word)
+{
+    return strlen(word) == len && strncmp(s, word, len) == 0;
+}
+
+// Alignment and size of a WGSL type in the uniform address space
+static bool ImPlatform_WGPU_WgslTypeLayout(ImPlatform_WgslCursor_WebGPU* c, unsigned int* out_align, unsigned int* out_size, int depth)
+{
+    const char* name;
+    size_t len = ImPlatform_WGPU_WgslIdent(c, &name);
+    if (len == 0 || depth > 4)
+        return false;
+
+    // Scalar size from the template argument (vec4<f32>) or the shorthand suffix (vec4f)
+    unsigned int scalar = 4;
+    unsigned int columns = 0, rows = 0;
+    if (len >= 4 && strncmp(name, "vec", 3) == 0 && name[3] >= '2' && name[3] <= '4')
+        rows = (unsigned int)(name[3] - '0');
+    else if (len >= 6 && strncmp(name, "mat", 3) == 0 && name[4] == 'x' && name[3] >= '2' && name[3] <= '4' && name[5] >= '2' && name[5] <= '4')
+    {
+        columns = (unsigned int)(name[3] - '0');
+        rows = (unsigned int)(name[5] - '0');
+    }
+    else if (ImPlatform_WGPU_WgslIsWord(name, len, "array"))
+    {
+        unsigned int elem_align = 0, elem_size = 0;
+        if (!ImPlatform_WGPU_WgslExpect(c, '<') || !ImPlatform_WGPU_WgslTypeLayout(c, &elem_align, &elem_size, depth + 1) || !ImPlatform_WGPU_WgslExpect(c, ','))
+            return false;
+        ImPlatform_WGPU_WgslSkipSpace(c);
+        unsigned long count = strtoul(c->p, (char**)&c->p, 0);
+        while (c->p < c->end && ImPlatform_WGPU_WgslIsIdent(*c->p)) c->p++;  // 'u' / 'i' suffix
+        if (count == 0 || !ImPlatform_WGPU_WgslExpect(c, '>'))
+            return false;
+        const unsigned int stride = (elem_size + elem_align - 1) / elem_align * elem_align;
+        *out_align = elem_align < 16 ? 16 : elem_align;
+        *out_size = (unsigned int)count * stride;
+        return true;
+    }
+    else
+    {
+        if (ImPlatform_WGPU_WgslIsWord(name, len, "f32") || ImPlatform_WGPU_WgslIsWord(name, len, "i32") || ImPlatform_WGPU_WgslIsWord(name, len, "u32"))
+            *out_align = *out_size = 4;
+        else if (ImPlatform_WGPU_WgslIsWord(name, len, "f16"))
+            *out_align = *out_size = 2;
+        else
+            return false;  // Nested structs / unsupported types
+        return true;
+    }
+
+    const size_t prefix = columns ? 6 : 4;
+    if (len == prefix + 1)
+        scalar = name[prefix] == 'h' ? 2 : 4;
+    else if (len != prefix)
+        return false;
+    else
+    {
+        const char* scalar_name;
+        size_t scalar_len;
+        if (!ImPlatform_WGPU_WgslExpect(c, '<') || (scalar_len = ImPlatform_WGPU_WgslIdent(c, &scalar_name)) == 0 || !ImPlatform_WGPU_WgslExpect(c, '>'))
+            return false;
+        scalar = ImPlatform_WGPU_WgslIsWord(scalar_name, scalar_len, "f16") ? 2 : 4;
+    }
+
+    const unsigned int vec_align = (rows == 2 ? 2 : 4) * scalar;
+    const unsigned int vec_size = rows * scalar;
+    *out_align = vec_align;
+    *out_size = columns ? columns * ((vec_size + vec_align - 1) / vec_align * vec_align) : vec_size;
+    return true;
+}
+
+// Records the members of the struct bound as `var<uniform>` in `source`. Members past
+// the projection matrix are kept with offsets relative to 64, the start of uniformData.
+static bool ImPlatform_WGPU_ReflectUniforms(const char* source, ImPlatform_ShaderData_WebGPU* shader_data)
+{
+    const char* var = strstr(source, "var<uniform>");
+    if (!var)
+        return false;
+
+    // var<uniform> name : Type ;
+    ImPlatform_WgslCursor_WebGPU c = { var + 12, source + strlen(source) };
+    const char* ident;
+    const char* type_name;
+    size_t type_len;
+    if (!ImPlatform_WGPU_WgslIdent(&c, &ident) || !ImPlatform_WGPU_WgslExpect(&c, ':') || (type_len = ImPlatform_WGPU_WgslIdent(&c, &type_name)) == 0)
+        return false;
+
+    // struct Type { ... }
+    const char* body = NULL;
+    for (const char* s = strstr(source, "struct"); s && !body; s = strstr(s + 6, "struct"))
+    {
+        if (s > source && ImPlatform_WGPU_WgslIsIdent(s[-1]))
+            continue;
+        ImPlatform_WgslCursor_WebGPU sc = { s + 6, c.end };
+        const char* struct_name;
+        size_t struct_len = ImPlatform_WGPU_WgslIdent(&sc, &struct_name);
+        if (struct_len == type_len && strncmp(struct_name, type_name, type_len) == 0 && ImPlatform_WGPU_WgslExpect(&sc, '{'))
+            body = sc.p;
+    }
+    if (!body)
+        return false;
+
+    ImPlatform_WgslCursor_WebGPU mc = { body, c.end };
+    unsigned int offset = 0;
+    for (;;)
+    {
+        ImPlatform_WGPU_WgslSkipSpace(&mc);
+        if (mc.p >= mc.end)
+            break;
+        if (*mc.p == '}')
+            return true;
+
+        // @align(n) / @size(n) override the natural layout, other attributes are ignored
+        unsigned int align_override = 0, size_override = 0;
+        while (ImPlatform_WGPU_WgslExpect(&mc, '@'))
+        {
+            const char* attr;
+            size_t attr_len = ImPlatform_WGPU_WgslIdent(&mc, &attr);
+            unsigned long value = 0;
+            if (ImPlatform_WGPU_WgslExpect(&mc, '('))
+            {
+                ImPlatform_WGPU_WgslSkipSpace(&mc);
+                value = strtoul(mc.p, (char**)&mc.p, 0);
+                while (mc.p < mc.end && *mc.p != ')') mc.p++;
+                mc.p = mc.p < mc.end ? mc.p + 1 : mc.end;
+            }
+            if (ImPlatform_WGPU_WgslIsWord(attr, attr_len, "align"))
+                align_override = (unsigned int)value;
+            else if (ImPlatform_WGPU_WgslIsWord(attr, attr_len, "size"))
+                size_override = (unsigned int)value;
+        }
+
+        const char* member;
+        size_t member_len = ImPlatform_WGPU_WgslIdent(&mc, &member);
+        unsigned int align = 0, size = 0;
+        if (member_len == 0 || !ImPlatform_WGPU_WgslExpect(&mc, ':') || !ImPlatform_WGPU_WgslTypeLayout(&mc, &align, &size, 0))
+            break;
+        if (align_override)
+            align = align_override;
+        offset = (offset + align - 1) / align * align;
+        const unsigned int data_size = size;
+        if (size_override)
+            size = size_override;
+
+        if (offset >= IMPLATFORM_WGPU_SHADER_CONSTANTS_OFFSET)
+        {
+            const unsigned int relative = offset - IMPLATFORM_WGPU_SHADER_CONSTANTS_OFFSET;
+            ImPlatform_ShaderNameTable_AddN(&shader_data->members, member, member_len, (int)relative, data_size);
+            if (relative + size > shader_data->membersEnd)
+                shader_data->membersEnd = relative + size;
+        }
+        offset += size;
+
+        if (!ImPlatform_WGPU_WgslExpect(&mc, ','))
+        {
+            ImPlatform_WGPU_WgslSkipSpace(&mc);
+            if (mc.p < mc.end && *mc.p == '}')
+                return true;
+            break;
+        }
+    }
+
+    // Layout not understood: fall back to call order packing
+    ImPlatform_ShaderNameTable_Free(&shader_data->members);
+    shader_data->membersEnd = 0;
+    return false;
+}
+
 // Caching strategy:
 //   Verified against imgui_impl_wgpu.h and the current webgpu.h headers
 //   bundled with this project: no pipeline cache type, no binary archive
@@ -1640,6 +2299,9 @@ IMPLATFORM_API ImPlatform_Shader ImPlatform_CreateShader(const ImPlatform_Shader
     shader_data->entryPoint = (char*)malloc(strlen(entry) + 1);
     strcpy(shader_data->entryPoint, entry);
 
+    // Uniform names are resolved against the WGSL struct layout once, here
+    ImPlatform_WGPU_ReflectUniforms(desc->source_code, shader_data);
+
     return shader_data;
 }
 
@@ -1654,6 +2316,7 @@ IMPLATFORM_API void ImPlatform_DestroyShader(ImPlatform_Shader shader)
         wgpuShaderModuleRelease(shader_data->shaderModule);
     if (shader_data->entryPoint)
         free(shader_data->entryPoint);
+    ImPlatform_ShaderNameTable_Free(&shader_data->members);
 
     delete shader_data;
 }
@@ -1790,6 +2453,27 @@ IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgram(ImPlatfor
     program_data->fragmentEntryPoint = (char*)malloc(strlen(fs_data->entryPoint) + 1);
     strcpy(program_data->fragmentEntryPoint, fs_data->entryPoint);
 
+    // Merge the members reflected from both stages and preallocate the block they span
+    unsigned int members_end = 0;
+    const ImPlatform_ShaderData_WebGPU* stages[2] = { vs_data, fs_data };
+    for (int s = 0; s < 2; s++)
+    {
+        const ImPlatform_ShaderNameTable* members = &stages[s]->members;
+        for (unsigned int i = 0; i < members->capacity; i++)
+            if (members->entries[i].hash)
+                ImPlatform_ShaderNameTable_AddN(&program_data->uniformMembers, members->entries[i].name, strlen(members->entries[i].name),
+                                                members->entries[i].value, members->entries[i].size);
+        if (stages[s]->membersEnd > members_end)
+            members_end = stages[s]->membersEnd;
+    }
+    if (members_end > 0)
+    {
+        program_data->uniformDataSize = (members_end + 15) & ~15u;
+        program_data->uniformData = calloc(1, program_data->uniformDataSize);
+        if (!program_data->uniformData)
+            program_data->uniformDataSize = 0;
+    }
+
     return program_data;
 }
 
@@ -1805,12 +2489,18 @@ IMPLATFORM_API void ImPlatform_DestroyShaderProgram(ImPlatform_ShaderProgram pro
     if (program_data->bindGroupLayout) wgpuBindGroupLayoutRelease(program_data->bindGroupLayout);
     if (program_data->renderPipeline) wgpuRenderPipelineRelease(program_data->renderPipeline);
     if (program_data->uniformData) free(program_data->uniformData);
+    ImPlatform_ShaderNameTable_Free(&program_data->uniformMembers);
     if (program_data->vertexEntryPoint) free(program_data->vertexEntryPoint);
     if (program_data->fragmentEntryPoint) free(program_data->fragmentEntryPoint);
 
     delete program_data;
 }
 
+// Asynchronous program creation is only implemented on OpenGL3 and Vulkan: programs are created synchronously
+IMPLATFORM_API ImPlatform_ShaderProgram ImPlatform_CreateShaderProgramAsync(ImPlatform_Shader vertex_shader, ImPlatform_Shader fragment_shader) { return ImPlatform_CreateShaderProgram(vertex_shader, fragment_shader); }
+IMPLATFORM_API bool ImPlatform_IsShaderProgramReady(ImPlatform_ShaderProgram program) { return program != NULL; }
+IMPLATFORM_API void ImPlatform_SetShaderProgramFallback(ImPlatform_ShaderProgram /*program*/) {}
+
 IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram program)
 {
     // WebGPU doesn't have a global "use program" concept
@@ -1818,12 +2508,29 @@ IMPLATFORM_API void ImPlatform_UseShaderProgram(ImPlatform_ShaderProgram program
     (void)program;
 }
 
-IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram program, const char* /*name*/, const void* data, unsigned int size)
+// Writes `name` into the program's preallocated uniform data. Returns false when
+// the name is not a reflected member.
+static bool ImPlatform_WGPU_WriteUniformMember(ImPlatform_ShaderProgramData_WebGPU* program_data, const char* name, const void* data, unsigned int size)
+{
+    const ImPlatform_ShaderNameEntry* member = ImPlatform_ShaderNameTable_Find(&program_data->uniformMembers, name);
+    if (!member || !program_data->uniformData || (size_t)member->value >= program_data->uniformDataSize)
+        return false;
+    size_t copy_size = size < member->size ? size : member->size;
+    if ((size_t)member->value + copy_size > program_data->uniformDataSize)
+        copy_size = program_data->uniformDataSize - (size_t)member->value;
+    memcpy((unsigned char*)program_data->uniformData + member->value, data, copy_size);
+    program_data->uniformDataDirty = true;
+    return true;
+}
+
+IMPLATFORM_API bool ImPlatform_SetShaderUniform(ImPlatform_ShaderProgram program, const char* name, const void* data, unsigned int size)
 {
     if (!program || !data || size == 0)
         return false;
 
     ImPlatform_ShaderProgramData_WebGPU* program_data = (ImPlatform_ShaderProgramData_WebGPU*)program;
+    if (program_data->uniformMembers.count > 0)
+        return name && ImPlatform_WGPU_WriteUniformMember(program_data, name, data, size);
 
     if (!program_data->uniformData || program_data->uniformDataSize != size)
     {
@@ -1853,27 +2560,34 @@ IMPLATFORM_API void ImPlatform_BeginUniformBlock(ImPlatform_ShaderProgram progra
         return;
 
     g_CurrentUniformBlockProgram = program;
-
-    if (g_UniformBlockData)
-    {
-        free(g_UniformBlockData);
-        g_UniformBlockData = nullptr;
-        g_UniformBlockSize = 0;
-    }
+    g_UniformBlockSize = 0;
 }
 
-IMPLATFORM_API bool ImPlatform_SetUniform(const char* /*name*/, const void* data, unsigned int size)
+IMPLATFORM_API bool ImPlatform_SetUniform(const char* name, const void* data, unsigned int size)
 {
     if (!g_CurrentUniformBlockProgram || !data || size == 0)
         return false;
 
+    // Reflected programs are written in place by name, in any order
+    ImPlatform_ShaderProgramData_WebGPU* program_data = (ImPlatform_ShaderProgramData_WebGPU*)g_CurrentUniformBlockProgram;
+    if (program_data->uniformMembers.count > 0)
+        return name && ImPlatform_WGPU_WriteUniformMember(program_data, name, data, size);
+
+    // Layout not reflected: pack in call order, the scratch only grows
     size_t new_size = g_UniformBlockSize + size;
-    void* new_data = realloc(g_UniformBlockData, new_size);
-    if (!new_data)
-        return false;
+    if (new_size > g_UniformBlockCapacity)
+    {
+        size_t capacity = g_UniformBlockCapacity ? g_UniformBlockCapacity * 2 : 256;
+        while (capacity < new_size)
+            capacity *= 2;
+        unsigned char* new_data = (unsigned char*)realloc(g_UniformBlockData, capacity);
+        if (!new_data)
+            return false;
+        g_UniformBlockData = new_data;
+        g_UniformBlockCapacity = capacity;
+    }
 
-    g_UniformBlockData = new_data;
-    memcpy((char*)g_UniformBlockData + g_UniformBlockSize, data, size);
+    memcpy(g_UniformBlockData + g_UniformBlockSize, data, size);
     g_UniformBlockSize = new_size;
 
     return true;
@@ -1884,9 +2598,10 @@ IMPLATFORM_API void ImPlatform_EndUniformBlock(ImPlatform_ShaderProgram program)
     if (!program || program != g_CurrentUniformBlockProgram)
         return;
 
-    if (g_UniformBlockData && g_UniformBlockSize > 0)
+    // Reflected programs were already written in place
+    ImPlatform_ShaderProgramData_WebGPU* program_data = (ImPlatform_ShaderProgramData_WebGPU*)program;
+    if (program_data->uniformMembers.count == 0 && g_UniformBlockSize > 0)
     {
-        ImPlatform_ShaderProgramData_WebGPU* program_data = (ImPlatform_ShaderProgramData_WebGPU*)program;
 
         // Store custom uniform data for later use in the render callback
         // The projection matrix will be prepended in the callback
@@ -1904,8 +2619,6 @@ IMPLATFORM_API void ImPlatform_EndUniformBlock(ImPlatform_ShaderProgram program)
             program_data->uniformDataDirty = true;
         }
 
-        free(g_UniformBlockData);
-        g_UniformBlockData = nullptr;
         g_UniformBlockSize = 0;
     }
 
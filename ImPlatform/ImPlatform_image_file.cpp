@@ -0,0 +1,425 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Memory-Mapped Image Files
+// Maps raw / PGM / PPM / PFM image files read-only and describes them with an ImImageBuffer.
+//
+// Nothing is read at open time except the header (or the JSON sidecar of a raw file): the OS
+// pages the pixels in when an upload touches them, so multi-GB captures open instantly and the
+// resident size follows what is actually displayed.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+struct ImPlatform_MappedImage_T
+{
+    const unsigned char* base;
+    size_t               size;
+};
+
+// ============================================================================
+// Mapping
+// ============================================================================
+
+static ImPlatform_MappedImage_T* ImPlatform_MapFile(const char* path)
+{
+    void* base = NULL;
+    size_t size = 0;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && (ULONGLONG)file_size.QuadPart <= (ULONGLONG)SIZE_MAX)
+    {
+        size = (size_t)file_size.QuadPart;
+        // The view keeps the mapping alive, both handles can be closed right away
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping)
+        {
+            base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 && (unsigned long long)st.st_size <= (unsigned long long)SIZE_MAX)
+    {
+        size = (size_t)st.st_size;
+        base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED)
+            base = NULL;
+    }
+    close(fd);
+#endif
+
+    if (!base)
+        return NULL;
+
+    ImPlatform_MappedImage_T* image = new ImPlatform_MappedImage_T;
+    image->base = (const unsigned char*)base;
+    image->size = size;
+    return image;
+}
+
+IMPLATFORM_API void ImPlatform_UnmapImageFile(ImPlatform_MappedImage image)
+{
+    if (!image)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(image->base);
+#else
+    munmap((void*)image->base, image->size);
+#endif
+    delete image;
+}
+
+IMPLATFORM_API void ImPlatform_TrimMappedImage(ImPlatform_MappedImage image)
+{
+    if (!image)
+        return;
+#ifdef _WIN32
+    // Unlocking pages that are not locked removes them from the working set
+    VirtualUnlock((LPVOID)image->base, image->size);
+#elif defined(MADV_DONTNEED)
+    // Clean file-backed pages: dropped from the process, kept in the page cache
+    madvise((void*)image->base, image->size, MADV_DONTNEED);
+#endif
+}
+
+// ============================================================================
+// Layout validation
+// ============================================================================
+
+// True when every sample addressed by `buf` (host == NULL, byte_offset from the file start) lies within `size` bytes
+static bool ImPlatform_ImageBufferFitsIn(const ImImageBuffer* buf, size_t size)
+{
+    if (!buf || buf->width == 0 || buf->height == 0 || buf->channels < 1 || buf->channels > 4)
+        return false;
+    const long long sample = (long long)ImPlatform_SampleTypeSize(buf->type);
+    if (sample == 0)
+        return false;
+
+    long long lo = (long long)buf->byte_offset, hi = lo;
+    const long long extents[3] = {
+        (long long)(buf->width - 1) * buf->x_stride_bytes,
+        (long long)(buf->height - 1) * buf->y_stride_bytes,
+        (long long)(buf->channels - 1) * buf->c_stride_bytes,
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        if (extents[i] < 0) lo += extents[i];
+        else                hi += extents[i];
+    }
+    return lo >= 0 && hi + sample <= (long long)size;
+}
+
+static ImPlatform_MappedImage ImPlatform_MapWithLayout(ImPlatform_MappedImage_T* image, ImImageBuffer* layout, ImImageBuffer* out_buffer, const char* path)
+{
+    if (!ImPlatform_ImageBufferFitsIn(layout, image->size))
+    {
+        fprintf(stderr, "[ImPlatform] %s: image layout exceeds the file size (%zu bytes)\n", path, image->size);
+        ImPlatform_UnmapImageFile(image);
+        return NULL;
+    }
+    layout->host = image->base;
+    if (layout->version == 0)
+        layout->version = 1;
+    *out_buffer = *layout;
+    return image;
+}
+
+static void ImPlatform_ImageBufferSetInterleaved(ImImageBuffer* buf, size_t row_stride)
+{
+    const ptrdiff_t sample = (ptrdiff_t)ImPlatform_SampleTypeSize(buf->type);
+    buf->c_stride_bytes = sample;
+    buf->x_stride_bytes = sample * buf->channels;
+    buf->y_stride_bytes = row_stride ? (ptrdiff_t)row_stride : buf->x_stride_bytes * buf->width;
+}
+
+IMPLATFORM_API ImPlatform_MappedImage ImPlatform_MapRawImageFile(const char* path, const ImImageBuffer* layout, ImImageBuffer* out_buffer)
+{
+    if (!path || !layout || !out_buffer)
+        return NULL;
+    ImPlatform_MappedImage_T* image = ImPlatform_MapFile(path);
+    if (!image)
+    {
+        fprintf(stderr, "[ImPlatform] Failed to map %s\n", path);
+        return NULL;
+    }
+    ImImageBuffer buf = *layout;
+    return ImPlatform_MapWithLayout(image, &buf, out_buffer, path);
+}
+
+// ============================================================================
+// PGM / PPM / PFM headers
+// ============================================================================
+
+// Next whitespace-separated token of a PNM / PFM header ('#' comments skipped). Returns its length, 0 at the end.
+static size_t ImPlatform_HeaderToken(const unsigned char* data, size_t size, size_t* cursor, char* out, size_t out_size)
+{
+    size_t i = *cursor;
+    for (;;)
+    {
+        while (i < size && (data[i] == ' ' || data[i] == '\t' || data[i] == '\r' || data[i] == '\n'))
+            i++;
+        if (i < size && data[i] == '#')
+        {
+            while (i < size && data[i] != '\n')
+                i++;
+            continue;
+        }
+        break;
+    }
+    size_t n = 0;
+    while (i < size && data[i] != ' ' && data[i] != '\t' && data[i] != '\r' && data[i] != '\n' && n + 1 < out_size)
+        out[n++] = (char)data[i++];
+    out[n] = '\0';
+    // A single whitespace byte separates the header from the pixels
+    *cursor = i < size ? i + 1 : i;
+    return n;
+}
+
+static bool ImPlatform_ParsePNM(const ImPlatform_MappedImage_T* image, ImImageBuffer* buf)
+{
+    size_t cursor = 0;
+    char magic[4], w[24], h[24], scale[32];
+    if (!ImPlatform_HeaderToken(image->base, image->size, &cursor, magic, sizeof(magic)))
+        return false;
+
+    const bool pnm = strcmp(magic, "P5") == 0 || strcmp(magic, "P6") == 0;
+    const bool pfm = strcmp(magic, "Pf") == 0 || strcmp(magic, "PF") == 0;
+    if (!pnm && !pfm)
+        return false;
+    if (!ImPlatform_HeaderToken(image->base, image->size, &cursor, w, sizeof(w)) ||
+        !ImPlatform_HeaderToken(image->base, image->size, &cursor, h, sizeof(h)) ||
+        !ImPlatform_HeaderToken(image->base, image->size, &cursor, scale, sizeof(scale)))
+        return false;
+
+    memset(buf, 0, sizeof(*buf));
+    buf->width       = (unsigned int)strtoul(w, NULL, 10);
+    buf->height      = (unsigned int)strtoul(h, NULL, 10);
+    buf->channels    = (magic[1] == '5' || magic[1] == 'f') ? 1 : 3;
+    buf->byte_offset = cursor;
+
+    if (pnm)
+    {
+        // 16-bit PNM samples are big-endian, which no upload path can consume as is
+        if (strtol(scale, NULL, 10) > 255)
+        {
+            fprintf(stderr, "[ImPlatform] 16-bit PGM/PPM is not supported (big-endian samples)\n");
+            return false;
+        }
+        buf->type = ImSampleType_U8;
+        ImPlatform_ImageBufferSetInterleaved(buf, 0);
+    }
+    else
+    {
+        // Negative scale means little-endian; rows are stored bottom to top
+        if (strtod(scale, NULL) >= 0.0)
+        {
+            fprintf(stderr, "[ImPlatform] Big-endian PFM is not supported\n");
+            return false;
+        }
+        buf->type = ImSampleType_F32;
+        ImPlatform_ImageBufferSetInterleaved(buf, 0);
+        buf->byte_offset += (size_t)buf->y_stride_bytes * (buf->height ? buf->height - 1 : 0);
+        buf->y_stride_bytes = -buf->y_stride_bytes;
+    }
+    return true;
+}
+
+// ============================================================================
+// Raw + JSON sidecar
+// ============================================================================
+// Just enough JSON for a flat object of numbers, strings and booleans.
+
+static const char* ImPlatform_JSON_FindValue(const char* json, const char* key)
+{
+    const size_t key_len = strlen(key);
+    for (const char* p = strchr(json, '"'); p; p = strchr(p + 1, '"'))
+    {
+        if (strncmp(p + 1, key, key_len) != 0 || p[1 + key_len] != '"')
+            continue;
+        const char* v = p + 2 + key_len;
+        while (*v == ' ' || *v == '\t' || *v == '\r' || *v == '\n')
+            v++;
+        if (*v != ':')
+            continue;
+        v++;
+        while (*v == ' ' || *v == '\t' || *v == '\r' || *v == '\n')
+            v++;
+        return v;
+    }
+    return NULL;
+}
+
+static unsigned long long ImPlatform_JSON_Number(const char* json, const char* key, unsigned long long default_value)
+{
+    const char* v = ImPlatform_JSON_FindValue(json, key);
+    return (v && *v >= '0' && *v <= '9') ? strtoull(v, NULL, 10) : default_value;
+}
+
+static bool ImPlatform_JSON_String(const char* json, const char* key, char* out, size_t out_size)
+{
+    const char* v = ImPlatform_JSON_FindValue(json, key);
+    if (!v || *v != '"')
+        return false;
+    size_t n = 0;
+    for (v++; *v && *v != '"' && n + 1 < out_size; v++)
+        out[n++] = *v;
+    out[n] = '\0';
+    return true;
+}
+
+static bool ImPlatform_JSON_Bool(const char* json, const char* key)
+{
+    const char* v = ImPlatform_JSON_FindValue(json, key);
+    return v && strncmp(v, "true", 4) == 0;
+}
+
+static char* ImPlatform_ReadSidecar(const char* path)
+{
+    const size_t len = strlen(path);
+    char* sidecar = (char*)malloc(len + 6);
+    if (!sidecar)
+        return NULL;
+
+    // "<path>.json", then "<path without extension>.json"
+    FILE* f = NULL;
+    memcpy(sidecar, path, len);
+    memcpy(sidecar + len, ".json", 6);
+    f = fopen(sidecar, "rb");
+    if (!f)
+    {
+        const char* dot = strrchr(path, '.');
+        const char* sep = strrchr(path, '/');
+        const char* sep2 = strrchr(path, '\\');
+        if (sep2 > sep)
+            sep = sep2;
+        if (dot && (!sep || dot > sep))
+        {
+            memcpy(sidecar + (dot - path), ".json", 6);
+            f = fopen(sidecar, "rb");
+        }
+    }
+    free(sidecar);
+    if (!f)
+        return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* json = size > 0 ? (char*)malloc((size_t)size + 1) : NULL;
+    if (json)
+    {
+        size_t read = fread(json, 1, (size_t)size, f);
+        json[read] = '\0';
+    }
+    fclose(f);
+    return json;
+}
+
+static bool ImPlatform_ParseSampleType(const char* name, ImSampleType* out_type)
+{
+    static const struct { const char* name; ImSampleType type; } types[] = {
+        { "u8",  ImSampleType_U8  }, { "i8",  ImSampleType_I8  },
+        { "u16", ImSampleType_U16 }, { "i16", ImSampleType_I16 },
+        { "u32", ImSampleType_U32 }, { "i32", ImSampleType_I32 },
+        { "f16", ImSampleType_F16 }, { "f32", ImSampleType_F32 },
+        { "f64", ImSampleType_F64 },
+    };
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+        if (strcmp(name, types[i].name) == 0)
+        {
+            *out_type = types[i].type;
+            return true;
+        }
+    return false;
+}
+
+static bool ImPlatform_ParseSidecar(const char* json, ImImageBuffer* buf)
+{
+    char type[8], layout[16];
+    memset(buf, 0, sizeof(*buf));
+    buf->width       = (unsigned int)ImPlatform_JSON_Number(json, "width", 0);
+    buf->height      = (unsigned int)ImPlatform_JSON_Number(json, "height", 0);
+    buf->channels    = (unsigned int)ImPlatform_JSON_Number(json, "channels", 1);
+    buf->byte_offset = (size_t)ImPlatform_JSON_Number(json, "offset", 0);
+    if (!ImPlatform_JSON_String(json, "type", type, sizeof(type)) || !ImPlatform_ParseSampleType(type, &buf->type))
+        return false;
+    if (!ImPlatform_JSON_String(json, "layout", layout, sizeof(layout)))
+        strcpy(layout, "interleaved");
+
+    const size_t row_stride = (size_t)ImPlatform_JSON_Number(json, "row_stride", 0);
+    if (strcmp(layout, "planar") == 0)
+    {
+        const ptrdiff_t sample = (ptrdiff_t)ImPlatform_SampleTypeSize(buf->type);
+        buf->x_stride_bytes = sample;
+        buf->y_stride_bytes = row_stride ? (ptrdiff_t)row_stride : sample * buf->width;
+        buf->c_stride_bytes = buf->y_stride_bytes * buf->height;
+    }
+    else if (strcmp(layout, "interleaved") == 0)
+        ImPlatform_ImageBufferSetInterleaved(buf, row_stride);
+    else
+        return false;
+
+    if (ImPlatform_JSON_Bool(json, "flip_y") && buf->height > 0)
+    {
+        buf->byte_offset += (size_t)buf->y_stride_bytes * (buf->height - 1);
+        buf->y_stride_bytes = -buf->y_stride_bytes;
+    }
+    return true;
+}
+
+IMPLATFORM_API ImPlatform_MappedImage ImPlatform_MapImageFile(const char* path, ImImageBuffer* out_buffer)
+{
+    if (!path || !out_buffer)
+        return NULL;
+
+    ImImageBuffer layout;
+    char* json = ImPlatform_ReadSidecar(path);
+    const bool has_sidecar = json != NULL;
+    if (has_sidecar)
+    {
+        const bool parsed = ImPlatform_ParseSidecar(json, &layout);
+        free(json);
+        if (!parsed)
+        {
+            fprintf(stderr, "[ImPlatform] %s: invalid JSON sidecar\n", path);
+            return NULL;
+        }
+    }
+
+    ImPlatform_MappedImage_T* image = ImPlatform_MapFile(path);
+    if (!image)
+    {
+        fprintf(stderr, "[ImPlatform] Failed to map %s\n", path);
+        return NULL;
+    }
+
+    if (!has_sidecar && !ImPlatform_ParsePNM(image, &layout))
+    {
+        fprintf(stderr, "[ImPlatform] %s: unknown image format (expected PGM/PPM/PFM or a JSON sidecar)\n", path);
+        ImPlatform_UnmapImageFile(image);
+        return NULL;
+    }
+    return ImPlatform_MapWithLayout(image, &layout, out_buffer, path);
+}
@@ -0,0 +1,665 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Shader Bytecode Cache
+// Single indexed pack file holding every cached shader blob of a graphics backend.
+//
+// The pack is mapped once when the backend opens the cache; lookups binary search the in-memory
+// index and decompress straight from the mapping, so a cold start costs one open and one map
+// whatever the number of shaders. New entries stay in memory until the cache is flushed (backend
+// shutdown): the whole pack is then rewritten to a temporary file, least recently used entries
+// first dropped past the size cap, and renamed over the old pack so readers never see a partial one.
+//
+// Layout (native endianness, a pack from another machine is rejected by its magic/device hash):
+//   ImPlatform_ShaderPackHeader
+//   ImPlatform_ShaderPackEntry[entry_count]   sorted by key
+//   entry blobs                               LZ4 block format, raw when it doesn't shrink
+
+#include "ImPlatform_Internal.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #include <direct.h>
+    #define IMPLATFORM_MKDIR_(path) _mkdir(path)
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/types.h>
+    #include <unistd.h>
+    #define IMPLATFORM_MKDIR_(path) mkdir((path), 0755)
+#endif
+
+// Default size cap of a pack, see ImPlatform_SetShaderCacheMaxSize
+#ifndef IMPLATFORM_SHADER_CACHE_MAX_BYTES
+#define IMPLATFORM_SHADER_CACHE_MAX_BYTES (64u * 1024u * 1024u)
+#endif
+
+#define IMPLATFORM_SHADER_CACHE_DIR         "./shaders/bytecode_cache"
+#define IMPLATFORM_SHADER_PACK_VERSION      1u
+#define IMPLATFORM_SHADER_PACK_MAX_BLOB     (256u * 1024u * 1024u)  // Sanity bound on raw entry sizes
+
+struct ImPlatform_ShaderPackHeader
+{
+    char                magic[4];       // "IPSC"
+    unsigned int        version;
+    unsigned long long  device_hash;    // Backend + device/driver identity the blobs were produced for
+    unsigned long long  clock;          // Last use stamp handed out
+    unsigned int        entry_count;
+    unsigned int        reserved;
+};
+
+struct ImPlatform_ShaderPackEntry
+{
+    unsigned long long  key;            // Hash of the entry name
+    unsigned long long  last_use;       // Clock stamp of the last hit or save
+    unsigned long long  offset;         // From the start of the pack
+    unsigned int        stored_size;    // Bytes in the pack
+    unsigned int        raw_size;       // Bytes once decompressed (== stored_size: stored raw)
+};
+
+struct ImPlatform_ShaderCacheEntry
+{
+    unsigned long long   key;
+    unsigned long long   last_use;
+    const unsigned char* data;          // Into the mapping, or owned when added this run
+    unsigned int         stored_size;
+    unsigned int         raw_size;
+    bool                 owned;
+};
+
+struct ImPlatform_ShaderCache
+{
+    bool                         open;
+    bool                         dirty;
+    char                         path[512];
+    unsigned long long           device_hash;
+    unsigned long long           clock;
+    const unsigned char*         map_base;
+    size_t                       map_size;
+    ImPlatform_ShaderCacheEntry* entries;       // Sorted by key
+    unsigned int                 count;
+    unsigned int                 capacity;
+    size_t                       max_bytes;
+};
+static ImPlatform_ShaderCache g_ShaderCache = { false, false, { 0 }, 0, 0, NULL, 0, NULL, 0, 0, IMPLATFORM_SHADER_CACHE_MAX_BYTES };
+
+// ============================================================================
+// LZ4 block format
+// ============================================================================
+// Greedy single-probe compressor: shader bytecode is small and highly repetitive (SPIR-V words,
+// DXBC chunk tables), decompression speed is what matters at startup.
+
+#define IMPLATFORM_LZ4_HASH_LOG     12
+#define IMPLATFORM_LZ4_MIN_MATCH    4
+#define IMPLATFORM_LZ4_LAST_LITERALS 5      // Spec: the last 5 bytes are always literals
+#define IMPLATFORM_LZ4_MATCH_LIMIT  12      // Spec: the last match starts at least 12 bytes before the end
+
+static inline size_t ImPlatform_LZ4_Bound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+static inline unsigned int ImPlatform_LZ4_Read32(const unsigned char* p)
+{
+    unsigned int v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline unsigned char* ImPlatform_LZ4_WriteLength(unsigned char* op, size_t len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+static unsigned char* ImPlatform_LZ4_WriteSequence(unsigned char* op, const unsigned char* literals, size_t literal_len,
+                                                   size_t offset, size_t match_len)
+{
+    unsigned char* token = op++;
+    *token = (unsigned char)((literal_len >= 15 ? 15 : literal_len) << 4);
+    if (literal_len >= 15)
+        op = ImPlatform_LZ4_WriteLength(op, literal_len - 15);
+    memcpy(op, literals, literal_len);
+    op += literal_len;
+    if (offset == 0)
+        return op; // Last sequence: literals only
+    *op++ = (unsigned char)(offset & 0xFF);
+    *op++ = (unsigned char)(offset >> 8);
+    match_len -= IMPLATFORM_LZ4_MIN_MATCH;
+    *token |= (unsigned char)(match_len >= 15 ? 15 : match_len);
+    if (match_len >= 15)
+        op = ImPlatform_LZ4_WriteLength(op, match_len - 15);
+    return op;
+}
+
+// Returns the compressed size. dst holds at least ImPlatform_LZ4_Bound(src_size) bytes.
+static size_t ImPlatform_LZ4_Compress(const unsigned char* src, size_t src_size, unsigned char* dst)
+{
+    const unsigned char* ip = src;
+    const unsigned char* anchor = src;
+    const unsigned char* end = src + src_size;
+    unsigned char* op = dst;
+
+    if (src_size > IMPLATFORM_LZ4_MATCH_LIMIT)
+    {
+        const unsigned char* match_limit = end - IMPLATFORM_LZ4_MATCH_LIMIT;
+        const unsigned char* extend_limit = end - IMPLATFORM_LZ4_LAST_LITERALS;
+        unsigned int table[1u << IMPLATFORM_LZ4_HASH_LOG];
+        memset(table, 0, sizeof(table));
+
+        while (ip <= match_limit)
+        {
+            const unsigned int seq = ImPlatform_LZ4_Read32(ip);
+            const unsigned int h = (seq * 2654435761u) >> (32 - IMPLATFORM_LZ4_HASH_LOG);
+            const unsigned char* ref = src + table[h];
+            table[h] = (unsigned int)(ip - src);
+            if (ref >= ip || ip - ref > 0xFFFF || ImPlatform_LZ4_Read32(ref) != seq)
+            {
+                ip++;
+                continue;
+            }
+
+            const unsigned char* match_end = ip + IMPLATFORM_LZ4_MIN_MATCH;
+            ref += IMPLATFORM_LZ4_MIN_MATCH;
+            while (match_end < extend_limit && *match_end == *ref)
+            {
+                match_end++;
+                ref++;
+            }
+
+            op = ImPlatform_LZ4_WriteSequence(op, anchor, (size_t)(ip - anchor), (size_t)(match_end - ref), (size_t)(match_end - ip));
+            ip = anchor = match_end;
+        }
+    }
+
+    op = ImPlatform_LZ4_WriteSequence(op, anchor, (size_t)(end - anchor), 0, 0);
+    return (size_t)(op - dst);
+}
+
+// Decodes exactly dst_size bytes; false on malformed input (a corrupted pack is a cache miss).
+static bool ImPlatform_LZ4_Decompress(const unsigned char* src, size_t src_size, unsigned char* dst, size_t dst_size)
+{
+    const unsigned char* ip = src;
+    const unsigned char* iend = src + src_size;
+    unsigned char* op = dst;
+    unsigned char* oend = dst + dst_size;
+
+    while (ip < iend)
+    {
+        const unsigned int token = *ip++;
+
+        size_t literal_len = token >> 4;
+        if (literal_len == 15)
+        {
+            unsigned char b;
+            do
+            {
+                if (ip >= iend)
+                    return false;
+                b = *ip++;
+                literal_len += b;
+            } while (b == 255);
+        }
+        if (literal_len > (size_t)(iend - ip) || literal_len > (size_t)(oend - op))
+            return false;
+        memcpy(op, ip, literal_len);
+        op += literal_len;
+        ip += literal_len;
+        if (ip == iend)
+            break; // Last sequence
+
+        if (iend - ip < 2)
+            return false;
+        const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst))
+            return false;
+
+        size_t match_len = token & 15;
+        if (match_len == 15)
+        {
+            unsigned char b;
+            do
+            {
+                if (ip >= iend)
+                    return false;
+                b = *ip++;
+                match_len += b;
+            } while (b == 255);
+        }
+        match_len += IMPLATFORM_LZ4_MIN_MATCH;
+        if (match_len > (size_t)(oend - op))
+            return false;
+
+        // Overlapping copy (offset < match_len repeats the pattern)
+        const unsigned char* match = op - offset;
+        for (size_t i = 0; i < match_len; i++)
+            op[i] = match[i];
+        op += match_len;
+    }
+    return op == oend;
+}
+
+// ============================================================================
+// Pack mapping
+// ============================================================================
+
+static void ImPlatform_ShaderCache_EnsureDir(void)
+{
+    static bool created = false;
+    if (created)
+        return;
+    IMPLATFORM_MKDIR_("./shaders");
+    IMPLATFORM_MKDIR_(IMPLATFORM_SHADER_CACHE_DIR);
+    created = true;
+}
+
+static const unsigned char* ImPlatform_ShaderCache_Map(const char* path, size_t* out_size)
+{
+    void* base = NULL;
+    *out_size = 0;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && (ULONGLONG)file_size.QuadPart <= (ULONGLONG)SIZE_MAX)
+    {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping)
+        {
+            base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (base)
+                *out_size = (size_t)file_size.QuadPart;
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0 && (unsigned long long)st.st_size <= (unsigned long long)SIZE_MAX)
+    {
+        base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED)
+            base = NULL;
+        else
+            *out_size = (size_t)st.st_size;
+    }
+    close(fd);
+#endif
+
+    return (const unsigned char*)base;
+}
+
+static void ImPlatform_ShaderCache_Unmap(void)
+{
+    if (!g_ShaderCache.map_base)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile((LPCVOID)g_ShaderCache.map_base);
+#else
+    munmap((void*)g_ShaderCache.map_base, g_ShaderCache.map_size);
+#endif
+    g_ShaderCache.map_base = NULL;
+    g_ShaderCache.map_size = 0;
+}
+
+static int ImPlatform_ShaderCache_CompareKey(const void* a, const void* b)
+{
+    const unsigned long long ka = ((const ImPlatform_ShaderCacheEntry*)a)->key;
+    const unsigned long long kb = ((const ImPlatform_ShaderCacheEntry*)b)->key;
+    return ka < kb ? -1 : ka > kb ? 1 : 0;
+}
+
+static bool ImPlatform_ShaderCache_Reserve(unsigned int count)
+{
+    if (count <= g_ShaderCache.capacity)
+        return true;
+    unsigned int capacity = g_ShaderCache.capacity ? g_ShaderCache.capacity * 2 : 64;
+    while (capacity < count)
+        capacity *= 2;
+    ImPlatform_ShaderCacheEntry* entries = (ImPlatform_ShaderCacheEntry*)realloc(g_ShaderCache.entries, capacity * sizeof(ImPlatform_ShaderCacheEntry));
+    if (!entries)
+        return false;
+    g_ShaderCache.entries = entries;
+    g_ShaderCache.capacity = capacity;
+    return true;
+}
+
+static void ImPlatform_ShaderCache_FreeEntries(void)
+{
+    for (unsigned int i = 0; i < g_ShaderCache.count; i++)
+        if (g_ShaderCache.entries[i].owned)
+            free((void*)g_ShaderCache.entries[i].data);
+    free(g_ShaderCache.entries);
+    g_ShaderCache.entries = NULL;
+    g_ShaderCache.count = 0;
+    g_ShaderCache.capacity = 0;
+}
+
+// Maps the pack at g_ShaderCache.path and loads its index. A missing, truncated or foreign pack
+// leaves the cache empty; it is replaced on the next flush.
+static void ImPlatform_ShaderCache_LoadPack(void)
+{
+    size_t size = 0;
+    const unsigned char* base = ImPlatform_ShaderCache_Map(g_ShaderCache.path, &size);
+    if (!base)
+        return;
+    g_ShaderCache.map_base = base;
+    g_ShaderCache.map_size = size;
+
+    ImPlatform_ShaderPackHeader header;
+    if (size < sizeof(header))
+        return;
+    memcpy(&header, base, sizeof(header));
+    if (memcmp(header.magic, "IPSC", 4) != 0 || header.version != IMPLATFORM_SHADER_PACK_VERSION)
+        return;
+    if (header.device_hash != g_ShaderCache.device_hash)
+    {
+        fprintf(stderr, "[ImPlatform shader cache] pack built for another device or driver, starting fresh\n");
+        return;
+    }
+    if (header.entry_count > (size - sizeof(header)) / sizeof(ImPlatform_ShaderPackEntry))
+        return;
+    if (!ImPlatform_ShaderCache_Reserve(header.entry_count))
+        return;
+
+    const unsigned char* index = base + sizeof(header);
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < header.entry_count; i++)
+    {
+        ImPlatform_ShaderPackEntry pe;
+        memcpy(&pe, index + (size_t)i * sizeof(pe), sizeof(pe));
+        if (pe.offset > size || pe.stored_size > size - pe.offset || pe.stored_size == 0 ||
+            pe.raw_size < pe.stored_size || pe.raw_size > IMPLATFORM_SHADER_PACK_MAX_BLOB)
+            continue;
+        ImPlatform_ShaderCacheEntry* e = &g_ShaderCache.entries[count++];
+        e->key = pe.key;
+        e->last_use = pe.last_use;
+        e->data = base + pe.offset;
+        e->stored_size = pe.stored_size;
+        e->raw_size = pe.raw_size;
+        e->owned = false;
+    }
+    g_ShaderCache.count = count;
+    g_ShaderCache.clock = header.clock;
+    qsort(g_ShaderCache.entries, count, sizeof(ImPlatform_ShaderCacheEntry), ImPlatform_ShaderCache_CompareKey);
+}
+
+static ImPlatform_ShaderCacheEntry* ImPlatform_ShaderCache_Find(unsigned long long key, unsigned int* out_insert)
+{
+    unsigned int lo = 0, hi = g_ShaderCache.count;
+    while (lo < hi)
+    {
+        unsigned int mid = (lo + hi) / 2;
+        if (g_ShaderCache.entries[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (out_insert)
+        *out_insert = lo;
+    if (lo < g_ShaderCache.count && g_ShaderCache.entries[lo].key == key)
+        return &g_ShaderCache.entries[lo];
+    return NULL;
+}
+
+static int ImPlatform_ShaderCache_CompareLastUse(const void* a, const void* b)
+{
+    const unsigned long long ua = (*(const ImPlatform_ShaderCacheEntry* const*)a)->last_use;
+    const unsigned long long ub = (*(const ImPlatform_ShaderCacheEntry* const*)b)->last_use;
+    return ua < ub ? -1 : ua > ub ? 1 : 0;
+}
+
+// Drops least recently used entries until the blobs fit in max_bytes (0: unbounded)
+static void ImPlatform_ShaderCache_Evict(void)
+{
+    size_t total = 0;
+    for (unsigned int i = 0; i < g_ShaderCache.count; i++)
+        total += g_ShaderCache.entries[i].stored_size;
+    if (g_ShaderCache.max_bytes == 0 || total <= g_ShaderCache.max_bytes)
+        return;
+
+    ImPlatform_ShaderCacheEntry** by_use = (ImPlatform_ShaderCacheEntry**)malloc(g_ShaderCache.count * sizeof(ImPlatform_ShaderCacheEntry*));
+    if (!by_use)
+        return;
+    for (unsigned int i = 0; i < g_ShaderCache.count; i++)
+        by_use[i] = &g_ShaderCache.entries[i];
+    qsort(by_use, g_ShaderCache.count, sizeof(ImPlatform_ShaderCacheEntry*), ImPlatform_ShaderCache_CompareLastUse);
+
+    unsigned int evicted = 0;
+    for (unsigned int i = 0; i < g_ShaderCache.count && total > g_ShaderCache.max_bytes; i++, evicted++)
+    {
+        total -= by_use[i]->stored_size;
+        if (by_use[i]->owned)
+            free((void*)by_use[i]->data);
+        by_use[i]->data = NULL;
+    }
+    free(by_use);
+
+    unsigned int kept = 0;
+    for (unsigned int i = 0; i < g_ShaderCache.count; i++)
+        if (g_ShaderCache.entries[i].data)
+            g_ShaderCache.entries[kept++] = g_ShaderCache.entries[i];
+    g_ShaderCache.count = kept;
+    fprintf(stderr, "[ImPlatform shader cache] evicted %u least recently used entries (cap %zu bytes)\n",
+            evicted, g_ShaderCache.max_bytes);
+}
+
+// Writes the pack to a temporary file and renames it over the old one
+static bool ImPlatform_ShaderCache_Flush(void)
+{
+    if (!g_ShaderCache.open || !g_ShaderCache.dirty)
+        return true;
+
+    ImPlatform_ShaderCache_Evict();
+    ImPlatform_ShaderCache_EnsureDir();
+
+    char tmp_path[sizeof(g_ShaderCache.path) + 8];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", g_ShaderCache.path);
+    FILE* f = fopen(tmp_path, "wb");
+    if (!f)
+        return false;
+
+    ImPlatform_ShaderPackHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "IPSC", 4);
+    header.version = IMPLATFORM_SHADER_PACK_VERSION;
+    header.device_hash = g_ShaderCache.device_hash;
+    header.clock = g_ShaderCache.clock;
+    header.entry_count = g_ShaderCache.count;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+
+    unsigned long long offset = sizeof(header) + (unsigned long long)g_ShaderCache.count * sizeof(ImPlatform_ShaderPackEntry);
+    for (unsigned int i = 0; ok && i < g_ShaderCache.count; i++)
+    {
+        const ImPlatform_ShaderCacheEntry* e = &g_ShaderCache.entries[i];
+        ImPlatform_ShaderPackEntry pe;
+        pe.key = e->key;
+        pe.last_use = e->last_use;
+        pe.offset = offset;
+        pe.stored_size = e->stored_size;
+        pe.raw_size = e->raw_size;
+        ok = fwrite(&pe, sizeof(pe), 1, f) == 1;
+        offset += e->stored_size;
+    }
+    for (unsigned int i = 0; ok && i < g_ShaderCache.count; i++)
+        ok = fwrite(g_ShaderCache.entries[i].data, 1, g_ShaderCache.entries[i].stored_size, f) == g_ShaderCache.entries[i].stored_size;
+    if (fclose(f) != 0)
+        ok = false;
+    if (!ok)
+    {
+        remove(tmp_path);
+        return false;
+    }
+
+    // Entries still point into the old mapping: the new pack is remapped once it replaced it
+    // (Windows can't replace a mapped file)
+    ImPlatform_ShaderCache_FreeEntries();
+    ImPlatform_ShaderCache_Unmap();
+#ifdef _WIN32
+    ok = MoveFileExA(tmp_path, g_ShaderCache.path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    ok = rename(tmp_path, g_ShaderCache.path) == 0;
+#endif
+    if (!ok)
+        remove(tmp_path);
+    ImPlatform_ShaderCache_LoadPack();
+    g_ShaderCache.dirty = false;
+    return ok;
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+void ImPlatform_ShaderCacheOpen(const char* backend, const void* device_id, size_t device_id_size)
+{
+    unsigned long long device_hash = ImPlatform_ShaderCacheHashBytes(backend, strlen(backend));
+    if (device_id && device_id_size)
+        device_hash ^= ImPlatform_ShaderCacheHashBytes(device_id, device_id_size) * 1099511628211ull;
+    if (g_ShaderCache.open && g_ShaderCache.device_hash == device_hash)
+        return;
+    ImPlatform_ShaderCacheClose();
+
+    snprintf(g_ShaderCache.path, sizeof(g_ShaderCache.path), IMPLATFORM_SHADER_CACHE_DIR "/%s.impack", backend);
+    g_ShaderCache.device_hash = device_hash;
+    g_ShaderCache.clock = 0;
+    g_ShaderCache.dirty = false;
+    g_ShaderCache.open = true;
+    ImPlatform_ShaderCache_LoadPack();
+    if (g_ShaderCache.count)
+        fprintf(stderr, "[ImPlatform shader cache] opened %s (%u entries)\n", g_ShaderCache.path, g_ShaderCache.count);
+}
+
+void ImPlatform_ShaderCacheClose(void)
+{
+    if (!g_ShaderCache.open)
+        return;
+    if (!ImPlatform_ShaderCache_Flush())
+        fprintf(stderr, "[ImPlatform shader cache] failed to write %s\n", g_ShaderCache.path);
+    ImPlatform_ShaderCache_FreeEntries();
+    ImPlatform_ShaderCache_Unmap();
+    g_ShaderCache.open = false;
+}
+
+void ImPlatform_ShaderCacheBuildName(
+    char* out_name, size_t out_size,
+    const char* cache_key, const char* entry, const char* ext,
+    unsigned long long hash)
+{
+    snprintf(out_name, out_size, "%s_%s_%016llx.%s",
+             cache_key ? cache_key : "shader",
+             entry ? entry : "main",
+             hash,
+             ext ? ext : "bin");
+}
+
+void ImPlatform_ShaderCacheBuildFilePath(char* out_path, size_t out_size, const char* file_name)
+{
+    ImPlatform_ShaderCache_EnsureDir();
+    snprintf(out_path, out_size, IMPLATFORM_SHADER_CACHE_DIR "/%s", file_name);
+}
+
+void* ImPlatform_ShaderCacheLoad(const char* name, size_t* out_size)
+{
+    if (!name || !out_size)
+        return NULL;
+    *out_size = 0;
+    if (!g_ShaderCache.open)
+        return NULL;
+
+    ImPlatform_ShaderCacheEntry* e = ImPlatform_ShaderCache_Find(ImPlatform_ShaderCacheHashBytes(name, strlen(name)), NULL);
+    if (!e)
+        return NULL;
+
+    void* data = malloc(e->raw_size);
+    if (!data)
+        return NULL;
+    if (e->stored_size == e->raw_size)
+        memcpy(data, e->data, e->raw_size);
+    else if (!ImPlatform_LZ4_Decompress(e->data, e->stored_size, (unsigned char*)data, e->raw_size))
+    {
+        free(data);
+        return NULL;
+    }
+    // Use stamps only reach the disk with the next write, runs that only hit don't rewrite the pack
+    e->last_use = ++g_ShaderCache.clock;
+    *out_size = e->raw_size;
+    return data;
+}
+
+bool ImPlatform_ShaderCacheSave(const char* name, const void* data, size_t size)
+{
+    if (!name || !data || size == 0 || size > IMPLATFORM_SHADER_PACK_MAX_BLOB || !g_ShaderCache.open)
+        return false;
+
+    unsigned char* stored = (unsigned char*)malloc(ImPlatform_LZ4_Bound(size));
+    if (!stored)
+        return false;
+    size_t stored_size = ImPlatform_LZ4_Compress((const unsigned char*)data, size, stored);
+    if (stored_size >= size)
+    {
+        memcpy(stored, data, size);
+        stored_size = size;
+    }
+    unsigned char* shrunk = (unsigned char*)realloc(stored, stored_size);
+    if (shrunk)
+        stored = shrunk;
+
+    unsigned int insert = 0;
+    const unsigned long long key = ImPlatform_ShaderCacheHashBytes(name, strlen(name));
+    ImPlatform_ShaderCacheEntry* e = ImPlatform_ShaderCache_Find(key, &insert);
+    if (e)
+    {
+        if (e->owned)
+            free((void*)e->data);
+    }
+    else
+    {
+        if (!ImPlatform_ShaderCache_Reserve(g_ShaderCache.count + 1))
+        {
+            free(stored);
+            return false;
+        }
+        e = &g_ShaderCache.entries[insert];
+        memmove(e + 1, e, (g_ShaderCache.count - insert) * sizeof(ImPlatform_ShaderCacheEntry));
+        g_ShaderCache.count++;
+        e->key = key;
+    }
+    e->data = stored;
+    e->stored_size = (unsigned int)stored_size;
+    e->raw_size = (unsigned int)size;
+    e->owned = true;
+    e->last_use = ++g_ShaderCache.clock;
+    g_ShaderCache.dirty = true;
+    return true;
+}
+
+IMPLATFORM_API void ImPlatform_SetShaderCacheMaxSize(size_t max_bytes)
+{
+    g_ShaderCache.max_bytes = max_bytes;
+}
+
+#else
+
+IMPLATFORM_API void ImPlatform_SetShaderCacheMaxSize(size_t max_bytes)
+{
+    (void)max_bytes;
+}
+
+#endif // IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
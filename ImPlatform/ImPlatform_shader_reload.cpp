@@ -0,0 +1,610 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Shader Hot Reload
+// Rebuilds watched shader programs when their source files change, without restarting the app.
+//
+// A watcher thread waits for file changes (inotify on Linux, modification time polling elsewhere)
+// and reads the new content. The render thread picks it up in ImPlatform_GfxAPINewFrame: only the
+// changed stages are recompiled (through the bytecode cache when the desc has a cache_key) and the
+// program is created with ImPlatform_CreateShaderProgramAsync, so the frame never waits for the
+// driver. Once the new program is ready it replaces the watched handle at the next frame boundary
+// and the previous one is destroyed after the frames that may still use it have completed.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #define IMPLATFORM_SHADER_RELOAD_THREADS 0
+#else
+    #define IMPLATFORM_SHADER_RELOAD_THREADS 1
+#endif
+
+#if IMPLATFORM_SHADER_RELOAD_THREADS
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+    #define IMPLATFORM_SHADER_RELOAD_INOTIFY 1
+    #include <limits.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#else
+    #define IMPLATFORM_SHADER_RELOAD_INOTIFY 0
+#endif
+#include <sys/stat.h>
+#include <sys/types.h>
+
+// Interval of the modification time polling (and of the quit check of the inotify wait)
+#ifndef IMPLATFORM_SHADER_RELOAD_POLL_MS
+#define IMPLATFORM_SHADER_RELOAD_POLL_MS 50
+#endif
+
+// Frames a replaced program stays alive, covers the frames in flight of every backend
+#ifndef IMPLATFORM_SHADER_RELOAD_RETIRE_FRAMES
+#define IMPLATFORM_SHADER_RELOAD_RETIRE_FRAMES 4
+#endif
+
+typedef std::chrono::steady_clock ImPlatform_ShaderReloadClock;
+
+// Shader created by a reload, shared by the builds using it
+struct ImPlatform_ShaderReloadShader
+{
+    ImPlatform_Shader shader;
+    int               refs;
+};
+
+// Program created by a reload (or the user's initial one, with no owned shaders)
+struct ImPlatform_ShaderReloadBuild
+{
+    ImPlatform_ShaderProgram        program;
+    ImPlatform_ShaderReloadShader*  shaders[2];     // NULL: shader owned by the user
+    int                             frames_left;    // Retired builds: destroyed once 0
+    ImPlatform_ShaderReloadBuild*   next;
+};
+
+struct ImPlatform_ShaderWatchStage
+{
+    ImPlatform_ShaderDesc           desc;           // Copy, entry_point / cache_key owned
+    char*                           path;           // NULL: stage not watched
+    const char*                     file_name;      // Into path
+    int                             wd;             // inotify directory watch, -1: polled
+    long long                       mtime;          // Polling
+    long long                       size;
+
+    // Watcher thread -> render thread, guarded by g_ShaderReload.mutex
+    unsigned long long              hash;           // Hash of the last content read
+    char*                           pending;        // New content, NUL-terminated
+    size_t                          pending_size;
+    ImPlatform_ShaderReloadClock::time_point changed_at;
+
+    // Render thread
+    char*                           source;         // Content of `latest` (or of the user's shader)
+    size_t                          source_size;
+    ImPlatform_ShaderReloadShader*  latest;         // Last shader that compiled, NULL: not built yet
+};
+
+struct ImPlatform_ShaderWatch_T
+{
+    ImPlatform_ShaderProgram*       slot;           // User variable holding the live program
+    ImPlatform_ShaderWatchStage     stages[2];
+    ImPlatform_ShaderReloadBuild    live;           // Program in *slot
+    ImPlatform_ShaderReloadBuild*   building;       // Created, not ready yet
+    ImPlatform_ShaderReloadBuild*   retired;
+    ImPlatform_ShaderReloadClock::time_point changed_at;
+    ImPlatform_ShaderWatch_T*       next;
+};
+
+struct ImPlatform_ShaderReloadState
+{
+    std::mutex                  mutex;
+    std::thread*                thread;         // Not joined at exit if a watch is leaked
+    std::atomic<bool>           quit;
+    std::atomic<bool>           has_pending;    // Some stage has pending content
+    int                         inotify_fd;
+    ImPlatform_ShaderWatch_T*   watches;
+};
+static ImPlatform_ShaderReloadState g_ShaderReload;
+
+// ============================================================================
+// Files
+// ============================================================================
+
+static char* ImPlatform_ShaderReload_StrDup(const char* s)
+{
+    if (!s)
+        return NULL;
+    size_t len = strlen(s) + 1;
+    char* copy = (char*)malloc(len);
+    if (copy)
+        memcpy(copy, s, len);
+    return copy;
+}
+
+// Whole file, NUL-terminated (GLSL/HLSL/WGSL sources are used as strings, SPIR-V as bytes)
+static char* ImPlatform_ShaderReload_ReadFile(const char* path, size_t* out_size)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return NULL;
+    char* data = NULL;
+    long size = -1;
+    if (fseek(f, 0, SEEK_END) == 0)
+        size = ftell(f);
+    if (size > 0 && fseek(f, 0, SEEK_SET) == 0)
+    {
+        data = (char*)malloc((size_t)size + 1);
+        if (data && fread(data, 1, (size_t)size, f) != (size_t)size)
+        {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(f);
+    if (!data)
+        return NULL;
+    data[size] = '\0';
+    *out_size = (size_t)size;
+    return data;
+}
+
+static bool ImPlatform_ShaderReload_Stat(const char* path, long long* mtime, long long* size)
+{
+    struct stat st;
+    if (stat(path, &st) != 0)
+        return false;
+    *mtime = (long long)st.st_mtime;
+    *size = (long long)st.st_size;
+    return true;
+}
+
+// Watcher thread: reads a stage whose file changed, keeps it if the content differs.
+// Called with g_ShaderReload.mutex held.
+static void ImPlatform_ShaderReload_ReadStage(ImPlatform_ShaderWatchStage* stage)
+{
+    size_t size = 0;
+    char* data = ImPlatform_ShaderReload_ReadFile(stage->path, &size);
+    if (!data)
+        return; // Mid-save (truncated or renamed away), the next event has the final content
+    const unsigned long long hash = ImPlatform_ShaderCacheHashBytes(data, size);
+    if (hash == stage->hash)
+    {
+        free(data);
+        return;
+    }
+    stage->hash = hash;
+    free(stage->pending);
+    stage->pending = data;
+    stage->pending_size = size;
+    stage->changed_at = ImPlatform_ShaderReloadClock::now();
+    g_ShaderReload.has_pending.store(true, std::memory_order_release);
+}
+
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+// Watch the directory of `stage`: editors often save to a temporary file renamed over the source
+static int ImPlatform_ShaderReload_WatchDirectory(const ImPlatform_ShaderWatchStage* stage)
+{
+    char dir[1024];
+    const char* slash = stage->file_name - 1;  // Last separator, if file_name isn't the whole path
+    if (stage->file_name != stage->path)
+        snprintf(dir, sizeof(dir), "%.*s", slash == stage->path ? 1 : (int)(slash - stage->path), stage->path);
+    else
+        snprintf(dir, sizeof(dir), ".");
+    return inotify_add_watch(g_ShaderReload.inotify_fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+}
+#endif
+
+static void ImPlatform_ShaderReload_ThreadMain(void)
+{
+    while (!g_ShaderReload.quit.load(std::memory_order_acquire))
+    {
+        bool waited = false;
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+        if (g_ShaderReload.inotify_fd >= 0)
+        {
+            waited = true;
+            struct pollfd pfd = { g_ShaderReload.inotify_fd, POLLIN, 0 };
+            alignas(struct inotify_event) char buffer[16 * (sizeof(struct inotify_event) + NAME_MAX + 1)];
+            ssize_t len = poll(&pfd, 1, IMPLATFORM_SHADER_RELOAD_POLL_MS) > 0 ? read(g_ShaderReload.inotify_fd, buffer, sizeof(buffer)) : 0;
+            if (len > 0)
+            {
+                std::lock_guard<std::mutex> lock(g_ShaderReload.mutex);
+                for (char* p = buffer; p < buffer + len; )
+                {
+                    const struct inotify_event* event = (const struct inotify_event*)p;
+                    p += sizeof(struct inotify_event) + event->len;
+                    if (!event->len)
+                        continue;
+                    for (ImPlatform_ShaderWatch_T* watch = g_ShaderReload.watches; watch; watch = watch->next)
+                        for (int s = 0; s < 2; s++)
+                        {
+                            ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+                            if (stage->path && stage->wd == event->wd && strcmp(stage->file_name, event->name) == 0)
+                                ImPlatform_ShaderReload_ReadStage(stage);
+                        }
+                }
+            }
+        }
+#endif
+        if (!waited)
+            std::this_thread::sleep_for(std::chrono::milliseconds(IMPLATFORM_SHADER_RELOAD_POLL_MS));
+
+        // Stages without a directory watch (no inotify, or the directory couldn't be watched
+        // yet) are polled; with inotify the watch is retried so they move to events once possible
+        std::lock_guard<std::mutex> lock(g_ShaderReload.mutex);
+        for (ImPlatform_ShaderWatch_T* watch = g_ShaderReload.watches; watch; watch = watch->next)
+            for (int s = 0; s < 2; s++)
+            {
+                ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+                long long mtime, size;
+                if (!stage->path || stage->wd >= 0)
+                    continue;
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+                if (g_ShaderReload.inotify_fd >= 0)
+                    stage->wd = ImPlatform_ShaderReload_WatchDirectory(stage);
+#endif
+                if (!ImPlatform_ShaderReload_Stat(stage->path, &mtime, &size))
+                    continue;
+                if (mtime == stage->mtime && size == stage->size)
+                    continue;
+                stage->mtime = mtime;
+                stage->size = size;
+                ImPlatform_ShaderReload_ReadStage(stage);
+            }
+    }
+}
+
+// Starts watching the directory of `stage`. Called with g_ShaderReload.mutex held.
+static void ImPlatform_ShaderReload_AddStage(ImPlatform_ShaderWatchStage* stage)
+{
+    const char* slash = strrchr(stage->path, '/');
+#ifdef _WIN32
+    const char* backslash = strrchr(stage->path, '\\');
+    if (backslash && (!slash || backslash > slash))
+        slash = backslash;
+#endif
+    stage->file_name = slash ? slash + 1 : stage->path;
+    stage->wd = -1;
+    ImPlatform_ShaderReload_Stat(stage->path, &stage->mtime, &stage->size);
+
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+    if (g_ShaderReload.inotify_fd < 0)
+        g_ShaderReload.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (g_ShaderReload.inotify_fd >= 0)
+    {
+        stage->wd = ImPlatform_ShaderReload_WatchDirectory(stage);
+        if (stage->wd < 0)
+            fprintf(stderr, "[ImPlatform shader reload] can't watch the directory of %s, polling it\n", stage->path);
+    }
+#endif
+}
+
+// ============================================================================
+// Builds
+// ============================================================================
+
+static void ImPlatform_ShaderReload_Release(ImPlatform_ShaderReloadShader* shader)
+{
+    if (shader && --shader->refs == 0)
+    {
+        ImPlatform_DestroyShader(shader->shader);
+        delete shader;
+    }
+}
+
+static void ImPlatform_ShaderReload_DestroyBuild(ImPlatform_ShaderReloadBuild* build)
+{
+    ImPlatform_DestroyShaderProgram(build->program);
+    ImPlatform_ShaderReload_Release(build->shaders[0]);
+    ImPlatform_ShaderReload_Release(build->shaders[1]);
+    delete build;
+}
+
+static ImPlatform_ShaderReloadShader* ImPlatform_ShaderReload_CreateShader(const ImPlatform_ShaderWatchStage* stage, const char* content, size_t size)
+{
+    ImPlatform_ShaderDesc desc = stage->desc;
+    if (desc.format == ImPlatform_ShaderFormat_SPIRV)
+    {
+        desc.source_code = NULL;
+        desc.bytecode = content;
+        desc.bytecode_size = (unsigned int)size;
+    }
+    else
+    {
+        desc.source_code = content;
+        desc.bytecode = NULL;
+        desc.bytecode_size = 0;
+    }
+    // OpenGL3: compile errors surface at link time instead of stalling the frame
+    desc.compile_flags |= IMPLATFORM_SHADER_COMPILE_ASYNC;
+
+    ImPlatform_Shader shader = ImPlatform_CreateShader(&desc);
+    if (!shader)
+        return NULL;
+    ImPlatform_ShaderReloadShader* result = new ImPlatform_ShaderReloadShader;
+    result->shader = shader;
+    result->refs = 1;
+    return result;
+}
+
+// Recompiles the stages with new content and starts creating the program
+static void ImPlatform_ShaderReload_Rebuild(ImPlatform_ShaderWatch_T* watch, char* content[2], size_t content_size[2])
+{
+    ImPlatform_ShaderReloadShader* shaders[2] = { NULL, NULL };
+    bool ok = true;
+    for (int s = 0; s < 2; s++)
+    {
+        ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+        if (content[s])
+            shaders[s] = ImPlatform_ShaderReload_CreateShader(stage, content[s], content_size[s]);
+        else if (stage->latest)
+            (shaders[s] = stage->latest)->refs++;
+        else
+            shaders[s] = ImPlatform_ShaderReload_CreateShader(stage, stage->source, stage->source_size); // First reload: the user's shader isn't ours to share
+        if (!shaders[s])
+        {
+            fprintf(stderr, "[ImPlatform shader reload] %s failed to compile, keeping the previous program\n",
+                    stage->path ? stage->path : "stage");
+            ok = false;
+        }
+    }
+
+    // Stages that compiled become the base of the next reloads, even if the other one failed
+    for (int s = 0; s < 2; s++)
+    {
+        ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+        if (shaders[s] && shaders[s] != stage->latest && (content[s] || !stage->latest))
+        {
+            ImPlatform_ShaderReload_Release(stage->latest);
+            (stage->latest = shaders[s])->refs++;
+            if (content[s])
+            {
+                free(stage->source);
+                stage->source = content[s];
+                stage->source_size = content_size[s];
+                content[s] = NULL;
+            }
+        }
+        free(content[s]);
+    }
+
+    ImPlatform_ShaderProgram program = ok ? ImPlatform_CreateShaderProgramAsync(shaders[0]->shader, shaders[1]->shader) : NULL;
+    if (!program)
+    {
+        if (ok)
+            fprintf(stderr, "[ImPlatform shader reload] program creation failed, keeping the previous program\n");
+        ImPlatform_ShaderReload_Release(shaders[0]);
+        ImPlatform_ShaderReload_Release(shaders[1]);
+        return;
+    }
+
+    // A newer edit supersedes the build in progress, which was never drawn with
+    if (watch->building)
+        ImPlatform_ShaderReload_DestroyBuild(watch->building);
+    ImPlatform_ShaderReloadBuild* build = new ImPlatform_ShaderReloadBuild;
+    build->program = program;
+    build->shaders[0] = shaders[0];
+    build->shaders[1] = shaders[1];
+    build->frames_left = 0;
+    build->next = NULL;
+    watch->building = build;
+}
+
+// Render thread, frame boundary: retire, swap ready programs, start rebuilds
+static void ImPlatform_ShaderReload_UpdateWatch(ImPlatform_ShaderWatch_T* watch, bool take_pending)
+{
+    for (ImPlatform_ShaderReloadBuild** it = &watch->retired; *it; )
+    {
+        ImPlatform_ShaderReloadBuild* build = *it;
+        if (--build->frames_left > 0)
+        {
+            it = &build->next;
+            continue;
+        }
+        *it = build->next;
+        ImPlatform_ShaderReload_DestroyBuild(build);
+    }
+
+    if (watch->building && ImPlatform_IsShaderProgramReady(watch->building->program))
+    {
+        ImPlatform_ShaderReloadBuild* old = new ImPlatform_ShaderReloadBuild(watch->live);
+        old->program = *watch->slot;
+        old->frames_left = IMPLATFORM_SHADER_RELOAD_RETIRE_FRAMES;
+        old->next = watch->retired;
+        watch->retired = old;
+
+        watch->live = *watch->building;
+        delete watch->building;
+        watch->building = NULL;
+        *watch->slot = watch->live.program;
+
+        const double ms = std::chrono::duration<double, std::milli>(ImPlatform_ShaderReloadClock::now() - watch->changed_at).count();
+        fprintf(stderr, "[ImPlatform shader reload] program swapped %.1f ms after the edit\n", ms);
+    }
+
+    if (!take_pending)
+        return;
+
+    char* content[2] = { NULL, NULL };
+    size_t content_size[2] = { 0, 0 };
+    {
+        std::lock_guard<std::mutex> lock(g_ShaderReload.mutex);
+        for (int s = 0; s < 2; s++)
+        {
+            ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+            if (!stage->pending)
+                continue;
+            content[s] = stage->pending;
+            content_size[s] = stage->pending_size;
+            watch->changed_at = stage->changed_at;
+            stage->pending = NULL;
+        }
+    }
+    if (content[0] || content[1])
+        ImPlatform_ShaderReload_Rebuild(watch, content, content_size);
+}
+
+void ImPlatform_ShaderReload_NewFrame(void)
+{
+    if (!g_ShaderReload.watches)
+        return;
+    const bool take_pending = g_ShaderReload.has_pending.exchange(false, std::memory_order_acquire);
+    for (ImPlatform_ShaderWatch_T* watch = g_ShaderReload.watches; watch; watch = watch->next)
+        ImPlatform_ShaderReload_UpdateWatch(watch, take_pending);
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+IMPLATFORM_API ImPlatform_ShaderWatch ImPlatform_WatchShaderProgram(
+    ImPlatform_ShaderProgram* program,
+    const ImPlatform_ShaderDesc* vs_desc, const char* vs_path,
+    const ImPlatform_ShaderDesc* fs_desc, const char* fs_path)
+{
+    if (!program || !*program || !vs_desc || !fs_desc || (!vs_path && !fs_path))
+        return NULL;
+
+    ImPlatform_ShaderWatch_T* watch = new ImPlatform_ShaderWatch_T();
+    watch->slot = program;
+    watch->live.program = *program;
+    const ImPlatform_ShaderDesc* descs[2] = { vs_desc, fs_desc };
+    const char* paths[2] = { vs_path, fs_path };
+    for (int s = 0; s < 2; s++)
+    {
+        ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+        stage->desc = *descs[s];
+        stage->desc.entry_point = ImPlatform_ShaderReload_StrDup(descs[s]->entry_point);
+        stage->desc.cache_key = ImPlatform_ShaderReload_StrDup(descs[s]->cache_key);
+        stage->path = ImPlatform_ShaderReload_StrDup(paths[s]);
+        stage->wd = -1;
+
+        // Content the user's shader was created from, to build this stage when only the other one changes
+        const void* data = descs[s]->bytecode;
+        size_t size = descs[s]->bytecode_size;
+        if (!data && descs[s]->source_code)
+        {
+            data = descs[s]->source_code;
+            size = strlen(descs[s]->source_code);
+        }
+        stage->source = (char*)malloc(size + 1);
+        if (stage->source)
+        {
+            if (size)
+                memcpy(stage->source, data, size);
+            stage->source[size] = '\0';
+            stage->source_size = size;
+        }
+        stage->hash = ImPlatform_ShaderCacheHashBytes(stage->source, stage->source_size);
+        stage->changed_at = ImPlatform_ShaderReloadClock::now();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_ShaderReload.mutex);
+        if (!g_ShaderReload.watches)
+            g_ShaderReload.inotify_fd = -1;
+        for (int s = 0; s < 2; s++)
+            if (watch->stages[s].path)
+                ImPlatform_ShaderReload_AddStage(&watch->stages[s]);
+        watch->next = g_ShaderReload.watches;
+        g_ShaderReload.watches = watch;
+    }
+    if (!g_ShaderReload.thread)
+    {
+        g_ShaderReload.quit.store(false, std::memory_order_relaxed);
+        g_ShaderReload.thread = new std::thread(ImPlatform_ShaderReload_ThreadMain);
+    }
+    return watch;
+}
+
+IMPLATFORM_API void ImPlatform_UnwatchShaderProgram(ImPlatform_ShaderWatch watch)
+{
+    if (!watch)
+        return;
+
+    bool last;
+    {
+        std::lock_guard<std::mutex> lock(g_ShaderReload.mutex);
+        for (ImPlatform_ShaderWatch_T** it = &g_ShaderReload.watches; *it; it = &(*it)->next)
+            if (*it == watch)
+            {
+                *it = watch->next;
+                break;
+            }
+        last = g_ShaderReload.watches == NULL;
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+        // inotify shares one watch per directory: drop it once no remaining stage uses it
+        for (int s = 0; s < 2; s++)
+        {
+            const int wd = watch->stages[s].wd;
+            bool in_use = wd < 0 || g_ShaderReload.inotify_fd < 0 || (s == 1 && watch->stages[0].wd == wd);
+            for (ImPlatform_ShaderWatch_T* other = g_ShaderReload.watches; other && !in_use; other = other->next)
+                in_use = (other->stages[0].path && other->stages[0].wd == wd) || (other->stages[1].path && other->stages[1].wd == wd);
+            if (!in_use)
+                inotify_rm_watch(g_ShaderReload.inotify_fd, wd);
+        }
+#endif
+    }
+    if (last && g_ShaderReload.thread)
+    {
+        g_ShaderReload.quit.store(true, std::memory_order_release);
+        g_ShaderReload.thread->join();
+        delete g_ShaderReload.thread;
+        g_ShaderReload.thread = NULL;
+#if IMPLATFORM_SHADER_RELOAD_INOTIFY
+        if (g_ShaderReload.inotify_fd >= 0)
+            close(g_ShaderReload.inotify_fd);
+        g_ShaderReload.inotify_fd = -1;
+#endif
+    }
+
+    if (watch->building)
+        ImPlatform_ShaderReload_DestroyBuild(watch->building);
+    while (ImPlatform_ShaderReloadBuild* build = watch->retired)
+    {
+        watch->retired = build->next;
+        ImPlatform_ShaderReload_DestroyBuild(build);
+    }
+    // The live program was destroyed by the caller, only the shaders it was built from remain
+    ImPlatform_ShaderReload_Release(watch->live.shaders[0]);
+    ImPlatform_ShaderReload_Release(watch->live.shaders[1]);
+    for (int s = 0; s < 2; s++)
+    {
+        ImPlatform_ShaderWatchStage* stage = &watch->stages[s];
+        ImPlatform_ShaderReload_Release(stage->latest);
+        free((void*)stage->desc.entry_point);
+        free((void*)stage->desc.cache_key);
+        free(stage->path);
+        free(stage->pending);
+        free(stage->source);
+    }
+    delete watch;
+}
+
+#else
+
+void ImPlatform_ShaderReload_NewFrame(void)
+{
+}
+
+IMPLATFORM_API ImPlatform_ShaderWatch ImPlatform_WatchShaderProgram(
+    ImPlatform_ShaderProgram* /*program*/,
+    const ImPlatform_ShaderDesc* /*vs_desc*/, const char* /*vs_path*/,
+    const ImPlatform_ShaderDesc* /*fs_desc*/, const char* /*fs_path*/)
+{
+    return NULL; // No watcher thread
+}
+
+IMPLATFORM_API void ImPlatform_UnwatchShaderProgram(ImPlatform_ShaderWatch /*watch*/)
+{
+}
+
+#endif // IMPLATFORM_SHADER_RELOAD_THREADS
+
+#endif // IMPLATFORM_GFX_SUPPORT_CUSTOM_SHADER
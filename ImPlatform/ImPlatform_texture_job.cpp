@@ -0,0 +1,268 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Tiled Texture Preparation
+// Asynchronous ImImageBuffer uploads for very large images, shared by all graphics backends.
+//
+// The image is split into bands of rows. Worker threads convert each band into a staging slot
+// (ImPlatform_ImageBufferCopyTight, which runs the SIMD conversion kernels), and the render thread
+// submits the finished bands in order through ImPlatform_UpdateTexture (the streaming rings on
+// OpenGL3 / Vulkan). Only a few slots per worker exist, so staging memory stays bounded whatever
+// the image size. Without thread support (Emscripten without pthreads) bands are prepared inline.
+
+#include "ImPlatform_Internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #define IMPLATFORM_TEXTURE_JOB_THREADS 0
+#else
+    #define IMPLATFORM_TEXTURE_JOB_THREADS 1
+#endif
+
+// Worker threads per job (0: one per hardware thread, minus the render thread)
+#ifndef IMPLATFORM_TEXTURE_JOB_WORKERS
+#define IMPLATFORM_TEXTURE_JOB_WORKERS 0
+#endif
+
+// Approximate staging size of one band
+#ifndef IMPLATFORM_TEXTURE_JOB_BAND_BYTES
+#define IMPLATFORM_TEXTURE_JOB_BAND_BYTES (4u * 1024u * 1024u)
+#endif
+
+// Staging slots per worker (bands converted ahead of submission)
+#ifndef IMPLATFORM_TEXTURE_JOB_SLOTS_PER_WORKER
+#define IMPLATFORM_TEXTURE_JOB_SLOTS_PER_WORKER 2
+#endif
+
+// Upper bound of bytes submitted per ImPlatform_UpdateTextureJob call, keeps the frame responsive
+#ifndef IMPLATFORM_TEXTURE_JOB_SUBMIT_BYTES
+#define IMPLATFORM_TEXTURE_JOB_SUBMIT_BYTES (32u * 1024u * 1024u)
+#endif
+
+struct ImPlatform_TextureJobSlot
+{
+    unsigned char*   data;
+    std::atomic<int> band;      // Band held by the slot once converted, -1 before the first one
+};
+
+struct ImPlatform_TextureJob_T
+{
+    ImImageBuffer               buffer;
+    ImTextureID                 texture;
+    unsigned int                band_rows;
+    unsigned int                band_count;
+    size_t                      pixel_bytes;    // Tight staging bytes per pixel
+    ImPlatform_TextureJobSlot*  slots;
+    unsigned int                slot_count;
+    std::atomic<unsigned int>   next_band;      // Next band for a worker to claim
+    unsigned int                submitted;      // Bands handed to the GPU, guarded by mutex
+    std::atomic<bool>           cancel;
+    bool                        failed;
+    std::mutex                  mutex;
+    std::condition_variable     slot_freed;
+    std::thread*                workers;
+    unsigned int                worker_count;
+};
+
+static unsigned int ImPlatform_TextureJob_BandHeight(const ImPlatform_TextureJob_T* job, unsigned int band)
+{
+    const unsigned int left = job->buffer.height - band * job->band_rows;
+    return left < job->band_rows ? left : job->band_rows;
+}
+
+static void ImPlatform_TextureJob_Cancel(ImPlatform_TextureJob_T* job)
+{
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->cancel.store(true);
+    }
+    job->slot_freed.notify_all();
+}
+
+static void ImPlatform_TextureJob_Prepare(ImPlatform_TextureJob_T* job, unsigned int band)
+{
+    const unsigned int y0 = band * job->band_rows;
+    ImImageBuffer rows = job->buffer;
+    rows.host        = ImPlatform_ImageBufferPixel(&job->buffer, 0, y0);
+    rows.byte_offset = 0;
+    rows.height      = ImPlatform_TextureJob_BandHeight(job, band);
+
+    ImPlatform_TextureJobSlot* slot = &job->slots[band % job->slot_count];
+    ImPlatform_ImageBufferCopyTight(&rows, slot->data, job->pixel_bytes);
+    slot->band.store((int)band, std::memory_order_release);
+}
+
+static void ImPlatform_TextureJob_Worker(ImPlatform_TextureJob_T* job)
+{
+    for (;;)
+    {
+        const unsigned int band = job->next_band.fetch_add(1);
+        if (band >= job->band_count)
+            return;
+
+        // Bands are claimed in order, so the slot's previous band is already claimed and will be submitted
+        {
+            std::unique_lock<std::mutex> lock(job->mutex);
+            job->slot_freed.wait(lock, [job, band] { return job->cancel.load() || band < job->submitted + job->slot_count; });
+        }
+        if (job->cancel.load())
+            return;
+
+        ImPlatform_TextureJob_Prepare(job, band);
+    }
+}
+
+static void ImPlatform_TextureJob_Free(ImPlatform_TextureJob_T* job)
+{
+    if (job->slots)
+    {
+        for (unsigned int i = 0; i < job->slot_count; i++)
+            free(job->slots[i].data);
+        delete[] job->slots;
+    }
+    delete job;
+}
+
+IMPLATFORM_API ImPlatform_TextureJob ImPlatform_CreateTextureAsync(const ImImageBuffer* buffer, const ImPlatform_TextureDesc* desc)
+{
+    ImPlatform_PixelFormat format;
+    if (!ImPlatform_ImageBufferResolveFormat(buffer, desc, &format))
+        return NULL;
+
+    ImPlatform_TextureDesc d = desc ? *desc : ImPlatform_TextureDesc_Default(buffer->width, buffer->height);
+    d.width  = buffer->width;
+    d.height = buffer->height;
+    d.format = format;
+
+    const size_t pixel_bytes = ImPlatform_ImageBufferUploadPixelBytes(buffer);
+    const size_t row_bytes   = pixel_bytes * buffer->width;
+
+    unsigned int worker_count = 0;
+#if IMPLATFORM_TEXTURE_JOB_THREADS
+    worker_count = IMPLATFORM_TEXTURE_JOB_WORKERS;
+    if (worker_count == 0)
+    {
+        const unsigned int hw = std::thread::hardware_concurrency();
+        worker_count = hw > 1 ? hw - 1 : 1;
+    }
+#endif
+
+    size_t band_rows = IMPLATFORM_TEXTURE_JOB_BAND_BYTES / row_bytes;
+    if (band_rows < 1)
+        band_rows = 1;
+    if (band_rows > buffer->height)
+        band_rows = buffer->height;
+
+    ImPlatform_TextureJob_T* job = new ImPlatform_TextureJob_T;
+    job->buffer       = *buffer;
+    job->texture      = (ImTextureID)0;
+    job->band_rows    = (unsigned int)band_rows;
+    job->band_count   = (buffer->height + job->band_rows - 1) / job->band_rows;
+    if (worker_count > job->band_count)
+        worker_count = job->band_count; // Never more workers than bands
+    job->pixel_bytes  = pixel_bytes;
+    job->slot_count   = (worker_count ? worker_count : 1) * IMPLATFORM_TEXTURE_JOB_SLOTS_PER_WORKER;
+    if (job->slot_count > job->band_count)
+        job->slot_count = job->band_count;
+    job->slots        = new ImPlatform_TextureJobSlot[job->slot_count];
+    job->next_band.store(0);
+    job->submitted    = 0;
+    job->cancel.store(false);
+    job->failed       = false;
+    job->workers      = NULL;
+    job->worker_count = 0;
+
+    bool ok = true;
+    for (unsigned int i = 0; i < job->slot_count; i++)
+    {
+        job->slots[i].data = (unsigned char*)malloc(row_bytes * job->band_rows);
+        job->slots[i].band.store(-1);
+        ok = ok && job->slots[i].data != NULL;
+    }
+
+    if (ok)
+    {
+        job->texture = ImPlatform_CreateEmptyTexture(&d, pixel_bytes);
+        ok = job->texture != (ImTextureID)0;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "[ImPlatform] Failed to start texture job (%ux%u)\n", buffer->width, buffer->height);
+        ImPlatform_TextureJob_Free(job);
+        return NULL;
+    }
+
+    if (worker_count > 0)
+    {
+        job->workers = new std::thread[worker_count];
+        for (unsigned int i = 0; i < worker_count; i++)
+            job->workers[i] = std::thread(ImPlatform_TextureJob_Worker, job);
+        job->worker_count = worker_count;
+    }
+
+    return job;
+}
+
+IMPLATFORM_API float ImPlatform_UpdateTextureJob(ImPlatform_TextureJob job)
+{
+    if (!job || job->failed)
+        return -1.0f;
+
+    const size_t band_bytes = job->pixel_bytes * job->buffer.width * job->band_rows;
+    size_t budget = IMPLATFORM_TEXTURE_JOB_SUBMIT_BYTES;
+    while (job->submitted < job->band_count)
+    {
+        const unsigned int band = job->submitted;
+        ImPlatform_TextureJobSlot* slot = &job->slots[band % job->slot_count];
+
+        if (job->worker_count == 0)
+            ImPlatform_TextureJob_Prepare(job, band);
+        else if (slot->band.load(std::memory_order_acquire) != (int)band)
+            break;
+
+        const unsigned int y0 = band * job->band_rows;
+        const unsigned int h  = ImPlatform_TextureJob_BandHeight(job, band);
+        if (!ImPlatform_UpdateTexture(job->texture, slot->data, 0, y0, job->buffer.width, h))
+        {
+            fprintf(stderr, "[ImPlatform] Texture job failed to submit rows %u..%u\n", y0, y0 + h);
+            job->failed = true;
+            ImPlatform_TextureJob_Cancel(job);
+            return -1.0f;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->submitted++;
+        }
+        job->slot_freed.notify_all();
+
+        if (budget <= band_bytes)
+            break;
+        budget -= band_bytes;
+    }
+
+    return (float)job->submitted / (float)job->band_count;
+}
+
+IMPLATFORM_API ImTextureID ImPlatform_GetTextureJobTexture(ImPlatform_TextureJob job)
+{
+    return job ? job->texture : (ImTextureID)0;
+}
+
+IMPLATFORM_API void ImPlatform_DestroyTextureJob(ImPlatform_TextureJob job)
+{
+    if (!job)
+        return;
+
+    ImPlatform_TextureJob_Cancel(job);
+    for (unsigned int i = 0; i < job->worker_count; i++)
+        job->workers[i].join();
+    delete[] job->workers;
+
+    ImPlatform_TextureJob_Free(job);
+}
@@ -0,0 +1,432 @@
+// dear imgui: Platform/Renderer Abstraction Layer - Virtual Texture
+// Tiled image pyramid for images beyond the GPU texture size limit, shared by all graphics backends.
+//
+// Level L of the pyramid samples every 2^L-th source pixel (an ImImageBuffer with scaled strides,
+// so no level is ever stored on the CPU). Tiles are cut from a level on demand and uploaded into
+// slots of a few atlas "pages" with ImPlatform_UpdateTexture. Every slot carries a 1 texel gutter
+// copied from the neighbouring tiles so bilinear filtering is seamless across tile edges.
+// Residency is tracked with a hash table plus an LRU list; the coarsest level (a single tile) is
+// pinned so there is always something to draw while finer tiles stream in.
+
+#include "ImPlatform_Internal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Atlas page edge limit in texels (tiles per page = (limit / (tile_size + 2))^2)
+#ifndef IMPLATFORM_VIRTUAL_TEXTURE_PAGE_SIZE
+#define IMPLATFORM_VIRTUAL_TEXTURE_PAGE_SIZE 2048
+#endif
+
+struct ImPlatform_VirtualTile
+{
+    ImU64 key;          // Level and tile coordinates, see ImPlatform_VT_Key
+    int   hash_next;
+    int   lru_prev;     // Toward the most recently used tile
+    int   lru_next;     // Toward the least recently used tile (free list link for unused slots)
+    int   last_frame;
+    bool  resident;
+};
+
+struct ImPlatform_VirtualTexture_T
+{
+    ImImageBuffer                   buffer;
+    ImPlatform_VirtualTextureDesc   desc;
+    size_t                          pixel_bytes;    // Tight upload bytes per pixel
+    unsigned int                    level_count;
+    unsigned int                    slot_size;      // tile_size + 2 gutter texels
+    unsigned int                    page_cols;      // Slots per page row
+    unsigned int                    page_texels;    // Page edge in texels
+    ImTextureID*                    pages;
+    unsigned int                    page_count;
+    ImPlatform_VirtualTile*         tiles;          // One per cache slot
+    int*                            buckets;
+    unsigned int                    bucket_mask;
+    int                             lru_head;
+    int                             lru_tail;
+    int                             free_head;
+    unsigned char*                  staging;        // One slot of tight pixels
+    int                             frame;
+    unsigned int                    uploads;        // Tiles uploaded during `frame`
+};
+
+static inline ImU64 ImPlatform_VT_Key(unsigned int level, unsigned int tx, unsigned int ty)
+{
+    return ((ImU64)level << 48) | ((ImU64)ty << 24) | (ImU64)tx;
+}
+
+static inline unsigned int ImPlatform_VT_Bucket(const ImPlatform_VirtualTexture_T* vt, ImU64 key)
+{
+    return (unsigned int)((key * 0x9E3779B97F4A7C15ull) >> 32) & vt->bucket_mask;
+}
+
+static inline unsigned int ImPlatform_VT_LevelSize(unsigned int size, unsigned int level)
+{
+    return (unsigned int)(((ImU64)size + (1ull << level) - 1) >> level);
+}
+
+// Source offset of the sample taken for each level texel: the centre of its footprint when it stays inside the image
+static inline unsigned int ImPlatform_VT_SampleOffset(unsigned int size, unsigned int level)
+{
+    const ImU64 step = 1ull << level;
+    const ImU64 centre = step >> 1;
+    return ((ImU64)(ImPlatform_VT_LevelSize(size, level) - 1) * step + centre < size) ? (unsigned int)centre : 0u;
+}
+
+static int ImPlatform_VT_Find(const ImPlatform_VirtualTexture_T* vt, ImU64 key)
+{
+    for (int i = vt->buckets[ImPlatform_VT_Bucket(vt, key)]; i >= 0; i = vt->tiles[i].hash_next)
+        if (vt->tiles[i].key == key)
+            return i;
+    return -1;
+}
+
+static void ImPlatform_VT_HashRemove(ImPlatform_VirtualTexture_T* vt, int index)
+{
+    int* link = &vt->buckets[ImPlatform_VT_Bucket(vt, vt->tiles[index].key)];
+    while (*link != index)
+        link = &vt->tiles[*link].hash_next;
+    *link = vt->tiles[index].hash_next;
+}
+
+static void ImPlatform_VT_LruUnlink(ImPlatform_VirtualTexture_T* vt, int index)
+{
+    ImPlatform_VirtualTile* t = &vt->tiles[index];
+    if (t->lru_prev >= 0) vt->tiles[t->lru_prev].lru_next = t->lru_next; else vt->lru_head = t->lru_next;
+    if (t->lru_next >= 0) vt->tiles[t->lru_next].lru_prev = t->lru_prev; else vt->lru_tail = t->lru_prev;
+    t->lru_prev = t->lru_next = -1;
+}
+
+static void ImPlatform_VT_LruPushFront(ImPlatform_VirtualTexture_T* vt, int index)
+{
+    ImPlatform_VirtualTile* t = &vt->tiles[index];
+    t->lru_prev = -1;
+    t->lru_next = vt->lru_head;
+    if (vt->lru_head >= 0)
+        vt->tiles[vt->lru_head].lru_prev = index;
+    else
+        vt->lru_tail = index;
+    vt->lru_head = index;
+}
+
+// Free slot, or the least recently used tile not drawn this frame. -1 when the cache is saturated.
+static int ImPlatform_VT_AcquireSlot(ImPlatform_VirtualTexture_T* vt)
+{
+    int index = vt->free_head;
+    if (index >= 0)
+    {
+        vt->free_head = vt->tiles[index].lru_next;
+        vt->tiles[index].lru_next = -1;
+        return index;
+    }
+
+    index = vt->lru_tail;
+    if (index < 0 || vt->tiles[index].last_frame == vt->frame)
+        return -1;
+    ImPlatform_VT_LruUnlink(vt, index);
+    ImPlatform_VT_HashRemove(vt, index);
+    vt->tiles[index].resident = false;
+    return index;
+}
+
+// Copy tile (tx, ty) of `level` plus its gutter into vt->staging, replicating edge texels past the image border
+static void ImPlatform_VT_FillStaging(ImPlatform_VirtualTexture_T* vt, unsigned int level, unsigned int tx, unsigned int ty)
+{
+    const ImImageBuffer* buf = &vt->buffer;
+    const unsigned int   S   = vt->slot_size;
+    const size_t         pb  = vt->pixel_bytes;
+    const ImU64          step = 1ull << level;
+    const long long      lw  = ImPlatform_VT_LevelSize(buf->width, level);
+    const long long      lh  = ImPlatform_VT_LevelSize(buf->height, level);
+    const unsigned int   cx  = ImPlatform_VT_SampleOffset(buf->width, level);
+    const unsigned int   cy  = ImPlatform_VT_SampleOffset(buf->height, level);
+
+    // Slot covers level texels [g0, g0 + S), the image only [v0, v1)
+    const long long gx0 = (long long)tx * vt->desc.tile_size - 1;
+    const long long gy0 = (long long)ty * vt->desc.tile_size - 1;
+    const long long vx0 = gx0 < 0 ? 0 : gx0, vx1 = gx0 + S > lw ? lw : gx0 + S;
+    const long long vy0 = gy0 < 0 ? 0 : gy0, vy1 = gy0 + S > lh ? lh : gy0 + S;
+    const unsigned int ox = (unsigned int)(vx0 - gx0), ow = (unsigned int)(vx1 - vx0);
+    const unsigned int oy = (unsigned int)(vy0 - gy0), oh = (unsigned int)(vy1 - vy0);
+
+    ImImageBuffer row = *buf;
+    row.byte_offset     = 0;
+    row.width           = ow;
+    row.height          = 1;
+    row.x_stride_bytes *= (ptrdiff_t)step;
+    for (unsigned int y = 0; y < oh; y++)
+    {
+        unsigned char* dst = vt->staging + ((size_t)(oy + y) * S + ox) * pb;
+        row.host = ImPlatform_ImageBufferPixel(buf, (unsigned int)(vx0 * step) + cx, (unsigned int)((vy0 + y) * step) + cy);
+        ImPlatform_ImageBufferCopyTight(&row, dst, pb);
+
+        for (unsigned int x = 0; x < ox; x++)
+            memcpy(dst - (size_t)(ox - x) * pb, dst, pb);
+        for (unsigned int x = ox + ow; x < S; x++)
+            memcpy(vt->staging + ((size_t)(oy + y) * S + x) * pb, dst + (size_t)(ow - 1) * pb, pb);
+    }
+    const size_t row_bytes = (size_t)S * pb;
+    for (unsigned int y = 0; y < oy; y++)
+        memcpy(vt->staging + y * row_bytes, vt->staging + oy * row_bytes, row_bytes);
+    for (unsigned int y = oy + oh; y < S; y++)
+        memcpy(vt->staging + y * row_bytes, vt->staging + (oy + oh - 1) * row_bytes, row_bytes);
+}
+
+static void ImPlatform_VT_SlotOrigin(const ImPlatform_VirtualTexture_T* vt, int index, unsigned int* page, unsigned int* x, unsigned int* y)
+{
+    const unsigned int per_page = vt->page_cols * vt->page_cols;
+    const unsigned int local = (unsigned int)index % per_page;
+    *page = (unsigned int)index / per_page;
+    *x = (local % vt->page_cols) * vt->slot_size;
+    *y = (local / vt->page_cols) * vt->slot_size;
+}
+
+static int ImPlatform_VT_Load(ImPlatform_VirtualTexture_T* vt, unsigned int level, unsigned int tx, unsigned int ty)
+{
+    const int index = ImPlatform_VT_AcquireSlot(vt);
+    if (index < 0)
+        return -1;
+
+    unsigned int page, x, y;
+    ImPlatform_VT_SlotOrigin(vt, index, &page, &x, &y);
+    ImPlatform_VT_FillStaging(vt, level, tx, ty);
+    ImPlatform_VirtualTile* t = &vt->tiles[index];
+    if (!ImPlatform_UpdateTexture(vt->pages[page], vt->staging, x, y, vt->slot_size, vt->slot_size))
+    {
+        t->lru_next = vt->free_head;
+        vt->free_head = index;
+        return -1;
+    }
+
+    const unsigned int bucket = ImPlatform_VT_Bucket(vt, ImPlatform_VT_Key(level, tx, ty));
+    t->key        = ImPlatform_VT_Key(level, tx, ty);
+    t->hash_next  = vt->buckets[bucket];
+    t->last_frame = vt->frame;
+    t->resident   = true;
+    vt->buckets[bucket] = index;
+    return index;
+}
+
+IMPLATFORM_API ImPlatform_VirtualTextureDesc ImPlatform_VirtualTextureDesc_Default(void)
+{
+    ImPlatform_VirtualTextureDesc desc;
+    desc.tile_size         = 256;
+    desc.cache_tiles       = 256;
+    desc.uploads_per_frame = 8;
+    desc.mag_filter        = ImPlatform_TextureFilter_Linear;
+    return desc;
+}
+
+static void ImPlatform_VT_Free(ImPlatform_VirtualTexture_T* vt)
+{
+    if (vt->pages)
+        for (unsigned int i = 0; i < vt->page_count; i++)
+            if (vt->pages[i])
+                ImPlatform_DestroyTexture(vt->pages[i]);
+    delete[] vt->pages;
+    delete[] vt->tiles;
+    delete[] vt->buckets;
+    free(vt->staging);
+    delete vt;
+}
+
+IMPLATFORM_API ImPlatform_VirtualTexture ImPlatform_CreateVirtualTexture(const ImImageBuffer* buffer, const ImPlatform_VirtualTextureDesc* desc)
+{
+    ImPlatform_PixelFormat format;
+    if (!ImPlatform_ImageBufferResolveFormat(buffer, NULL, &format))
+        return NULL;
+
+    ImPlatform_VirtualTexture_T* vt = new ImPlatform_VirtualTexture_T;
+    memset(vt, 0, sizeof(*vt));
+    vt->buffer      = *buffer;
+    vt->desc        = desc ? *desc : ImPlatform_VirtualTextureDesc_Default();
+    if (vt->desc.tile_size < 16)
+        vt->desc.tile_size = 16;
+    if (vt->desc.tile_size + 2 > IMPLATFORM_VIRTUAL_TEXTURE_PAGE_SIZE)
+        vt->desc.tile_size = IMPLATFORM_VIRTUAL_TEXTURE_PAGE_SIZE - 2;
+    if (vt->desc.cache_tiles < 2)
+        vt->desc.cache_tiles = 2;
+    vt->pixel_bytes = ImPlatform_ImageBufferUploadPixelBytes(buffer);
+
+    // Coarsest level fits a single tile
+    const unsigned int extent = buffer->width > buffer->height ? buffer->width : buffer->height;
+    vt->level_count = 1;
+    while (ImPlatform_VT_LevelSize(extent, vt->level_count - 1) > vt->desc.tile_size)
+        vt->level_count++;
+
+    vt->slot_size   = vt->desc.tile_size + 2;
+    vt->page_cols   = IMPLATFORM_VIRTUAL_TEXTURE_PAGE_SIZE / vt->slot_size;
+    const unsigned int per_page = vt->page_cols * vt->page_cols;
+    vt->page_count  = (vt->desc.cache_tiles + per_page - 1) / per_page;
+    if (vt->page_count == 1)
+        vt->page_cols = (unsigned int)ceilf(sqrtf((float)vt->desc.cache_tiles));
+    vt->page_texels = vt->page_cols * vt->slot_size;
+
+    unsigned int bucket_count = 1;
+    while (bucket_count < vt->desc.cache_tiles * 2)
+        bucket_count <<= 1;
+    vt->bucket_mask = bucket_count - 1;
+    vt->buckets     = new int[bucket_count];
+    for (unsigned int i = 0; i < bucket_count; i++)
+        vt->buckets[i] = -1;
+
+    vt->tiles = new ImPlatform_VirtualTile[vt->desc.cache_tiles];
+    for (unsigned int i = 0; i < vt->desc.cache_tiles; i++)
+    {
+        ImPlatform_VirtualTile* t = &vt->tiles[i];
+        t->key        = 0;
+        t->hash_next  = -1;
+        t->lru_prev   = -1;
+        t->lru_next   = (i + 1 < vt->desc.cache_tiles) ? (int)i + 1 : -1;
+        t->last_frame = -1;
+        t->resident   = false;
+    }
+    vt->free_head = 0;
+    vt->lru_head  = -1;
+    vt->lru_tail  = -1;
+    vt->frame     = -1;
+
+    vt->staging = (unsigned char*)malloc((size_t)vt->slot_size * vt->slot_size * vt->pixel_bytes);
+    vt->pages   = new ImTextureID[vt->page_count];
+    bool ok = vt->staging != NULL;
+    for (unsigned int i = 0; i < vt->page_count; i++)
+    {
+        ImPlatform_TextureDesc page_desc = ImPlatform_TextureDesc_Default(vt->page_texels, vt->page_texels);
+        page_desc.format     = format;
+        page_desc.mag_filter = vt->desc.mag_filter;
+        vt->pages[i] = ok ? ImPlatform_CreateEmptyTexture(&page_desc, vt->pixel_bytes) : (ImTextureID)0;
+        ok = ok && vt->pages[i];
+    }
+
+    // Pin the coarsest tile: it is never in the LRU list, so never evicted
+    if (ok)
+        ok = ImPlatform_VT_Load(vt, vt->level_count - 1, 0, 0) >= 0;
+    if (!ok)
+    {
+        fprintf(stderr, "[ImPlatform] Failed to create virtual texture (%ux%u)\n", buffer->width, buffer->height);
+        ImPlatform_VT_Free(vt);
+        return NULL;
+    }
+
+    return vt;
+}
+
+IMPLATFORM_API void ImPlatform_DestroyVirtualTexture(ImPlatform_VirtualTexture vt)
+{
+    if (vt)
+        ImPlatform_VT_Free(vt);
+}
+
+// Image (source pixel) space -> screen space mapping of one draw call
+struct ImPlatform_VT_View
+{
+    ImVec2 origin;      // Screen position of source pixel (0, 0)
+    ImVec2 scale;       // Screen pixels per source pixel
+};
+
+// Draw the part [x0, x1) x [y0, y1) (source pixels) of the resident tile `index` holding (level, tx, ty)
+static void ImPlatform_VT_Emit(ImDrawList* draw, const ImPlatform_VirtualTexture_T* vt, const ImPlatform_VT_View* view, int index,
+                               unsigned int level, unsigned int tx, unsigned int ty, float x0, float y0, float x1, float y1)
+{
+    unsigned int page, sx, sy;
+    ImPlatform_VT_SlotOrigin(vt, index, &page, &sx, &sy);
+
+    const float inv_step = 1.0f / (float)(1u << level);
+    const float inv_page = 1.0f / (float)vt->page_texels;
+    const float ox = (float)(sx + 1) - (float)(tx * vt->desc.tile_size);
+    const float oy = (float)(sy + 1) - (float)(ty * vt->desc.tile_size);
+    draw->AddImage(vt->pages[page],
+                   ImVec2(view->origin.x + x0 * view->scale.x, view->origin.y + y0 * view->scale.y),
+                   ImVec2(view->origin.x + x1 * view->scale.x, view->origin.y + y1 * view->scale.y),
+                   ImVec2((ox + x0 * inv_step) * inv_page, (oy + y0 * inv_step) * inv_page),
+                   ImVec2((ox + x1 * inv_step) * inv_page, (oy + y1 * inv_step) * inv_page));
+}
+
+IMPLATFORM_API void ImPlatform_DrawVirtualTexture(ImDrawList* draw, ImPlatform_VirtualTexture vt, ImVec2 p_min, ImVec2 p_max, ImVec2 uv0, ImVec2 uv1)
+{
+    if (!draw || !vt || uv0.x == uv1.x || uv0.y == uv1.y || p_min.x >= p_max.x || p_min.y >= p_max.y)
+        return;
+
+    const int frame = ImGui::GetFrameCount();
+    if (frame != vt->frame)
+    {
+        vt->frame   = frame;
+        vt->uploads = 0;
+    }
+
+    const float W = (float)vt->buffer.width;
+    const float H = (float)vt->buffer.height;
+    ImPlatform_VT_View view;
+    view.scale  = ImVec2((p_max.x - p_min.x) / ((uv1.x - uv0.x) * W), (p_max.y - p_min.y) / ((uv1.y - uv0.y) * H));
+    view.origin = ImVec2(p_min.x - uv0.x * W * view.scale.x, p_min.y - uv0.y * H * view.scale.y);
+
+    // Visible part of the image, in source pixels
+    draw->PushClipRect(p_min, p_max, true);
+    const ImVec2 clip_min = draw->GetClipRectMin();
+    const ImVec2 clip_max = draw->GetClipRectMax();
+    float ax = (clip_min.x - view.origin.x) / view.scale.x, bx = (clip_max.x - view.origin.x) / view.scale.x;
+    float ay = (clip_min.y - view.origin.y) / view.scale.y, by = (clip_max.y - view.origin.y) / view.scale.y;
+    if (ax > bx) { float t = ax; ax = bx; bx = t; }
+    if (ay > by) { float t = ay; ay = by; by = t; }
+    ax = ax < 0.0f ? 0.0f : ax; bx = bx > W ? W : bx;
+    ay = ay < 0.0f ? 0.0f : ay; by = by > H ? H : by;
+    if (ax >= bx || ay >= by)
+    {
+        draw->PopClipRect();
+        return;
+    }
+
+    // Finest level with at most one level texel per screen pixel
+    const float texels_per_pixel = 1.0f / fminf(fabsf(view.scale.x), fabsf(view.scale.y));
+    unsigned int level = 0;
+    while (level + 1 < vt->level_count && (float)(1u << (level + 1)) <= texels_per_pixel)
+        level++;
+
+    const float tile_span = (float)vt->desc.tile_size * (float)(1u << level);    // Source pixels per tile
+    const unsigned int tx0 = (unsigned int)(ax / tile_span), tx1 = (unsigned int)ceilf(bx / tile_span);
+    const unsigned int ty0 = (unsigned int)(ay / tile_span), ty1 = (unsigned int)ceilf(by / tile_span);
+    for (unsigned int ty = ty0; ty < ty1; ty++)
+        for (unsigned int tx = tx0; tx < tx1; tx++)
+        {
+            const float x0 = tx * tile_span, x1 = fminf((tx + 1) * tile_span, W);
+            const float y0 = ty * tile_span, y1 = fminf((ty + 1) * tile_span, H);
+
+            int index = ImPlatform_VT_Find(vt, ImPlatform_VT_Key(level, tx, ty));
+            if (index < 0 && vt->uploads < vt->desc.uploads_per_frame)
+            {
+                vt->uploads++;
+                index = ImPlatform_VT_Load(vt, level, tx, ty);
+            }
+
+            // Fall back to the closest resident ancestor (the pinned coarsest tile at worst)
+            unsigned int l = level, ltx = tx, lty = ty;
+            while (index < 0 && l + 1 < vt->level_count)
+            {
+                l++; ltx >>= 1; lty >>= 1;
+                index = ImPlatform_VT_Find(vt, ImPlatform_VT_Key(l, ltx, lty));
+            }
+            if (index < 0)
+                continue;
+
+            ImPlatform_VirtualTile* t = &vt->tiles[index];
+            t->last_frame = frame;
+            if (l + 1 < vt->level_count)
+            {
+                if (t->lru_prev >= 0 || vt->lru_head == index)
+                    ImPlatform_VT_LruUnlink(vt, index);
+                ImPlatform_VT_LruPushFront(vt, index);
+            }
+            ImPlatform_VT_Emit(draw, vt, &view, index, l, ltx, lty, x0, y0, x1, y1);
+        }
+
+    draw->PopClipRect();
+}
+
+IMPLATFORM_API void ImPlatform_VirtualTextureImage(ImPlatform_VirtualTexture vt, ImVec2 size, ImVec2 uv0, ImVec2 uv1)
+{
+    const ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImPlatform_DrawVirtualTexture(ImGui::GetWindowDrawList(), vt, pos, ImVec2(pos.x + size.x, pos.y + size.y), uv0, uv1);
+    ImGui::Dummy(size);
+}
@@ -451,8 +451,8 @@ int main()
 	gradient_vs_source =
 		"struct Uniforms {\n"
 		"    projMtx: mat4x4<f32>,\n"
-		"    colorStart: vec4<f32>,\n"
-		"    colorEnd: vec4<f32>,\n"
+		"    ColorStart: vec4<f32>,\n"
+		"    ColorEnd: vec4<f32>,\n"
 		"};\n"
 		"@group(0) @binding(0) var<uniform> uniforms: Uniforms;\n"
 		"\n"
@@ -478,8 +478,8 @@ int main()
 	gradient_ps_source =
 		"struct Uniforms {\n"
 		"    projMtx: mat4x4<f32>,\n"
-		"    colorStart: vec4<f32>,\n"
-		"    colorEnd: vec4<f32>,\n"
+		"    ColorStart: vec4<f32>,\n"
+		"    ColorEnd: vec4<f32>,\n"
 		"};\n"
 		"@group(0) @binding(0) var<uniform> uniforms: Uniforms;\n"
 		"\n"
@@ -489,7 +489,7 @@ int main()
 		"\n"
 		"@fragment\n"
 		"fn main(input: FragInput) -> @location(0) vec4<f32> {\n"
-		"    return mix(uniforms.colorStart, uniforms.colorEnd, input.uv.y);\n"
+		"    return mix(uniforms.ColorStart, uniforms.ColorEnd, input.uv.y);\n"
 		"}\n";
 #endif
 